@@ -0,0 +1,76 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Microbenchmarks - Compression contexts
+// Whole-payload compression of a representative JSON API response through
+// the reusable thread-local contexts, at the levels the gateway defaults
+// to (and zstd-1 as the latency-first alternative).
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "core/compression.hpp"
+#include "bench_corpus.hpp"
+
+namespace {
+
+using titan::bench::load_corpus;
+using titan::core::BrotliContext;
+using titan::core::GzipContext;
+using titan::core::ZstdContext;
+
+template <typename Context>
+void compress_loop(benchmark::State& state, Context& ctx) {
+    std::vector<uint8_t> payload = load_corpus("api_response.json");
+
+    for (auto _ : state) {
+        std::vector<uint8_t> compressed = ctx.compress(payload.data(), payload.size());
+        if (compressed.empty()) {
+            state.SkipWithError("compression failed");
+            return;
+        }
+        benchmark::DoNotOptimize(compressed.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.size()));
+}
+
+void BM_Compress_Gzip6(benchmark::State& state) {
+    GzipContext ctx(6);
+    compress_loop(state, ctx);
+}
+BENCHMARK(BM_Compress_Gzip6);
+
+void BM_Compress_Zstd1(benchmark::State& state) {
+    ZstdContext ctx(1);
+    compress_loop(state, ctx);
+}
+BENCHMARK(BM_Compress_Zstd1);
+
+void BM_Compress_Zstd5(benchmark::State& state) {
+    ZstdContext ctx(5);
+    compress_loop(state, ctx);
+}
+BENCHMARK(BM_Compress_Zstd5);
+
+void BM_Compress_Brotli4(benchmark::State& state) {
+    BrotliContext ctx(4);
+    compress_loop(state, ctx);
+}
+BENCHMARK(BM_Compress_Brotli4);
+
+}  // namespace
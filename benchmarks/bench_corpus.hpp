@@ -0,0 +1,49 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Microbenchmarks - Corpus loading
+// Fixture inputs live in benchmarks/corpus/ and are located through the
+// TITAN_BENCH_CORPUS_DIR compile definition, so the binary runs from any
+// working directory.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace titan::bench {
+
+/// Load a fixture file from the checked-in corpus directory. Benchmarks
+/// are useless against truncated inputs, so a missing file aborts rather
+/// than producing numbers for an empty buffer.
+inline std::vector<uint8_t> load_corpus(const std::string& name) {
+    std::string path = std::string(TITAN_BENCH_CORPUS_DIR "/") + name;
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        std::fprintf(stderr, "titan_bench: missing corpus file %s\n", path.c_str());
+        std::abort();
+    }
+    std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    return data;
+}
+
+}  // namespace titan::bench
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Microbenchmarks - JwtValidator::validate
+// Signs an HS256 token at setup (HMAC over header.payload, same key the
+// validator holds) and measures the cached hit path separately from full
+// uncached validation (decode + signature verify + claims checks).
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+#include "core/jwt.hpp"
+
+namespace {
+
+using titan::core::base64url_encode;
+using titan::core::JwtValidator;
+using titan::core::JwtValidatorConfig;
+using titan::core::KeyManager;
+using titan::core::VerificationKey;
+
+constexpr std::string_view kSecret = "titan-bench-hs256-secret-0123456789abcdef";
+constexpr std::string_view kKeyId = "bench-key";
+
+/// Mint a valid HS256 token with a far-future expiry, signed with kSecret.
+std::string make_token() {
+    std::string header = R"({"alg":"HS256","typ":"JWT","kid":"bench-key"})";
+    std::string payload =
+        R"({"sub":"user-42","iss":"https://auth.example.com","aud":"titan",)"
+        R"("scope":"orders:read orders:write","exp":4102444800,"iat":1756684800})";
+    std::string message = base64url_encode(header) + "." + base64url_encode(payload);
+
+    uint8_t digest[EVP_MAX_MD_SIZE];
+    unsigned int digest_len = 0;
+    HMAC(EVP_sha256(), kSecret.data(), static_cast<int>(kSecret.size()),
+         reinterpret_cast<const uint8_t*>(message.data()), message.size(), digest, &digest_len);
+
+    return message + "." +
+           base64url_encode(std::string_view(reinterpret_cast<const char*>(digest), digest_len));
+}
+
+JwtValidator make_validator(bool cache_enabled) {
+    JwtValidatorConfig config;
+    config.cache_enabled = cache_enabled;
+
+    JwtValidator validator(std::move(config));
+    auto keys = std::make_shared<KeyManager>();
+    // load_hmac_secret expects the secret base64-encoded
+    auto key = VerificationKey::load_hmac_secret(kKeyId, base64url_encode(kSecret));
+    keys->add_key(std::move(*key));
+    validator.set_key_manager(std::move(keys));
+    return validator;
+}
+
+/// Full validation every iteration: split, base64url decode, JSON claim
+/// parse, HMAC-SHA256 verify, claims checks.
+void BM_JwtValidate_Uncached(benchmark::State& state) {
+    JwtValidator validator = make_validator(false);
+    std::string token = make_token();
+
+    for (auto _ : state) {
+        auto result = validator.validate(token);
+        if (!result.valid) {
+            state.SkipWithError("token failed validation");
+            return;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_JwtValidate_Uncached);
+
+/// Steady-state hit in the thread-local token cache - the path every
+/// request after the first on a connection takes.
+void BM_JwtValidate_CacheHit(benchmark::State& state) {
+    JwtValidator validator = make_validator(true);
+    std::string token = make_token();
+    if (auto warm = validator.validate(token); !warm.valid) {
+        state.SkipWithError("token failed validation");
+        return;
+    }
+
+    for (auto _ : state) {
+        auto result = validator.validate(token);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_JwtValidate_CacheHit);
+
+/// Rejection cost for a token whose signature does not verify -
+/// the attacker-facing path must not be slower than the accept path.
+void BM_JwtValidate_BadSignature(benchmark::State& state) {
+    JwtValidator validator = make_validator(false);
+    std::string token = make_token();
+    token.back() = token.back() == 'A' ? 'B' : 'A';
+
+    for (auto _ : state) {
+        auto result = validator.validate(token);
+        if (result.valid) {
+            state.SkipWithError("tampered token validated");
+            return;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_JwtValidate_BadSignature);
+
+}  // namespace
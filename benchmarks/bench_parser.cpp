@@ -0,0 +1,88 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Microbenchmarks - HTTP/1.1 request parsing
+// Full-message parse loops over the checked-in request corpus, one
+// benchmark per request shape the gateway sees in practice.
+
+#include <span>
+
+#include <benchmark/benchmark.h>
+
+#include "http/parser.hpp"
+#include "bench_corpus.hpp"
+
+namespace {
+
+using titan::bench::load_corpus;
+using titan::http::Parser;
+using titan::http::ParseResult;
+using titan::http::Request;
+
+void parse_loop(benchmark::State& state, const std::string& corpus_name) {
+    std::vector<uint8_t> raw = load_corpus(corpus_name);
+    Parser parser;
+
+    for (auto _ : state) {
+        Request request;
+        auto [result, consumed] = parser.parse_request(std::span<const uint8_t>(raw), request);
+        if (result != ParseResult::Complete) {
+            state.SkipWithError("parse_request did not complete");
+            return;
+        }
+        benchmark::DoNotOptimize(consumed);
+        benchmark::DoNotOptimize(request.path);
+        parser.reset();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * raw.size()));
+}
+
+void BM_ParseRequest_SmallGet(benchmark::State& state) {
+    parse_loop(state, "get_small.raw");
+}
+BENCHMARK(BM_ParseRequest_SmallGet);
+
+void BM_ParseRequest_ManyHeaders(benchmark::State& state) {
+    parse_loop(state, "get_many_headers.raw");
+}
+BENCHMARK(BM_ParseRequest_ManyHeaders);
+
+void BM_ParseRequest_PostJson(benchmark::State& state) {
+    parse_loop(state, "post_json.raw");
+}
+BENCHMARK(BM_ParseRequest_PostJson);
+
+/// Header-only parse used by the streamed-body path: stops at the blank
+/// line and leaves body framing to the caller.
+void BM_ParseRequestHeaders_PostJson(benchmark::State& state) {
+    std::vector<uint8_t> raw = load_corpus("post_json.raw");
+    Parser parser;
+
+    for (auto _ : state) {
+        Request request;
+        auto [result, consumed] =
+            parser.parse_request_headers(std::span<const uint8_t>(raw), request);
+        if (result != ParseResult::Complete) {
+            state.SkipWithError("parse_request_headers did not complete");
+            return;
+        }
+        benchmark::DoNotOptimize(consumed);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * raw.size()));
+}
+BENCHMARK(BM_ParseRequestHeaders_PostJson);
+
+}  // namespace
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Microbenchmarks - Router::match
+// Matches against a mid-size compiled route table: static hits, parameter
+// extraction, wildcard capture, and the miss path (which still walks the
+// tree furthest before rejecting).
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "gateway/router.hpp"
+
+namespace {
+
+using titan::gateway::Route;
+using titan::gateway::RouteBuilder;
+using titan::gateway::Router;
+using titan::http::Method;
+
+/// A route table shaped like a typical gateway config: a handful of
+/// static endpoints plus parameterized and wildcard API routes.
+Router build_router() {
+    Router router;
+    router.add_route(RouteBuilder("/api/health").method(Method::GET).handler("health").build());
+    router.add_route(RouteBuilder("/api/version").method(Method::GET).handler("version").build());
+    router.add_route(RouteBuilder("/api/login").method(Method::POST).handler("login").build());
+    router.add_route(RouteBuilder("/api/users").method(Method::GET).handler("users.list").build());
+    router.add_route(
+        RouteBuilder("/api/users/:id").method(Method::GET).handler("users.get").build());
+    router.add_route(
+        RouteBuilder("/api/users/:id/orders").method(Method::GET).handler("orders.list").build());
+    router.add_route(RouteBuilder("/api/users/:id/orders/:order_id")
+                         .method(Method::GET)
+                         .handler("orders.get")
+                         .build());
+    router.add_route(
+        RouteBuilder("/api/orders").method(Method::POST).handler("orders.create").build());
+    router.add_route(
+        RouteBuilder("/api/products/:sku").method(Method::GET).handler("products.get").build());
+    router.add_route(RouteBuilder("/static/*").method(Method::GET).handler("static").build());
+    for (int i = 0; i < 20; ++i) {
+        router.add_route(RouteBuilder("/api/internal/service" + std::to_string(i))
+                             .method(Method::GET)
+                             .handler("internal." + std::to_string(i))
+                             .build());
+    }
+    router.compile();
+    return router;
+}
+
+void match_loop(benchmark::State& state, std::string_view path, bool expect_match) {
+    Router router = build_router();
+
+    for (auto _ : state) {
+        auto match = router.match(Method::GET, path);
+        if (match.matched() != expect_match) {
+            state.SkipWithError("unexpected match result");
+            return;
+        }
+        benchmark::DoNotOptimize(match);
+    }
+}
+
+void BM_RouterMatch_Static(benchmark::State& state) {
+    match_loop(state, "/api/health", true);
+}
+BENCHMARK(BM_RouterMatch_Static);
+
+void BM_RouterMatch_OneParam(benchmark::State& state) {
+    match_loop(state, "/api/users/42", true);
+}
+BENCHMARK(BM_RouterMatch_OneParam);
+
+void BM_RouterMatch_TwoParams(benchmark::State& state) {
+    match_loop(state, "/api/users/42/orders/91042", true);
+}
+BENCHMARK(BM_RouterMatch_TwoParams);
+
+void BM_RouterMatch_Wildcard(benchmark::State& state) {
+    match_loop(state, "/static/css/vendor/normalize.min.css", true);
+}
+BENCHMARK(BM_RouterMatch_Wildcard);
+
+void BM_RouterMatch_Miss(benchmark::State& state) {
+    match_loop(state, "/api/users/42/settings/profile", false);
+}
+BENCHMARK(BM_RouterMatch_Miss);
+
+}  // namespace
@@ -18,16 +18,40 @@
 
 #include "config.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <atomic>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <nlohmann/json.hpp>
 #include <sstream>
+#include <unordered_map>
 
 #include "../core/jwt.hpp"    // For security constants (MAX_REQUIRED_SCOPES_ROLES)
 #include "../http/regex.hpp"  // For regex pattern validation
 
 namespace titan::control {
 
+namespace {
+// Binary snapshot layout: header + the Config serialized as CBOR. Decoding
+// CBOR skips the JSON text scan, and validation is skipped entirely - it
+// already passed when the snapshot was written. The source hash ties the
+// snapshot to the exact JSON bytes; an edited config falls back to a full
+// parse and the snapshot is rewritten.
+constexpr uint32_t kSnapshotMagic = 0x50534354;  // "TCSP" (Titan Config SnaPshot)
+constexpr uint32_t kSnapshotVersion = 1;
+
+struct SnapshotHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t source_hash;
+};
+}  // namespace
+
 // Forward declaration for helper function
 static void validate_transform_config(const TransformConfig& transform, const std::string& context,
                                       ValidationResult& result);
@@ -120,10 +144,23 @@ ValidationResult ConfigLoader::validate(const Config& config) {
         // Validate load balancing strategy
         if (upstream.load_balancing != "round_robin" &&
             upstream.load_balancing != "least_connections" && upstream.load_balancing != "random" &&
-            upstream.load_balancing != "weighted_round_robin") {
+            upstream.load_balancing != "weighted_round_robin" &&
+            upstream.load_balancing != "consistent_hash" && upstream.load_balancing != "p2c") {
             result.add_error("Unknown load_balancing strategy '" + upstream.load_balancing +
                              "' in upstream '" + upstream.name + "'");
         }
+
+        // Validate hash key (only meaningful for consistent_hash)
+        if (upstream.load_balancing == "consistent_hash") {
+            const std::string& key = upstream.hash_key;
+            bool valid = key == "ip" || key == "path" ||
+                         (key.starts_with("header:") && key.size() > 7) ||
+                         (key.starts_with("cookie:") && key.size() > 7);
+            if (!valid) {
+                result.add_error("Invalid hash_key '" + key + "' in upstream '" + upstream.name +
+                                 "' (expected ip, path, header:<name> or cookie:<name>)");
+            }
+        }
     }
 
     // Validate routes
@@ -497,19 +534,168 @@ std::string ConfigLoader::to_json(const Config& config) {
     }
 }
 
+uint64_t ConfigLoader::source_hash(std::string_view json) noexcept {
+    // FNV-1a 64-bit
+    uint64_t hash = 14695981039346656037ULL;
+    for (char c : json) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::optional<Config> ConfigLoader::load_from_snapshot(std::string_view snapshot_path,
+                                                       uint64_t source_hash) {
+    std::string path_str{snapshot_path};
+    int fd = ::open(path_str.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return std::nullopt;
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) <= sizeof(SnapshotHeader)) {
+        ::close(fd);
+        return std::nullopt;
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+
+    void* map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        return std::nullopt;
+    }
+
+    std::optional<Config> config;
+    const auto* bytes = static_cast<const uint8_t*>(map);
+
+    SnapshotHeader header;
+    std::memcpy(&header, bytes, sizeof(header));
+    if (header.magic == kSnapshotMagic && header.version == kSnapshotVersion &&
+        header.source_hash == source_hash) {
+        try {
+            auto j = nlohmann::json::from_cbor(bytes + sizeof(header), bytes + size);
+            config = j.get<Config>();
+        } catch (const nlohmann::json::exception&) {
+            config.reset();  // Corrupt payload - caller reparses the JSON
+        }
+    }
+
+    ::munmap(map, size);
+    return config;
+}
+
+bool ConfigLoader::save_snapshot(const Config& config, std::string_view snapshot_path,
+                                 uint64_t source_hash) {
+    std::vector<uint8_t> payload;
+    try {
+        nlohmann::json j = config;
+        payload = nlohmann::json::to_cbor(j);
+    } catch (const nlohmann::json::exception&) {
+        return false;
+    }
+
+    // Write-then-rename so a crash mid-write never leaves a torn snapshot
+    std::string final_path{snapshot_path};
+    std::string tmp_path = final_path + ".tmp";
+    {
+        std::ofstream out{tmp_path, std::ios::binary | std::ios::trunc};
+        if (!out.is_open()) {
+            return false;
+        }
+        SnapshotHeader header{kSnapshotMagic, kSnapshotVersion, source_hash};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(payload.data()),
+                  static_cast<std::streamsize>(payload.size()));
+        if (!out.good()) {
+            out.close();
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+    }
+
+    if (std::rename(tmp_path.c_str(), final_path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+ConfigDelta ConfigLoader::diff(const Config& old_config, const Config& new_config) {
+    ConfigDelta delta;
+
+    try {
+        delta.routes_changed =
+            nlohmann::json(old_config.routes) != nlohmann::json(new_config.routes);
+        delta.jwt_changed = nlohmann::json(old_config.jwt) != nlohmann::json(new_config.jwt);
+
+        // Index old upstream sections by name, then mark every new
+        // upstream whose section serializes identically as unchanged.
+        // Renames and removals fall out naturally: a name missing on
+        // either side is simply never marked unchanged.
+        std::unordered_map<std::string, nlohmann::json> old_upstreams;
+        for (const auto& upstream : old_config.upstreams) {
+            old_upstreams.emplace(upstream.name, upstream);
+        }
+        for (const auto& upstream : new_config.upstreams) {
+            auto it = old_upstreams.find(upstream.name);
+            if (it != old_upstreams.end() && it->second == nlohmann::json(upstream)) {
+                delta.unchanged_upstreams.push_back(upstream.name);
+            }
+        }
+    } catch (const nlohmann::json::exception&) {
+        // Serialization failure - fall back to a full rebuild
+        return ConfigDelta{};
+    }
+
+    return delta;
+}
+
 // ConfigManager implementation
 
-bool ConfigManager::load(std::string_view path) {
-    config_path_ = path;
+std::optional<Config> ConfigManager::load_validated(std::string_view path) {
+    // Read the source text once: it keys the binary snapshot and feeds the
+    // fallback parse
+    std::string path_str{path};
+    std::ifstream file{path_str};
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string json = buffer.str();
+
+    uint64_t hash = ConfigLoader::source_hash(json);
+    std::string snapshot_path = path_str + ".snapshot";
 
-    auto maybe_config = ConfigLoader::load_from_file(path);
+    // Fast path: mmap the compiled snapshot from a previous start. Skips
+    // JSON parsing and the validation pass (both ran when it was written).
+    if (auto snapshot = ConfigLoader::load_from_snapshot(snapshot_path, hash)) {
+        last_validation_ = ValidationResult{};
+        return snapshot;
+    }
+
+    auto maybe_config = ConfigLoader::load_from_json(json);
     if (!maybe_config.has_value()) {
-        return false;
+        return std::nullopt;
     }
 
-    // Validate configuration
     last_validation_ = ConfigLoader::validate(*maybe_config);
     if (last_validation_.has_errors()) {
+        return std::nullopt;
+    }
+
+    // Compile a snapshot for the next restart (best effort - a failed
+    // write just means the next start parses the JSON again)
+    (void)ConfigLoader::save_snapshot(*maybe_config, snapshot_path, hash);
+
+    return maybe_config;
+}
+
+bool ConfigManager::load(std::string_view path) {
+    config_path_ = path;
+
+    auto maybe_config = load_validated(path);
+    if (!maybe_config.has_value()) {
         return false;
     }
 
@@ -524,17 +710,11 @@ bool ConfigManager::reload() {
         return false;
     }
 
-    auto maybe_config = ConfigLoader::load_from_file(config_path_);
+    auto maybe_config = load_validated(config_path_);
     if (!maybe_config.has_value()) {
         return false;
     }
 
-    // Validate configuration
-    last_validation_ = ConfigLoader::validate(*maybe_config);
-    if (last_validation_.has_errors()) {
-        return false;
-    }
-
     // RCU pattern: Create new shared_ptr and atomically swap
     // Old config remains valid until all readers release their references
     auto new_config = std::make_shared<const Config>(std::move(*maybe_config));
@@ -542,6 +722,9 @@ bool ConfigManager::reload() {
     // Atomic swap - this is the critical section for hot-reload
     std::atomic_store(&current_config_, new_config);
 
+    // Publish the swap; workers poll generation() and re-fetch via get()
+    generation_.fetch_add(1, std::memory_order_release);
+
     return true;
 }
 
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <nlohmann/json.hpp>
@@ -91,6 +92,11 @@ struct WebSocketRouteConfig {
 
     // Connection limits
     std::optional<uint32_t> max_connections;  // Per-route connection limit
+
+    // Broadcast fan-out: non-empty makes Titan terminate the WebSocket
+    // and subscribe the connection to this channel instead of proxying
+    // (see http/ws_broadcast.hpp)
+    std::string broadcast_channel;
 };
 
 /// WebSocket upstream-level configuration (must come before UpstreamConfig)
@@ -109,6 +115,96 @@ struct ServerConfig {
     uint16_t listen_port = 8080;
     uint32_t backlog = DEFAULT_LISTEN_BACKLOG;
 
+    // Listener TCP tuning. TCP Fast Open lets repeat clients carry their
+    // request in the SYN (one RTT saved on reconnect storms); the queue
+    // length bounds pending TFO connections. TCP_DEFER_ACCEPT holds a
+    // connection in the kernel until data arrives so workers never wake
+    // for data-less handshakes. Both 0 = disabled.
+    uint32_t tcp_fastopen_queue = 0;
+    uint32_t tcp_defer_accept = 0;  // Seconds to defer
+
+    // TCP_FASTOPEN_CONNECT on backend sockets: after the first exchange
+    // with a backend, subsequent connects carry the request in the SYN
+    // (Linux 4.11+, needs TFO enabled on the backend side too)
+    bool backend_tcp_fastopen = false;
+
+    // Event loop backend: "epoll" (default) or "io_uring"
+    // io_uring batches poll submissions into a single syscall per loop
+    // iteration (Linux 5.11+); workers fall back to epoll if unavailable
+    std::string event_backend = "epoll";
+
+    // splice() streaming proxy for large response bodies (Linux only).
+    // Bodies at or above the threshold are moved backend->client through a
+    // pipe without entering userspace. Eligible responses skip response
+    // middleware (they are never buffered), so this is opt-in.
+    bool splice_proxy_enabled = false;
+    uint32_t splice_min_body_size = 1048576;  // 1MB
+
+    // Streamed request-body forwarding: uploads with a Content-Length at or
+    // above the threshold are forwarded to the backend as they arrive
+    // instead of being buffered whole. Client reads halt while the backend's
+    // send queue sits above the high watermark and resume below the low one.
+    uint32_t stream_request_min_body_size = 262144;  // 256KB
+    uint32_t stream_high_watermark = 1048576;        // 1MB queued to backend
+    uint32_t stream_low_watermark = 131072;          // 128KB
+
+    // Zero-copy sends: bodies at or above the threshold go out with
+    // MSG_ZEROCOPY (kernel reads the pages in place, completion arrives on
+    // the error queue). Opt-in - only pays off for large responses.
+    // tcp_notsent_lowat (0 = kernel default) caps how much unsent data a
+    // socket may queue before it stops reporting writable.
+    bool zerocopy_send_enabled = false;
+    uint32_t zerocopy_min_send_size = 65536;  // 64KB
+    uint32_t tcp_notsent_lowat = 0;
+
+    // Steer each connection to the SO_REUSEPORT listener on the CPU that
+    // received its SYN (cBPF, Linux only). Requires core-pinned workers;
+    // falls back to the kernel's 4-tuple hash when unavailable.
+    bool reuseport_cpu_steering = false;
+
+    // Spread pinned workers round-robin across NUMA nodes and prefer the
+    // local node for each worker's allocations (arenas, pools and buffers
+    // are first-touched on the worker thread). No-op on single-node
+    // machines. With reuseport_cpu_steering the identity cpu order is
+    // kept (the cBPF program needs it) and only memory binding applies.
+    bool numa_aware = true;
+
+    // Back per-worker arenas and pool slabs with 2MB hugepages
+    // (MAP_HUGETLB, transparent-hugepage fallback) to cut dTLB misses on
+    // connection-dense workloads. Opt-in: hugetlb pages must be reserved
+    // via vm.nr_hugepages or the THP fallback carries the load. Residency
+    // by backing is exported at /metrics (titan_hugepage_bytes).
+    bool hugepages_enabled = false;
+
+    // Latency mode (opt-in - burns idle CPU): workers spin with
+    // zero-timeout polls before blocking in the event loop. The spin
+    // window adapts to observed arrivals: it widens while spinning keeps
+    // finding events (up to busy_poll_spin_us) and decays back to brief
+    // blocking waits when idle. busy_poll_budget_us > 0 additionally sets
+    // SO_BUSY_POLL on the listener and accepted sockets so those polls
+    // drive the NIC queue directly (may need CAP_NET_ADMIN).
+    bool busy_poll_enabled = false;
+    uint32_t busy_poll_spin_us = 100;  // Max spin window per iteration
+    uint32_t busy_poll_budget_us = 0;  // SO_BUSY_POLL microseconds (0 = off)
+
+    // Event loop watchdog: an iteration whose dispatch time exceeds this
+    // threshold counts as a stall (metric + log line with per-subsystem
+    // breakdown), and the orchestrator watchdog snapshots the stuck
+    // worker's stack while it is still inside the slow callback. 0 = off.
+    uint32_t loop_stall_threshold_ms = 100;
+
+    // HTTP/3 advertisement: Alt-Svc value appended to every response on
+    // the TCP listeners (e.g. "h3=\":443\"; ma=86400") so capable clients
+    // migrate to the QUIC endpoint deployed in front of the gateway.
+    // Empty = no advertisement.
+    std::string alt_svc;
+
+    // HTTP/2 flow control: receive windows grow toward the estimated
+    // bandwidth-delay product (PING-based probing) up to this cap, so
+    // high-RTT clients are not throttled by the 64KB protocol default.
+    // Set to 65535 to disable auto-tuning.
+    uint32_t h2_max_window = 16777216;  // 16MB
+
     // Timeouts (milliseconds)
     uint32_t read_timeout = 60000;  // 60 seconds
     uint32_t write_timeout = 60000;
@@ -125,6 +221,19 @@ struct ServerConfig {
     std::string tls_certificate_path;  // Path to certificate file (PEM format)
     std::string tls_private_key_path;  // Path to private key file (PEM format)
     std::vector<std::string> tls_alpn_protocols = {"h2", "http/1.1"};  // ALPN protocol list
+
+    // Zero-downtime binary upgrade: when set, this process serves its
+    // listening sockets over a Unix socket at this path (SCM_RIGHTS) and a
+    // newly exec'd Titan adopts them at startup instead of binding fresh,
+    // so no accept queue is ever closed. Empty disables handover.
+    std::string upgrade_socket_path;
+
+    // Kernel TLS offload (Linux 4.17+): record crypto moves into the socket
+    // after the handshake, so proxied bytes are encrypted on the send path
+    // without round-tripping through userspace, and kTLS connections become
+    // eligible for the splice() streaming proxy. Falls back to userspace
+    // crypto per connection when the kernel or cipher doesn't support it.
+    bool tls_ktls_enabled = false;
     bool route_cache_enabled = true;  // Thread-local LRU route cache
 
     // WebSocket settings (optional)
@@ -152,15 +261,42 @@ struct CircuitBreakerConfigSchema {
     uint32_t success_threshold = 2;        // Successes to close circuit
     uint32_t timeout_ms = 30000;           // Time before OPEN → HALF_OPEN (30s)
     uint32_t window_ms = 10000;            // Sliding window for failures (10s)
+    double failure_rate_threshold = 0.5;   // Failure fraction in window to open
+    uint32_t min_requests = 20;            // Window volume before rate applies
     bool enable_global_hints = true;       // Cross-worker catastrophic failure hints
     uint32_t catastrophic_threshold = 20;  // Failures to trigger global hint
 };
 
+/// Passive outlier detection configuration (per upstream)
+struct OutlierDetectionConfigSchema {
+    bool enabled = true;
+    uint32_t consecutive_errors = 5;      // Proxy failures to eject
+    double latency_factor = 3.0;          // Eject above this multiple of mean EWMA
+    uint64_t min_latency_us = 10000;      // Latency ejection floor (10ms)
+    uint32_t base_ejection_ms = 30000;    // First ejection duration (30s)
+    uint32_t max_ejection_ms = 300000;    // Ejection duration cap (5min)
+    double max_ejected_fraction = 0.5;    // Never eject more than this share
+};
+
+/// Request hedging configuration (per upstream)
+struct HedgingConfigSchema {
+    bool enabled = false;
+    double delay_percentile = 0.95;  // Hedge past this worker latency percentile
+    uint32_t min_delay_ms = 5;       // Delay clamp floor
+    uint32_t max_delay_ms = 1000;    // Delay clamp ceiling
+    double budget_percent = 10.0;    // Hedges per 100 requests (10s window)
+};
+
 /// Upstream group configuration
 struct UpstreamConfig {
     std::string name;
     std::vector<BackendConfig> backends;
-    std::string load_balancing = "round_robin";  // round_robin, least_connections, random
+    std::string load_balancing = "round_robin";  // round_robin, least_connections, random,
+                                                 // weighted_round_robin, consistent_hash, p2c
+
+    // Consistent hashing: request attribute to hash on
+    // "ip", "path", "header:<name>" or "cookie:<name>"
+    std::string hash_key = "ip";
 
     // Retry settings
     uint32_t max_retries = 2;
@@ -170,8 +306,16 @@ struct UpstreamConfig {
     uint32_t pool_size = 100;
     uint32_t pool_idle_timeout = 60;  // seconds
 
+    // Speak HTTP/2 to the backends (h2c prior knowledge, RFC 7540 §3.4):
+    // one multiplexed connection per backend instead of one socket per
+    // in-flight request
+    bool http2 = false;
+
     // Circuit breaker settings
+    uint32_t min_pool_size = 0;  // Connections the warmer keeps ready per backend, per worker
+    HedgingConfigSchema hedging;
     CircuitBreakerConfigSchema circuit_breaker;
+    OutlierDetectionConfigSchema outlier_detection;
 
     // WebSocket settings (optional)
     std::optional<WebSocketUpstreamConfig> websocket;
@@ -257,6 +401,49 @@ struct CompressionConfig {
         int brotli = 4;  // 0-11 (4 = balanced for dynamic content)
     } levels;
 
+    // Adaptive level selection: under CPU pressure shipping slightly
+    // larger bytes beats queueing requests behind the compressor. Worker
+    // CPU utilization comes from the server's once-a-second rusage sample.
+    struct Adaptive {
+        bool enabled = false;
+        double cpu_fast_threshold = 0.70;  // Drop to the fast level above this
+        double cpu_skip_threshold = 0.90;  // Skip compression entirely above this
+        size_t large_body_size = 1048576;  // Bodies >= this always use the fast level
+    } adaptive;
+
+    // Offloaded compression: bodies at or above min_body_size are handed
+    // to a small process-wide compressor thread pool instead of being
+    // compressed on the event-loop thread (brotli on multi-MB bodies
+    // visibly stalls co-resident connections). In-flight jobs are capped
+    // to bound the memory pinned in offloaded bodies; at the cap the
+    // response is sent uncompressed. HTTP/1.1 clients only.
+    struct Offload {
+        bool enabled = false;
+        size_t min_body_size = 1048576;  // 1MB
+        size_t threads = 2;
+        size_t max_inflight_jobs = 8;
+    } offload;
+
+    // Zstd dictionary compression for small responses. A dictionary gives
+    // zstd shared history that 1-4KB JSON bodies otherwise lack; clients
+    // opt in by listing the custom "zstd-dict" token in Accept-Encoding.
+    struct DictionaryEntry {
+        std::string id;           // Sent back in X-Zstd-Dictionary-Id
+        std::string path_prefix;  // Longest matching prefix wins
+        std::string file;         // Raw dictionary bytes on disk
+    };
+    struct Dictionaries {
+        bool enabled = false;
+        std::vector<DictionaryEntry> entries;
+
+        // Response sampling for training via the admin endpoint
+        // (POST /_admin/compression/dictionaries/train)
+        bool sample_responses = false;
+        size_t sample_every = 64;           // 1-in-N compressible responses retained
+        size_t max_sample_bytes = 4194304;  // Per-entry cap on retained sample bytes
+        size_t max_dict_size = 16384;       // ZDICT output budget
+    } dictionaries;
+
     // BREACH attack mitigation (disable compression for sensitive endpoints)
     // Paths matching these patterns will NOT be compressed (protects auth endpoints)
     // Example: ["/auth/*", "/login", "/api/csrf-token", "/api/token"]
@@ -272,6 +459,15 @@ struct CompressionConfig {
     PrecompressedConfig precompressed;
 };
 
+/// Response cache middleware configuration
+struct CacheConfig {
+    bool enabled = false;
+    size_t max_entries = 10000;      // Per-worker entry cap (per shard: /8)
+    size_t max_body_size = 1048576;  // Don't cache bodies > 1MB
+    uint32_t default_ttl = 0;        // Seconds; 0 = cache only with Cache-Control max-age
+    uint32_t stale_while_revalidate = 30;  // Default SWR window when header omits one (seconds)
+};
+
 /// Route configuration
 struct RouteConfig {
     std::string path;
@@ -302,6 +498,18 @@ struct RouteConfig {
 
     // WebSocket settings (per-route, optional)
     std::optional<WebSocketRouteConfig> websocket;
+
+    // Static file serving: serve files from this directory instead of
+    // proxying. Pair with a wildcard path ("/assets/*") so the wildcard
+    // remainder selects the file; a bare path serves index.html.
+    std::string static_root;
+
+    // Shadow traffic mirroring: a sample of this route's requests is
+    // duplicated fire-and-forget to this upstream. Responses are drained
+    // and discarded; nothing on the mirror path can fail or slow the
+    // primary request.
+    std::string mirror_upstream;
+    uint32_t mirror_sample_percent = 100;  // Of proxied requests on this route
 };
 
 /// CORS middleware configuration
@@ -320,6 +528,13 @@ struct RateLimitConfig {
     uint32_t requests_per_second = 100;
     uint32_t burst_size = 200;
     std::string key = "client_ip";  // client_ip, header:X-API-Key, etc.
+
+    // Cluster mode: one shared quota table across all workers (limit is
+    // enforced node-globally instead of split per worker), with the
+    // configured rate statically apportioned across cluster_node_count
+    // gateway nodes
+    bool cluster_enabled = false;
+    uint32_t cluster_node_count = 1;
 };
 
 /// Authentication configuration (simple token validation)
@@ -394,6 +609,12 @@ struct LogConfig {
     bool log_responses = false;
     std::vector<std::string> exclude_paths;  // Don't log these paths
 
+    // Binary access log: fixed-layout records via per-worker ring buffers,
+    // serialized to access_log_path by a background thread. Convert offline
+    // with `titan --dump-access-log <file>`.
+    bool access_log_binary = false;
+    std::string access_log_path;
+
     struct RotationConfig {
         uint32_t max_size_mb = 100;
         uint32_t max_files = 10;
@@ -433,6 +654,8 @@ struct Config {
     titan::core::fast_map<std::string, CompressionConfig>
         compression_configs;  // Named compression instances
 
+    CacheConfig cache;  // Response cache (per-worker in-memory store)
+
     // Observability
     LogConfig logging;
     MetricsConfig metrics;
@@ -491,6 +714,23 @@ inline void from_json(const nlohmann::json& j, WebSocketRouteConfig& ws) {
     if (j.contains("max_connections")) {
         ws.max_connections = j.at("max_connections").get<uint32_t>();
     }
+    ws.broadcast_channel = j.value("broadcast_channel", std::string{});
+}
+
+inline void to_json(nlohmann::json& j, const WebSocketRouteConfig& ws) {
+    j["enabled"] = ws.enabled;
+    j["subprotocols"] = ws.subprotocols;
+    j["compression"] = ws.compression;
+    if (ws.idle_timeout) {
+        j["idle_timeout"] = *ws.idle_timeout;
+    }
+    if (ws.ping_interval) {
+        j["ping_interval"] = *ws.ping_interval;
+    }
+    if (ws.max_connections) {
+        j["max_connections"] = *ws.max_connections;
+    }
+    j["broadcast_channel"] = ws.broadcast_channel;
 }
 
 inline void from_json(const nlohmann::json& j, WebSocketUpstreamConfig& ws) {
@@ -505,6 +745,27 @@ inline void from_json(const nlohmann::json& j, ServerConfig& s) {
     s.listen_address = j.value("listen_address", std::string("0.0.0.0"));
     s.listen_port = j.value("listen_port", uint16_t(8080));
     s.backlog = j.value("backlog", DEFAULT_LISTEN_BACKLOG);
+    s.tcp_fastopen_queue = j.value("tcp_fastopen_queue", 0u);
+    s.tcp_defer_accept = j.value("tcp_defer_accept", 0u);
+    s.backend_tcp_fastopen = j.value("backend_tcp_fastopen", false);
+    s.event_backend = j.value("event_backend", std::string("epoll"));
+    s.splice_proxy_enabled = j.value("splice_proxy_enabled", false);
+    s.splice_min_body_size = j.value("splice_min_body_size", 1048576u);
+    s.stream_request_min_body_size = j.value("stream_request_min_body_size", 262144u);
+    s.stream_high_watermark = j.value("stream_high_watermark", 1048576u);
+    s.stream_low_watermark = j.value("stream_low_watermark", 131072u);
+    s.zerocopy_send_enabled = j.value("zerocopy_send_enabled", false);
+    s.zerocopy_min_send_size = j.value("zerocopy_min_send_size", 65536u);
+    s.tcp_notsent_lowat = j.value("tcp_notsent_lowat", 0u);
+    s.reuseport_cpu_steering = j.value("reuseport_cpu_steering", false);
+    s.numa_aware = j.value("numa_aware", true);
+    s.hugepages_enabled = j.value("hugepages_enabled", false);
+    s.busy_poll_enabled = j.value("busy_poll_enabled", false);
+    s.busy_poll_spin_us = j.value("busy_poll_spin_us", 100u);
+    s.busy_poll_budget_us = j.value("busy_poll_budget_us", 0u);
+    s.loop_stall_threshold_ms = j.value("loop_stall_threshold_ms", 100u);
+    s.alt_svc = j.value("alt_svc", std::string());
+    s.h2_max_window = j.value("h2_max_window", 16777216u);
     s.read_timeout = j.value("read_timeout", 60000u);
     s.write_timeout = j.value("write_timeout", 60000u);
     s.idle_timeout = j.value("idle_timeout", 300000u);
@@ -517,6 +778,8 @@ inline void from_json(const nlohmann::json& j, ServerConfig& s) {
     s.tls_private_key_path = j.value("tls_private_key_path", std::string());
     s.tls_alpn_protocols =
         j.value("tls_alpn_protocols", std::vector<std::string>{"h2", "http/1.1"});
+    s.tls_ktls_enabled = j.value("tls_ktls_enabled", false);
+    s.upgrade_socket_path = j.value("upgrade_socket_path", std::string());
     if (j.contains("websocket")) {
         s.websocket = j.at("websocket").get<WebSocketServerConfig>();
     }
@@ -539,19 +802,44 @@ inline void from_json(const nlohmann::json& j, CircuitBreakerConfigSchema& c) {
     c.success_threshold = j.value("success_threshold", 2u);
     c.timeout_ms = j.value("timeout_ms", 30000u);
     c.window_ms = j.value("window_ms", 10000u);
+    c.failure_rate_threshold = j.value("failure_rate_threshold", 0.5);
+    c.min_requests = j.value("min_requests", 20u);
     c.enable_global_hints = j.value("enable_global_hints", true);
     c.catastrophic_threshold = j.value("catastrophic_threshold", 20u);
 }
 
+inline void from_json(const nlohmann::json& j, HedgingConfigSchema& h) {
+    h.enabled = j.value("enabled", false);
+    h.delay_percentile = j.value("delay_percentile", 0.95);
+    h.min_delay_ms = j.value("min_delay_ms", 5u);
+    h.max_delay_ms = j.value("max_delay_ms", 1000u);
+    h.budget_percent = j.value("budget_percent", 10.0);
+}
+
+inline void from_json(const nlohmann::json& j, OutlierDetectionConfigSchema& o) {
+    o.enabled = j.value("enabled", true);
+    o.consecutive_errors = j.value("consecutive_errors", 5u);
+    o.latency_factor = j.value("latency_factor", 3.0);
+    o.min_latency_us = j.value("min_latency_us", uint64_t{10000});
+    o.base_ejection_ms = j.value("base_ejection_ms", 30000u);
+    o.max_ejection_ms = j.value("max_ejection_ms", 300000u);
+    o.max_ejected_fraction = j.value("max_ejected_fraction", 0.5);
+}
+
 inline void from_json(const nlohmann::json& j, UpstreamConfig& u) {
     j.at("name").get_to(u.name);          // name is required
     j.at("backends").get_to(u.backends);  // backends is required
     u.load_balancing = j.value("load_balancing", std::string("round_robin"));
+    u.hash_key = j.value("hash_key", std::string("ip"));
     u.max_retries = j.value("max_retries", 2u);
     u.retry_timeout = j.value("retry_timeout", 1000u);
     u.pool_size = j.value("pool_size", 100u);
     u.pool_idle_timeout = j.value("pool_idle_timeout", 60u);
+    u.http2 = j.value("http2", false);
+    u.min_pool_size = j.value("min_pool_size", 0u);
+    u.hedging = j.value("hedging", HedgingConfigSchema{});
     u.circuit_breaker = j.value("circuit_breaker", CircuitBreakerConfigSchema{});
+    u.outlier_detection = j.value("outlier_detection", OutlierDetectionConfigSchema{});
     if (j.contains("websocket")) {
         u.websocket = j.at("websocket").get<WebSocketUpstreamConfig>();
     }
@@ -635,6 +923,62 @@ inline void to_json(nlohmann::json& j, const CompressionConfig::CompressionLevel
     j = nlohmann::json{{"gzip", l.gzip}, {"zstd", l.zstd}, {"brotli", l.brotli}};
 }
 
+inline void from_json(const nlohmann::json& j, CompressionConfig::Adaptive& a) {
+    a.enabled = j.value("enabled", false);
+    a.cpu_fast_threshold = j.value("cpu_fast_threshold", 0.70);
+    a.cpu_skip_threshold = j.value("cpu_skip_threshold", 0.90);
+    a.large_body_size = j.value("large_body_size", size_t(1048576));
+}
+
+inline void to_json(nlohmann::json& j, const CompressionConfig::Adaptive& a) {
+    j = nlohmann::json{{"enabled", a.enabled},
+                       {"cpu_fast_threshold", a.cpu_fast_threshold},
+                       {"cpu_skip_threshold", a.cpu_skip_threshold},
+                       {"large_body_size", a.large_body_size}};
+}
+
+inline void from_json(const nlohmann::json& j, CompressionConfig::Offload& o) {
+    o.enabled = j.value("enabled", false);
+    o.min_body_size = j.value("min_body_size", size_t(1048576));
+    o.threads = j.value("threads", size_t(2));
+    o.max_inflight_jobs = j.value("max_inflight_jobs", size_t(8));
+}
+
+inline void to_json(nlohmann::json& j, const CompressionConfig::Offload& o) {
+    j = nlohmann::json{{"enabled", o.enabled},
+                       {"min_body_size", o.min_body_size},
+                       {"threads", o.threads},
+                       {"max_inflight_jobs", o.max_inflight_jobs}};
+}
+
+inline void from_json(const nlohmann::json& j, CompressionConfig::DictionaryEntry& e) {
+    e.id = j.value("id", std::string{});
+    e.path_prefix = j.value("path_prefix", std::string{});
+    e.file = j.value("file", std::string{});
+}
+
+inline void to_json(nlohmann::json& j, const CompressionConfig::DictionaryEntry& e) {
+    j = nlohmann::json{{"id", e.id}, {"path_prefix", e.path_prefix}, {"file", e.file}};
+}
+
+inline void from_json(const nlohmann::json& j, CompressionConfig::Dictionaries& d) {
+    d.enabled = j.value("enabled", false);
+    d.entries = j.value("entries", std::vector<CompressionConfig::DictionaryEntry>{});
+    d.sample_responses = j.value("sample_responses", false);
+    d.sample_every = j.value("sample_every", size_t(64));
+    d.max_sample_bytes = j.value("max_sample_bytes", size_t(4194304));
+    d.max_dict_size = j.value("max_dict_size", size_t(16384));
+}
+
+inline void to_json(nlohmann::json& j, const CompressionConfig::Dictionaries& d) {
+    j = nlohmann::json{{"enabled", d.enabled},
+                       {"entries", d.entries},
+                       {"sample_responses", d.sample_responses},
+                       {"sample_every", d.sample_every},
+                       {"max_sample_bytes", d.max_sample_bytes},
+                       {"max_dict_size", d.max_dict_size}};
+}
+
 inline void from_json(const nlohmann::json& j, CompressionConfig& c) {
     c.enabled = j.value("enabled", false);
     c.min_size = j.value("min_size", size_t(1024));
@@ -651,6 +995,9 @@ inline void from_json(const nlohmann::json& j, CompressionConfig& c) {
                     "audio/mp3", "audio/aac", "application/zip", "application/gzip",
                     "application/x-brotli", "application/pdf", "application/octet-stream"});
     c.levels = j.value("levels", CompressionConfig::CompressionLevels{});
+    c.adaptive = j.value("adaptive", CompressionConfig::Adaptive{});
+    c.offload = j.value("offload", CompressionConfig::Offload{});
+    c.dictionaries = j.value("dictionaries", CompressionConfig::Dictionaries{});
     // BREACH mitigation - empty by default, user must configure
     c.disable_for_paths = j.value("disable_for_paths", std::vector<std::string>{});
     c.disable_when_setting_cookies = j.value("disable_when_setting_cookies", true);
@@ -665,15 +1012,39 @@ inline void to_json(nlohmann::json& j, const CompressionConfig& c) {
     j["content_types"] = c.content_types;
     j["excluded_content_types"] = c.excluded_content_types;
     j["levels"] = c.levels;
+    j["adaptive"] = c.adaptive;
+    j["offload"] = c.offload;
+    j["dictionaries"] = c.dictionaries;
     j["disable_for_paths"] = c.disable_for_paths;
     j["disable_when_setting_cookies"] = c.disable_when_setting_cookies;
     j["precompressed"] = c.precompressed;
 }
 
+inline void from_json(const nlohmann::json& j, CacheConfig& c) {
+    c.enabled = j.value("enabled", false);
+    c.max_entries = j.value("max_entries", static_cast<size_t>(10000));
+    c.max_body_size = j.value("max_body_size", static_cast<size_t>(1048576));
+    c.default_ttl = j.value("default_ttl", 0u);
+    c.stale_while_revalidate = j.value("stale_while_revalidate", 30u);
+}
+
+inline void to_json(nlohmann::json& j, const CacheConfig& c) {
+    j = nlohmann::json{{"enabled", c.enabled},
+                       {"max_entries", c.max_entries},
+                       {"max_body_size", c.max_body_size},
+                       {"default_ttl", c.default_ttl},
+                       {"stale_while_revalidate", c.stale_while_revalidate}};
+}
+
 inline void from_json(const nlohmann::json& j, RouteConfig& r) {
-    // Required fields
+    // Required fields (static file routes need no upstream)
     j.at("path").get_to(r.path);
-    j.at("upstream").get_to(r.upstream);
+    r.static_root = j.value("static_root", std::string());
+    if (r.static_root.empty()) {
+        j.at("upstream").get_to(r.upstream);
+    } else {
+        r.upstream = j.value("upstream", std::string());
+    }
 
     // Optional fields - use contains() to avoid infinite recursion with complex types
     r.method = j.value("method", std::string("GET"));
@@ -706,6 +1077,8 @@ inline void from_json(const nlohmann::json& j, RouteConfig& r) {
     if (j.contains("websocket")) {
         r.websocket = j.at("websocket").get<WebSocketRouteConfig>();
     }
+    r.mirror_upstream = j.value("mirror_upstream", std::string());
+    r.mirror_sample_percent = j.value("mirror_sample_percent", 100u);
 }
 
 inline void to_json(nlohmann::json& j, const RouteConfig& r) {
@@ -722,6 +1095,12 @@ inline void to_json(nlohmann::json& j, const RouteConfig& r) {
     j["auth_required"] = r.auth_required;
     j["required_scopes"] = r.required_scopes;
     j["required_roles"] = r.required_roles;
+    j["static_root"] = r.static_root;
+    j["mirror_upstream"] = r.mirror_upstream;
+    j["mirror_sample_percent"] = r.mirror_sample_percent;
+    if (r.websocket) {
+        j["websocket"] = *r.websocket;
+    }
 }
 
 inline void from_json(const nlohmann::json& j, CorsConfig& c) {
@@ -739,6 +1118,8 @@ inline void from_json(const nlohmann::json& j, RateLimitConfig& r) {
     r.requests_per_second = j.value("requests_per_second", 100u);
     r.burst_size = j.value("burst_size", 200u);
     r.key = j.value("key", std::string("client_ip"));
+    r.cluster_enabled = j.value("cluster_enabled", false);
+    r.cluster_node_count = j.value("cluster_node_count", 1u);
 }
 
 inline void from_json(const nlohmann::json& j, AuthConfig& a) {
@@ -798,6 +1179,8 @@ inline void from_json(const nlohmann::json& j, LogConfig& l) {
     l.log_requests = j.value("log_requests", true);
     l.log_responses = j.value("log_responses", false);
     l.exclude_paths = j.value("exclude_paths", std::vector<std::string>());
+    l.access_log_binary = j.value("access_log_binary", false);
+    l.access_log_path = j.value("access_log_path", std::string());
     l.rotation = j.value("rotation", LogConfig::RotationConfig{});
 }
 
@@ -853,6 +1236,9 @@ inline void from_json(const nlohmann::json& j, Config& c) {
     if (j.contains("compression_configs")) {
         j.at("compression_configs").get_to(c.compression_configs);
     }
+    if (j.contains("cache")) {
+        j.at("cache").get_to(c.cache);
+    }
     if (j.contains("logging")) {
         j.at("logging").get_to(c.logging);
     }
@@ -876,6 +1262,27 @@ inline void to_json(nlohmann::json& j, const ServerConfig& s) {
                        {"listen_address", s.listen_address},
                        {"listen_port", s.listen_port},
                        {"backlog", s.backlog},
+                       {"tcp_fastopen_queue", s.tcp_fastopen_queue},
+                       {"tcp_defer_accept", s.tcp_defer_accept},
+                       {"backend_tcp_fastopen", s.backend_tcp_fastopen},
+                       {"event_backend", s.event_backend},
+                       {"splice_proxy_enabled", s.splice_proxy_enabled},
+                       {"splice_min_body_size", s.splice_min_body_size},
+                       {"stream_request_min_body_size", s.stream_request_min_body_size},
+                       {"stream_high_watermark", s.stream_high_watermark},
+                       {"stream_low_watermark", s.stream_low_watermark},
+                       {"zerocopy_send_enabled", s.zerocopy_send_enabled},
+                       {"zerocopy_min_send_size", s.zerocopy_min_send_size},
+                       {"tcp_notsent_lowat", s.tcp_notsent_lowat},
+                       {"reuseport_cpu_steering", s.reuseport_cpu_steering},
+                       {"numa_aware", s.numa_aware},
+                       {"hugepages_enabled", s.hugepages_enabled},
+                       {"busy_poll_enabled", s.busy_poll_enabled},
+                       {"busy_poll_spin_us", s.busy_poll_spin_us},
+                       {"busy_poll_budget_us", s.busy_poll_budget_us},
+                       {"loop_stall_threshold_ms", s.loop_stall_threshold_ms},
+                       {"alt_svc", s.alt_svc},
+                       {"h2_max_window", s.h2_max_window},
                        {"read_timeout", s.read_timeout},
                        {"write_timeout", s.write_timeout},
                        {"idle_timeout", s.idle_timeout},
@@ -886,7 +1293,9 @@ inline void to_json(nlohmann::json& j, const ServerConfig& s) {
                        {"tls_enabled", s.tls_enabled},
                        {"tls_certificate_path", s.tls_certificate_path},
                        {"tls_private_key_path", s.tls_private_key_path},
-                       {"tls_alpn_protocols", s.tls_alpn_protocols}};
+                       {"tls_alpn_protocols", s.tls_alpn_protocols},
+                       {"tls_ktls_enabled", s.tls_ktls_enabled},
+                       {"upgrade_socket_path", s.upgrade_socket_path}};
 }
 
 inline void to_json(nlohmann::json& j, const BackendConfig& b) {
@@ -906,19 +1315,44 @@ inline void to_json(nlohmann::json& j, const CircuitBreakerConfigSchema& c) {
                        {"success_threshold", c.success_threshold},
                        {"timeout_ms", c.timeout_ms},
                        {"window_ms", c.window_ms},
+                       {"failure_rate_threshold", c.failure_rate_threshold},
+                       {"min_requests", c.min_requests},
                        {"enable_global_hints", c.enable_global_hints},
                        {"catastrophic_threshold", c.catastrophic_threshold}};
 }
 
+inline void to_json(nlohmann::json& j, const HedgingConfigSchema& h) {
+    j = nlohmann::json{{"enabled", h.enabled},
+                       {"delay_percentile", h.delay_percentile},
+                       {"min_delay_ms", h.min_delay_ms},
+                       {"max_delay_ms", h.max_delay_ms},
+                       {"budget_percent", h.budget_percent}};
+}
+
+inline void to_json(nlohmann::json& j, const OutlierDetectionConfigSchema& o) {
+    j = nlohmann::json{{"enabled", o.enabled},
+                       {"consecutive_errors", o.consecutive_errors},
+                       {"latency_factor", o.latency_factor},
+                       {"min_latency_us", o.min_latency_us},
+                       {"base_ejection_ms", o.base_ejection_ms},
+                       {"max_ejection_ms", o.max_ejection_ms},
+                       {"max_ejected_fraction", o.max_ejected_fraction}};
+}
+
 inline void to_json(nlohmann::json& j, const UpstreamConfig& u) {
     j = nlohmann::json{{"name", u.name},
                        {"backends", u.backends},
                        {"load_balancing", u.load_balancing},
+                       {"hash_key", u.hash_key},
                        {"max_retries", u.max_retries},
                        {"retry_timeout", u.retry_timeout},
                        {"pool_size", u.pool_size},
                        {"pool_idle_timeout", u.pool_idle_timeout},
-                       {"circuit_breaker", u.circuit_breaker}};
+                       {"http2", u.http2},
+                       {"min_pool_size", u.min_pool_size},
+                       {"hedging", u.hedging},
+                       {"circuit_breaker", u.circuit_breaker},
+                       {"outlier_detection", u.outlier_detection}};
 }
 
 inline void to_json(nlohmann::json& j, const CorsConfig& c) {
@@ -934,7 +1368,9 @@ inline void to_json(nlohmann::json& j, const RateLimitConfig& r) {
     j = nlohmann::json{{"enabled", r.enabled},
                        {"requests_per_second", r.requests_per_second},
                        {"burst_size", r.burst_size},
-                       {"key", r.key}};
+                       {"key", r.key},
+                       {"cluster_enabled", r.cluster_enabled},
+                       {"cluster_node_count", r.cluster_node_count}};
 }
 
 inline void to_json(nlohmann::json& j, const AuthConfig& a) {
@@ -985,6 +1421,8 @@ inline void to_json(nlohmann::json& j, const LogConfig& l) {
                        {"log_requests", l.log_requests},
                        {"log_responses", l.log_responses},
                        {"exclude_paths", l.exclude_paths},
+                       {"access_log_binary", l.access_log_binary},
+                       {"access_log_path", l.access_log_path},
                        {"rotation", l.rotation}};
 }
 
@@ -1008,6 +1446,7 @@ inline void to_json(nlohmann::json& j, const Config& c) {
     j["transform_configs"] = c.transform_configs;
     j["compression"] = c.compression;
     j["compression_configs"] = c.compression_configs;
+    j["cache"] = c.cache;
     j["logging"] = c.logging;
     j["metrics"] = c.metrics;
     j["version"] = c.version;
@@ -1030,6 +1469,36 @@ struct ValidationResult {
     [[nodiscard]] bool has_errors() const noexcept { return !valid || !errors.empty(); }
 };
 
+/// What changed between two config snapshots (see ConfigLoader::diff).
+/// Drives incremental reload: workers rebuild only the components whose
+/// config sections actually differ and carry unchanged ones (with their
+/// warmed balancer/breaker/pool state) into the new RCU snapshot.
+struct ConfigDelta {
+    /// Any route added, removed or edited. Defaults to true so a delta
+    /// that was never computed (first swap, no previous snapshot) means
+    /// "rebuild everything".
+    bool routes_changed = true;
+
+    /// JWT section added, removed or edited. Signals key rotation: cached
+    /// token verifications were made against the old keys and must be
+    /// dropped. Same never-computed default as routes_changed.
+    bool jwt_changed = true;
+
+    /// Upstreams whose config section is byte-identical between the two
+    /// snapshots - safe to move the live Upstream object across instead
+    /// of rebuilding it
+    std::vector<std::string> unchanged_upstreams;
+
+    [[nodiscard]] bool upstream_unchanged(std::string_view name) const noexcept {
+        for (const auto& unchanged : unchanged_upstreams) {
+            if (unchanged == name) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
 /// Configuration loader
 class ConfigLoader {
 public:
@@ -1047,6 +1516,26 @@ public:
 
     /// Convert configuration to JSON string
     [[nodiscard]] static std::string to_json(const Config& config);
+
+    /// FNV-1a hash of the config source text; keys the binary snapshot to
+    /// the exact JSON bytes it was compiled from
+    [[nodiscard]] static uint64_t source_hash(std::string_view json) noexcept;
+
+    /// Load a compiled config from a binary snapshot. The header (magic,
+    /// format version, source hash) must match; any mismatch or decode
+    /// error returns nullopt and the caller falls back to a full parse.
+    [[nodiscard]] static std::optional<Config> load_from_snapshot(std::string_view snapshot_path,
+                                                                  uint64_t source_hash);
+
+    /// Serialize an already-validated config to a binary snapshot
+    /// (written to a temp file and renamed into place)
+    static bool save_snapshot(const Config& config, std::string_view snapshot_path,
+                              uint64_t source_hash);
+
+    /// Compare two configs section by section (via their canonical JSON
+    /// forms - no hand-written operator== to drift out of sync with the
+    /// schema). Runs on the reload path only, a few times an hour.
+    [[nodiscard]] static ConfigDelta diff(const Config& old_config, const Config& new_config);
 };
 
 /// Configuration manager with hot-reload support (RCU pattern)
@@ -1068,6 +1557,13 @@ public:
     /// Get current configuration (thread-safe read)
     [[nodiscard]] std::shared_ptr<const Config> get() const noexcept;
 
+    /// Monotonic reload generation, bumped after each successful reload().
+    /// Workers poll this at loop-iteration boundaries: a plain load when
+    /// nothing changed, so the hot path never touches a lock.
+    [[nodiscard]] uint64_t generation() const noexcept {
+        return generation_.load(std::memory_order_acquire);
+    }
+
     /// Get configuration file path
     [[nodiscard]] std::string_view config_path() const noexcept { return config_path_; }
 
@@ -1080,8 +1576,13 @@ public:
     }
 
 private:
+    /// Shared load path: binary snapshot fast path with JSON fallback plus
+    /// validation; writes a fresh snapshot after a successful full parse
+    [[nodiscard]] std::optional<Config> load_validated(std::string_view path);
+
     std::string config_path_;
     std::shared_ptr<const Config> current_config_;
+    std::atomic<uint64_t> generation_{0};
     ValidationResult last_validation_;
 };
 
@@ -0,0 +1,434 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Active Health Prober - Implementation
+
+#include "health_prober.hpp"
+
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "../core/socket.hpp"
+
+namespace titan::control {
+
+namespace {
+
+// Probes in flight at once. With 300 backends on 1s jittered intervals
+// roughly interval/duration * 300 probes overlap; 64 sockets is plenty
+// and bounds the poll set if an upstream melts down and every probe
+// rides out its full timeout.
+constexpr size_t kMaxInFlightProbes = 64;
+
+// HTTP/2 connection preface + empty SETTINGS + PING (RFC 7540 §3.5,
+// §6.5, §6.7). The server must answer the PING with an ACK regardless
+// of stream state, which makes it the cheapest full-path liveness check
+// for a multiplexed backend.
+constexpr char kH2ClientPreface[] = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+
+constexpr uint8_t kH2SettingsFrame[] = {
+    0x00, 0x00, 0x00,        // Length: 0
+    0x04,                    // Type: SETTINGS
+    0x00,                    // Flags
+    0x00, 0x00, 0x00, 0x00,  // Stream: 0
+};
+
+constexpr uint8_t kH2PingFrame[] = {
+    0x00, 0x00, 0x08,        // Length: 8
+    0x06,                    // Type: PING
+    0x00,                    // Flags
+    0x00, 0x00, 0x00, 0x00,  // Stream: 0
+    't',  'i',  't',  'a',  'n', 'h', 'p', '!',  // Opaque data
+};
+
+constexpr uint8_t kH2FrameTypePing = 0x06;
+constexpr uint8_t kH2FlagAck = 0x01;
+
+}  // namespace
+
+HealthProber::HealthProber(const Config& config) {
+    auto now = std::chrono::steady_clock::now();
+    for (const auto& upstream : config.upstreams) {
+        for (const auto& backend : upstream.backends) {
+            if (!backend.health_check_enabled) {
+                continue;
+            }
+            Target target;
+            target.upstream = upstream.name;
+            target.host = backend.host;
+            target.port = backend.port;
+            target.path = backend.health_check_path;
+            target.http2 = upstream.http2;
+            target.interval_ms = std::max(backend.health_check_interval, 1u) * 1000;
+            target.timeout_ms = std::max(backend.health_check_timeout, 1u) * 1000;
+            // Spread first probes across one interval so startup doesn't
+            // hit every backend in the same millisecond
+            target.next_due =
+                now + std::chrono::milliseconds(jittered_interval_ms(target.interval_ms) %
+                                                target.interval_ms);
+            targets_.push_back(std::move(target));
+        }
+    }
+}
+
+HealthProber::~HealthProber() {
+    stop();
+}
+
+void HealthProber::start() {
+    if (targets_.empty() || running_.exchange(true)) {
+        return;
+    }
+    thread_ = std::thread([this] { run(); });
+}
+
+void HealthProber::stop() {
+    running_ = false;
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    for (auto& probe : probes_) {
+        if (probe.fd >= 0) {
+            core::close_fd(probe.fd);
+        }
+    }
+    probes_.clear();
+}
+
+std::string HealthProber::result_key(std::string_view upstream, std::string_view host,
+                                     uint16_t port) {
+    std::string key;
+    key.reserve(upstream.size() + host.size() + 8);
+    key.append(upstream);
+    key.push_back('|');
+    key.append(host);
+    key.push_back(':');
+    key.append(std::to_string(port));
+    return key;
+}
+
+uint32_t HealthProber::jittered_interval_ms(uint32_t interval_ms) {
+    // xorshift64 - schedule jitter needs no crypto quality
+    jitter_rng_ ^= jitter_rng_ << 13;
+    jitter_rng_ ^= jitter_rng_ >> 7;
+    jitter_rng_ ^= jitter_rng_ << 17;
+    // interval +/- 10%
+    uint32_t spread = std::max(interval_ms / 5, 1u);
+    return interval_ms - interval_ms / 10 + static_cast<uint32_t>(jitter_rng_ % spread);
+}
+
+bool HealthProber::resolve_target(Target& target) {
+    if (target.addr_len > 0) {
+        return true;
+    }
+    // Blocking resolution, cached across probes and only redone after a
+    // failed probe. Backends are typically literal IPs, so in practice
+    // this never touches the network; a slow resolver would only delay
+    // this probing pass, never a worker loop.
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* res = nullptr;
+    std::string port_str = std::to_string(target.port);
+    if (getaddrinfo(target.host.c_str(), port_str.c_str(), &hints, &res) != 0 || res == nullptr) {
+        return false;
+    }
+    std::memcpy(&target.addr, res->ai_addr, res->ai_addrlen);
+    target.addr_len = static_cast<socklen_t>(res->ai_addrlen);
+    freeaddrinfo(res);
+    return true;
+}
+
+void HealthProber::start_probe(size_t target_idx, std::chrono::steady_clock::time_point now) {
+    Target& target = targets_[target_idx];
+    target.next_due = now + std::chrono::milliseconds(jittered_interval_ms(target.interval_ms));
+
+    if (!resolve_target(target)) {
+        Probe failed;
+        failed.target_idx = target_idx;
+        failed.started = now;
+        finish_probe(failed, false, now);
+        return;
+    }
+
+    int fd = socket(target.addr.ss_family, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return;  // Transient (fd exhaustion); the next due time retries
+    }
+    if (auto ec = core::set_nonblocking(fd); ec) {
+        core::close_fd(fd);
+        return;
+    }
+
+    Probe probe;
+    probe.fd = fd;
+    probe.target_idx = target_idx;
+    probe.started = now;
+    probe.deadline = now + std::chrono::milliseconds(target.timeout_ms);
+
+    if (target.http2) {
+        probe.out.insert(probe.out.end(), kH2ClientPreface,
+                         kH2ClientPreface + sizeof(kH2ClientPreface) - 1);
+        probe.out.insert(probe.out.end(), kH2SettingsFrame,
+                         kH2SettingsFrame + sizeof(kH2SettingsFrame));
+        probe.out.insert(probe.out.end(), kH2PingFrame, kH2PingFrame + sizeof(kH2PingFrame));
+    } else {
+        std::string request;
+        request.reserve(target.path.size() + target.host.size() + 96);
+        request.append("GET ").append(target.path).append(" HTTP/1.1\r\nHost: ");
+        request.append(target.host).append(":").append(std::to_string(target.port));
+        request.append("\r\nUser-Agent: titan-health\r\nConnection: close\r\n\r\n");
+        probe.out.assign(request.begin(), request.end());
+    }
+
+    int rc = connect(fd, reinterpret_cast<const sockaddr*>(&target.addr), target.addr_len);
+    if (rc < 0 && errno != EINPROGRESS) {
+        core::close_fd(fd);
+        probe.fd = -1;
+        finish_probe(probe, false, now);
+        return;
+    }
+    probe.state = rc == 0 ? Probe::State::Sending : Probe::State::Connecting;
+    probes_.push_back(std::move(probe));
+}
+
+void HealthProber::finish_probe(Probe& probe, bool success,
+                                std::chrono::steady_clock::time_point now) {
+    if (probe.fd >= 0) {
+        core::close_fd(probe.fd);
+        probe.fd = -1;
+    }
+
+    Target& target = targets_[probe.target_idx];
+    if (!success) {
+        // Re-resolve before the next attempt - the failure may be a
+        // moved backend, not a dead one
+        target.addr_len = 0;
+    }
+
+    Result result;
+    result.status = success ? HealthStatus::Healthy : HealthStatus::Unhealthy;
+    result.rtt_us = success
+                        ? static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                                    now - probe.started)
+                                                    .count())
+                        : 0;
+    result.completed = now;
+    result.valid_until = now + std::chrono::milliseconds(3 * target.interval_ms);
+
+    std::lock_guard lock(results_mutex_);
+    result.seq = next_seq_++;
+    results_[result_key(target.upstream, target.host, target.port)] = result;
+}
+
+bool HealthProber::consume_response(Probe& probe, std::chrono::steady_clock::time_point now) {
+    const Target& target = targets_[probe.target_idx];
+
+    if (target.http2) {
+        // Scan frames for the PING ACK; whatever the server sends first
+        // (its SETTINGS, a SETTINGS ACK) is skipped by length
+        size_t cursor = 0;
+        while (probe.in.size() - cursor >= 9) {
+            const auto* header = reinterpret_cast<const uint8_t*>(probe.in.data() + cursor);
+            uint32_t length = (static_cast<uint32_t>(header[0]) << 16) |
+                              (static_cast<uint32_t>(header[1]) << 8) | header[2];
+            uint8_t type = header[3];
+            uint8_t flags = header[4];
+            if (type == kH2FrameTypePing && (flags & kH2FlagAck)) {
+                finish_probe(probe, true, now);
+                return true;
+            }
+            if (probe.in.size() - cursor < 9 + length) {
+                break;  // Partial frame, wait for more
+            }
+            cursor += 9 + length;
+        }
+        probe.in.erase(0, cursor);
+        return false;
+    }
+
+    // HTTP/1.1: the status line is the verdict, the body is irrelevant
+    size_t eol = probe.in.find("\r\n");
+    if (eol == std::string::npos) {
+        return false;
+    }
+    // "HTTP/1.x NNN ..." - 2xx/3xx passes, anything else (including a
+    // non-HTTP response) fails
+    bool healthy = false;
+    if (eol >= 12 && probe.in.compare(0, 5, "HTTP/") == 0) {
+        int status = 0;
+        for (size_t i = 9; i < 12; ++i) {
+            char c = probe.in[i];
+            if (c < '0' || c > '9') {
+                status = 0;
+                break;
+            }
+            status = status * 10 + (c - '0');
+        }
+        healthy = status >= 200 && status < 400;
+    }
+    finish_probe(probe, healthy, now);
+    return true;
+}
+
+void HealthProber::run() {
+    std::vector<pollfd> pollfds;
+
+    while (running_.load(std::memory_order_relaxed)) {
+        auto now = std::chrono::steady_clock::now();
+
+        // Launch due probes (bounded; anything over the cap stays due
+        // and starts as soon as an in-flight probe finishes)
+        for (size_t i = 0; i < targets_.size() && probes_.size() < kMaxInFlightProbes; ++i) {
+            if (targets_[i].next_due > now) {
+                continue;
+            }
+            bool in_flight = std::any_of(probes_.begin(), probes_.end(), [i](const Probe& p) {
+                return p.target_idx == i;
+            });
+            if (!in_flight) {
+                start_probe(i, now);
+            }
+        }
+
+        // Time out stragglers
+        std::erase_if(probes_, [&](Probe& probe) {
+            if (now < probe.deadline) {
+                return false;
+            }
+            finish_probe(probe, false, now);
+            return true;
+        });
+
+        // Wait for socket readiness or the next schedule point
+        pollfds.clear();
+        pollfds.reserve(probes_.size());
+        for (const auto& probe : probes_) {
+            pollfd pfd{};
+            pfd.fd = probe.fd;
+            pfd.events = probe.state == Probe::State::Reading ? POLLIN : POLLOUT;
+            pollfds.push_back(pfd);
+        }
+
+        auto wake = now + std::chrono::milliseconds(100);  // stop() responsiveness cap
+        for (const auto& target : targets_) {
+            wake = std::min(wake, target.next_due);
+        }
+        for (const auto& probe : probes_) {
+            wake = std::min(wake, probe.deadline);
+        }
+        int timeout_ms = static_cast<int>(std::max<int64_t>(
+            1, std::chrono::duration_cast<std::chrono::milliseconds>(wake - now).count()));
+
+        int n = poll(pollfds.data(), pollfds.size(), timeout_ms);
+        if (n <= 0) {
+            continue;
+        }
+
+        now = std::chrono::steady_clock::now();
+        std::erase_if(probes_, [&, idx = size_t{0}](Probe& probe) mutable {
+            const pollfd& pfd = pollfds[idx++];
+            if (pfd.revents == 0) {
+                return false;
+            }
+            if (pfd.revents & (POLLERR | POLLNVAL)) {
+                finish_probe(probe, false, now);
+                return true;
+            }
+
+            if (probe.state == Probe::State::Connecting) {
+                int err = 0;
+                socklen_t len = sizeof(err);
+                if (getsockopt(probe.fd, SOL_SOCKET, SO_ERROR, &err, &len) < 0 || err != 0) {
+                    finish_probe(probe, false, now);
+                    return true;
+                }
+                probe.state = Probe::State::Sending;
+            }
+
+            if (probe.state == Probe::State::Sending) {
+                while (probe.out_cursor < probe.out.size()) {
+                    ssize_t sent = send(probe.fd, probe.out.data() + probe.out_cursor,
+                                        probe.out.size() - probe.out_cursor, MSG_NOSIGNAL);
+                    if (sent > 0) {
+                        probe.out_cursor += static_cast<size_t>(sent);
+                    } else if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                        return false;  // Stay in Sending, poll for POLLOUT
+                    } else {
+                        finish_probe(probe, false, now);
+                        return true;
+                    }
+                }
+                probe.state = Probe::State::Reading;
+                return false;  // Poll for POLLIN next pass
+            }
+
+            // Reading
+            char buf[4096];
+            while (true) {
+                ssize_t received = recv(probe.fd, buf, sizeof(buf), 0);
+                if (received > 0) {
+                    probe.in.append(buf, static_cast<size_t>(received));
+                    if (consume_response(probe, now)) {
+                        return true;
+                    }
+                } else if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                    return false;
+                } else {
+                    // Peer closed (or error) before a verdict
+                    finish_probe(probe, false, now);
+                    return true;
+                }
+            }
+        });
+    }
+}
+
+void HealthProber::apply(gateway::UpstreamManager& upstreams, uint64_t& last_applied_seq) const {
+    auto now = std::chrono::steady_clock::now();
+    uint64_t max_seq = last_applied_seq;
+
+    std::lock_guard lock(results_mutex_);
+    for (const auto& upstream : upstreams.upstreams()) {
+        for (auto& backend : upstream->backends()) {
+            auto it = results_.find(result_key(upstream->name(), backend.host, backend.port));
+            if (it == results_.end() || now > it->second.valid_until) {
+                continue;  // Never probed, or the prober went quiet - leave passive state alone
+            }
+            const Result& result = it->second;
+            HealthChecker::update_backend_with_circuit_breaker(&backend, result.status);
+            backend.last_health_check = result.completed;
+            // Fold the probe RTT into the latency EWMA once per result
+            // per worker: idle backends keep a live latency signal for
+            // the power-of-two-choices balancer without probe samples
+            // swamping request-driven ones
+            if (result.seq > last_applied_seq && result.status == HealthStatus::Healthy &&
+                result.rtt_us > 0) {
+                backend.record_latency(result.rtt_us);
+            }
+            max_seq = std::max(max_seq, result.seq);
+        }
+    }
+    last_applied_seq = max_seq;
+}
+
+}  // namespace titan::control
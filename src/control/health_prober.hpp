@@ -0,0 +1,151 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Active Health Prober - Header
+//
+// A single background thread actively probes every configured backend
+// without blocking or burning a thread per target: all probes share one
+// non-blocking poll(2) event loop, so 300 backends on 1s intervals cost
+// one thread and a handful of sockets, not 300 blocked connects.
+//
+// Probe schedules are jittered per backend (interval +/- 10%) so a fleet
+// restart doesn't synchronize into probe bursts against the backends.
+// HTTP/1.1 upstreams get a GET on the configured health path with the
+// status line parsed for 2xx/3xx; h2c upstreams (UpstreamConfig.http2)
+// are probed with a raw HTTP/2 PING - connection preface, empty
+// SETTINGS, PING - and pass when the PING ACK comes back, which
+// exercises the same multiplexed path the proxy uses.
+//
+// Results land in a small mutex-guarded table keyed by
+// "upstream|host:port". Workers own their UpstreamManager (and thus
+// their Backend objects), so the prober never touches them directly:
+// each worker folds fresh results into its own backends once a second
+// from its timer path via apply() - status transitions go through
+// HealthChecker::update_backend_with_circuit_breaker, and each probe's
+// RTT is recorded into Backend::ewma_latency_us exactly once per worker
+// so idle backends still feed the latency-aware balancer.
+
+#pragma once
+
+#include <sys/socket.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "../gateway/upstream.hpp"
+#include "config.hpp"
+#include "health.hpp"
+
+namespace titan::control {
+
+/// Event-loop-multiplexed active health checker (one thread, all backends)
+class HealthProber {
+public:
+    /// Snapshot probe targets from the config (backends with
+    /// health_check_enabled). The config outlives the prober.
+    explicit HealthProber(const Config& config);
+    ~HealthProber();
+
+    // Non-copyable, non-movable (owns a thread and live sockets)
+    HealthProber(const HealthProber&) = delete;
+    HealthProber& operator=(const HealthProber&) = delete;
+
+    /// Start the prober thread (no-op without targets)
+    void start();
+
+    /// Stop and join the prober thread, closing in-flight probes
+    void stop();
+
+    /// Any backends configured for active checking?
+    [[nodiscard]] bool has_targets() const noexcept { return !targets_.empty(); }
+
+    /// Fold probe results into a worker's backends. Called from the
+    /// worker timer path. Status is applied idempotently on every pass;
+    /// RTT samples are folded into the latency EWMA only for results
+    /// newer than last_applied_seq, which the caller persists between
+    /// calls so each probe feeds each worker's balancer exactly once.
+    void apply(gateway::UpstreamManager& upstreams, uint64_t& last_applied_seq) const;
+
+private:
+    /// One configured backend to probe
+    struct Target {
+        std::string upstream;
+        std::string host;
+        uint16_t port = 80;
+        std::string path;  // Health endpoint (h1 probes)
+        bool http2 = false;
+        uint32_t interval_ms = 30000;
+        uint32_t timeout_ms = 5000;
+        std::chrono::steady_clock::time_point next_due;
+
+        // Resolved address, cached across probes and re-resolved after
+        // a failure (backends are usually literal IPs anyway)
+        sockaddr_storage addr{};
+        socklen_t addr_len = 0;
+    };
+
+    /// An in-flight probe (one non-blocking socket)
+    struct Probe {
+        int fd = -1;
+        size_t target_idx = 0;
+        enum class State : uint8_t { Connecting, Sending, Reading } state = State::Connecting;
+        std::chrono::steady_clock::time_point started;
+        std::chrono::steady_clock::time_point deadline;
+        std::vector<uint8_t> out;  // Request bytes (h1 GET or h2 preface+SETTINGS+PING)
+        size_t out_cursor = 0;
+        std::string in;  // Response prefix (status line / h2 frames)
+    };
+
+    /// A completed probe, as published to workers
+    struct Result {
+        HealthStatus status = HealthStatus::Unhealthy;
+        uint64_t rtt_us = 0;  // Valid for successful probes only
+        uint64_t seq = 0;     // Monotonic publish counter
+        std::chrono::steady_clock::time_point completed;
+        std::chrono::steady_clock::time_point valid_until;  // completed + 3 intervals
+    };
+
+    void run();
+    void start_probe(size_t target_idx, std::chrono::steady_clock::time_point now);
+    bool resolve_target(Target& target);
+    void finish_probe(Probe& probe, bool success, std::chrono::steady_clock::time_point now);
+    [[nodiscard]] uint32_t jittered_interval_ms(uint32_t interval_ms);
+
+    /// Consume readable bytes, returns true once the verdict is in
+    /// (pass/fail via finish_probe) - h1 status line or h2 PING ACK
+    bool consume_response(Probe& probe, std::chrono::steady_clock::time_point now);
+
+    static std::string result_key(std::string_view upstream, std::string_view host, uint16_t port);
+
+    std::vector<Target> targets_;
+    std::vector<Probe> probes_;
+
+    mutable std::mutex results_mutex_;
+    std::unordered_map<std::string, Result> results_;
+    uint64_t next_seq_ = 1;
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    uint64_t jitter_rng_ = 0x9e3779b97f4a7c15ULL;
+};
+
+}  // namespace titan::control
@@ -19,16 +19,272 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <bit>
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <vector>
 
 namespace titan::control {
 
+/// HDR-style log-bucketed latency histogram (microsecond values)
+///
+/// Buckets subdivide each power-of-two range into 8 linear sub-buckets,
+/// giving <=12.5% relative error across the whole range - enough for SLO
+/// percentiles without per-thread kilobytes of exact counts. record() is
+/// a single relaxed fetch_add, so it sits on the request hot path next to
+/// the existing counters. Values beyond ~64s clamp into the last bucket.
+class LatencyHistogram {
+public:
+    static constexpr size_t kSubBits = 3;               // 8 sub-buckets per octave
+    static constexpr size_t kSubCount = 1 << kSubBits;  // 8
+    static constexpr size_t kOctaves = 24;              // up to 2^26 us (~67s)
+    static constexpr size_t kBucketCount = (kOctaves + 1) * kSubCount;
+
+    /// Bucket index for a microsecond value
+    [[nodiscard]] static constexpr size_t bucket_index(uint64_t us) noexcept {
+        if (us < kSubCount) {
+            return static_cast<size_t>(us);  // First octave is exact
+        }
+        size_t msb = 63 - static_cast<size_t>(std::countl_zero(us));
+        size_t octave = msb - kSubBits + 1;
+        if (octave > kOctaves) {
+            return kBucketCount - 1;
+        }
+        size_t sub = (us >> (msb - kSubBits)) & (kSubCount - 1);
+        return octave * kSubCount + sub;
+    }
+
+    /// Inclusive upper bound (microseconds) of a bucket
+    [[nodiscard]] static constexpr uint64_t bucket_upper_bound(size_t index) noexcept {
+        if (index < kSubCount) {
+            return index;
+        }
+        uint64_t octave = index / kSubCount;
+        uint64_t sub = index % kSubCount;
+        // Bucket covers [base + sub*width, base + (sub+1)*width)
+        uint64_t base = uint64_t{1} << (octave + kSubBits - 1);
+        uint64_t width = base >> kSubBits;
+        return base + (sub + 1) * width - 1;
+    }
+
+    void record(uint64_t us) noexcept {
+        buckets_[bucket_index(us)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t bucket_count(size_t index) const noexcept {
+        return buckets_[index].load(std::memory_order_relaxed);
+    }
+
+    void reset() noexcept {
+        for (auto& bucket : buckets_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, kBucketCount> buckets_{};
+};
+
+/// Flat per-route stats, indexed by the dense Route::metrics_id assigned
+/// at config compile. Fixed size once built - the worker installs a whole
+/// new table on config swap rather than resizing in place, so the export
+/// reader never races a reallocation. Route names are export-time labels
+/// only; the request hot path touches nothing but the slot array.
+struct RouteMetricsTable {
+    struct Slot {
+        std::atomic<uint64_t> requests{0};
+        std::atomic<uint64_t> errors{0};
+        LatencyHistogram latency;
+    };
+
+    std::vector<std::string> names;  // Slot index -> route handler_id
+    std::unique_ptr<Slot[]> slots;
+};
+
+// ============================================================================
+// Flight recorder: nanosecond-scale stage timestamps for recent requests
+// ============================================================================
+
+/// Raw cycle counter: TSC on x86-64, the generic timer on aarch64. Both
+/// are unserialized reads costing a few nanoseconds - cheap enough to
+/// mark every stage of every request in production. Conversion to
+/// nanoseconds happens once at dump time, never on the request path.
+[[nodiscard]] inline uint64_t cycle_now() noexcept {
+#if defined(__x86_64__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    uint64_t value;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+#endif
+}
+
+/// Cycles per nanosecond, calibrated against steady_clock on first use.
+/// Dump-path only - the one-off 2ms measurement window never runs on a
+/// worker thread's request path.
+[[nodiscard]] inline double cycles_per_ns() noexcept {
+    static const double rate = [] {
+        auto wall_start = std::chrono::steady_clock::now();
+        uint64_t cycle_start = cycle_now();
+        while (std::chrono::steady_clock::now() - wall_start < std::chrono::milliseconds(2)) {
+        }
+        auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - wall_start)
+                              .count();
+        uint64_t cycles = cycle_now() - cycle_start;
+        return static_cast<double>(cycles) / static_cast<double>(elapsed_ns);
+    }();
+    return rate;
+}
+
+/// Fixed stage boundaries marked along a request's life. A stage a
+/// request never reaches (local responses have no backend stages) keeps
+/// its zero mark and dumps as null.
+enum class FlightStage : uint8_t {
+    RecvStart = 0,       // First byte of the request seen
+    Parsed,              // Parser returned Complete
+    PipelineDone,        // Request middleware chain finished
+    BackendConnected,    // Backend socket writable (or acquired from pool)
+    BackendResponded,    // Backend response fully received
+    Complete,            // Response handed to the client socket
+};
+inline constexpr size_t kFlightStageCount = 6;
+
+/// Per-request stage marks. mark() is one cycle-counter read and one
+/// array store; the whole struct travels by value with the request state
+/// (Connection, BackendConnection) and is committed once at completion.
+struct FlightTrace {
+    std::array<uint64_t, kFlightStageCount> marks{};
+
+    void mark(FlightStage stage) noexcept {
+        marks[static_cast<size_t>(stage)] = cycle_now();
+    }
+
+    [[nodiscard]] bool started() const noexcept {
+        return marks[static_cast<size_t>(FlightStage::RecvStart)] != 0;
+    }
+
+    void reset() noexcept { marks.fill(0); }
+};
+
+/// Per-worker ring of recent request traces plus an always-on "slowest N"
+/// retention list, readable by the admin server while the worker keeps
+/// writing. Each slot is seqlock-guarded: the writer bumps the sequence
+/// to odd before the store and even after, and the dump path rereads the
+/// sequence to discard records it raced with - same tolerance for
+/// concurrent readers as the rest of the metrics in this file.
+class FlightRecorder {
+public:
+    static constexpr size_t kRingSize = 256;     // power of two
+    static constexpr size_t kSlowestCount = 16;
+
+    struct Record {
+        std::array<uint64_t, kFlightStageCount> marks{};
+        uint64_t total_cycles = 0;
+        uint32_t route_id = 0;
+        uint16_t status = 0;
+    };
+
+    /// Commit a finished request (worker thread only). Fast path is the
+    /// ring store plus one compare against the slowest-list floor.
+    void commit(const FlightTrace& trace, uint32_t route_id, uint16_t status) noexcept {
+        uint64_t start = trace.marks[static_cast<size_t>(FlightStage::RecvStart)];
+        uint64_t end = trace.marks[static_cast<size_t>(FlightStage::Complete)];
+        uint64_t total = (end > start) ? end - start : 0;
+
+        Record record;
+        record.marks = trace.marks;
+        record.total_cycles = total;
+        record.route_id = route_id;
+        record.status = status;
+
+        uint64_t idx = write_index_.load(std::memory_order_relaxed);
+        store(ring_[idx & (kRingSize - 1)], record);
+        write_index_.store(idx + 1, std::memory_order_release);
+
+        if (total > slowest_floor_) {
+            retain_slow(record);
+        }
+    }
+
+    /// Copy out readable records (admin thread); torn slots are skipped.
+    [[nodiscard]] std::vector<Record> snapshot_ring() const {
+        std::vector<Record> out;
+        out.reserve(kRingSize);
+        for (const Slot& slot : ring_) {
+            Record record;
+            if (read(slot, record) && record.total_cycles > 0) {
+                out.push_back(record);
+            }
+        }
+        return out;
+    }
+
+    [[nodiscard]] std::vector<Record> snapshot_slowest() const {
+        std::vector<Record> out;
+        out.reserve(kSlowestCount);
+        for (const Slot& slot : slowest_) {
+            Record record;
+            if (read(slot, record) && record.total_cycles > 0) {
+                out.push_back(record);
+            }
+        }
+        return out;
+    }
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> seq{0};
+        Record record;
+    };
+
+    static void store(Slot& slot, const Record& record) noexcept {
+        slot.seq.fetch_add(1, std::memory_order_acquire);  // odd: write in progress
+        slot.record = record;
+        slot.seq.fetch_add(1, std::memory_order_release);  // even: stable
+    }
+
+    static bool read(const Slot& slot, Record& out) noexcept {
+        uint32_t before = slot.seq.load(std::memory_order_acquire);
+        if (before & 1) {
+            return false;
+        }
+        out = slot.record;
+        return slot.seq.load(std::memory_order_acquire) == before;
+    }
+
+    /// Replace the current minimum of the slowest list and recompute the
+    /// floor (off the fast path - runs only for new outliers)
+    void retain_slow(const Record& record) noexcept {
+        size_t min_idx = 0;
+        for (size_t i = 1; i < kSlowestCount; ++i) {
+            if (slowest_cycles_[i] < slowest_cycles_[min_idx]) {
+                min_idx = i;
+            }
+        }
+        slowest_cycles_[min_idx] = record.total_cycles;
+        store(slowest_[min_idx], record);
+        slowest_floor_ = *std::min_element(slowest_cycles_.begin(), slowest_cycles_.end());
+    }
+
+    std::array<Slot, kRingSize> ring_{};
+    std::atomic<uint64_t> write_index_{0};
+
+    std::array<Slot, kSlowestCount> slowest_{};
+    std::array<uint64_t, kSlowestCount> slowest_cycles_{};  // writer-private mirror
+    uint64_t slowest_floor_ = 0;  // cached min, rejects non-outliers in one compare
+};
+
 /// Metrics snapshot at a point in time
 struct MetricsSnapshot {
     // Request metrics
@@ -41,6 +297,15 @@ struct MetricsSnapshot {
     uint64_t total_connections = 0;
     uint64_t rejected_connections = 0;
 
+    // Listener accept-queue health (depth/limit/peak from TCP_INFO on
+    // this worker's listener; overflows/drops are host-wide TcpExt
+    // counters - the kernel does not account them per listener)
+    uint64_t accept_queue_depth = 0;
+    uint64_t accept_queue_limit = 0;
+    uint64_t accept_queue_peak = 0;
+    uint64_t listen_overflows = 0;
+    uint64_t listen_drops = 0;
+
     // Latency metrics (microseconds)
     uint64_t total_latency_us = 0;
     uint64_t min_latency_us = 0;
@@ -56,6 +321,38 @@ struct MetricsSnapshot {
     uint64_t status_4xx = 0;  // Client error
     uint64_t status_5xx = 0;  // Server error
 
+    // TLS handshake counters
+    uint64_t tls_handshakes = 0;   // Completed handshakes
+    uint64_t tls_resumptions = 0;  // Completed via session resumption (ticket hit)
+
+    // JWT revocation Bloom filter counters
+    // Circuit breaker state transitions (by destination state)
+    uint64_t circuit_opened = 0;       // → OPEN (tripped or recovery test failed)
+    uint64_t circuit_half_opened = 0;  // → HALF_OPEN (timeout expired, probing)
+    uint64_t circuit_closed = 0;       // → CLOSED (recovery confirmed)
+
+    // Hedged requests (tail-latency duplicates raced against a second backend)
+    uint64_t hedges_issued = 0;  // Duplicate requests launched
+    uint64_t hedge_wins = 0;     // Races won by the hedge (tail trimmed)
+
+    uint64_t revocation_checks = 0;                 // Total revocation probes
+    uint64_t revocation_bloom_negatives = 0;        // Settled by the filter alone
+    uint64_t revocation_bloom_false_positives = 0;  // Filter hit, exact lookup missed
+
+    // Event loop health (dispatch time excludes epoll waits)
+    uint64_t loop_iterations = 0;
+    uint64_t loop_busy_ns = 0;         // Cumulative dispatch time
+    uint64_t loop_max_busy_ns = 0;     // Worst single iteration
+    uint64_t loop_events = 0;          // epoll events dispatched
+    uint64_t loop_stalls = 0;          // Iterations over the stall threshold
+    uint64_t loop_client_io_ns = 0;    // Accept + client read/write callbacks
+    uint64_t loop_backend_io_ns = 0;   // Backend socket callbacks
+    uint64_t loop_timer_ns = 0;        // Timer wheel ticks
+    uint64_t loop_maintenance_ns = 0;  // Pending backend ops + config polling
+
+    // Latency distribution (same bucket layout as LatencyHistogram)
+    std::array<uint64_t, LatencyHistogram::kBucketCount> latency_buckets{};
+
     // Derived metrics
     [[nodiscard]] double error_rate() const noexcept {
         if (total_requests == 0)
@@ -63,11 +360,60 @@ struct MetricsSnapshot {
         return static_cast<double>(total_errors) / static_cast<double>(total_requests);
     }
 
+    /// Fraction of TLS handshakes completed via session resumption
+    [[nodiscard]] double tls_resumption_rate() const noexcept {
+        if (tls_handshakes == 0)
+            return 0.0;
+        return static_cast<double>(tls_resumptions) / static_cast<double>(tls_handshakes);
+    }
+
+    /// Observed revocation-filter false-positive rate (false positives
+    /// over all probes the filter answered)
+    [[nodiscard]] double revocation_bloom_false_positive_rate() const noexcept {
+        if (revocation_checks == 0)
+            return 0.0;
+        return static_cast<double>(revocation_bloom_false_positives) /
+               static_cast<double>(revocation_checks);
+    }
+
+    /// Mean event-loop dispatch time per iteration in nanoseconds
+    [[nodiscard]] double avg_loop_busy_ns() const noexcept {
+        if (loop_iterations == 0)
+            return 0.0;
+        return static_cast<double>(loop_busy_ns) / static_cast<double>(loop_iterations);
+    }
+
     [[nodiscard]] double avg_latency_us() const noexcept {
         if (total_requests == 0)
             return 0.0;
         return static_cast<double>(total_latency_us) / static_cast<double>(total_requests);
     }
+
+    /// Latency percentile (e.g. 0.99) from the histogram, in microseconds.
+    /// Accurate to the bucket's relative error (<=12.5%)
+    [[nodiscard]] uint64_t latency_percentile_us(double percentile) const noexcept {
+        uint64_t total = 0;
+        for (uint64_t count : latency_buckets) {
+            total += count;
+        }
+        if (total == 0) {
+            return 0;
+        }
+
+        auto target = static_cast<uint64_t>(static_cast<double>(total) * percentile);
+        if (target >= total) {
+            target = total - 1;
+        }
+
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < latency_buckets.size(); ++i) {
+            cumulative += latency_buckets[i];
+            if (cumulative > target) {
+                return LatencyHistogram::bucket_upper_bound(i);
+            }
+        }
+        return LatencyHistogram::bucket_upper_bound(latency_buckets.size() - 1);
+    }
 };
 
 /// Thread-local metrics collector (lock-free)
@@ -107,11 +453,35 @@ public:
         rejected_connections_.fetch_add(1, std::memory_order_relaxed);
     }
 
+    /// Record an accept-queue sample from the worker's listener (timer
+    /// sweep). Depth is a gauge; the peak is retained so a scrape can't
+    /// miss a burst that drained between samples.
+    void record_accept_queue(uint32_t depth, uint32_t limit) noexcept {
+        accept_queue_depth_.store(depth, std::memory_order_relaxed);
+        accept_queue_limit_.store(limit, std::memory_order_relaxed);
+        uint64_t current_peak = accept_queue_peak_.load(std::memory_order_relaxed);
+        while (depth > current_peak) {
+            if (accept_queue_peak_.compare_exchange_weak(current_peak, depth,
+                                                         std::memory_order_relaxed,
+                                                         std::memory_order_relaxed)) {
+                break;
+            }
+        }
+    }
+
+    /// Record the host-wide TcpExt listen overflow/drop counters (absolute
+    /// values straight from /proc/net/netstat)
+    void record_listen_overflows(uint64_t overflows, uint64_t drops) noexcept {
+        listen_overflows_.store(overflows, std::memory_order_relaxed);
+        listen_drops_.store(drops, std::memory_order_relaxed);
+    }
+
     /// Record request latency
     void record_latency(std::chrono::microseconds latency) noexcept {
         uint64_t latency_us = latency.count();
 
         total_latency_us_.fetch_add(latency_us, std::memory_order_relaxed);
+        latency_histogram_.record(latency_us);
 
         // Update min (if this is smaller)
         uint64_t current_min = min_latency_us_.load(std::memory_order_relaxed);
@@ -144,6 +514,133 @@ public:
         bytes_sent_.fetch_add(bytes, std::memory_order_relaxed);
     }
 
+    /// Install the per-route table (worker thread only, before serving or
+    /// at a config-swap boundary). Displaced tables are retained, not
+    /// freed: the metrics exporter may still be mid-read, and keeping a
+    /// table per reload costs far less than reader coordination would.
+    void configure_routes(std::vector<std::string> route_names) {
+        auto table = std::make_unique<RouteMetricsTable>();
+        table->names = std::move(route_names);
+        table->slots = std::make_unique<RouteMetricsTable::Slot[]>(table->names.size());
+        RouteMetricsTable* raw = table.get();
+        route_tables_.push_back(std::move(table));
+        route_table_.store(raw, std::memory_order_release);
+    }
+
+    /// Record a completed request against its route: two relaxed adds and
+    /// a histogram bump, all array-indexed - no hashing, no string keys
+    void record_route(uint32_t route_id, uint64_t latency_us, bool error) noexcept {
+        auto* table = route_table_.load(std::memory_order_acquire);
+        if (!table || route_id >= table->names.size()) {
+            return;  // UINT32_MAX sentinel (no route) lands here too
+        }
+        auto& slot = table->slots[route_id];
+        slot.requests.fetch_add(1, std::memory_order_relaxed);
+        if (error) {
+            slot.errors.fetch_add(1, std::memory_order_relaxed);
+        }
+        slot.latency.record(latency_us);
+    }
+
+    /// Current per-route table for export (may be null before configure)
+    [[nodiscard]] const RouteMetricsTable* route_table() const noexcept {
+        return route_table_.load(std::memory_order_acquire);
+    }
+
+    /// One event-loop iteration's dispatch breakdown, recorded by the
+    /// worker loop after each pass
+    struct LoopIterationSample {
+        uint64_t busy_ns = 0;         // Total dispatch time (excludes epoll waits)
+        uint64_t client_io_ns = 0;    // Accept + client callbacks
+        uint64_t backend_io_ns = 0;   // Backend callbacks
+        uint64_t timer_ns = 0;        // Timer wheel tick
+        uint64_t maintenance_ns = 0;  // Backend ops + config polling
+        uint32_t events = 0;          // epoll events dispatched this pass
+        bool stalled = false;         // busy_ns exceeded the configured threshold
+    };
+
+    /// Record one event-loop iteration (a handful of relaxed adds; the
+    /// loop runs thousands of these per second so keep it cheap)
+    void record_loop_iteration(const LoopIterationSample& s) noexcept {
+        loop_iterations_.fetch_add(1, std::memory_order_relaxed);
+        loop_busy_ns_.fetch_add(s.busy_ns, std::memory_order_relaxed);
+        loop_events_.fetch_add(s.events, std::memory_order_relaxed);
+        loop_client_io_ns_.fetch_add(s.client_io_ns, std::memory_order_relaxed);
+        loop_backend_io_ns_.fetch_add(s.backend_io_ns, std::memory_order_relaxed);
+        loop_timer_ns_.fetch_add(s.timer_ns, std::memory_order_relaxed);
+        loop_maintenance_ns_.fetch_add(s.maintenance_ns, std::memory_order_relaxed);
+        if (s.stalled) {
+            loop_stalls_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        uint64_t current_max = loop_max_busy_ns_.load(std::memory_order_relaxed);
+        while (s.busy_ns > current_max) {
+            if (loop_max_busy_ns_.compare_exchange_weak(current_max, s.busy_ns,
+                                                        std::memory_order_relaxed,
+                                                        std::memory_order_relaxed)) {
+                break;
+            }
+        }
+    }
+
+    /// Loop heartbeat for the orchestrator watchdog: monotonic ns when
+    /// the current iteration started dispatching, 0 while parked in
+    /// epoll_wait. A stale nonzero value means the loop is stuck inside
+    /// a callback.
+    void loop_enter(uint64_t now_ns) noexcept {
+        loop_heartbeat_ns_.store(now_ns, std::memory_order_relaxed);
+    }
+    void loop_park() noexcept { loop_heartbeat_ns_.store(0, std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t loop_heartbeat_ns() const noexcept {
+        return loop_heartbeat_ns_.load(std::memory_order_relaxed);
+    }
+
+    /// Per-worker flight recorder (stage timestamps of recent requests)
+    [[nodiscard]] FlightRecorder& flight_recorder() noexcept { return flight_recorder_; }
+    [[nodiscard]] const FlightRecorder& flight_recorder() const noexcept {
+        return flight_recorder_;
+    }
+
+    /// Record a completed TLS handshake (resumed = session ticket accepted)
+    void record_tls_handshake(bool resumed) noexcept {
+        tls_handshakes_.fetch_add(1, std::memory_order_relaxed);
+        if (resumed) {
+            tls_resumptions_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /// Record a JWT revocation probe. bloom_negative means the filter
+    /// settled it without touching the exact structure; false_positive
+    /// means the filter hit but the exact lookup missed
+    /// Record a circuit breaker state transition (one flag set, or neither
+    /// for a transition back to CLOSED)
+    void record_circuit_transition(bool to_open, bool to_half_open) noexcept {
+        if (to_open) {
+            circuit_opened_.fetch_add(1, std::memory_order_relaxed);
+        } else if (to_half_open) {
+            circuit_half_opened_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            circuit_closed_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void record_hedge(bool won) noexcept {
+        if (won) {
+            hedge_wins_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            hedges_issued_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void record_revocation_probe(bool bloom_negative, bool false_positive) noexcept {
+        revocation_checks_.fetch_add(1, std::memory_order_relaxed);
+        if (bloom_negative) {
+            revocation_bloom_negatives_.fetch_add(1, std::memory_order_relaxed);
+        } else if (false_positive) {
+            revocation_bloom_fp_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
     /// Record HTTP status code
     void record_status_code(uint16_t status_code) noexcept {
         if (status_code >= 200 && status_code < 300) {
@@ -169,6 +666,12 @@ public:
         snap.total_connections = total_connections_.load(std::memory_order_relaxed);
         snap.rejected_connections = rejected_connections_.load(std::memory_order_relaxed);
 
+        snap.accept_queue_depth = accept_queue_depth_.load(std::memory_order_relaxed);
+        snap.accept_queue_limit = accept_queue_limit_.load(std::memory_order_relaxed);
+        snap.accept_queue_peak = accept_queue_peak_.load(std::memory_order_relaxed);
+        snap.listen_overflows = listen_overflows_.load(std::memory_order_relaxed);
+        snap.listen_drops = listen_drops_.load(std::memory_order_relaxed);
+
         snap.total_latency_us = total_latency_us_.load(std::memory_order_relaxed);
         snap.min_latency_us = min_latency_us_.load(std::memory_order_relaxed);
         snap.max_latency_us = max_latency_us_.load(std::memory_order_relaxed);
@@ -181,9 +684,74 @@ public:
         snap.status_4xx = status_4xx_.load(std::memory_order_relaxed);
         snap.status_5xx = status_5xx_.load(std::memory_order_relaxed);
 
+        snap.tls_handshakes = tls_handshakes_.load(std::memory_order_relaxed);
+        snap.tls_resumptions = tls_resumptions_.load(std::memory_order_relaxed);
+
+        snap.circuit_opened = circuit_opened_.load(std::memory_order_relaxed);
+        snap.circuit_half_opened = circuit_half_opened_.load(std::memory_order_relaxed);
+        snap.circuit_closed = circuit_closed_.load(std::memory_order_relaxed);
+        snap.hedges_issued = hedges_issued_.load(std::memory_order_relaxed);
+        snap.hedge_wins = hedge_wins_.load(std::memory_order_relaxed);
+
+        snap.revocation_checks = revocation_checks_.load(std::memory_order_relaxed);
+        snap.revocation_bloom_negatives =
+            revocation_bloom_negatives_.load(std::memory_order_relaxed);
+        snap.revocation_bloom_false_positives = revocation_bloom_fp_.load(std::memory_order_relaxed);
+
+        snap.loop_iterations = loop_iterations_.load(std::memory_order_relaxed);
+        snap.loop_busy_ns = loop_busy_ns_.load(std::memory_order_relaxed);
+        snap.loop_max_busy_ns = loop_max_busy_ns_.load(std::memory_order_relaxed);
+        snap.loop_events = loop_events_.load(std::memory_order_relaxed);
+        snap.loop_stalls = loop_stalls_.load(std::memory_order_relaxed);
+        snap.loop_client_io_ns = loop_client_io_ns_.load(std::memory_order_relaxed);
+        snap.loop_backend_io_ns = loop_backend_io_ns_.load(std::memory_order_relaxed);
+        snap.loop_timer_ns = loop_timer_ns_.load(std::memory_order_relaxed);
+        snap.loop_maintenance_ns = loop_maintenance_ns_.load(std::memory_order_relaxed);
+
+        for (size_t i = 0; i < LatencyHistogram::kBucketCount; ++i) {
+            snap.latency_buckets[i] = latency_histogram_.bucket_count(i);
+        }
+
         return snap;
     }
 
+    /// Publish a coherent snapshot for the aggregator. Worker thread
+    /// only, called from the timer sweep (~1/s): the counters are copied
+    /// into the inactive half of a double buffer under an epoch counter,
+    /// so the admin thread reads a consistent block without ever
+    /// synchronizing with the hot-path increments (which stay plain
+    /// relaxed adds regardless of scrape frequency).
+    void publish_snapshot() noexcept {
+        uint64_t seq = publish_seq_.load(std::memory_order_relaxed);
+        // Odd epoch marks the write in progress (same seqlock discipline
+        // as the flight recorder ring)
+        publish_seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        published_[((seq >> 1) + 1) & 1] = snapshot();
+        publish_seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    /// Latest published snapshot (admin thread). Retries across a
+    /// concurrent publish; falls back to a live (per-counter coherent,
+    /// cross-counter skewed) read until the worker's first publish.
+    [[nodiscard]] MetricsSnapshot read_published() const noexcept {
+        for (int attempt = 0; attempt < 8; ++attempt) {
+            uint64_t seq = publish_seq_.load(std::memory_order_acquire);
+            if (seq == 0) {
+                break;  // Nothing published yet
+            }
+            if (seq & 1) {
+                continue;  // Publish in progress - the other half is one epoch old
+            }
+            MetricsSnapshot snap = published_[(seq >> 1) & 1];
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (publish_seq_.load(std::memory_order_relaxed) == seq) {
+                return snap;
+            }
+        }
+        return snapshot();
+    }
+
     /// Reset all counters (for testing)
     void reset() noexcept {
         total_requests_.store(0, std::memory_order_relaxed);
@@ -193,6 +761,11 @@ public:
         active_connections_.store(0, std::memory_order_relaxed);
         total_connections_.store(0, std::memory_order_relaxed);
         rejected_connections_.store(0, std::memory_order_relaxed);
+        accept_queue_depth_.store(0, std::memory_order_relaxed);
+        accept_queue_limit_.store(0, std::memory_order_relaxed);
+        accept_queue_peak_.store(0, std::memory_order_relaxed);
+        listen_overflows_.store(0, std::memory_order_relaxed);
+        listen_drops_.store(0, std::memory_order_relaxed);
 
         total_latency_us_.store(0, std::memory_order_relaxed);
         min_latency_us_.store(0, std::memory_order_relaxed);
@@ -205,6 +778,31 @@ public:
         status_3xx_.store(0, std::memory_order_relaxed);
         status_4xx_.store(0, std::memory_order_relaxed);
         status_5xx_.store(0, std::memory_order_relaxed);
+
+        tls_handshakes_.store(0, std::memory_order_relaxed);
+        tls_resumptions_.store(0, std::memory_order_relaxed);
+
+        circuit_opened_.store(0, std::memory_order_relaxed);
+        circuit_half_opened_.store(0, std::memory_order_relaxed);
+        circuit_closed_.store(0, std::memory_order_relaxed);
+        hedges_issued_.store(0, std::memory_order_relaxed);
+        hedge_wins_.store(0, std::memory_order_relaxed);
+
+        revocation_checks_.store(0, std::memory_order_relaxed);
+        revocation_bloom_negatives_.store(0, std::memory_order_relaxed);
+        revocation_bloom_fp_.store(0, std::memory_order_relaxed);
+
+        loop_iterations_.store(0, std::memory_order_relaxed);
+        loop_busy_ns_.store(0, std::memory_order_relaxed);
+        loop_max_busy_ns_.store(0, std::memory_order_relaxed);
+        loop_events_.store(0, std::memory_order_relaxed);
+        loop_stalls_.store(0, std::memory_order_relaxed);
+        loop_client_io_ns_.store(0, std::memory_order_relaxed);
+        loop_backend_io_ns_.store(0, std::memory_order_relaxed);
+        loop_timer_ns_.store(0, std::memory_order_relaxed);
+        loop_maintenance_ns_.store(0, std::memory_order_relaxed);
+
+        latency_histogram_.reset();
     }
 
 private:
@@ -217,6 +815,11 @@ private:
     std::atomic<uint64_t> active_connections_{0};
     std::atomic<uint64_t> total_connections_{0};
     std::atomic<uint64_t> rejected_connections_{0};
+    std::atomic<uint64_t> accept_queue_depth_{0};
+    std::atomic<uint64_t> accept_queue_limit_{0};
+    std::atomic<uint64_t> accept_queue_peak_{0};
+    std::atomic<uint64_t> listen_overflows_{0};
+    std::atomic<uint64_t> listen_drops_{0};
 
     // Latency counters
     std::atomic<uint64_t> total_latency_us_{0};
@@ -232,8 +835,62 @@ private:
     std::atomic<uint64_t> status_3xx_{0};
     std::atomic<uint64_t> status_4xx_{0};
     std::atomic<uint64_t> status_5xx_{0};
+
+    // TLS handshake counters
+    std::atomic<uint64_t> tls_handshakes_{0};
+    std::atomic<uint64_t> tls_resumptions_{0};
+
+    // JWT revocation Bloom filter counters
+    std::atomic<uint64_t> circuit_opened_{0};
+    std::atomic<uint64_t> circuit_half_opened_{0};
+    std::atomic<uint64_t> circuit_closed_{0};
+    std::atomic<uint64_t> hedges_issued_{0};
+    std::atomic<uint64_t> hedge_wins_{0};
+
+    std::atomic<uint64_t> revocation_checks_{0};
+    std::atomic<uint64_t> revocation_bloom_negatives_{0};
+    std::atomic<uint64_t> revocation_bloom_fp_{0};
+
+    // Event loop health counters
+    std::atomic<uint64_t> loop_iterations_{0};
+    std::atomic<uint64_t> loop_busy_ns_{0};
+    std::atomic<uint64_t> loop_max_busy_ns_{0};
+    std::atomic<uint64_t> loop_events_{0};
+    std::atomic<uint64_t> loop_stalls_{0};
+    std::atomic<uint64_t> loop_client_io_ns_{0};
+    std::atomic<uint64_t> loop_backend_io_ns_{0};
+    std::atomic<uint64_t> loop_timer_ns_{0};
+    std::atomic<uint64_t> loop_maintenance_ns_{0};
+    std::atomic<uint64_t> loop_heartbeat_ns_{0};
+
+    // Latency distribution
+    LatencyHistogram latency_histogram_;
+
+    // Per-route tables: current pointer for the hot path, retained
+    // history so concurrent exporters never see a freed table
+    std::atomic<RouteMetricsTable*> route_table_{nullptr};
+    std::vector<std::unique_ptr<RouteMetricsTable>> route_tables_;
+
+    // Recent-request flight recorder (ring + slowest-N retention)
+    FlightRecorder flight_recorder_;
+
+    // Double-buffered published snapshots (see publish_snapshot): even
+    // epoch = block (epoch>>1)&1 is complete, odd = write in progress
+    std::array<MetricsSnapshot, 2> published_{};
+    std::atomic<uint64_t> publish_seq_{0};
 };
 
+/// Worker thread's own ThreadMetrics, set at worker startup. Lets code
+/// buried in per-worker components (middlewares) record counters without
+/// threading a pointer through every layer.
+inline thread_local ThreadMetrics* t_thread_metrics = nullptr;
+
+/// This worker's CPU utilization over the last maintenance interval
+/// (0..1), sampled once a second from getrusage(RUSAGE_THREAD) by the
+/// server's timer sweep and lightly smoothed. A load signal for adaptive
+/// consumers (compression level selection), not an exported metric.
+inline thread_local double t_worker_cpu_utilization = 0.0;
+
 /// Global metrics aggregator (collects from all threads)
 class MetricsAggregator {
 public:
@@ -255,7 +912,9 @@ public:
             if (!thread_metrics)
                 continue;
 
-            auto snap = thread_metrics->snapshot();
+            // Published (epoch-stamped) snapshot: coherent across
+            // counters, no synchronization with the worker's hot path
+            auto snap = thread_metrics->read_published();
 
             total.total_requests += snap.total_requests;
             total.total_errors += snap.total_errors;
@@ -283,6 +942,23 @@ public:
             total.status_3xx += snap.status_3xx;
             total.status_4xx += snap.status_4xx;
             total.status_5xx += snap.status_5xx;
+
+            total.tls_handshakes += snap.tls_handshakes;
+            total.tls_resumptions += snap.tls_resumptions;
+
+            total.circuit_opened += snap.circuit_opened;
+            total.circuit_half_opened += snap.circuit_half_opened;
+            total.circuit_closed += snap.circuit_closed;
+            total.hedges_issued += snap.hedges_issued;
+            total.hedge_wins += snap.hedge_wins;
+
+            total.revocation_checks += snap.revocation_checks;
+            total.revocation_bloom_negatives += snap.revocation_bloom_negatives;
+            total.revocation_bloom_false_positives += snap.revocation_bloom_false_positives;
+
+            for (size_t i = 0; i < LatencyHistogram::kBucketCount; ++i) {
+                total.latency_buckets[i] += snap.latency_buckets[i];
+            }
         }
 
         return total;
@@ -0,0 +1,349 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan CPU Profiler - Implementation
+// Per-thread CPU-time timers fire SIGPROF on the sampled thread; the
+// handler records a raw backtrace into a shared buffer. All expensive
+// work (symbolization, demangling, folding) runs on the admin thread
+// after sampling stops, so the in-handler cost is one backtrace() walk.
+
+#include "profiler.hpp"
+
+#ifdef __linux__
+
+#include <csignal>
+#include <ctime>
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// glibc only exposes this accessor behind _GNU_SOURCE in newer versions
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+namespace titan::control {
+
+namespace {
+
+constexpr long kSampleHz = 997;      // Prime, avoids lockstep with 1ms tickers
+constexpr size_t kMaxDepth = 48;     // Frames kept per sample
+constexpr size_t kMaxSamples = 1 << 16;  // Hard cap; extra samples are dropped
+constexpr int kSkipFrames = 2;       // Handler + kernel signal trampoline
+
+struct RawSample {
+    pid_t tid;
+    int depth;
+    void* pcs[kMaxDepth];
+};
+
+/// Shared sample sink for one profiling run. Published via g_active while
+/// timers are armed; handlers claim slots with a relaxed fetch_add.
+struct SampleBuffer {
+    std::atomic<uint32_t> count{0};
+    std::vector<RawSample> samples;
+};
+
+std::atomic<SampleBuffer*> g_active{nullptr};
+
+void sigprof_handler(int /*signo*/, siginfo_t* /*info*/, void* /*ucontext*/) {
+    int saved_errno = errno;
+    SampleBuffer* buf = g_active.load(std::memory_order_acquire);
+    if (buf) {
+        uint32_t idx = buf->count.fetch_add(1, std::memory_order_relaxed);
+        if (idx < buf->samples.size()) {
+            RawSample& s = buf->samples[idx];
+            s.tid = static_cast<pid_t>(syscall(SYS_gettid));
+            s.depth = backtrace(s.pcs, kMaxDepth);
+        }
+    }
+    errno = saved_errno;
+}
+
+/// One sampled thread: its kernel tid, worker attribution, and the
+/// disarmed CPU-time timer created on that thread at registration
+struct RegisteredThread {
+    pid_t tid;
+    uint32_t worker_id;
+    timer_t timer;
+};
+
+std::mutex g_registry_mutex;
+std::vector<RegisteredThread> g_registry;
+
+// Serializes sampling runs: profile() and the watchdog's capture_stack()
+// both write through the single g_active sink
+std::atomic<bool> g_sampling{false};
+
+/// Install the SIGPROF handler exactly once, warming libgcc's unwinder
+/// first (the first backtrace() call allocates and must not happen
+/// inside a signal handler)
+void ensure_handler_installed() {
+    static std::once_flag once;
+    std::call_once(once, [] {
+        void* warm[4];
+        backtrace(warm, 4);
+
+        struct sigaction sa{};
+        sa.sa_sigaction = sigprof_handler;
+        sa.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&sa.sa_mask);
+        sigaction(SIGPROF, &sa, nullptr);
+    });
+}
+
+/// Resolve a return address to a human-readable frame. Results are
+/// cached by the caller; this runs off the hot path.
+std::string symbolize(void* pc) {
+    Dl_info info{};
+    if (dladdr(pc, &info) != 0 && info.dli_sname != nullptr) {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        if (status == 0 && demangled != nullptr) {
+            std::string name(demangled);
+            free(demangled);
+            // Collapsed-stack separators would split the frame
+            std::replace(name.begin(), name.end(), ';', ':');
+            return name;
+        }
+        return info.dli_sname;
+    }
+    char buf[32];
+    if (info.dli_fname != nullptr) {
+        auto off = reinterpret_cast<uintptr_t>(pc) -
+                   reinterpret_cast<uintptr_t>(info.dli_fbase);
+        snprintf(buf, sizeof(buf), "+0x%zx", static_cast<size_t>(off));
+        // Keep the basename only; full paths bloat every output line
+        const char* base = strrchr(info.dli_fname, '/');
+        return std::string(base ? base + 1 : info.dli_fname) + buf;
+    }
+    snprintf(buf, sizeof(buf), "0x%zx", reinterpret_cast<size_t>(pc));
+    return buf;
+}
+
+}  // namespace
+
+CpuProfiler& CpuProfiler::instance() {
+    static CpuProfiler profiler;
+    return profiler;
+}
+
+void CpuProfiler::register_thread(uint32_t worker_id) {
+    RegisteredThread reg{};
+    reg.tid = static_cast<pid_t>(syscall(SYS_gettid));
+    reg.worker_id = worker_id;
+
+    // CLOCK_THREAD_CPUTIME_ID binds the timer to the calling thread's CPU
+    // clock, and SIGEV_THREAD_ID delivers the signal back to that thread,
+    // so the backtrace is always taken on the thread being measured
+    sigevent sev{};
+    sev.sigev_notify = SIGEV_THREAD_ID;
+    sev.sigev_signo = SIGPROF;
+    sev.sigev_notify_thread_id = reg.tid;
+    if (timer_create(CLOCK_THREAD_CPUTIME_ID, &sev, &reg.timer) != 0) {
+        return;  // Profiling unavailable for this thread; not fatal
+    }
+
+    std::lock_guard lock(g_registry_mutex);
+    g_registry.push_back(reg);
+}
+
+std::string CpuProfiler::profile(uint32_t seconds, std::error_code& ec) {
+    seconds = std::clamp(seconds, 1u, 60u);
+
+    if (g_sampling.exchange(true, std::memory_order_acq_rel)) {
+        ec = std::make_error_code(std::errc::device_or_resource_busy);
+        return {};
+    }
+
+    ensure_handler_installed();
+
+    std::vector<RegisteredThread> threads;
+    {
+        std::lock_guard lock(g_registry_mutex);
+        threads = g_registry;
+    }
+    if (threads.empty()) {
+        g_sampling.store(false, std::memory_order_release);
+        ec = std::make_error_code(std::errc::no_such_process);
+        return {};
+    }
+
+    auto buffer = std::make_unique<SampleBuffer>();
+    buffer->samples.resize(kMaxSamples);
+    g_active.store(buffer.get(), std::memory_order_release);
+
+    // Arm every per-thread timer at kSampleHz of CPU time
+    itimerspec its{};
+    its.it_interval.tv_nsec = 1'000'000'000L / kSampleHz;
+    its.it_value = its.it_interval;
+    for (auto& t : threads) {
+        timer_settime(t.timer, 0, &its, nullptr);
+    }
+
+    timespec wall{};
+    wall.tv_sec = seconds;
+    nanosleep(&wall, nullptr);
+
+    itimerspec disarm{};
+    for (auto& t : threads) {
+        timer_settime(t.timer, 0, &disarm, nullptr);
+    }
+    g_active.store(nullptr, std::memory_order_release);
+
+    // Let any handler that already loaded the buffer pointer finish
+    timespec grace{0, 10'000'000};
+    nanosleep(&grace, nullptr);
+
+    uint32_t n = std::min<uint32_t>(buffer->count.load(std::memory_order_acquire),
+                                    kMaxSamples);
+
+    std::unordered_map<pid_t, uint32_t> tid_to_worker;
+    for (const auto& t : threads) {
+        tid_to_worker.emplace(t.tid, t.worker_id);
+    }
+
+    // Fold identical stacks; symbolize each unique pc exactly once
+    std::unordered_map<void*, std::string> symbol_cache;
+    std::map<std::string, uint64_t> folded;
+    for (uint32_t i = 0; i < n; ++i) {
+        const RawSample& s = buffer->samples[i];
+        if (s.depth <= kSkipFrames) {
+            continue;
+        }
+        std::string line;
+        auto worker = tid_to_worker.find(s.tid);
+        if (worker != tid_to_worker.end()) {
+            line = "titan-worker-" + std::to_string(worker->second);
+        } else {
+            line = "titan-tid-" + std::to_string(s.tid);
+        }
+        // backtrace() is leaf-first; collapsed format wants root-first
+        for (int f = s.depth - 1; f >= kSkipFrames; --f) {
+            auto [it, inserted] = symbol_cache.try_emplace(s.pcs[f]);
+            if (inserted) {
+                it->second = symbolize(s.pcs[f]);
+            }
+            line += ';';
+            line += it->second;
+        }
+        ++folded[line];
+    }
+
+    std::string out;
+    for (const auto& [stack, count] : folded) {
+        out += stack;
+        out += ' ';
+        out += std::to_string(count);
+        out += '\n';
+    }
+
+    g_sampling.store(false, std::memory_order_release);
+    ec = {};
+    return out;
+}
+
+std::string CpuProfiler::capture_stack(uint32_t worker_id) {
+    pid_t tid = 0;
+    {
+        std::lock_guard lock(g_registry_mutex);
+        for (const auto& t : g_registry) {
+            if (t.worker_id == worker_id) {
+                tid = t.tid;
+                break;
+            }
+        }
+    }
+    if (tid == 0) {
+        return {};
+    }
+
+    if (g_sampling.exchange(true, std::memory_order_acq_rel)) {
+        return {};  // A full profile is running; it will show the stall anyway
+    }
+
+    ensure_handler_installed();
+
+    auto buffer = std::make_unique<SampleBuffer>();
+    buffer->samples.resize(1);
+    g_active.store(buffer.get(), std::memory_order_release);
+
+    // Poke the stuck thread directly; its handler records one sample.
+    // SA_RESTART means this is safe even mid-syscall.
+    syscall(SYS_tgkill, getpid(), tid, SIGPROF);
+
+    // Wait briefly for the handler to run (it may be delayed if the
+    // thread is spinning with the signal pending delivery)
+    timespec step{0, 1'000'000};
+    for (int i = 0; i < 50 && buffer->count.load(std::memory_order_acquire) == 0; ++i) {
+        nanosleep(&step, nullptr);
+    }
+    g_active.store(nullptr, std::memory_order_release);
+    timespec grace{0, 2'000'000};
+    nanosleep(&grace, nullptr);
+
+    std::string out;
+    if (buffer->count.load(std::memory_order_acquire) > 0) {
+        const RawSample& s = buffer->samples[0];
+        for (int f = kSkipFrames; f < s.depth; ++f) {
+            out += "    ";
+            out += symbolize(s.pcs[f]);
+            out += '\n';
+        }
+    }
+
+    g_sampling.store(false, std::memory_order_release);
+    return out;
+}
+
+}  // namespace titan::control
+
+#else  // !__linux__
+
+namespace titan::control {
+
+CpuProfiler& CpuProfiler::instance() {
+    static CpuProfiler profiler;
+    return profiler;
+}
+
+void CpuProfiler::register_thread(uint32_t /*worker_id*/) {}
+
+std::string CpuProfiler::profile(uint32_t /*seconds*/, std::error_code& ec) {
+    ec = std::make_error_code(std::errc::not_supported);
+    return {};
+}
+
+std::string CpuProfiler::capture_stack(uint32_t /*worker_id*/) {
+    return {};
+}
+
+}  // namespace titan::control
+
+#endif  // __linux__
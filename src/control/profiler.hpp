@@ -0,0 +1,66 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan CPU Profiler - Header
+// On-demand signal-based CPU sampler for production diagnosis.
+// Worker threads register at startup; the admin server arms the sampler
+// for N seconds and renders a collapsed-stack profile with per-worker
+// attribution. Zero cost while idle (timers exist but are disarmed).
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <system_error>
+
+namespace titan::control {
+
+/// Signal-based CPU sampler (Linux only; profile() reports
+/// not_supported elsewhere)
+///
+/// Each registered thread owns a disarmed CLOCK_THREAD_CPUTIME_ID timer
+/// that delivers SIGPROF to that thread only, so samples are taken on
+/// CPU time (idle epoll_wait never fires) and attribution is exact.
+/// The handler walks the stack with backtrace() into a shared
+/// preallocated buffer; symbolization and folding happen on the admin
+/// thread after sampling stops.
+class CpuProfiler {
+public:
+    /// Global instance (workers register against it, admin drives it)
+    static CpuProfiler& instance();
+
+    /// Register the calling thread for sampling. Call once per worker
+    /// thread at startup, before the event loop. No-op on non-Linux.
+    void register_thread(uint32_t worker_id);
+
+    /// Sample all registered threads for `seconds` (clamped to 1..60),
+    /// blocking the caller, then return the profile in collapsed-stack
+    /// format ("titan-worker-0;main;frame;frame <count>" per line).
+    /// Only one profile may run at a time; a concurrent call fails with
+    /// device_or_resource_busy.
+    [[nodiscard]] std::string profile(uint32_t seconds, std::error_code& ec);
+
+    /// Capture a single stack snapshot from one registered worker, one
+    /// frame per line, leaf first (used by the event-loop watchdog when a
+    /// worker stalls). Returns empty if the worker is unknown, a profile
+    /// is already running, or the thread does not respond in time.
+    [[nodiscard]] std::string capture_stack(uint32_t worker_id);
+
+private:
+    CpuProfiler() = default;
+};
+
+}  // namespace titan::control
@@ -19,10 +19,13 @@
 
 #pragma once
 
-#include <sstream>
+#include <charconv>
+#include <cmath>
+#include <functional>
 #include <string>
 #include <string_view>
 
+#include "../core/memory.hpp"
 #include "../gateway/compression_middleware.hpp"
 #include "../gateway/upstream.hpp"
 #include "metrics.hpp"
@@ -37,6 +40,132 @@ enum class PrometheusType {
     Summary     // Quantile summaries
 };
 
+/// Incremental exposition writer with a reusable buffer.
+///
+/// A scrape renders metric families into `buffer_` via append helpers that
+/// format integers with std::to_chars and doubles with fixed-point integer
+/// math - no ostringstream, no snprintf per sample. The buffer is cleared
+/// between scrapes but keeps its capacity, so steady-state scrapes allocate
+/// nothing. With a sink attached, the buffer is handed off every time it
+/// crosses the flush threshold (chunked transfer); without one, the caller
+/// reads the full payload from buffer().
+class ExpositionWriter {
+public:
+    /// Sink receives a filled chunk; returns false to abort the scrape
+    /// (e.g. the peer went away)
+    using Sink = std::function<bool(std::string_view)>;
+
+    static constexpr size_t kDefaultFlushThreshold = 16 * 1024;
+
+    ExpositionWriter() {
+        buffer_.reserve(kDefaultFlushThreshold + 512);
+    }
+
+    /// Attach (or detach, with nullptr) a chunk sink
+    void set_sink(Sink sink, size_t flush_threshold = kDefaultFlushThreshold) {
+        sink_ = std::move(sink);
+        flush_threshold_ = flush_threshold;
+        sink_failed_ = false;
+    }
+
+    /// Prepare for a new scrape: empty the buffer, keep its capacity
+    void reset() {
+        buffer_.clear();
+        last_header_.clear();
+        sink_failed_ = false;
+    }
+
+    /// Flush whatever remains to the sink. Returns false if the sink
+    /// rejected any chunk during this scrape.
+    bool finish() {
+        if (sink_ && !sink_failed_ && !buffer_.empty()) {
+            if (!sink_(buffer_)) {
+                sink_failed_ = true;
+            }
+            buffer_.clear();
+        }
+        return !sink_failed_;
+    }
+
+    /// Rendered payload (only meaningful without a sink)
+    [[nodiscard]] const std::string& buffer() const noexcept { return buffer_; }
+
+    void append(std::string_view text) {
+        buffer_.append(text);
+        maybe_flush();
+    }
+
+    void append(char c) {
+        buffer_.push_back(c);
+        maybe_flush();
+    }
+
+    /// Integer sample value via std::to_chars
+    void append_u64(uint64_t value) {
+        char digits[20];
+        auto [end, ec] = std::to_chars(digits, digits + sizeof(digits), value);
+        buffer_.append(digits, static_cast<size_t>(end - digits));
+        maybe_flush();
+    }
+
+    /// Fixed-point sample value: up to six decimals, trailing zeros
+    /// trimmed. Covers every double we expose (rates in [0,1], latency
+    /// in seconds, `le` bounds) without a printf-family call.
+    void append_fixed(double value) {
+        if (!std::isfinite(value)) {
+            buffer_.push_back('0');
+            maybe_flush();
+            return;
+        }
+        if (value < 0) {
+            buffer_.push_back('-');
+            value = -value;
+        }
+        auto integral = static_cast<uint64_t>(value);
+        auto fraction =
+            static_cast<uint64_t>((value - static_cast<double>(integral)) * 1e6 + 0.5);
+        if (fraction >= 1000000) {
+            ++integral;
+            fraction = 0;
+        }
+        append_u64(integral);
+        if (fraction != 0) {
+            char digits[6];
+            for (int i = 5; i >= 0; --i) {
+                digits[i] = static_cast<char>('0' + fraction % 10);
+                fraction /= 10;
+            }
+            size_t len = 6;
+            while (len > 0 && digits[len - 1] == '0') {
+                --len;
+            }
+            buffer_.push_back('.');
+            buffer_.append(digits, len);
+            maybe_flush();
+        }
+    }
+
+private:
+    friend class PrometheusExporter;
+
+    void maybe_flush() {
+        if (sink_ && buffer_.size() >= flush_threshold_) {
+            if (!sink_failed_ && !sink_(buffer_)) {
+                sink_failed_ = true;
+            }
+            buffer_.clear();
+        }
+    }
+
+    std::string buffer_;
+    Sink sink_;
+    size_t flush_threshold_ = kDefaultFlushThreshold;
+    bool sink_failed_ = false;
+    // Last family for which HELP/TYPE were emitted (suppresses duplicate
+    // headers for consecutive samples of the same family)
+    std::string last_header_;
+};
+
 /// Prometheus exporter
 class PrometheusExporter {
 public:
@@ -47,11 +176,9 @@ public:
     PrometheusExporter(const PrometheusExporter&) = delete;
     PrometheusExporter& operator=(const PrometheusExporter&) = delete;
 
-    /// Export metrics in Prometheus text format
-    [[nodiscard]] static std::string export_metrics(const MetricsSnapshot& metrics,
-                                                    std::string_view namespace_prefix = "titan") {
-        std::ostringstream out;
-
+    /// Render core metrics into an exposition writer
+    static void export_metrics(ExpositionWriter& out, const MetricsSnapshot& metrics,
+                               std::string_view namespace_prefix = "titan") {
         // Request metrics (counters)
         write_metric(out, namespace_prefix, "requests_total", "Total number of HTTP requests",
                      PrometheusType::Counter, metrics.total_requests);
@@ -74,6 +201,28 @@ public:
                      "Total number of rejected connections", PrometheusType::Counter,
                      metrics.rejected_connections);
 
+        // Listener accept-queue health (depth/limit sampled per worker via
+        // TCP_INFO; overflows/drops are host-wide TcpExt counters)
+        write_metric(out, namespace_prefix, "accept_queue_depth",
+                     "Connections waiting in the listener's accept queue",
+                     PrometheusType::Gauge, metrics.accept_queue_depth);
+
+        write_metric(out, namespace_prefix, "accept_queue_limit",
+                     "Configured accept-queue (backlog) limit", PrometheusType::Gauge,
+                     metrics.accept_queue_limit);
+
+        write_metric(out, namespace_prefix, "accept_queue_depth_peak",
+                     "Peak accept-queue depth observed between samples",
+                     PrometheusType::Gauge, metrics.accept_queue_peak);
+
+        write_metric(out, namespace_prefix, "listen_overflows_total",
+                     "Host-wide connections dropped on accept-queue overflow (TcpExt)",
+                     PrometheusType::Counter, metrics.listen_overflows);
+
+        write_metric(out, namespace_prefix, "listen_drops_total",
+                     "Host-wide SYNs dropped at the listener (TcpExt)",
+                     PrometheusType::Counter, metrics.listen_drops);
+
         // Latency metrics (microseconds)
         write_metric(out, namespace_prefix, "latency_microseconds_total",
                      "Total latency in microseconds", PrometheusType::Counter,
@@ -92,6 +241,24 @@ public:
                      "Average latency in microseconds", PrometheusType::Gauge,
                      metrics.avg_latency_us());
 
+        // Latency distribution (from the HDR histogram in ThreadMetrics)
+        write_latency_histogram(out, namespace_prefix, metrics);
+
+        // Percentile gauges for dashboards/alerts that don't run
+        // histogram_quantile themselves
+        write_metric(out, namespace_prefix, "latency_microseconds_p50",
+                     "50th percentile latency in microseconds", PrometheusType::Gauge,
+                     metrics.latency_percentile_us(0.50));
+        write_metric(out, namespace_prefix, "latency_microseconds_p90",
+                     "90th percentile latency in microseconds", PrometheusType::Gauge,
+                     metrics.latency_percentile_us(0.90));
+        write_metric(out, namespace_prefix, "latency_microseconds_p99",
+                     "99th percentile latency in microseconds", PrometheusType::Gauge,
+                     metrics.latency_percentile_us(0.99));
+        write_metric(out, namespace_prefix, "latency_microseconds_p999",
+                     "99.9th percentile latency in microseconds", PrometheusType::Gauge,
+                     metrics.latency_percentile_us(0.999));
+
         // Bandwidth metrics
         write_metric(out, namespace_prefix, "bytes_received_total", "Total bytes received",
                      PrometheusType::Counter, metrics.bytes_received);
@@ -116,24 +283,120 @@ public:
                      "Total HTTP responses by status class", PrometheusType::Counter,
                      metrics.status_5xx, {{"code", "5xx"}});
 
+        // TLS handshake metrics (session resumption hit rate)
+        write_metric(out, namespace_prefix, "tls_handshakes_total",
+                     "Total completed TLS handshakes", PrometheusType::Counter,
+                     metrics.tls_handshakes);
+
+        write_metric(out, namespace_prefix, "tls_resumptions_total",
+                     "TLS handshakes completed via session resumption", PrometheusType::Counter,
+                     metrics.tls_resumptions);
+
+        write_metric(out, namespace_prefix, "tls_resumption_rate",
+                     "Fraction of TLS handshakes resumed (resumptions/handshakes)",
+                     PrometheusType::Gauge, metrics.tls_resumption_rate());
+
+        // JWT revocation Bloom filter metrics
+        write_metric(out, namespace_prefix, "jwt_revocation_checks_total",
+                     "Total JWT revocation probes", PrometheusType::Counter,
+                     metrics.revocation_checks);
+
+        write_metric(out, namespace_prefix, "jwt_revocation_bloom_negatives_total",
+                     "Revocation probes settled by the Bloom filter alone",
+                     PrometheusType::Counter, metrics.revocation_bloom_negatives);
+
+        write_metric(out, namespace_prefix, "jwt_revocation_bloom_false_positives_total",
+                     "Bloom filter hits not confirmed by the exact blacklist",
+                     PrometheusType::Counter, metrics.revocation_bloom_false_positives);
+
+        write_metric(out, namespace_prefix, "jwt_revocation_bloom_false_positive_rate",
+                     "Observed revocation filter false-positive rate", PrometheusType::Gauge,
+                     metrics.revocation_bloom_false_positive_rate());
+
+        // Event loop health (loop lag: dispatch time per iteration,
+        // epoll waits excluded)
+        write_metric(out, namespace_prefix, "event_loop_iterations_total",
+                     "Event loop iterations", PrometheusType::Counter, metrics.loop_iterations);
+
+        write_metric(out, namespace_prefix, "event_loop_busy_nanoseconds_total",
+                     "Cumulative event loop dispatch time in nanoseconds",
+                     PrometheusType::Counter, metrics.loop_busy_ns);
+
+        write_metric(out, namespace_prefix, "event_loop_busy_nanoseconds_max",
+                     "Worst single-iteration dispatch time in nanoseconds",
+                     PrometheusType::Gauge, metrics.loop_max_busy_ns);
+
+        write_metric(out, namespace_prefix, "event_loop_busy_nanoseconds_avg",
+                     "Mean dispatch time per iteration in nanoseconds", PrometheusType::Gauge,
+                     metrics.avg_loop_busy_ns());
+
+        write_metric(out, namespace_prefix, "event_loop_events_total",
+                     "Epoll events dispatched by the event loop", PrometheusType::Counter,
+                     metrics.loop_events);
+
+        write_metric(out, namespace_prefix, "event_loop_stalls_total",
+                     "Iterations whose dispatch time exceeded the stall threshold",
+                     PrometheusType::Counter, metrics.loop_stalls);
+
+        write_metric(out, namespace_prefix, "event_loop_subsystem_nanoseconds_total",
+                     "Event loop dispatch time by subsystem", PrometheusType::Counter,
+                     metrics.loop_client_io_ns, {{"subsystem", "client_io"}});
+
+        write_metric(out, namespace_prefix, "event_loop_subsystem_nanoseconds_total",
+                     "Event loop dispatch time by subsystem", PrometheusType::Counter,
+                     metrics.loop_backend_io_ns, {{"subsystem", "backend_io"}});
+
+        write_metric(out, namespace_prefix, "event_loop_subsystem_nanoseconds_total",
+                     "Event loop dispatch time by subsystem", PrometheusType::Counter,
+                     metrics.loop_timer_ns, {{"subsystem", "timers"}});
+
+        write_metric(out, namespace_prefix, "event_loop_subsystem_nanoseconds_total",
+                     "Event loop dispatch time by subsystem", PrometheusType::Counter,
+                     metrics.loop_maintenance_ns, {{"subsystem", "maintenance"}});
+
+        // Circuit breaker state transitions (aggregated across backends;
+        // per-backend counters live in export_circuit_breaker_metrics)
+        write_metric(out, namespace_prefix, "circuit_breaker_opened_total",
+                     "Circuit breaker transitions to OPEN", PrometheusType::Counter,
+                     metrics.circuit_opened);
+
+        write_metric(out, namespace_prefix, "circuit_breaker_half_opened_total",
+                     "Circuit breaker transitions to HALF_OPEN", PrometheusType::Counter,
+                     metrics.circuit_half_opened);
+
+        write_metric(out, namespace_prefix, "circuit_breaker_closed_total",
+                     "Circuit breaker transitions to CLOSED", PrometheusType::Counter,
+                     metrics.circuit_closed);
+
+        write_metric(out, namespace_prefix, "hedged_requests_total",
+                     "Hedged requests issued", PrometheusType::Counter, metrics.hedges_issued);
+
+        write_metric(out, namespace_prefix, "hedge_wins_total",
+                     "Hedged requests that beat the primary", PrometheusType::Counter,
+                     metrics.hedge_wins);
+
         // Error rate (derived)
         write_metric(out, namespace_prefix, "error_rate", "Error rate (errors/requests)",
                      PrometheusType::Gauge, metrics.error_rate());
+    }
 
-        return out.str();
+    /// Export metrics in Prometheus text format
+    [[nodiscard]] static std::string export_metrics(const MetricsSnapshot& metrics,
+                                                    std::string_view namespace_prefix = "titan") {
+        ExpositionWriter out;
+        export_metrics(out, metrics, namespace_prefix);
+        return out.buffer();
     }
 
-    /// Export circuit breaker metrics for all upstreams
-    [[nodiscard]] static std::string export_circuit_breaker_metrics(
-        const gateway::UpstreamManager* upstream_manager, uint32_t worker_id = 0,
-        std::string_view namespace_prefix = "titan") {
+    /// Render circuit breaker metrics for all upstreams
+    static void export_circuit_breaker_metrics(ExpositionWriter& out,
+                                               const gateway::UpstreamManager* upstream_manager,
+                                               uint32_t worker_id = 0,
+                                               std::string_view namespace_prefix = "titan") {
         if (!upstream_manager) {
-            return "";
+            return;
         }
 
-        std::ostringstream out;
-        static std::string last_metric;
-
         // Iterate through all upstreams and their backends
         for (const auto& upstream_ptr : upstream_manager->upstreams()) {
             const auto& upstream = *upstream_ptr;
@@ -179,16 +442,64 @@ public:
                              backend.circuit_breaker->get_state_transitions(), labels);
             }
         }
-
-        return out.str();
     }
 
-    /// Export compression metrics
-    [[nodiscard]] static std::string export_compression_metrics(
-        const gateway::CompressionMetrics& metrics, uint32_t worker_id = 0,
+    /// Export circuit breaker metrics for all upstreams
+    [[nodiscard]] static std::string export_circuit_breaker_metrics(
+        const gateway::UpstreamManager* upstream_manager, uint32_t worker_id = 0,
         std::string_view namespace_prefix = "titan") {
-        std::ostringstream out;
+        ExpositionWriter out;
+        export_circuit_breaker_metrics(out, upstream_manager, worker_id, namespace_prefix);
+        return out.buffer();
+    }
 
+    /// Render per-route metrics (requests, errors, latency percentiles)
+    /// from the flat table indexed by Route::metrics_id
+    static void export_route_metrics(ExpositionWriter& out, const RouteMetricsTable* table,
+                                     std::string_view namespace_prefix = "titan") {
+        if (!table || table->names.empty()) {
+            return;
+        }
+
+        for (size_t i = 0; i < table->names.size(); ++i) {
+            const auto& slot = table->slots[i];
+            uint64_t requests = slot.requests.load(std::memory_order_relaxed);
+            if (requests == 0) {
+                continue;  // Keep exposition small: skip never-hit routes
+            }
+
+            std::vector<Label> labels = {{"route", table->names[i]}};
+
+            write_metric(out, namespace_prefix, "route_requests_total",
+                         "Total requests per route", PrometheusType::Counter, requests, labels);
+
+            write_metric(out, namespace_prefix, "route_errors_total", "Total errors per route",
+                         PrometheusType::Counter, slot.errors.load(std::memory_order_relaxed),
+                         labels);
+
+            write_metric(out, namespace_prefix, "route_latency_p50_us",
+                         "Per-route median latency (microseconds)", PrometheusType::Gauge,
+                         histogram_percentile(slot.latency, 0.50), labels);
+
+            write_metric(out, namespace_prefix, "route_latency_p99_us",
+                         "Per-route p99 latency (microseconds)", PrometheusType::Gauge,
+                         histogram_percentile(slot.latency, 0.99), labels);
+        }
+    }
+
+    /// Export per-route metrics as a standalone string
+    [[nodiscard]] static std::string export_route_metrics(
+        const RouteMetricsTable* table, std::string_view namespace_prefix = "titan") {
+        ExpositionWriter out;
+        export_route_metrics(out, table, namespace_prefix);
+        return out.buffer();
+    }
+
+    /// Render compression metrics
+    static void export_compression_metrics(ExpositionWriter& out,
+                                           const gateway::CompressionMetrics& metrics,
+                                           uint32_t worker_id = 0,
+                                           std::string_view namespace_prefix = "titan") {
         std::vector<Label> worker_label = {{"worker", std::to_string(worker_id)}};
 
         write_metric(out, namespace_prefix, "compression_requests_total",
@@ -253,11 +564,49 @@ public:
                      metrics.skipped_breach_mitigation,
                      {{"reason", "breach_mitigation"}, {"worker", std::to_string(worker_id)}});
 
+        write_metric(out, namespace_prefix, "compression_skipped_total",
+                     "Requests skipped by reason", PrometheusType::Counter,
+                     metrics.skipped_cpu_pressure,
+                     {{"reason", "cpu_pressure"}, {"worker", std::to_string(worker_id)}});
+
+        write_metric(out, namespace_prefix, "compression_level_degraded_total",
+                     "Responses compressed at the fast fallback level", PrometheusType::Counter,
+                     metrics.level_degraded, worker_label);
+
         write_metric(out, namespace_prefix, "compression_precompressed_total",
                      "Requests served from precompressed files", PrometheusType::Counter,
                      metrics.precompressed_hits, worker_label);
 
-        return out.str();
+        write_metric(out, namespace_prefix, "compression_dictionary_total",
+                     "Responses compressed against a zstd dictionary", PrometheusType::Counter,
+                     metrics.dictionary_hits, worker_label);
+
+        write_metric(out, namespace_prefix, "compression_offloaded_total",
+                     "Bodies handed to the offload compressor pool", PrometheusType::Counter,
+                     metrics.offloaded, worker_label);
+    }
+
+    /// Export compression metrics
+    [[nodiscard]] static std::string export_compression_metrics(
+        const gateway::CompressionMetrics& metrics, uint32_t worker_id = 0,
+        std::string_view namespace_prefix = "titan") {
+        ExpositionWriter out;
+        export_compression_metrics(out, metrics, worker_id, namespace_prefix);
+        return out.buffer();
+    }
+
+    /// Export hugepage residency (process-wide - see core::hugepages)
+    static void export_hugepage_metrics(ExpositionWriter& out,
+                                        std::string_view namespace_prefix = "titan") {
+        auto residency = titan::core::hugepages::residency();
+
+        write_metric(out, namespace_prefix, "hugepage_bytes",
+                     "Bytes mapped for arena/pool slabs by backing", PrometheusType::Gauge,
+                     residency.hugetlb_bytes, {{"backing", "hugetlb"}});
+
+        write_metric(out, namespace_prefix, "hugepage_bytes",
+                     "Bytes mapped for arena/pool slabs by backing", PrometheusType::Gauge,
+                     residency.thp_bytes, {{"backing", "thp"}});
     }
 
 private:
@@ -267,94 +616,169 @@ private:
         std::string value;
     };
 
+    /// Write the request latency histogram in Prometheus histogram format.
+    /// The fine-grained HDR buckets are folded into a fixed ladder of `le`
+    /// bounds - scrape payloads stay small while histogram_quantile keeps
+    /// enough resolution for SLO percentiles.
+    static void write_latency_histogram(ExpositionWriter& out, std::string_view namespace_prefix,
+                                        const MetricsSnapshot& metrics) {
+        // Upper bounds in seconds (Prometheus convention for *_seconds)
+        static constexpr double kBounds[] = {0.0005, 0.001, 0.0025, 0.005, 0.01,
+                                             0.025,  0.05,  0.1,    0.25,  0.5,
+                                             1.0,    2.5,   5.0,    10.0};
+
+        write_header(out, namespace_prefix, "request_latency_seconds",
+                     "Request latency distribution in seconds", PrometheusType::Histogram);
+
+        std::string name = std::string(namespace_prefix) + "_request_latency_seconds";
+
+        uint64_t total = 0;
+        for (uint64_t count : metrics.latency_buckets) {
+            total += count;
+        }
+
+        size_t bucket = 0;
+        uint64_t cumulative = 0;
+        for (double bound : kBounds) {
+            auto bound_us = static_cast<uint64_t>(bound * 1e6);
+            while (bucket < metrics.latency_buckets.size() &&
+                   LatencyHistogram::bucket_upper_bound(bucket) <= bound_us) {
+                cumulative += metrics.latency_buckets[bucket];
+                ++bucket;
+            }
+            out.append(name);
+            out.append("_bucket{le=\"");
+            out.append_fixed(bound);
+            out.append("\"} ");
+            out.append_u64(cumulative);
+            out.append('\n');
+        }
+        out.append(name);
+        out.append("_bucket{le=\"+Inf\"} ");
+        out.append_u64(total);
+        out.append('\n');
+        out.append(name);
+        out.append("_sum ");
+        out.append_fixed(static_cast<double>(metrics.total_latency_us) / 1e6);
+        out.append('\n');
+        out.append(name);
+        out.append("_count ");
+        out.append_u64(total);
+        out.append('\n');
+    }
+
     /// Write HELP and TYPE lines
-    static void write_header(std::ostringstream& out, std::string_view namespace_prefix,
+    static void write_header(ExpositionWriter& out, std::string_view namespace_prefix,
                              std::string_view metric_name, std::string_view help,
                              PrometheusType type) {
         // HELP line
-        out << "# HELP " << namespace_prefix << "_" << metric_name << " " << help << "\n";
+        out.append("# HELP ");
+        out.append(namespace_prefix);
+        out.append('_');
+        out.append(metric_name);
+        out.append(' ');
+        out.append(help);
+        out.append('\n');
 
         // TYPE line
-        out << "# TYPE " << namespace_prefix << "_" << metric_name << " ";
+        out.append("# TYPE ");
+        out.append(namespace_prefix);
+        out.append('_');
+        out.append(metric_name);
+        out.append(' ');
         switch (type) {
             case PrometheusType::Counter:
-                out << "counter";
+                out.append("counter");
                 break;
             case PrometheusType::Gauge:
-                out << "gauge";
+                out.append("gauge");
                 break;
             case PrometheusType::Histogram:
-                out << "histogram";
+                out.append("histogram");
                 break;
             case PrometheusType::Summary:
-                out << "summary";
+                out.append("summary");
                 break;
         }
-        out << "\n";
+        out.append('\n');
     }
 
-    /// Write metric with uint64_t value
-    static void write_metric(std::ostringstream& out, std::string_view namespace_prefix,
-                             std::string_view metric_name, std::string_view help,
-                             PrometheusType type, uint64_t value,
-                             const std::vector<Label>& labels = {}) {
-        static std::string last_metric;
-        std::string full_name = std::string(namespace_prefix) + "_" + std::string(metric_name);
-
-        // Only write header if this is a new metric
-        if (full_name != last_metric) {
-            write_header(out, namespace_prefix, metric_name, help, type);
-            last_metric = full_name;
+    /// Percentile (e.g. 0.99) straight from a live histogram's buckets,
+    /// accurate to the bucket's relative error
+    [[nodiscard]] static uint64_t histogram_percentile(const LatencyHistogram& histogram,
+                                                       double percentile) noexcept {
+        uint64_t total = 0;
+        for (size_t i = 0; i < LatencyHistogram::kBucketCount; ++i) {
+            total += histogram.bucket_count(i);
+        }
+        if (total == 0) {
+            return 0;
         }
 
-        // Metric line
-        out << full_name;
+        auto target = static_cast<uint64_t>(static_cast<double>(total) * percentile);
+        if (target >= total) {
+            target = total - 1;
+        }
 
-        // Labels
-        if (!labels.empty()) {
-            out << "{";
-            for (size_t i = 0; i < labels.size(); ++i) {
-                out << labels[i].name << "=\"" << labels[i].value << "\"";
-                if (i < labels.size() - 1) {
-                    out << ",";
-                }
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < LatencyHistogram::kBucketCount; ++i) {
+            cumulative += histogram.bucket_count(i);
+            if (cumulative > target) {
+                return LatencyHistogram::bucket_upper_bound(i);
             }
-            out << "}";
         }
-
-        out << " " << value << "\n";
+        return LatencyHistogram::bucket_upper_bound(LatencyHistogram::kBucketCount - 1);
     }
 
-    /// Write metric with double value
-    static void write_metric(std::ostringstream& out, std::string_view namespace_prefix,
-                             std::string_view metric_name, std::string_view help,
-                             PrometheusType type, double value,
-                             const std::vector<Label>& labels = {}) {
-        static std::string last_metric;
+    /// Emit HELP/TYPE only when the family changes (the writer tracks the
+    /// last family, so consecutive labeled samples share one header)
+    static void write_name_and_labels(ExpositionWriter& out, std::string_view namespace_prefix,
+                                      std::string_view metric_name, std::string_view help,
+                                      PrometheusType type, const std::vector<Label>& labels) {
         std::string full_name = std::string(namespace_prefix) + "_" + std::string(metric_name);
 
-        // Only write header if this is a new metric
-        if (full_name != last_metric) {
+        if (full_name != out.last_header_) {
             write_header(out, namespace_prefix, metric_name, help, type);
-            last_metric = full_name;
+            out.last_header_ = std::move(full_name);
         }
 
-        // Metric line
-        out << full_name;
+        out.append(out.last_header_);
 
-        // Labels
         if (!labels.empty()) {
-            out << "{";
+            out.append('{');
             for (size_t i = 0; i < labels.size(); ++i) {
-                out << labels[i].name << "=\"" << labels[i].value << "\"";
+                out.append(labels[i].name);
+                out.append("=\"");
+                out.append(labels[i].value);
+                out.append('"');
                 if (i < labels.size() - 1) {
-                    out << ",";
+                    out.append(',');
                 }
             }
-            out << "}";
+            out.append('}');
         }
 
-        out << " " << value << "\n";
+        out.append(' ');
+    }
+
+    /// Write metric with uint64_t value
+    static void write_metric(ExpositionWriter& out, std::string_view namespace_prefix,
+                             std::string_view metric_name, std::string_view help,
+                             PrometheusType type, uint64_t value,
+                             const std::vector<Label>& labels = {}) {
+        write_name_and_labels(out, namespace_prefix, metric_name, help, type, labels);
+        out.append_u64(value);
+        out.append('\n');
+    }
+
+    /// Write metric with double value
+    static void write_metric(ExpositionWriter& out, std::string_view namespace_prefix,
+                             std::string_view metric_name, std::string_view help,
+                             PrometheusType type, double value,
+                             const std::vector<Label>& labels = {}) {
+        write_name_and_labels(out, namespace_prefix, metric_name, help, type, labels);
+        out.append_fixed(value);
+        out.append('\n');
     }
 };
 
@@ -0,0 +1,161 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Binary Access Log - Header
+// Fixed-layout access records pushed into a per-worker SPSC ring on the
+// request path; a background thread batches them to disk. The hot-path
+// cost is one struct fill plus a release store - no formatting, no locks.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace titan::core {
+
+/// One access-log entry. Fixed layout, written verbatim to disk; bump
+/// kAccessLogVersion when the layout changes.
+struct AccessLogRecord {
+    uint64_t timestamp_ns;  // Unix epoch ns at response completion
+    uint64_t bytes_in;      // Request body bytes
+    uint64_t bytes_out;     // Response body bytes
+    uint32_t duration_us;   // Request start -> response completion
+    uint32_t route_id;      // Route::metrics_id (UINT32_MAX = unmatched)
+    uint32_t backend_id;    // FNV-1a of "host:port" (0 = no backend)
+    uint16_t status;        // HTTP status code
+    uint8_t flags;          // kAccessLogFlag* bits
+    uint8_t reserved = 0;
+};
+
+static_assert(sizeof(AccessLogRecord) == 40, "access log record layout is on-disk format");
+static_assert(std::is_trivially_copyable_v<AccessLogRecord>);
+
+inline constexpr uint8_t kAccessLogFlagBackendError = 0x01;
+
+inline constexpr uint32_t kAccessLogMagic = 0x474C4154;  // "TALG" little-endian
+inline constexpr uint32_t kAccessLogVersion = 1;
+
+/// Binary log file header (precedes the raw record stream)
+struct AccessLogFileHeader {
+    uint32_t magic = kAccessLogMagic;
+    uint32_t version = kAccessLogVersion;
+    uint32_t record_size = sizeof(AccessLogRecord);
+    uint32_t reserved = 0;
+};
+
+/// Single-producer single-consumer record ring. The owning worker pushes,
+/// the writer thread drains; full rings drop (and count) rather than block.
+class AccessLogRing {
+public:
+    // 64K records = 2.5 MiB per worker; absorbs multi-second writer stalls
+    // at full line rate before dropping
+    static constexpr size_t kCapacity = 64 * 1024;
+    static_assert((kCapacity & (kCapacity - 1)) == 0, "capacity must be a power of two");
+
+    AccessLogRing() : records_(std::make_unique<AccessLogRecord[]>(kCapacity)) {}
+
+    // Non-copyable, non-movable (producer/consumer hold raw pointers)
+    AccessLogRing(const AccessLogRing&) = delete;
+    AccessLogRing& operator=(const AccessLogRing&) = delete;
+
+    /// Producer side: enqueue one record, dropping when the ring is full
+    void push(const AccessLogRecord& record) noexcept {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        uint64_t tail = tail_.load(std::memory_order_acquire);
+        if (head - tail >= kCapacity) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        records_[head & (kCapacity - 1)] = record;
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    /// Consumer side: copy up to max_records into out, returns count drained
+    size_t drain(AccessLogRecord* out, size_t max_records) noexcept {
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        uint64_t head = head_.load(std::memory_order_acquire);
+        size_t available = static_cast<size_t>(head - tail);
+        size_t count = available < max_records ? available : max_records;
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = records_[(tail + i) & (kCapacity - 1)];
+        }
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    /// Records dropped because the ring was full (writer fell behind)
+    [[nodiscard]] uint64_t dropped() const noexcept {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::unique_ptr<AccessLogRecord[]> records_;
+    alignas(64) std::atomic<uint64_t> head_{0};  // Producer cursor
+    alignas(64) std::atomic<uint64_t> tail_{0};  // Consumer cursor
+    std::atomic<uint64_t> dropped_{0};
+};
+
+/// Background writer: owns the worker rings and the log file, drains all
+/// rings in batches on its own thread
+class AccessLogWriter {
+public:
+    explicit AccessLogWriter(std::string path) : path_(std::move(path)) {}
+    ~AccessLogWriter();
+
+    // Non-copyable, non-movable
+    AccessLogWriter(const AccessLogWriter&) = delete;
+    AccessLogWriter& operator=(const AccessLogWriter&) = delete;
+
+    /// Open the log file (writing the file header) and start the drain
+    /// thread. Returns false when the file cannot be opened.
+    [[nodiscard]] bool start();
+
+    /// Drain remaining records, close the file, join the thread
+    void stop();
+
+    /// Allocate a ring for one worker. The writer owns the ring, so it
+    /// stays valid for drain even after the worker thread exits.
+    [[nodiscard]] AccessLogRing* create_ring();
+
+private:
+    void run();
+    void drain_all();
+
+    std::string path_;
+    FILE* file_ = nullptr;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+
+    std::mutex rings_mutex_;  // Guards ring registration only; drain reads
+    std::vector<std::unique_ptr<AccessLogRing>> rings_;
+};
+
+/// Per-worker ring used by LoggingMiddleware's binary path. Null when
+/// binary access logging is disabled.
+extern thread_local AccessLogRing* t_access_log_ring;
+
+/// Offline converter: render a binary access log as text (one line per
+/// record) or JSON lines. Returns false on open/format errors.
+[[nodiscard]] bool convert_access_log(const char* binary_path, FILE* out, bool as_json);
+
+}  // namespace titan::core
@@ -22,7 +22,11 @@
 #include <atomic>
 #include <nlohmann/json.hpp>
 
+#include "../control/profiler.hpp"
 #include "../control/prometheus.hpp"
+#include "../gateway/compression_middleware.hpp"
+#include "../http/websocket.hpp"
+#include "../http/ws_broadcast.hpp"
 #include "socket.hpp"
 
 // Forward declare global for metrics
@@ -33,6 +37,7 @@ struct CompressionMetrics;
 namespace titan::core {
 extern std::atomic<const gateway::UpstreamManager*> g_upstream_manager_for_metrics;
 extern std::atomic<const gateway::CompressionMetrics*> g_compression_metrics_for_export;
+extern std::atomic<const control::ThreadMetrics*> g_worker_metrics_for_export;
 }  // namespace titan::core
 
 #include <arpa/inet.h>
@@ -40,12 +45,51 @@ extern std::atomic<const gateway::CompressionMetrics*> g_compression_metrics_for
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <charconv>
 #include <cstring>
+#include <fstream>
 #include <sstream>
 #include <string>
 
 namespace titan::core {
 
+namespace {
+
+/// Blocking send of the full buffer (retries short writes and EINTR)
+bool send_all(int fd, std::string_view data) {
+    while (!data.empty()) {
+        ssize_t n = send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        if (n == 0) {
+            return false;
+        }
+        data.remove_prefix(static_cast<size_t>(n));
+    }
+    return true;
+}
+
+/// One HTTP/1.1 chunk: hex size line, payload, trailing CRLF
+bool send_chunk(int fd, std::string_view payload) {
+    if (payload.empty()) {
+        return true;  // An empty chunk would terminate the body
+    }
+    char size_line[18];
+    auto [end, ec] = std::to_chars(size_line, size_line + sizeof(size_line) - 2, payload.size(),
+                                   16);
+    *end++ = '\r';
+    *end++ = '\n';
+    return send_all(fd, {size_line, static_cast<size_t>(end - size_line)}) &&
+           send_all(fd, payload) && send_all(fd, "\r\n");
+}
+
+}  // namespace
+
 AdminServer::AdminServer(const control::Config& config,
                          const gateway::UpstreamManager* upstream_manager,
                          RevocationQueue* revocation_queue)
@@ -159,20 +203,17 @@ void AdminServer::handle_connection(int client_fd) {
         }
 
         if (req.path == "/metrics" || req.path == config_.metrics.path) {
-            const gateway::UpstreamManager* upstream_mgr =
-                titan::core::g_upstream_manager_for_metrics.load(std::memory_order_acquire);
-            const gateway::CompressionMetrics* compression_metrics_ptr =
-                titan::core::g_compression_metrics_for_export.load(std::memory_order_acquire);
-
-            std::string body;
-            body += control::PrometheusExporter::export_circuit_breaker_metrics(
-                upstream_mgr, worker_id_, "titan");
-            if (compression_metrics_ptr) {
-                body += control::PrometheusExporter::export_compression_metrics(
-                    *compression_metrics_ptr, worker_id_, "titan");
-            }
+            send_metrics_chunked(client_fd);
+            return;
+        }
 
-            send_response(client_fd, 200, "text/plain; version=0.0.4", body);
+        if (req.path == "/_admin/flight-recorder") {
+            handle_flight_recorder(client_fd);
+            return;
+        }
+
+        if (req.path == "/_admin/profile" || req.path.starts_with("/_admin/profile?")) {
+            handle_profile(client_fd, req.path);
             return;
         }
     }
@@ -236,6 +277,138 @@ void AdminServer::handle_connection(int client_fd) {
                 return;
             }
         }
+        if (req.path == "/_admin/compression/dictionaries/train") {
+            // Train a zstd dictionary from sampled response bodies. The
+            // trained dictionary is written to the entry's configured file;
+            // workers pick it up on the next restart/config reload.
+            const auto& dictionaries = config_.compression.dictionaries;
+
+            const char* body_start = std::strstr(buffer, "\r\n\r\n");
+            if (!body_start) {
+                send_response(client_fd, 400, "application/json",
+                              R"({"error":"bad_request","message":"Missing request body"})");
+                return;
+            }
+            body_start += 4;
+
+            try {
+                auto json = nlohmann::json::parse(body_start);
+
+                if (!json.contains("id") || !json["id"].is_string()) {
+                    send_response(
+                        client_fd, 400, "application/json",
+                        R"({"error":"bad_request","message":"Missing or invalid 'id' field"})");
+                    return;
+                }
+                std::string id = json["id"];
+
+                const control::CompressionConfig::DictionaryEntry* entry = nullptr;
+                for (const auto& candidate : dictionaries.entries) {
+                    if (candidate.id == id) {
+                        entry = &candidate;
+                        break;
+                    }
+                }
+                if (!entry || entry->file.empty()) {
+                    send_response(
+                        client_fd, 404, "application/json",
+                        R"({"error":"not_found","message":"No dictionary entry with that id"})");
+                    return;
+                }
+
+                size_t max_dict_size = json.value("max_dict_size", dictionaries.max_dict_size);
+                auto result =
+                    gateway::DictionarySampleStore::instance().train(id, max_dict_size);
+                if (result.dictionary.empty()) {
+                    nlohmann::json error = {
+                        {"error", "insufficient_samples"},
+                        {"message", "Training failed; need more sampled responses"},
+                        {"sample_count", result.sample_count},
+                        {"sample_bytes", result.sample_bytes}};
+                    send_response(client_fd, 400, "application/json", error.dump());
+                    return;
+                }
+
+                std::ofstream out(entry->file, std::ios::binary | std::ios::trunc);
+                if (!out.is_open() ||
+                    !out.write(reinterpret_cast<const char*>(result.dictionary.data()),
+                               static_cast<std::streamsize>(result.dictionary.size()))) {
+                    send_response(
+                        client_fd, 500, "application/json",
+                        R"({"error":"internal_error","message":"Failed to write dictionary file"})");
+                    return;
+                }
+
+                nlohmann::json response = {
+                    {"status", "ok"},
+                    {"id", id},
+                    {"file", entry->file},
+                    {"dictionary_bytes", result.dictionary.size()},
+                    {"sample_count", result.sample_count},
+                    {"sample_bytes", result.sample_bytes},
+                    {"message", "Dictionary written; takes effect on config reload"}};
+                send_response(client_fd, 200, "application/json", response.dump());
+                return;
+
+            } catch (const nlohmann::json::exception& e) {
+                std::string error_body = R"({"error":"bad_request","message":"Invalid JSON: )" +
+                                         std::string(e.what()) + R"("})";
+                send_response(client_fd, 400, "application/json", error_body);
+                return;
+            }
+        }
+        if (req.path == "/_admin/broadcast") {
+            // Publish a message to a WebSocket broadcast channel. The
+            // payload is framed once into a shared buffer and fanned out
+            // to every subscribed connection by the workers (see
+            // http/ws_broadcast.hpp).
+            const char* body_start = std::strstr(buffer, "\r\n\r\n");
+            if (!body_start) {
+                send_response(client_fd, 400, "application/json",
+                              R"({"error":"bad_request","message":"Missing request body"})");
+                return;
+            }
+            body_start += 4;
+
+            try {
+                auto json = nlohmann::json::parse(body_start);
+
+                if (!json.contains("channel") || !json["channel"].is_string()) {
+                    send_response(
+                        client_fd, 400, "application/json",
+                        R"({"error":"bad_request","message":"Missing or invalid 'channel' field"})");
+                    return;
+                }
+                if (!json.contains("message") || !json["message"].is_string()) {
+                    send_response(
+                        client_fd, 400, "application/json",
+                        R"({"error":"bad_request","message":"Missing or invalid 'message' field"})");
+                    return;
+                }
+
+                std::string channel = json["channel"];
+                std::string message = json["message"];
+                bool binary = json.value("binary", false);
+
+                auto frame = http::make_broadcast_frame(
+                    binary ? http::WebSocketOpcode::BINARY : http::WebSocketOpcode::TEXT,
+                    std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(message.data()),
+                                             message.size()));
+                http::WsBroadcastBus::instance().publish(channel, std::move(frame));
+
+                nlohmann::json response = {{"status", "ok"},
+                                           {"channel", channel},
+                                           {"frame_bytes", message.size()}};
+                send_response(client_fd, 200, "application/json", response.dump());
+                return;
+
+            } catch (const nlohmann::json::exception& e) {
+                std::string error_body = R"({"error":"bad_request","message":"Invalid JSON: )" +
+                                         std::string(e.what()) + R"("})";
+                send_response(client_fd, 400, "application/json", error_body);
+                return;
+            }
+        }
     }
 
     // Not found
@@ -270,6 +443,158 @@ AdminServer::SimpleRequest AdminServer::parse_request(const char* data, size_t l
     return req;
 }
 
+void AdminServer::send_metrics_chunked(int fd) {
+    const gateway::UpstreamManager* upstream_mgr =
+        titan::core::g_upstream_manager_for_metrics.load(std::memory_order_acquire);
+    const gateway::CompressionMetrics* compression_metrics_ptr =
+        titan::core::g_compression_metrics_for_export.load(std::memory_order_acquire);
+    const control::ThreadMetrics* worker_metrics =
+        titan::core::g_worker_metrics_for_export.load(std::memory_order_acquire);
+
+    // Headers first; the body follows as chunks flushed by the writer's
+    // sink every time its buffer crosses the threshold
+    std::string_view headers =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/plain; version=0.0.4\r\n"
+        "Transfer-Encoding: chunked\r\n"
+        "Connection: close\r\n"
+        "Server: Titan-Admin/0.1.0\r\n"
+        "\r\n";
+    if (!send_all(fd, headers)) {
+        return;
+    }
+
+    auto& writer = exposition_writer_;
+    writer.reset();
+    writer.set_sink([fd](std::string_view chunk) { return send_chunk(fd, chunk); });
+
+    if (worker_metrics) {
+        // Epoch-published snapshot: coherent across counters without
+        // synchronizing with the worker's relaxed hot-path increments
+        control::PrometheusExporter::export_metrics(writer, worker_metrics->read_published(),
+                                                    "titan");
+        control::PrometheusExporter::export_route_metrics(writer, worker_metrics->route_table(),
+                                                          "titan");
+    }
+    control::PrometheusExporter::export_circuit_breaker_metrics(writer, upstream_mgr, worker_id_,
+                                                                "titan");
+    if (compression_metrics_ptr) {
+        control::PrometheusExporter::export_compression_metrics(writer, *compression_metrics_ptr,
+                                                                worker_id_, "titan");
+    }
+    if (config_.server.hugepages_enabled) {
+        control::PrometheusExporter::export_hugepage_metrics(writer, "titan");
+    }
+
+    if (writer.finish()) {
+        (void)send_all(fd, "0\r\n\r\n");  // Terminating chunk
+    }
+    writer.set_sink(nullptr);  // Don't hold the fd capture past this scrape
+}
+
+void AdminServer::handle_flight_recorder(int fd) {
+    const control::ThreadMetrics* worker_metrics =
+        titan::core::g_worker_metrics_for_export.load(std::memory_order_acquire);
+    if (!worker_metrics) {
+        send_response(fd, 503, "application/json",
+                      R"({"error":"service_unavailable","message":"No worker metrics yet"})");
+        return;
+    }
+
+    const double rate = control::cycles_per_ns();
+    const auto* route_table = worker_metrics->route_table();
+
+    // Cycle deltas between two stage marks, null when either mark is
+    // missing (a local response never reaches the backend stages)
+    auto stage_ns = [&](const control::FlightRecorder::Record& record, control::FlightStage from,
+                        control::FlightStage to) -> nlohmann::json {
+        uint64_t a = record.marks[static_cast<size_t>(from)];
+        uint64_t b = record.marks[static_cast<size_t>(to)];
+        if (a == 0 || b == 0 || b < a) {
+            return nullptr;
+        }
+        return static_cast<uint64_t>(static_cast<double>(b - a) / rate);
+    };
+
+    auto to_json = [&](const control::FlightRecorder::Record& record) {
+        nlohmann::json entry;
+        if (route_table && record.route_id < route_table->names.size()) {
+            entry["route"] = route_table->names[record.route_id];
+        } else {
+            entry["route"] = nullptr;
+        }
+        entry["status"] = record.status;
+        entry["total_ns"] =
+            static_cast<uint64_t>(static_cast<double>(record.total_cycles) / rate);
+        entry["parse_ns"] =
+            stage_ns(record, control::FlightStage::RecvStart, control::FlightStage::Parsed);
+        entry["pipeline_ns"] =
+            stage_ns(record, control::FlightStage::Parsed, control::FlightStage::PipelineDone);
+        entry["backend_connect_ns"] = stage_ns(record, control::FlightStage::PipelineDone,
+                                               control::FlightStage::BackendConnected);
+        entry["backend_wait_ns"] = stage_ns(record, control::FlightStage::BackendConnected,
+                                            control::FlightStage::BackendResponded);
+        // Local responses have no backend leg; their write span starts at
+        // the end of the pipeline instead
+        bool proxied =
+            record.marks[static_cast<size_t>(control::FlightStage::BackendResponded)] != 0;
+        entry["write_ns"] = stage_ns(record,
+                                     proxied ? control::FlightStage::BackendResponded
+                                             : control::FlightStage::PipelineDone,
+                                     control::FlightStage::Complete);
+        return entry;
+    };
+
+    const auto& recorder = worker_metrics->flight_recorder();
+    nlohmann::json body;
+    body["worker"] = worker_id_;
+    body["recent"] = nlohmann::json::array();
+    body["slowest"] = nlohmann::json::array();
+    for (const auto& record : recorder.snapshot_ring()) {
+        body["recent"].push_back(to_json(record));
+    }
+    auto slowest = recorder.snapshot_slowest();
+    std::sort(slowest.begin(), slowest.end(),
+              [](const auto& a, const auto& b) { return a.total_cycles > b.total_cycles; });
+    for (const auto& record : slowest) {
+        body["slowest"].push_back(to_json(record));
+    }
+
+    send_response(fd, 200, "application/json", body.dump());
+}
+
+void AdminServer::handle_profile(int fd, std::string_view path) {
+    // Optional ?seconds=N (clamped by the profiler to 1..60)
+    uint32_t seconds = 5;
+    if (auto pos = path.find("seconds="); pos != std::string_view::npos) {
+        auto value = path.substr(pos + 8);
+        std::from_chars(value.data(), value.data() + value.size(), seconds);
+    }
+
+    // Blocks this admin connection for the sampling window, like every
+    // pprof-style profile handler; workers are unaffected beyond the
+    // per-sample SIGPROF cost
+    std::error_code ec;
+    std::string profile = control::CpuProfiler::instance().profile(seconds, ec);
+    if (ec == std::errc::device_or_resource_busy) {
+        send_response(fd, 409, "application/json",
+                      R"({"error":"conflict","message":"A profile is already running"})");
+        return;
+    }
+    if (ec == std::errc::no_such_process) {
+        send_response(fd, 503, "application/json",
+                      R"({"error":"service_unavailable","message":"No worker threads registered"})");
+        return;
+    }
+    if (ec) {
+        send_response(fd, 501, "application/json",
+                      R"({"error":"not_implemented","message":"Profiling not supported on this platform"})");
+        return;
+    }
+
+    send_response(fd, 200, "text/plain", profile);
+}
+
 void AdminServer::send_response(int fd, int status_code, std::string_view content_type,
                                 std::string_view body) {
     std::ostringstream response;
@@ -22,9 +22,11 @@
 
 #include <atomic>
 #include <memory>
+#include <string_view>
 #include <system_error>
 
 #include "../control/config.hpp"
+#include "../control/prometheus.hpp"
 #include "../gateway/upstream.hpp"
 #include "jwt_revocation.hpp"
 
@@ -68,6 +70,10 @@ private:
     std::atomic<bool> running_{false};
     uint32_t worker_id_ = 0;  // Which worker is this admin server for (0 for global)
 
+    // Reused across scrapes; its buffer keeps capacity so steady-state
+    // /metrics responses render without allocation
+    control::ExpositionWriter exposition_writer_;
+
     /// Handle single client connection (blocking)
     void handle_connection(int client_fd);
 
@@ -82,6 +88,18 @@ private:
     /// Send HTTP response
     void send_response(int fd, int status_code, std::string_view content_type,
                        std::string_view body);
+
+    /// Stream the /metrics exposition with chunked transfer encoding so the
+    /// full payload is never materialized at once
+    void send_metrics_chunked(int fd);
+
+    /// Dump the worker flight recorder (recent + slowest request traces)
+    /// as JSON
+    void handle_flight_recorder(int fd);
+
+    /// Run the on-demand CPU sampler for ?seconds=N (default 5) and
+    /// return a collapsed-stack profile (blocks this connection)
+    void handle_profile(int fd, std::string_view path);
 };
 
 }  // namespace titan::core
@@ -19,6 +19,7 @@
 #include "compression.hpp"
 
 #include <brotli/encode.h>
+#include <zdict.h>
 #include <zlib.h>
 #include <zstd.h>
 
@@ -128,6 +129,52 @@ void GzipContext::reset() {
     }
 }
 
+void GzipContext::set_level(int level) {
+    if (level == level_) {
+        return;
+    }
+    level_ = level;
+    if (initialized_) {
+        // deflateParams wants a stream at a deflate block boundary; after a
+        // reset the new level sticks for every following stream
+        deflateReset(stream_);
+        deflateParams(stream_, level_, Z_DEFAULT_STRATEGY);
+    }
+}
+
+// ============================================================================
+// ZstdDictionary Implementation
+// ============================================================================
+
+ZstdDictionary::ZstdDictionary(const uint8_t* data, size_t size, int level)
+    : cdict_(ZSTD_createCDict(data, size, std::clamp(level, 1, 22))) {}
+
+ZstdDictionary::~ZstdDictionary() {
+    if (cdict_) {
+        // ZSTD_freeCDict takes a mutable pointer; the const on cdict_ only
+        // reflects that compression never mutates the digested form
+        ZSTD_freeCDict(const_cast<ZSTD_CDict*>(cdict_));
+    }
+}
+
+std::vector<uint8_t> ZstdDictionary::train(const std::vector<uint8_t>& samples,
+                                           const std::vector<size_t>& sample_sizes,
+                                           size_t max_dict_size) {
+    if (samples.empty() || sample_sizes.empty() || max_dict_size == 0) {
+        return {};
+    }
+
+    std::vector<uint8_t> dictionary(max_dict_size);
+    size_t ret = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(), samples.data(),
+                                       sample_sizes.data(), static_cast<unsigned>(sample_sizes.size()));
+    if (ZDICT_isError(ret)) {
+        return {};  // Usually: not enough samples for meaningful training
+    }
+
+    dictionary.resize(ret);
+    return dictionary;
+}
+
 // ============================================================================
 // ZstdContext Implementation
 // ============================================================================
@@ -174,6 +221,35 @@ std::vector<uint8_t> ZstdContext::compress(const uint8_t* data, size_t size) {
     return output;
 }
 
+std::vector<uint8_t> ZstdContext::compress_with_dictionary(const uint8_t* data, size_t size,
+                                                           const ZstdDictionary& dict) {
+    if (!cstream_ || !data || size == 0 || !dict.valid()) {
+        return {};
+    }
+
+    ZSTD_CCtx_reset(cstream_, ZSTD_reset_session_only);
+    ZSTD_CCtx_refCDict(cstream_, dict.handle());
+
+    size_t max_output_size = ZSTD_compressBound(size);
+    std::vector<uint8_t> output(max_output_size);
+
+    ZSTD_inBuffer input = {data, size, 0};
+    ZSTD_outBuffer out = {output.data(), output.size(), 0};
+
+    size_t ret = ZSTD_compressStream2(cstream_, &out, &input, ZSTD_e_end);
+
+    // Drop the dictionary reference so subsequent plain compress calls on
+    // this pooled context don't silently emit dictionary frames
+    ZSTD_CCtx_refCDict(cstream_, nullptr);
+
+    if (ZSTD_isError(ret)) {
+        return {};
+    }
+
+    output.resize(out.pos);
+    return output;
+}
+
 bool ZstdContext::compress_stream(const uint8_t* data, size_t size,
                                   std::function<void(const uint8_t*, size_t)> callback,
                                   bool finish) {
@@ -216,6 +292,16 @@ void ZstdContext::reset() {
     }
 }
 
+void ZstdContext::set_level(int level) {
+    if (level == level_) {
+        return;
+    }
+    level_ = level;
+    if (cstream_) {
+        ZSTD_CCtx_setParameter(cstream_, ZSTD_c_compressionLevel, level_);
+    }
+}
+
 // ============================================================================
 // BrotliContext Implementation
 // ============================================================================
@@ -319,6 +405,10 @@ bool BrotliContext::compress_stream(const uint8_t* data, size_t size,
     return true;
 }
 
+void BrotliContext::set_quality(int quality) {
+    quality_ = quality;  // Applied when the next compress call recreates the encoder
+}
+
 void BrotliContext::reset() {
     if (state_) {
         // Brotli doesn't have a reset function - recreate instance
@@ -31,6 +31,8 @@ struct z_stream_s;
 typedef struct z_stream_s z_stream;
 struct ZSTD_CCtx_s;
 typedef struct ZSTD_CCtx_s ZSTD_CCtx;
+struct ZSTD_CDict_s;
+typedef struct ZSTD_CDict_s ZSTD_CDict;
 struct BrotliEncoderStateStruct;
 typedef struct BrotliEncoderStateStruct BrotliEncoderState;
 
@@ -114,12 +116,50 @@ public:
     /// Get compression level
     [[nodiscard]] int level() const noexcept { return level_; }
 
+    /// Change the compression level in place (no re-init; zlib carries
+    /// deflateParams across deflateReset, so reuse stays cheap)
+    void set_level(int level);
+
 private:
     z_stream* stream_;
     int level_;
     bool initialized_;
 };
 
+/// Pre-digested zstd dictionary (ZSTD_CDict). Immutable after construction
+/// and safe to share across worker threads; the compression level is baked
+/// into the digested form, which is what makes dictionary frames cheap.
+class ZstdDictionary {
+public:
+    /// Digest raw dictionary bytes at the given compression level
+    ZstdDictionary(const uint8_t* data, size_t size, int level);
+
+    ~ZstdDictionary();
+
+    // Non-copyable, non-movable
+    ZstdDictionary(const ZstdDictionary&) = delete;
+    ZstdDictionary& operator=(const ZstdDictionary&) = delete;
+    ZstdDictionary(ZstdDictionary&&) = delete;
+    ZstdDictionary& operator=(ZstdDictionary&&) = delete;
+
+    /// Whether the dictionary digested successfully
+    [[nodiscard]] bool valid() const noexcept { return cdict_ != nullptr; }
+
+    /// Opaque handle for ZSTD_CCtx_refCDict
+    [[nodiscard]] const ZSTD_CDict* handle() const noexcept { return cdict_; }
+
+    /// Train a dictionary from concatenated sample bodies (ZDICT).
+    /// `sample_sizes` gives the length of each sample within `samples`.
+    /// Returns the raw dictionary bytes, or an empty vector on failure
+    /// (ZDICT needs enough distinct samples to find shared history).
+    [[nodiscard]] static std::vector<uint8_t> train(const std::vector<uint8_t>& samples,
+                                                    const std::vector<size_t>& sample_sizes,
+                                                    size_t max_dict_size);
+
+private:
+    const ZSTD_CDict* cdict_;
+};
+
 /// Zstandard compression context (thread-local, reusable)
 class ZstdContext {
 public:
@@ -139,6 +179,12 @@ public:
     /// Returns compressed data or empty vector on error
     [[nodiscard]] std::vector<uint8_t> compress(const uint8_t* data, size_t size);
 
+    /// Compress data against a shared dictionary (single frame). The
+    /// dictionary's baked-in level overrides the context level for this
+    /// frame; the context returns to plain compression afterwards.
+    [[nodiscard]] std::vector<uint8_t> compress_with_dictionary(const uint8_t* data, size_t size,
+                                                                const ZstdDictionary& dict);
+
     /// Compress data with streaming (callback invoked for each chunk)
     /// Returns true on success, false on error
     [[nodiscard]] bool compress_stream(const uint8_t* data, size_t size,
@@ -151,6 +197,10 @@ public:
     /// Get compression level
     [[nodiscard]] int level() const noexcept { return level_; }
 
+    /// Change the compression level in place (a context parameter; takes
+    /// effect on the next frame)
+    void set_level(int level);
+
 private:
     ZSTD_CCtx* cstream_;
     int level_;
@@ -187,6 +237,10 @@ public:
     /// Get quality level
     [[nodiscard]] int quality() const noexcept { return quality_; }
 
+    /// Change the quality in place (the encoder instance is recreated per
+    /// compress call anyway, so this is just the stored parameter)
+    void set_quality(int quality);
+
 private:
     BrotliEncoderState* state_;
     int quality_;
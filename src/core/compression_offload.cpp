@@ -0,0 +1,150 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Compression Offload Pool - Implementation
+
+#include "compression_offload.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+
+namespace titan::core {
+
+namespace {
+
+/// Compress a job's input on a compressor thread. Contexts are
+/// thread-local to the compressor threads (same pooling pattern as the
+/// middleware's worker-side contexts).
+[[nodiscard]] std::vector<uint8_t> compress_job(const CompressionJob& job) {
+    switch (job.encoding) {
+        case CompressionEncoding::GZIP: {
+            static thread_local GzipContext gzip(6);
+            gzip.set_level(job.level);
+            return gzip.compress(job.input.data(), job.input.size());
+        }
+        case CompressionEncoding::ZSTD: {
+            static thread_local ZstdContext zstd(5);
+            zstd.set_level(job.level);
+            return zstd.compress(job.input.data(), job.input.size());
+        }
+        case CompressionEncoding::BROTLI: {
+            static thread_local BrotliContext brotli(4);
+            brotli.set_quality(job.level);
+            return brotli.compress(job.input.data(), job.input.size());
+        }
+        default:
+            return {};
+    }
+}
+
+}  // namespace
+
+CompressionOffloadPool& CompressionOffloadPool::instance() {
+    static CompressionOffloadPool pool;
+    return pool;
+}
+
+CompressionOffloadPool::~CompressionOffloadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto& thread : threads_) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+void CompressionOffloadPool::ensure_started(size_t threads, size_t max_inflight) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (started_ || stopping_) {
+        return;
+    }
+
+    started_ = true;
+    max_inflight_ = std::max<size_t>(1, max_inflight);
+
+    size_t count = std::clamp<size_t>(threads, 1, 16);
+    threads_.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        threads_.emplace_back([this] { worker_loop(); });
+    }
+}
+
+bool CompressionOffloadPool::has_capacity() const noexcept {
+    return inflight_.load(std::memory_order_relaxed) < max_inflight_;
+}
+
+bool CompressionOffloadPool::submit(std::unique_ptr<CompressionJob>& job) {
+    if (!job) {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!started_ || stopping_) {
+            return false;
+        }
+        if (inflight_.load(std::memory_order_relaxed) >= max_inflight_) {
+            return false;  // Cap reached - caller falls back to inline/identity
+        }
+        inflight_.fetch_add(1, std::memory_order_relaxed);
+        queue_.push_back(std::move(job));
+    }
+    cv_.notify_one();
+    return true;
+}
+
+void CompressionOffloadPool::worker_loop() {
+    for (;;) {
+        std::unique_ptr<CompressionJob> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (stopping_) {
+                return;  // Queued jobs are abandoned; workers time out fds
+            }
+            job = std::move(queue_.front());
+            queue_.erase(queue_.begin());
+        }
+
+        job->output = compress_job(*job);
+        if (!job->output.empty()) {
+            // Release the (large) input early; on failure it is kept so
+            // the worker can still send the identity body
+            job->input.clear();
+            job->input.shrink_to_fit();
+        }
+
+        CompressionCompletionQueue* completions = job->completions;
+        int wake_fd = job->wake_eventfd;
+        {
+            std::lock_guard<std::mutex> lock(completions->mutex);
+            completions->done.push_back(std::move(job));
+        }
+        inflight_.fetch_sub(1, std::memory_order_relaxed);
+
+        // Wake the owning worker's event loop
+        uint64_t one = 1;
+        ssize_t n = write(wake_fd, &one, sizeof(one));
+        (void)n;  // EAGAIN means the counter is already nonzero - still wakes
+    }
+}
+
+}  // namespace titan::core
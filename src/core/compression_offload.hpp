@@ -0,0 +1,106 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Compression Offload Pool - Header
+// Dedicated compressor threads for large response bodies, so brotli/zstd
+// on multi-megabyte payloads never stalls a worker's event loop
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "compression.hpp"
+
+namespace titan::core {
+
+/// One offloaded compression job. The submitting worker fills the input
+/// and routing fields; a compressor thread fills the output and delivers
+/// the job back through the worker's completion queue.
+struct CompressionJob {
+    // Filled by the submitting worker
+    int client_fd = -1;
+    uint64_t client_generation = 0;  // Guards against fd reuse while offloaded
+    bool keep_alive = false;
+    CompressionEncoding encoding = CompressionEncoding::NONE;
+    int level = 0;
+    std::vector<uint8_t> input;
+    size_t input_size = 0;  // Original body size (input is freed on success)
+
+    // Completion routing back to the owning worker
+    int wake_eventfd = -1;
+    struct CompressionCompletionQueue* completions = nullptr;
+
+    // Filled by the compressor thread (empty on failure; input is kept
+    // intact on failure so the worker can fall back to identity)
+    std::vector<uint8_t> output;
+};
+
+/// Per-worker completion mailbox. Compressor threads push finished jobs
+/// and signal the worker's eventfd; the worker drains it from its loop.
+struct CompressionCompletionQueue {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<CompressionJob>> done;
+};
+
+/// Process-wide pool of compressor threads. Workers submit whole-body
+/// jobs (a queue push - the event loop never blocks on compression) and
+/// get woken via eventfd when the compressed body is ready. In-flight
+/// jobs are capped to bound the memory pinned in offloaded bodies.
+class CompressionOffloadPool {
+public:
+    [[nodiscard]] static CompressionOffloadPool& instance();
+
+    ~CompressionOffloadPool();
+
+    // Non-copyable, non-movable
+    CompressionOffloadPool(const CompressionOffloadPool&) = delete;
+    CompressionOffloadPool& operator=(const CompressionOffloadPool&) = delete;
+
+    /// Start the compressor threads (idempotent; first caller's sizing wins)
+    void ensure_started(size_t threads, size_t max_inflight);
+
+    /// Whether a submit would currently be accepted (racy by nature - a
+    /// cheap pre-check so the middleware can skip marking responses for
+    /// offload when the pool is saturated)
+    [[nodiscard]] bool has_capacity() const noexcept;
+
+    /// Queue a job. On success the pool owns the job and `job` is null;
+    /// on rejection (cap reached or pool not started) `job` is untouched
+    /// so the caller can compress inline or send identity.
+    [[nodiscard]] bool submit(std::unique_ptr<CompressionJob>& job);
+
+private:
+    CompressionOffloadPool() = default;
+
+    void worker_loop();
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<std::thread> threads_;
+    std::vector<std::unique_ptr<CompressionJob>> queue_;
+    std::atomic<size_t> inflight_{0};  // Submitted but not yet delivered
+    size_t max_inflight_ = 0;
+    bool started_ = false;
+    bool stopping_ = false;
+};
+
+}  // namespace titan::core
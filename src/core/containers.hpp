@@ -2,6 +2,11 @@
 
 #include <ankerl/unordered_dense.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 namespace titan::core {
 
 // High-performance container type aliases using ankerl::unordered_dense
@@ -35,4 +40,106 @@ using fast_set = ankerl::unordered_dense::set<Key>;
 // template <typename Key>
 // using large_set = ankerl::unordered_dense::segmented_set<Key>;
 
+/// Flat slot table indexed directly by file descriptor.
+///
+/// File descriptors are small dense integers bounded by RLIMIT_NOFILE, so a
+/// vector indexed by fd beats hashing: O(1) lookup with no hash, no probe
+/// sequence, and no rehash pauses at high connection counts. Each slot carries
+/// a generation counter bumped on every insert and erase; code that holds an
+/// fd across event-loop iterations (timers, async completions) can capture
+/// generation(fd) and compare later to detect that the fd was closed and
+/// reused by a new connection.
+///
+/// The table grows on demand to the highest fd seen and never shrinks -
+/// at 64K fds the slot overhead is a few MB per worker, which is noise next
+/// to the per-connection buffers.
+template <typename T>
+class FdTable {
+public:
+    /// Look up value by fd; nullptr if the slot is empty
+    [[nodiscard]] T* find(int fd) noexcept {
+        if (fd < 0 || static_cast<size_t>(fd) >= slots_.size() || !slots_[fd].occupied) {
+            return nullptr;
+        }
+        return &slots_[fd].value;
+    }
+
+    [[nodiscard]] const T* find(int fd) const noexcept {
+        return const_cast<FdTable*>(this)->find(fd);
+    }
+
+    /// Insert or overwrite; matches map operator[] semantics
+    T& operator[](int fd) {
+        ensure_capacity(fd);
+        auto& slot = slots_[fd];
+        if (!slot.occupied) {
+            slot.occupied = true;
+            ++slot.generation;
+            ++size_;
+        }
+        return slot.value;
+    }
+
+    void erase(int fd) noexcept {
+        if (fd < 0 || static_cast<size_t>(fd) >= slots_.size() || !slots_[fd].occupied) {
+            return;
+        }
+        slots_[fd].occupied = false;
+        ++slots_[fd].generation;
+        slots_[fd].value = T{};  // Release owned resources eagerly
+        --size_;
+    }
+
+    /// Generation counter for stale-fd detection (0 if fd never seen)
+    [[nodiscard]] uint32_t generation(int fd) const noexcept {
+        if (fd < 0 || static_cast<size_t>(fd) >= slots_.size()) {
+            return 0;
+        }
+        return slots_[fd].generation;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    void clear() noexcept {
+        for (auto& slot : slots_) {
+            if (slot.occupied) {
+                slot.occupied = false;
+                ++slot.generation;
+                slot.value = T{};
+            }
+        }
+        size_ = 0;
+    }
+
+    /// Visit every occupied slot as (fd, value&). Safe against erasure of the
+    /// visited slot, but not against inserts that grow the table.
+    template <typename Fn>
+    void for_each(Fn&& fn) {
+        for (size_t fd = 0; fd < slots_.size(); ++fd) {
+            if (slots_[fd].occupied) {
+                fn(static_cast<int>(fd), slots_[fd].value);
+            }
+        }
+    }
+
+private:
+    struct Slot {
+        T value{};
+        uint32_t generation = 0;
+        bool occupied = false;
+    };
+
+    void ensure_capacity(int fd) {
+        if (static_cast<size_t>(fd) >= slots_.size()) {
+            // Grow in chunks to amortize; fds arrive roughly densely anyway
+            size_t new_size = std::max(static_cast<size_t>(fd) + 1, slots_.size() * 2);
+            slots_.resize(std::max(new_size, size_t{64}));
+        }
+    }
+
+    std::vector<Slot> slots_;
+    size_t size_ = 0;
+};
+
 }  // namespace titan::core
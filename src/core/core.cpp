@@ -22,12 +22,77 @@
 #ifdef __linux__
 #include <pthread.h>
 #include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 #endif
 
+#include <cstdlib>
+#include <fstream>
+#include <string>
 #include <thread>
+#include <vector>
 
 namespace titan::core {
 
+namespace {
+
+#ifdef __linux__
+
+/// CPU topology read once from sysfs (no libnuma dependency)
+struct NumaTopology {
+    std::vector<std::vector<uint32_t>> node_cpus;  // node id -> cpus
+    std::vector<int> cpu_node;                     // cpu -> node id (-1 unknown)
+};
+
+const NumaTopology& numa_topology() {
+    static const NumaTopology topology = [] {
+        NumaTopology t;
+        for (uint32_t node = 0;; ++node) {
+            std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(node) +
+                                  "/cpulist");
+            if (!cpulist.is_open()) {
+                break;
+            }
+            std::string line;
+            std::getline(cpulist, line);
+
+            // Parse a kernel cpulist: "0-3,8-11" (ranges and singles)
+            std::vector<uint32_t> cpus;
+            const char* p = line.c_str();
+            while (*p != '\0') {
+                char* end = nullptr;
+                unsigned long first = std::strtoul(p, &end, 10);
+                if (end == p) {
+                    break;
+                }
+                unsigned long last = first;
+                if (*end == '-') {
+                    p = end + 1;
+                    last = std::strtoul(p, &end, 10);
+                }
+                for (unsigned long cpu = first; cpu <= last; ++cpu) {
+                    cpus.push_back(static_cast<uint32_t>(cpu));
+                    if (t.cpu_node.size() <= cpu) {
+                        t.cpu_node.resize(cpu + 1, -1);
+                    }
+                    t.cpu_node[cpu] = static_cast<int>(node);
+                }
+                if (*end != ',') {
+                    break;
+                }
+                p = end + 1;
+            }
+            t.node_cpus.push_back(std::move(cpus));
+        }
+        return t;
+    }();
+    return topology;
+}
+
+#endif  // __linux__
+
+}  // namespace
+
 std::error_code pin_thread_to_core(uint32_t core_id) {
 #ifdef __linux__
     cpu_set_t cpuset;
@@ -51,4 +116,59 @@ uint32_t get_cpu_count() {
     return std::thread::hardware_concurrency();
 }
 
+uint32_t get_numa_node_count() {
+#ifdef __linux__
+    size_t nodes = numa_topology().node_cpus.size();
+    return nodes > 0 ? static_cast<uint32_t>(nodes) : 1;
+#else
+    return 1;
+#endif
+}
+
+int get_numa_node_of_cpu(uint32_t cpu) {
+#ifdef __linux__
+    const auto& cpu_node = numa_topology().cpu_node;
+    return cpu < cpu_node.size() ? cpu_node[cpu] : -1;
+#else
+    (void)cpu;
+    return -1;
+#endif
+}
+
+NumaPlacement numa_worker_placement(uint32_t worker_id) {
+#ifdef __linux__
+    const auto& topology = numa_topology();
+    uint32_t nodes = static_cast<uint32_t>(topology.node_cpus.size());
+    if (nodes >= 2) {
+        uint32_t node = worker_id % nodes;
+        const auto& cpus = topology.node_cpus[node];
+        if (!cpus.empty()) {
+            return NumaPlacement{cpus[(worker_id / nodes) % cpus.size()],
+                                 static_cast<int>(node)};
+        }
+    }
+#endif
+    // Single node or topology unavailable: identity placement, no binding
+    return NumaPlacement{worker_id, -1};
+}
+
+std::error_code bind_memory_to_node(int node) {
+#if defined(__linux__) && defined(SYS_set_mempolicy)
+    if (node < 0 || static_cast<size_t>(node) >= sizeof(unsigned long) * 8) {
+        return std::make_error_code(std::errc::invalid_argument);
+    }
+    // MPOL_PREFERRED (linux/mempolicy.h): allocate on this node, fall
+    // back to others under pressure - never OOM a worker over locality
+    constexpr long kMpolPreferred = 1;
+    unsigned long nodemask = 1UL << node;
+    if (syscall(SYS_set_mempolicy, kMpolPreferred, &nodemask, sizeof(nodemask) * 8) != 0) {
+        return std::error_code(errno, std::system_category());
+    }
+    return {};
+#else
+    (void)node;
+    return std::make_error_code(std::errc::not_supported);
+#endif
+}
+
 }  // namespace titan::core
@@ -30,4 +30,27 @@ namespace titan::core {
 /// Get number of available CPU cores
 [[nodiscard]] uint32_t get_cpu_count();
 
+/// NUMA placement for one worker: the core to pin to and its memory
+/// node. node is -1 when the topology is unknown or single-node, in
+/// which case cpu falls back to the worker index (previous behavior).
+struct NumaPlacement {
+    uint32_t cpu = 0;
+    int node = -1;
+};
+
+/// Number of NUMA nodes with CPUs (1 when topology is unavailable)
+[[nodiscard]] uint32_t get_numa_node_count();
+
+/// NUMA node owning a CPU, or -1 if unknown
+[[nodiscard]] int get_numa_node_of_cpu(uint32_t cpu);
+
+/// Spread workers round-robin across NUMA nodes: worker i lands on node
+/// i % nodes, filling each node's cores in order
+[[nodiscard]] NumaPlacement numa_worker_placement(uint32_t worker_id);
+
+/// Prefer the given node for this thread's future page allocations
+/// (set_mempolicy MPOL_PREFERRED). Arenas, pools and buffers built on a
+/// worker thread after this call are first-touched on the local node.
+[[nodiscard]] std::error_code bind_memory_to_node(int node);
+
 }  // namespace titan::core
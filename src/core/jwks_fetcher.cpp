@@ -30,6 +30,7 @@
 #include <cmath>
 #include <ctime>
 #include <nlohmann/json.hpp>
+#include <random>
 
 namespace titan::core {
 
@@ -76,10 +77,10 @@ void JwksFetcher::start() {
         return;  // Already running
     }
 
-    // Fetch keys immediately on start
-    (void)fetch_keys();  // Ignore return value - errors logged internally
-
-    // Start background thread
+    // All fetching happens on the refresher thread, including the first
+    // fetch - start() never blocks on the IdP. Until the first snapshot is
+    // published, get_keys() returns the empty manager and validators fall
+    // back to static keys.
     fetch_thread_ = std::make_unique<std::thread>(&JwksFetcher::fetch_loop, this);
 }
 
@@ -98,17 +99,39 @@ std::shared_ptr<KeyManager> JwksFetcher::get_keys() const {
 }
 
 void JwksFetcher::fetch_loop() {
+    // First fetch runs here so startup never waits on the IdP
+    bool last_fetch_ok = fetch_keys();
+    uint32_t failed_attempts = last_fetch_ok ? 0 : 1;
+
+    std::mt19937 rng(std::random_device{}());
+
     while (running_) {
-        // Sleep for refresh interval
-        for (uint32_t i = 0; i < config_.refresh_interval_seconds && running_; ++i) {
+        uint32_t delay_seconds;
+        if (last_fetch_ok) {
+            // Prefetch ahead of the nominal interval with jitter (80-95%)
+            // so keys rotate before consumers would notice staleness and
+            // gateway instances don't stampede the IdP in lockstep
+            std::uniform_real_distribution<double> jitter(0.80, 0.95);
+            delay_seconds = std::max<uint32_t>(
+                1, static_cast<uint32_t>(static_cast<double>(config_.refresh_interval_seconds) *
+                                         jitter(rng)));
+        } else {
+            // Retry failures on an exponential backoff instead of waiting
+            // out the whole interval; the last good snapshot keeps serving
+            // (stale-while-revalidate) the entire time
+            delay_seconds = std::max<uint32_t>(1, calculate_backoff(failed_attempts));
+        }
+
+        // Sleep in 1s ticks so stop() stays responsive
+        for (uint32_t i = 0; i < delay_seconds && running_; ++i) {
             std::this_thread::sleep_for(std::chrono::seconds(1));
         }
 
         if (!running_)
             break;
 
-        // Fetch keys
-        (void)fetch_keys();  // Ignore return value - errors logged internally
+        last_fetch_ok = fetch_keys();
+        failed_attempts = last_fetch_ok ? 0 : failed_attempts + 1;
     }
 }
 
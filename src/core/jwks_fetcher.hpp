@@ -67,7 +67,14 @@ struct JsonWebKey {
     [[nodiscard]] static std::optional<JsonWebKey> parse(const std::string& json);
 };
 
-/// JWKS fetcher (background thread fetches keys periodically)
+/// JWKS fetcher (dedicated refresher thread publishes immutable key-set
+/// snapshots via RCU - same pattern as config hot swap)
+///
+/// Validation never blocks on or observes a fetch: get_keys() always
+/// returns the last published snapshot, which keeps serving while a
+/// refresh is in flight (stale-while-revalidate). The refresher
+/// prefetches ahead of the nominal interval with jitter and retries
+/// failures on an exponential backoff.
 class JwksFetcher {
 public:
     explicit JwksFetcher(JwksConfig config);
@@ -79,13 +86,15 @@ public:
     JwksFetcher(JwksFetcher&&) = delete;
     JwksFetcher& operator=(JwksFetcher&&) = delete;
 
-    /// Start background fetcher thread
+    /// Start the refresher thread (returns immediately; the first fetch
+    /// runs on the refresher, so startup never waits on the IdP)
     void start();
 
     /// Stop background fetcher thread
     void stop();
 
-    /// Fetch keys synchronously (blocking, called by background thread)
+    /// Fetch and publish one key-set snapshot (blocking; runs on the
+    /// refresher thread - exposed for tests and manual refresh)
     [[nodiscard]] bool fetch_keys();
 
     /// Get current key manager (RCU read, thread-safe)
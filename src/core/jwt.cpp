@@ -33,6 +33,7 @@
 #include <fstream>
 #include <sstream>
 
+#include "../http/simd.hpp"
 #include "jwks_fetcher.hpp"
 
 namespace titan::core {
@@ -71,34 +72,27 @@ std::string base64url_encode(std::string_view input) {
 }
 
 std::optional<std::string> base64url_decode(std::string_view input) {
+    // Strip any trailing padding: JWT segments are unpadded (RFC 7515), but
+    // config-supplied secrets sometimes arrive padded.
+    while (!input.empty() && input.back() == '=') {
+        input.remove_suffix(1);
+    }
     if (input.empty()) {
         return "";
     }
 
-    // Convert base64url to standard base64
-    std::string base64(input);
-    std::replace(base64.begin(), base64.end(), '-', '+');
-    std::replace(base64.begin(), base64.end(), '_', '/');
-
-    // Add padding if needed
-    size_t padding = (4 - (base64.size() % 4)) % 4;
-    base64.append(padding, '=');
-
-    // Decode base64
-    BIO* b64 = BIO_new(BIO_f_base64());
-    BIO* bmem = BIO_new_mem_buf(base64.data(), static_cast<int>(base64.size()));
-    bmem = BIO_push(b64, bmem);
-    BIO_set_flags(bmem, BIO_FLAGS_BASE64_NO_NL);
-
-    std::vector<char> buffer(base64.size());
-    int decoded_size = BIO_read(bmem, buffer.data(), static_cast<int>(buffer.size()));
-    BIO_free_all(bmem);
-
-    if (decoded_size < 0) {
+    // SIMD decode (AVX2 with scalar fallback) - this runs three times per
+    // cache-miss token validation, so the old OpenSSL BIO chain was pure
+    // overhead.
+    std::string result;
+    result.resize((input.size() / 4) * 3 + 2);
+    size_t decoded = http::simd::base64url_decode(input.data(), input.size(),
+                                                  reinterpret_cast<uint8_t*>(result.data()));
+    if (decoded == SIZE_MAX) {
         return std::nullopt;
     }
-
-    return std::string(buffer.data(), decoded_size);
+    result.resize(decoded);
+    return result;
 }
 
 // ============================================================================
@@ -448,6 +442,60 @@ size_t ThreadLocalTokenCache::calculate_token_size(std::string_view token,
     return size;
 }
 
+// ============================================================================
+// SharedTokenCache Implementation
+// ============================================================================
+
+SharedTokenCache& SharedTokenCache::instance() {
+    static SharedTokenCache cache;
+    return cache;
+}
+
+std::optional<ThreadLocalTokenCache::CachedToken> SharedTokenCache::get(std::string_view token) {
+    Shard& shard = shard_for(token);
+    std::shared_lock lock(shard.mutex);
+    auto it = shard.entries.find(token);
+    if (it == shard.entries.end()) {
+        return std::nullopt;
+    }
+    return it->second;  // Copy under the read lock
+}
+
+void SharedTokenCache::put(std::string_view token, const JwtClaims& claims) {
+    if (token.size() > MAX_JWT_TOKEN_SIZE) {
+        return;
+    }
+    Shard& shard = shard_for(token);
+    std::unique_lock lock(shard.mutex);
+    if (shard.entries.size() >= kMaxEntriesPerShard && !shard.entries.contains(token)) {
+        // Full: reclaim expired entries first (bounded scan), otherwise
+        // drop an arbitrary one - the L1 caches keep genuinely hot
+        // tokens warm regardless of what L2 evicts
+        auto now = std::time(nullptr);
+        size_t scanned = 0;
+        for (auto it = shard.entries.begin(); it != shard.entries.end() && scanned < 64;) {
+            if (it->second.claims.exp > 0 && it->second.claims.exp < now) {
+                it = shard.entries.erase(it);
+            } else {
+                ++it;
+                ++scanned;
+            }
+        }
+        if (shard.entries.size() >= kMaxEntriesPerShard) {
+            shard.entries.erase(shard.entries.begin());
+        }
+    }
+    shard.entries.insert_or_assign(std::string(token),
+                                   ThreadLocalTokenCache::CachedToken{claims, std::time(nullptr)});
+}
+
+void SharedTokenCache::clear() {
+    for (auto& shard : shards_) {
+        std::unique_lock lock(shard.mutex);
+        shard.entries.clear();
+    }
+}
+
 // ============================================================================
 // JwtValidator Implementation
 // ============================================================================
@@ -472,12 +520,30 @@ ValidationResult JwtValidator::validate(std::string_view token) {
         }
     }
 
-    // Cache miss - full validation
+    // L1 miss - consult the shared L2 before paying for signature
+    // verification (another worker may have verified this token already)
+    if (config_.cache_enabled) {
+        if (auto shared = SharedTokenCache::instance().get(token)) {
+            auto now = std::time(nullptr);
+            if (shared->claims.exp > 0 && shared->claims.exp < now) {
+                return ValidationResult::failure("Token expired");
+            }
+            if (cache_) {
+                cache_->put(token, shared->claims);  // Warm the L1
+            }
+            return ValidationResult::success(shared->claims);
+        }
+    }
+
+    // Both caches missed - full validation
     auto result = validate_uncached(token);
 
-    // Cache successful validations
-    if (result.valid && cache_) {
-        cache_->put(token, result.claims);
+    // Cache successful validations locally and publish for other workers
+    if (result.valid && config_.cache_enabled) {
+        if (cache_) {
+            cache_->put(token, result.claims);
+        }
+        SharedTokenCache::instance().put(token, result.claims);
     }
 
     return result;
@@ -766,6 +832,15 @@ std::shared_ptr<KeyManager> JwtValidator::get_merged_keys() {
         return jwks_keys;
     }
 
+    // The merge runs on every cache-miss validation, so reuse the last
+    // merged manager (with its fully constructed EVP_PKEY objects) until the
+    // JWKS snapshot actually rotates. Pointer identity doubles as the
+    // generation: the fetcher publishes a fresh KeyManager on every refresh.
+    // Validators are per-worker (like the token cache), so no locking.
+    if (merged_keys_cache_ && merged_keys_source_ == jwks_keys) {
+        return merged_keys_cache_;
+    }
+
     // MERGE: Create new KeyManager with JWKS keys + static keys
     // JWKS keys take precedence (added first, checked first by KeyManager::get_key)
     auto merged = std::make_shared<KeyManager>();
@@ -786,6 +861,8 @@ std::shared_ptr<KeyManager> JwtValidator::get_merged_keys() {
         }
     }
 
+    merged_keys_source_ = jwks_keys;
+    merged_keys_cache_ = merged;
     return merged;
 }
 
@@ -22,12 +22,14 @@
 #include <openssl/evp.h>
 #include <openssl/rsa.h>
 
+#include <array>
 #include <cstdint>
 #include <ctime>
 #include <list>
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <optional>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -210,6 +212,63 @@ private:
     titan::core::fast_map<std::string, decltype(lru_list_)::iterator> cache_;
 };
 
+/// Process-wide second-level token cache behind the per-thread L1s
+///
+/// Signature verification is the most expensive per-request CPU item, and
+/// ThreadLocalTokenCache is per worker: on an N-worker box the same token
+/// used to be verified up to N times, and every L1 starts cold after a
+/// reload. Workers consult this cache on L1 miss and publish successful
+/// verifications to it, so each token is verified once per process.
+/// Sharded by token hash with reader-writer locks per shard - the L1
+/// absorbs the hot path, so L2 traffic is miss-rate only and readers
+/// never contend across shards.
+class SharedTokenCache {
+public:
+    [[nodiscard]] static SharedTokenCache& instance();
+
+    /// Copy of the cached entry, or nullopt on miss (expiry is the
+    /// caller's check - it also rejects stale L1 hits the same way)
+    [[nodiscard]] std::optional<ThreadLocalTokenCache::CachedToken> get(std::string_view token);
+
+    /// Publish a successfully verified token for other workers
+    void put(std::string_view token, const JwtClaims& claims);
+
+    /// Drop everything (key rotation, revocation sweep)
+    void clear();
+
+    // Shared across workers - not copyable
+    SharedTokenCache(const SharedTokenCache&) = delete;
+    SharedTokenCache& operator=(const SharedTokenCache&) = delete;
+
+private:
+    SharedTokenCache() = default;
+
+    static constexpr size_t kShardCount = 16;        // Power of two (hash & mask)
+    static constexpr size_t kMaxEntriesPerShard = 4096;
+
+    /// Heterogeneous lookup: string_view probes against std::string keys
+    struct TokenHash {
+        using is_transparent = void;
+        using is_avalanching = void;
+        [[nodiscard]] uint64_t operator()(std::string_view token) const noexcept {
+            return ankerl::unordered_dense::hash<std::string_view>{}(token);
+        }
+    };
+
+    struct Shard {
+        std::shared_mutex mutex;
+        ankerl::unordered_dense::map<std::string, ThreadLocalTokenCache::CachedToken, TokenHash,
+                                     std::equal_to<>>
+            entries;
+    };
+
+    [[nodiscard]] Shard& shard_for(std::string_view token) noexcept {
+        return shards_[TokenHash{}(token) & (kShardCount - 1)];
+    }
+
+    std::array<Shard, kShardCount> shards_;
+};
+
 /// JWT validator configuration
 struct JwtValidatorConfig {
     // Claims validation
@@ -250,6 +309,14 @@ public:
     /// Get cache statistics
     [[nodiscard]] size_t cache_size() const noexcept { return cache_ ? cache_->size() : 0; }
 
+    /// Drop this worker's L1 token cache (key rotation via config reload -
+    /// cached verifications were made against the old keys)
+    void clear_cache() {
+        if (cache_) {
+            cache_->clear();
+        }
+    }
+
 private:
     /// Validate token without cache (full validation)
     [[nodiscard]] ValidationResult validate_uncached(std::string_view token);
@@ -268,6 +335,11 @@ private:
     std::shared_ptr<KeyManager> static_keys_;    // Static keys from config
     std::shared_ptr<JwksFetcher> jwks_fetcher_;  // Dynamic JWKS fetcher (optional)
     std::unique_ptr<ThreadLocalTokenCache> cache_;
+
+    // Cached JWKS+static merge, rebuilt only when the JWKS snapshot rotates
+    // (merged_keys_source_ tracks the snapshot the cache was built from)
+    std::shared_ptr<KeyManager> merged_keys_cache_;
+    std::shared_ptr<KeyManager> merged_keys_source_;
 };
 
 // Utility functions
@@ -108,11 +108,29 @@ bool RevocationQueue::has_pending() const noexcept {
 void RevocationList::revoke(std::string_view jti, uint64_t exp) {
     // Insert or update expiration time
     blacklist_[std::string(jti)] = exp;
+
+    // Keep the Bloom front in sync: filters don't delete, so growth past
+    // the sized capacity means a rebuild at double size; otherwise a plain
+    // insert (re-revocations just set already-set bits)
+    if (blacklist_.size() > bloom_.capacity()) {
+        bloom_.reset(blacklist_.size() * 2);
+        rebuild_filter();
+    } else {
+        bloom_.insert(jti);
+    }
 }
 
-bool RevocationList::is_revoked(std::string_view jti) const noexcept {
-    // O(1) hash lookup
-    return blacklist_.find(std::string(jti)) != blacklist_.end();
+RevocationList::ProbeResult RevocationList::check(std::string_view jti) const noexcept {
+    // Fast path: one cache-line probe, no allocation, no hash-map touch
+    if (!bloom_.may_contain(jti)) {
+        return ProbeResult::BloomNegative;
+    }
+
+    // Filter hit: confirm against the exact structure
+    if (blacklist_.find(std::string(jti)) != blacklist_.end()) {
+        return ProbeResult::Revoked;
+    }
+    return ProbeResult::FalsePositive;
 }
 
 void RevocationList::sync_from_queue(RevocationQueue& queue) {
@@ -133,9 +151,22 @@ void RevocationList::sync_from_queue(RevocationQueue& queue) {
 void RevocationList::cleanup_expired(uint64_t current_time_seconds) {
     // Remove entries where exp < current_time
     // Use erase_if (C++20) for efficient removal
-    std::erase_if(blacklist_, [current_time_seconds](const auto& pair) {
+    size_t erased = std::erase_if(blacklist_, [current_time_seconds](const auto& pair) {
         return pair.second < current_time_seconds;  // exp < now
     });
+
+    // Bloom filters can't unset bits; rebuild so expired jtis stop
+    // costing exact lookups as false positives
+    if (erased > 0) {
+        bloom_.reset(blacklist_.size());
+        rebuild_filter();
+    }
+}
+
+void RevocationList::rebuild_filter() {
+    for (const auto& [jti, exp] : blacklist_) {
+        bloom_.insert(jti);
+    }
 }
 
 }  // namespace titan::core
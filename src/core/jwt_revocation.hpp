@@ -28,7 +28,9 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <bit>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -82,6 +84,84 @@ private:
     std::atomic<size_t> size_{0};       // Approximate size for has_pending()
 };
 
+/// Split-block Bloom filter over jti strings (Putze et al. blocked bloom)
+///
+/// Each key maps to one 32-byte block and sets one bit in each of the
+/// block's eight 32-bit words, so a probe touches a single cache line.
+/// Sized at ~16 bits per key (16 keys per block) the false-positive rate
+/// stays well under 1%. No deletion: the owning RevocationList rebuilds
+/// the filter after expiry cleanup.
+class RevocationBloomFilter {
+public:
+    static constexpr size_t kKeysPerBlock = 16;
+
+    /// Clear and resize for the expected number of keys (rounds the block
+    /// count up to a power of two; a minimum of one block is kept so
+    /// may_contain() never needs an emptiness branch)
+    void reset(size_t expected_keys) {
+        size_t blocks = std::bit_ceil((expected_keys + kKeysPerBlock - 1) / kKeysPerBlock + 1);
+        blocks_.assign(blocks, Block{});
+        block_mask_ = blocks - 1;
+    }
+
+    void insert(std::string_view jti) noexcept {
+        uint64_t hash = hash_jti(jti);
+        Block& block = blocks_[(hash >> 32) & block_mask_];
+        auto h = static_cast<uint32_t>(hash);
+        for (size_t w = 0; w < 8; ++w) {
+            block.words[w] |= uint32_t{1} << ((h * kSalt[w]) >> 27);
+        }
+    }
+
+    /// True if jti may be in the set (false positives possible, never
+    /// false negatives)
+    [[nodiscard]] bool may_contain(std::string_view jti) const noexcept {
+        uint64_t hash = hash_jti(jti);
+        const Block& block = blocks_[(hash >> 32) & block_mask_];
+        auto h = static_cast<uint32_t>(hash);
+        for (size_t w = 0; w < 8; ++w) {
+            if ((block.words[w] & (uint32_t{1} << ((h * kSalt[w]) >> 27))) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Number of keys the filter is sized for (insert beyond this degrades
+    /// the false-positive rate rather than failing)
+    [[nodiscard]] size_t capacity() const noexcept { return blocks_.size() * kKeysPerBlock; }
+
+private:
+    struct alignas(32) Block {
+        std::array<uint32_t, 8> words{};
+    };
+
+    // Odd multipliers spreading one bit into each word (Impala's constants)
+    static constexpr std::array<uint32_t, 8> kSalt = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU,
+                                                      0xa2b7289dU, 0x705495c7U, 0x2df1424bU,
+                                                      0x9efc4947U, 0x5c6bfb31U};
+
+    [[nodiscard]] static uint64_t hash_jti(std::string_view jti) noexcept {
+        // FNV-1a with a murmur3 finalizer: raw FNV diffuses poorly into the
+        // high bits for short similar strings (sequential jtis pile into a
+        // handful of blocks), and the block index comes from those bits
+        uint64_t hash = 1469598103934665603ULL;
+        for (char c : jti) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ULL;
+        }
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    std::vector<Block> blocks_{1};
+    size_t block_mask_ = 0;
+};
+
 /// Thread-local revocation blacklist with automatic cleanup
 /// Each worker thread maintains its own blacklist (shared-nothing design)
 class RevocationList {
@@ -99,9 +179,23 @@ public:
     /// O(1) hash insert
     void revoke(std::string_view jti, uint64_t exp);
 
+    /// Outcome of a revocation probe (see check())
+    enum class ProbeResult : uint8_t {
+        BloomNegative,  // Filter miss: definitely not revoked, no map lookup
+        FalsePositive,  // Filter hit but exact lookup missed
+        Revoked         // Filter hit confirmed by exact lookup
+    };
+
     /// Check if token is revoked
-    /// O(1) hash lookup
-    [[nodiscard]] bool is_revoked(std::string_view jti) const noexcept;
+    /// Common case (not revoked) is a single cache-line Bloom probe;
+    /// only filter hits fall through to the exact hash lookup
+    [[nodiscard]] bool is_revoked(std::string_view jti) const noexcept {
+        return check(jti) == ProbeResult::Revoked;
+    }
+
+    /// Like is_revoked() but reports which path decided, so callers can
+    /// track the filter's observed false-positive rate
+    [[nodiscard]] ProbeResult check(std::string_view jti) const noexcept;
 
     /// Sync from global revocation queue
     /// Drains pending revocations and adds to local blacklist
@@ -117,10 +211,18 @@ public:
     [[nodiscard]] size_t size() const noexcept { return blacklist_.size(); }
 
 private:
+    /// Rebuild the Bloom filter from the current blacklist contents
+    /// (called after cleanup or when the filter outgrows its sizing)
+    void rebuild_filter();
+
     // jti → exp_timestamp
     // Tokens are automatically invalid after exp, but we keep them
     // in blacklist until cleanup_expired() is called
     titan::core::fast_map<std::string, uint64_t> blacklist_;
+
+    // Bloom front for the common not-revoked case; rebuilt on cleanup,
+    // grown when the blacklist exceeds its sized capacity
+    RevocationBloomFilter bloom_;
 };
 
 }  // namespace titan::core
@@ -19,26 +19,196 @@
 
 #include "memory.hpp"
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
 #include <new>
+#include <utility>
 
 namespace titan::core {
 
+namespace hugepages {
+
+namespace {
+
+constexpr size_t kChunkSize = 2 * 1024 * 1024;  // One 2MB hugepage
+
+std::atomic<bool> g_enabled{false};
+std::atomic<size_t> g_hugetlb_bytes{0};
+std::atomic<size_t> g_thp_bytes{0};
+
+#ifdef __linux__
+
+/// Map one chunk: MAP_HUGETLB first, transparent-hugepage fallback when
+/// the hugetlb pool is empty (or unconfigured). nullptr only when plain
+/// anonymous mmap itself fails.
+void* map_chunk(size_t size) {
+#ifdef MAP_HUGETLB
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr != MAP_FAILED) {
+        g_hugetlb_bytes.fetch_add(size, std::memory_order_relaxed);
+        return ptr;
+    }
+#endif
+    void* ptr2 = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr2 == MAP_FAILED) {
+        return nullptr;
+    }
+#ifdef MADV_HUGEPAGE
+    (void)madvise(ptr2, size, MADV_HUGEPAGE);
+#endif
+    g_thp_bytes.fetch_add(size, std::memory_order_relaxed);
+    return ptr2;
+}
+
+/// Per-worker slab: a bump cursor into the current chunk plus per-size
+/// free lists (block sizes here are few and fixed - arena capacities and
+/// pool slabs - so exact-size recycling behaves like a pool). Chunks are
+/// never unmapped.
+struct Slab {
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    std::vector<std::pair<size_t, FreeBlock*>> free_lists;  // (block size, head)
+    std::byte* chunk = nullptr;
+    size_t chunk_off = 0;
+    size_t chunk_cap = 0;
+};
+
+thread_local Slab t_slab;
+
+#endif  // __linux__
+
+}  // namespace
+
+void set_enabled(bool enabled) noexcept {
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool enabled() noexcept {
+#ifdef __linux__
+    return g_enabled.load(std::memory_order_relaxed);
+#else
+    return false;
+#endif
+}
+
+void* allocate(size_t size) {
+#ifdef __linux__
+    size = (size + 63) & ~size_t{63};
+    Slab& slab = t_slab;
+
+    for (auto& [block_size, head] : slab.free_lists) {
+        if (block_size == size && head != nullptr) {
+            Slab::FreeBlock* block = head;
+            head = block->next;
+            return block;
+        }
+    }
+
+    // Blocks bigger than a chunk get a dedicated multi-page mapping; it
+    // recycles through the free list like any other block
+    if (size > kChunkSize) {
+        size_t mapped = (size + kChunkSize - 1) & ~(kChunkSize - 1);
+        void* ptr = map_chunk(mapped);
+        if (!ptr) {
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+
+    if (slab.chunk_off + size > slab.chunk_cap) {
+        // The old chunk's tail (less than one block) is abandoned -
+        // bounded waste, never more than one partial block per chunk
+        void* chunk = map_chunk(kChunkSize);
+        if (!chunk) {
+            throw std::bad_alloc();
+        }
+        slab.chunk = static_cast<std::byte*>(chunk);
+        slab.chunk_off = 0;
+        slab.chunk_cap = kChunkSize;
+    }
+
+    void* ptr = slab.chunk + slab.chunk_off;
+    slab.chunk_off += size;
+    return ptr;
+#else
+    // Non-Linux: enabled() is always false, but keep the contract usable
+    void* ptr = std::aligned_alloc(64, (size + 63) & ~size_t{63});
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+#endif
+}
+
+void deallocate(void* ptr, size_t size) noexcept {
+    if (!ptr) {
+        return;
+    }
+#ifdef __linux__
+    size = (size + 63) & ~size_t{63};
+    Slab& slab = t_slab;
+    for (auto& [block_size, head] : slab.free_lists) {
+        if (block_size == size) {
+            auto* block = static_cast<Slab::FreeBlock*>(ptr);
+            block->next = head;
+            head = block;
+            return;
+        }
+    }
+    auto* block = static_cast<Slab::FreeBlock*>(ptr);
+    block->next = nullptr;
+    slab.free_lists.emplace_back(size, block);
+#else
+    (void)size;
+    std::free(ptr);
+#endif
+}
+
+Residency residency() noexcept {
+    Residency r;
+    r.hugetlb_bytes = g_hugetlb_bytes.load(std::memory_order_relaxed);
+    r.thp_bytes = g_thp_bytes.load(std::memory_order_relaxed);
+    return r;
+}
+
+}  // namespace hugepages
+
 Arena::Arena(size_t initial_size) : initial_size_(initial_size) {
-    // Use aligned_alloc to ensure buffer can satisfy high alignment requirements
     // Align size up to cache line boundary (64 bytes) for better performance
     size_t aligned_size = (initial_size + 63) & ~63;
-    buffer_ = static_cast<std::byte*>(std::aligned_alloc(64, aligned_size));
-    if (!buffer_) {
-        throw std::bad_alloc();
+    if (hugepages::enabled()) {
+        buffer_ = static_cast<std::byte*>(hugepages::allocate(aligned_size));
+        hugepage_ = true;
+    } else {
+        // aligned_alloc ensures the buffer can satisfy high alignment requirements
+        buffer_ = static_cast<std::byte*>(std::aligned_alloc(64, aligned_size));
+        if (!buffer_) {
+            throw std::bad_alloc();
+        }
     }
     capacity_ = aligned_size;
     offset_ = 0;
 }
 
 Arena::~Arena() {
-    if (buffer_) {
+    release_buffer();
+}
+
+void Arena::release_buffer() noexcept {
+    if (!buffer_) {
+        return;
+    }
+    if (hugepage_) {
+        hugepages::deallocate(buffer_, capacity_);
+    } else {
         std::free(buffer_);
     }
 }
@@ -47,26 +217,28 @@ Arena::Arena(Arena&& other) noexcept
     : buffer_(other.buffer_),
       capacity_(other.capacity_),
       offset_(other.offset_),
-      initial_size_(other.initial_size_) {
+      initial_size_(other.initial_size_),
+      hugepage_(other.hugepage_) {
     other.buffer_ = nullptr;
     other.capacity_ = 0;
     other.offset_ = 0;
+    other.hugepage_ = false;
 }
 
 Arena& Arena::operator=(Arena&& other) noexcept {
     if (this != &other) {
-        if (buffer_) {
-            std::free(buffer_);
-        }
+        release_buffer();
 
         buffer_ = other.buffer_;
         capacity_ = other.capacity_;
         offset_ = other.offset_;
         initial_size_ = other.initial_size_;
+        hugepage_ = other.hugepage_;
 
         other.buffer_ = nullptr;
         other.capacity_ = 0;
         other.offset_ = 0;
+        other.hugepage_ = false;
     }
     return *this;
 }
@@ -110,20 +282,109 @@ void Arena::grow(size_t min_size) {
     // Align new capacity to 64-byte boundary
     new_capacity = (new_capacity + 63) & ~63;
 
-    // Can't use realloc with aligned_alloc, must allocate + copy + free
-    std::byte* new_buffer = static_cast<std::byte*>(std::aligned_alloc(64, new_capacity));
-    if (!new_buffer) {
-        throw std::bad_alloc();
+    // Can't realloc either backing, must allocate + copy + free
+    std::byte* new_buffer;
+    bool new_hugepage = hugepages::enabled();
+    if (new_hugepage) {
+        new_buffer = static_cast<std::byte*>(hugepages::allocate(new_capacity));
+    } else {
+        new_buffer = static_cast<std::byte*>(std::aligned_alloc(64, new_capacity));
+        if (!new_buffer) {
+            throw std::bad_alloc();
+        }
     }
 
     // Copy existing data
     std::memcpy(new_buffer, buffer_, offset_);
 
     // Free old buffer
-    std::free(buffer_);
+    release_buffer();
 
     buffer_ = new_buffer;
     capacity_ = new_capacity;
+    hugepage_ = new_hugepage;
+}
+
+int BufferPool::class_index(size_t size) const noexcept {
+    if (size <= kSmall) {
+        return 0;
+    }
+    if (size <= kMedium) {
+        return 1;
+    }
+    if (size <= kLarge) {
+        return 2;
+    }
+    return -1;
+}
+
+std::vector<uint8_t> BufferPool::acquire(size_t size_hint) {
+    int idx = class_index(size_hint);
+    if (idx < 0) {
+        // Oversized request - hand out an exact, unpooled reservation
+        std::vector<uint8_t> buffer;
+        buffer.reserve(size_hint);
+        return buffer;
+    }
+
+    SizeClass& cls = classes_[idx];
+    cls.in_use++;
+    if (cls.in_use > cls.high_watermark) {
+        cls.high_watermark = cls.in_use;
+    }
+
+    if (!cls.free_list.empty()) {
+        std::vector<uint8_t> buffer = std::move(cls.free_list.back());
+        cls.free_list.pop_back();
+        return buffer;
+    }
+
+    std::vector<uint8_t> buffer;
+    buffer.reserve(cls.capacity);
+    return buffer;
+}
+
+void BufferPool::release(std::vector<uint8_t>&& buffer) noexcept {
+    size_t cap = buffer.capacity();
+    for (SizeClass& cls : classes_) {
+        if (cls.capacity == cap) {
+            if (cls.in_use > 0) {
+                cls.in_use--;
+            }
+            buffer.clear();
+            cls.free_list.push_back(std::move(buffer));
+            return;
+        }
+    }
+
+    // Capacity drifted from its class (the buffer grew mid-connection) or
+    // was never pooled - account for the return and let it free normally
+    int idx = class_index(cap);
+    if (idx >= 0 && classes_[idx].in_use > 0) {
+        classes_[idx].in_use--;
+    }
+}
+
+void BufferPool::trim() noexcept {
+    for (SizeClass& cls : classes_) {
+        // Keep enough free buffers to re-reach the recent demand peak
+        // without allocating; everything beyond that goes back to the OS
+        size_t keep =
+            cls.high_watermark > cls.in_use ? cls.high_watermark - cls.in_use : 0;
+        if (cls.free_list.size() > keep) {
+            cls.free_list.resize(keep);
+            cls.free_list.shrink_to_fit();
+        }
+        cls.high_watermark = cls.in_use;
+    }
+}
+
+size_t BufferPool::pooled_bytes() const noexcept {
+    size_t total = 0;
+    for (const SizeClass& cls : classes_) {
+        total += cls.free_list.size() * cls.capacity;
+    }
+    return total;
 }
 
 }  // namespace titan::core
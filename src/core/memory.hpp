@@ -22,11 +22,46 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <new>
 #include <span>
 #include <string_view>
+#include <vector>
 
 namespace titan::core {
 
+/// Hugepage-backed block allocator (opt-in via server.hugepages_enabled)
+///
+/// Per-worker slabs carve 64-byte-aligned blocks out of 2MB chunks mapped
+/// with MAP_HUGETLB, falling back to anonymous mappings with
+/// MADV_HUGEPAGE (transparent hugepages) when the hugetlb pool is empty.
+/// Freed blocks go to per-size free lists on their worker (slabs are
+/// thread-local like everything else on the hot path - allocate and
+/// deallocate must happen on the same thread); chunks are never unmapped,
+/// so the footprint is bounded by each worker's peak usage. Process-wide
+/// counters report residency by backing for the admin metrics endpoint.
+namespace hugepages {
+
+/// Process-wide opt-in; set once at startup before workers spawn
+void set_enabled(bool enabled) noexcept;
+[[nodiscard]] bool enabled() noexcept;
+
+/// Allocate a 64-byte-aligned block (size rounds up to a 64-byte
+/// multiple). Throws std::bad_alloc when no backing can be mapped.
+[[nodiscard]] void* allocate(size_t size);
+
+/// Return a block previously allocated with the same size, on the same
+/// thread
+void deallocate(void* ptr, size_t size) noexcept;
+
+/// Bytes currently mapped per backing (process-wide)
+struct Residency {
+    size_t hugetlb_bytes = 0;  // MAP_HUGETLB chunks
+    size_t thp_bytes = 0;      // MADV_HUGEPAGE fallback chunks
+};
+[[nodiscard]] Residency residency() noexcept;
+
+}  // namespace hugepages
+
 /// Monotonic arena allocator
 /// Allocates memory in a single contiguous buffer, reset per request
 /// No individual deallocation - entire arena is reset at once
@@ -77,10 +112,45 @@ public:
 private:
     void grow(size_t min_size);
 
+    /// Free the current buffer through whichever backing produced it
+    void release_buffer() noexcept;
+
     std::byte* buffer_ = nullptr;
     size_t capacity_ = 0;
     size_t offset_ = 0;
     size_t initial_size_;
+    bool hugepage_ = false;  // Buffer drawn from the hugepage slab
+};
+
+/// STL-compatible allocator backed by an Arena
+/// deallocate() is a no-op - memory is reclaimed wholesale when the arena
+/// resets, so only use this for containers whose lifetime is bounded by one
+/// request (anything that escapes the request must deep-copy first).
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena& arena) noexcept : arena_(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_(other.arena()) {}
+
+    [[nodiscard]] T* allocate(size_t n) {
+        return static_cast<T*>(arena_->allocate(sizeof(T) * n, alignof(T)));
+    }
+
+    void deallocate(T* /*ptr*/, size_t /*n*/) noexcept {}  // Reclaimed on arena reset
+
+    [[nodiscard]] Arena* arena() const noexcept { return arena_; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena_ == other.arena();
+    }
+
+private:
+    Arena* arena_;
 };
 
 /// RAII scope guard for arena reset
@@ -96,13 +166,74 @@ private:
     Arena& arena_;
 };
 
+/// Size-classed pool for connection I/O buffers
+///
+/// Connection churn otherwise frees and reallocates recv/send buffers on
+/// every close/accept, which shows up as large-allocation traffic and an
+/// RSS sawtooth during spikes. The pool recycles buffers in three classes
+/// (16KB / 64KB / 256KB); oversized or odd-capacity buffers (ones that
+/// grew past their class) are simply dropped to the allocator.
+///
+/// Single-threaded by design: one pool per worker, accessed only from
+/// that worker's event loop - no locks.
+///
+/// trim() implements high-watermark trimming: call it periodically (the
+/// Server does, from its timer path) to drop free buffers beyond the
+/// demand peak observed since the previous trim, so memory retained
+/// during a spike is given back once traffic subsides.
+class BufferPool {
+public:
+    static constexpr size_t kSmall = 16 * 1024;    // Client recv buffers
+    static constexpr size_t kMedium = 64 * 1024;   // Backend response buffers
+    static constexpr size_t kLarge = 256 * 1024;   // Large bodies
+
+    /// Acquire an empty buffer with capacity >= size_hint (rounded up to a
+    /// size class; hints above kLarge get an unpooled exact reservation)
+    [[nodiscard]] std::vector<uint8_t> acquire(size_t size_hint);
+
+    /// Return a buffer to its size class (cleared, capacity kept).
+    /// Buffers whose capacity no longer matches a class are freed.
+    void release(std::vector<uint8_t>&& buffer) noexcept;
+
+    /// Drop free buffers beyond the in-use peak seen since the last trim,
+    /// then reset the watermark to current demand
+    void trim() noexcept;
+
+    /// Total bytes currently parked in free lists (for metrics)
+    [[nodiscard]] size_t pooled_bytes() const noexcept;
+
+private:
+    struct SizeClass {
+        size_t capacity = 0;
+        std::vector<std::vector<uint8_t>> free_list;
+        size_t in_use = 0;
+        size_t high_watermark = 0;  // Peak in_use since last trim()
+    };
+
+    /// Class index for a capacity/hint; -1 if unpooled
+    [[nodiscard]] int class_index(size_t size) const noexcept;
+
+    SizeClass classes_[3] = {{kSmall, {}, 0, 0}, {kMedium, {}, 0, 0}, {kLarge, {}, 0, 0}};
+};
+
 /// Pool allocator for fixed-size objects
-/// Thread-local pool with free-list for object reuse
+/// Thread-local pool with free-list for object reuse. The slab is
+/// allocated on first use and drawn from the hugepage slab when the
+/// process opted in (see hugepages).
 template <typename T, size_t PoolSize = 128>
 class ObjectPool {
 public:
     ObjectPool() = default;
-    ~ObjectPool() { clear(); }
+    ~ObjectPool() {
+        clear();
+        if (storage_) {
+            if (storage_huge_) {
+                hugepages::deallocate(storage_, sizeof(Slot) * PoolSize);
+            } else {
+                ::operator delete(storage_, std::align_val_t{alignof(Slot)});
+            }
+        }
+    }
 
     // Non-copyable, non-movable
     ObjectPool(const ObjectPool&) = delete;
@@ -120,6 +251,13 @@ public:
         }
 
         if (allocated_ < PoolSize) {
+            if (!storage_) {
+                storage_huge_ = hugepages::enabled();
+                storage_ = static_cast<Slot*>(
+                    storage_huge_ ? hugepages::allocate(sizeof(Slot) * PoolSize)
+                                  : ::operator new(sizeof(Slot) * PoolSize,
+                                                   std::align_val_t{alignof(Slot)}));
+            }
             Slot* slot = &storage_[allocated_++];
             T* obj = reinterpret_cast<T*>(slot);
             new (obj) T(std::forward<Args>(args)...);
@@ -139,7 +277,7 @@ public:
 
         // Check if object is from pool
         Slot* slot = reinterpret_cast<Slot*>(obj);
-        if (slot >= storage_ && slot < storage_ + PoolSize) {
+        if (storage_ && slot >= storage_ && slot < storage_ + PoolSize) {
             slot->next = free_list_;
             free_list_ = slot;
         } else {
@@ -162,9 +300,10 @@ private:
         ~Slot() {}  // Trivial destructor
     };
 
-    Slot storage_[PoolSize];
+    Slot* storage_ = nullptr;  // Lazily allocated slab (hugepage-backed when enabled)
     Slot* free_list_ = nullptr;
     size_t allocated_ = 0;
+    bool storage_huge_ = false;
 };
 
 }  // namespace titan::core
@@ -19,29 +19,51 @@
 #include "server.hpp"
 
 #include <arpa/inet.h>
+#include <fcntl.h>
 #include <netdb.h>
 #include <netinet/tcp.h>
+#include <poll.h>
 #include <sys/resource.h>
 #include <sys/socket.h>
+#include <sys/stat.h>
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
+#include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
+#include <charconv>
 #include <cstring>
 #include <iostream>
 #include <unordered_set>
 
+#include "../control/health_prober.hpp"
+#include "../gateway/compression_middleware.hpp"
+#include "../http/simd.hpp"
 #include "../http/websocket.hpp"
 #include "logging.hpp"
 #include "socket.hpp"
 
 #ifdef __linux__
 #include <sys/epoll.h>
+#include <sys/eventfd.h>
 #elif defined(__APPLE__) || defined(__FreeBSD__)
 #include <sys/event.h>
 #endif
 
 namespace titan::core {
 
+// Worker 0 publishes its upstream manager for the admin /metrics endpoint;
+// a config swap must repoint it before the old manager is retired
+extern std::atomic<const gateway::UpstreamManager*> g_upstream_manager_for_metrics;
+
+// Process-wide active health prober (owned by the orchestrator); workers
+// pull its probe results into their own backends from process_timers
+extern std::atomic<const control::HealthProber*> g_health_prober_for_workers;
+
 // Backend proxy performance tuning constants
 namespace {
 // Buffer sizes optimized for typical API responses
@@ -58,24 +80,105 @@ constexpr size_t kQuerySeparatorSize = 1;    // "?"
 // Connection staleness check threshold
 // Only perform expensive MSG_PEEK validation if connection idle > 5s
 constexpr auto kConnectionStaleThreshold = std::chrono::seconds(5);
+
+// splice() streaming: per-call transfer cap (kernel clamps to pipe capacity)
+constexpr size_t kSpliceMaxChunk = 1024 * 1024;  // 1MB
+
+/// File mtime in seconds, or 0 when the path can't be stat'ed
+time_t file_mtime(const std::string& path) {
+    struct stat st {};
+    return stat(path.c_str(), &st) == 0 ? st.st_mtime : 0;
+}
+
+/// Extract a cookie value from a Cookie request header ("a=1; b=2")
+std::string_view extract_cookie(std::string_view cookie_header, std::string_view name) {
+    size_t pos = 0;
+    while (pos < cookie_header.size()) {
+        // Skip leading whitespace/separators
+        while (pos < cookie_header.size() &&
+               (cookie_header[pos] == ' ' || cookie_header[pos] == ';')) {
+            ++pos;
+        }
+        size_t eq = cookie_header.find('=', pos);
+        if (eq == std::string_view::npos) {
+            break;
+        }
+        size_t end = cookie_header.find(';', eq);
+        if (end == std::string_view::npos) {
+            end = cookie_header.size();
+        }
+        if (cookie_header.substr(pos, eq - pos) == name) {
+            return cookie_header.substr(eq + 1, end - eq - 1);
+        }
+        pos = end + 1;
+    }
+    return {};
+}
+
+/// FNV-1a 64-bit accumulator (coalescing keys)
+uint64_t fnv1a_mix(uint64_t hash, std::string_view data) {
+    for (char c : data) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    hash ^= 0x1f;  // Component separator
+    hash *= 1099511628211ull;
+    return hash;
+}
+
+/// Only idempotent, non-personalized requests may share a backend response
+bool is_coalescable(const http::Request& request) {
+    return request.method == http::Method::GET && !request.has_header(http::WellKnownHeader::Authorization) &&
+           !request.has_header(http::WellKnownHeader::Cookie);
+}
+
+/// Coalescing key: one backend round trip per (upstream, host, path, query)
+uint64_t coalesce_hash(const http::Request& request, std::string_view upstream_name) {
+    uint64_t hash = 14695981039346656037ull;
+    hash = fnv1a_mix(hash, upstream_name);
+    hash = fnv1a_mix(hash, request.get_header(http::WellKnownHeader::Host));
+    hash = fnv1a_mix(hash, request.path);
+    hash = fnv1a_mix(hash, request.query);
+    return hash;
+}
+
+/// Balancing key for the upstream's configured hash attribute
+/// ("ip", "path", "header:<name>", "cookie:<name>"). Only consistent
+/// hashing uses it; other strategies ignore the key.
+std::string_view backend_hash_key(const Connection& conn, const gateway::Upstream& upstream) {
+    std::string_view spec = upstream.hash_key();
+    if (spec == "path") {
+        return conn.request.path;
+    }
+    if (spec.starts_with("header:")) {
+        return conn.request.get_header(spec.substr(7));
+    }
+    if (spec.starts_with("cookie:")) {
+        return extract_cookie(conn.request.get_header(http::WellKnownHeader::Cookie), spec.substr(7));
+    }
+    return conn.remote_ip;  // "ip" (default)
+}
 }  // anonymous namespace
 
 Server::Server(const control::Config& config, std::unique_ptr<gateway::Router> router,
                std::unique_ptr<gateway::UpstreamManager> upstream_manager,
                std::unique_ptr<gateway::Pipeline> pipeline)
-    : config_(config),
+    : config_(&config),
       router_(std::move(router)),
       upstream_manager_(std::move(upstream_manager)),
       pipeline_(std::move(pipeline)) {
     // Initialize TLS if enabled
-    if (config_.server.tls_enabled) {
+    if (config_->server.tls_enabled) {
         std::error_code error;
-        auto result = TlsContext::create(config_.server.tls_certificate_path,
-                                         config_.server.tls_private_key_path,
-                                         config_.server.tls_alpn_protocols, error);
+        auto result = TlsContext::create(config_->server.tls_certificate_path,
+                                         config_->server.tls_private_key_path,
+                                         config_->server.tls_alpn_protocols, error,
+                                         config_->server.tls_ktls_enabled);
 
         if (result) {
             tls_context_ = std::move(*result);
+            tls_cert_mtime_ = file_mtime(config_->server.tls_certificate_path);
+            tls_key_mtime_ = file_mtime(config_->server.tls_private_key_path);
         } else {
             throw std::runtime_error("Failed to initialize TLS context: " + error.message());
         }
@@ -87,6 +190,20 @@ Server::Server(const control::Config& config, std::unique_ptr<gateway::Router> r
     if (backend_epoll_fd_ < 0) {
         throw std::runtime_error("Failed to create backend epoll instance");
     }
+
+    // Offload completion wakeup: compressor threads signal this eventfd
+    // when a compressed body is ready; it rides the backend epoll so
+    // every loop variant picks it up without new plumbing
+    offload_eventfd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (offload_eventfd_ >= 0) {
+        struct epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.fd = offload_eventfd_;
+        if (epoll_ctl(backend_epoll_fd_, EPOLL_CTL_ADD, offload_eventfd_, &ev) < 0) {
+            close_fd(offload_eventfd_);
+            offload_eventfd_ = -1;
+        }
+    }
 #elif defined(__APPLE__) || defined(__FreeBSD__)
     backend_epoll_fd_ = kqueue();
     if (backend_epoll_fd_ < 0) {
@@ -98,6 +215,11 @@ Server::Server(const control::Config& config, std::unique_ptr<gateway::Router> r
 Server::~Server() {
     stop();
 
+    if (offload_eventfd_ >= 0) {
+        close_fd(offload_eventfd_);
+        offload_eventfd_ = -1;
+    }
+
     // Close backend epoll/kqueue instance
     if (backend_epoll_fd_ >= 0) {
         close_fd(backend_epoll_fd_);
@@ -120,13 +242,35 @@ std::error_code Server::start() {
         // In production, this should be set via systemd LimitNOFILE or ulimit
     }
 
-    listen_fd_ = create_listening_socket(config_.server.listen_address, config_.server.listen_port,
-                                         config_.server.backlog);
+    if (inherited_listen_fd_ >= 0) {
+        // Binary handover: the predecessor's listener arrives already
+        // bound and listening, accept queue intact
+        listen_fd_ = inherited_listen_fd_;
+    } else {
+        listen_fd_ = create_listening_socket(config_->server.listen_address,
+                                             config_->server.listen_port, config_->server.backlog);
+    }
 
     if (listen_fd_ < 0) {
         return std::error_code(errno, std::system_category());
     }
 
+    // Listener TCP tuning (applied to inherited listeners too - the
+    // options are per-socket and the predecessor may predate them).
+    // TFO shaves an RTT off repeat-visitor first byte during reconnect
+    // storms; DEFER_ACCEPT keeps data-less handshakes out of the loop.
+    if (config_->server.tcp_fastopen_queue > 0) {
+        if (auto ec = core::set_tcp_fastopen(listen_fd_, config_->server.tcp_fastopen_queue); ec) {
+            LOG_WARNING(logger_, "TCP_FASTOPEN unavailable: {}", ec.message());
+        }
+    }
+    if (config_->server.tcp_defer_accept > 0) {
+        if (auto ec = core::set_tcp_defer_accept(listen_fd_, config_->server.tcp_defer_accept);
+            ec) {
+            LOG_WARNING(logger_, "TCP_DEFER_ACCEPT unavailable: {}", ec.message());
+        }
+    }
+
     running_ = true;
     return {};
 }
@@ -139,9 +283,7 @@ void Server::stop() {
     running_ = false;
 
     // Close all client connections
-    for (auto& [fd, conn] : connections_) {
-        close_fd(conn->fd);
-    }
+    connections_.for_each([](int, std::unique_ptr<Connection>& conn) { close_fd(conn->fd); });
     connections_.clear();
 
     // Close listening socket
@@ -156,7 +298,23 @@ void Server::handle_accept(int client_fd, std::string_view remote_ip, uint16_t r
     conn->fd = client_fd;
     conn->remote_ip = remote_ip;
     conn->remote_port = remote_port;
-    conn->recv_buffer.reserve(8192);
+    conn->buffer_pool = &buffer_pool_;
+    conn->recv_buffer = buffer_pool_.acquire(BufferPool::kSmall);
+
+    // Zero-copy sends (cleartext only: SSL_write copies into records
+    // regardless, so there is nothing for MSG_ZEROCOPY to save there)
+    if (config_->server.zerocopy_send_enabled && !tls_context_) {
+        conn->zerocopy_enabled = !core::enable_zerocopy(client_fd);
+    }
+    if (config_->server.tcp_notsent_lowat > 0) {
+        (void)core::set_notsent_lowat(client_fd, config_->server.tcp_notsent_lowat);
+    }
+
+    // Latency mode: accepted sockets busy-poll the NIC queue too
+    // (SO_BUSY_POLL is not inherited from the listener)
+    if (config_->server.busy_poll_enabled && config_->server.busy_poll_budget_us > 0) {
+        (void)core::set_busy_poll(client_fd, config_->server.busy_poll_budget_us);
+    }
 
     // Create SSL object if TLS is enabled
     if (tls_context_) {
@@ -172,16 +330,42 @@ void Server::handle_accept(int client_fd, std::string_view remote_ip, uint16_t r
         }
     }
 
+    // Arm idle timeout. Reads only push conn.idle_deadline forward; the
+    // timer re-checks the deadline when it fires (see on_idle_timeout)
+    if (config_->server.idle_timeout > 0) {
+        conn->timer_wheel = &timer_wheel_;
+        conn->idle_deadline = std::chrono::steady_clock::now() +
+                              std::chrono::milliseconds(config_->server.idle_timeout);
+        conn->idle_timer = timer_wheel_.add(config_->server.idle_timeout,
+                                            [this, client_fd] { on_idle_timeout(client_fd); });
+    }
+
     connections_[client_fd] = std::move(conn);
 }
 
 void Server::handle_read(int client_fd) {
-    auto it = connections_.find(client_fd);
-    if (it == connections_.end()) {
+    auto* slot = connections_.find(client_fd);
+    if (!slot) {
         return;
     }
 
-    Connection& conn = *it->second;
+    Connection& conn = **slot;
+
+    // Streamed upload backpressure: above the high watermark the socket is
+    // deliberately left unread so the TCP window closes and the sender
+    // stalls; the drain path resumes reads (see stream_request_body)
+    if (conn.read_paused) {
+        return;
+    }
+
+    // Activity - push the idle deadline out. Deliberately no cancel+add:
+    // cancellation is lazy, so re-arming per read strands a dead Timer
+    // (and its std::function) in the wheel for the full idle timeout.
+    // The armed timer re-checks this deadline when it fires.
+    if (conn.idle_timer != TimerWheel::kInvalidTimer) {
+        conn.idle_deadline = std::chrono::steady_clock::now() +
+                             std::chrono::milliseconds(config_->server.idle_timeout);
+    }
 
     // TLS handshake if enabled and not yet complete
     if (conn.tls_enabled && !conn.tls_handshake_complete) {
@@ -190,12 +374,26 @@ void Server::handle_read(int client_fd) {
         if (result == TlsHandshakeResult::Complete) {
             conn.tls_handshake_complete = true;
 
+            // Resumption-rate accounting: ticket hits skip the ~1ms full
+            // handshake, and this is how we verify the hit rate in production
+            if (metrics_) {
+                metrics_->record_tls_handshake(SSL_session_reused(conn.ssl) == 1);
+            }
+
+#ifdef SSL_OP_ENABLE_KTLS
+            // With SSL_OP_ENABLE_KTLS set, OpenSSL already tried to install
+            // the record keys via setsockopt(TLS_TX); this just records
+            // whether the kernel accepted so splice eligibility can use it
+            conn.ktls_tx = BIO_get_ktls_send(SSL_get_wbio(conn.ssl)) > 0;
+#endif
+
             // Get negotiated protocol from ALPN
             auto alpn_protocol = get_alpn_protocol(conn.ssl);
 
             if (alpn_protocol == "h2") {
                 conn.protocol = Protocol::HTTP_2;
-                conn.h2_session = std::make_unique<http::H2Session>(true);  // server mode
+                conn.h2_session = std::make_unique<http::H2Session>(
+                    true, config_->server.h2_max_window);  // server mode
             } else {
                 // Default to HTTP/1.1 (even if ALPN selected "http/1.1" or no ALPN)
                 conn.protocol = Protocol::HTTP_1_1;
@@ -271,7 +469,8 @@ void Server::handle_read(int client_fd) {
         if (http::is_http2_connection(conn.recv_buffer)) {
             // HTTP/2 connection (h2c with prior knowledge)
             conn.protocol = Protocol::HTTP_2;
-            conn.h2_session = std::make_unique<http::H2Session>(true);  // server mode
+            conn.h2_session = std::make_unique<http::H2Session>(
+                true, config_->server.h2_max_window);  // server mode
         } else {
             // Assume HTTP/1.1
             conn.protocol = Protocol::HTTP_1_1;
@@ -289,6 +488,18 @@ void Server::handle_read(int client_fd) {
 }
 
 void Server::handle_http1(Connection& conn) {
+    // Streamed upload in progress: body bytes bypass the parser straight
+    // into the backend's send queue
+    if (conn.request_streaming) {
+        if (!stream_request_body(conn)) {
+            return;  // Connection torn down
+        }
+        if (conn.request_streaming) {
+            return;  // Body still incoming
+        }
+        // Body fully forwarded - fall through for pipelined requests
+    }
+
     // Process multiple pipelined requests if available (HTTP pipelining)
     while (true) {
         // Clear request and response objects before parsing (prevents data accumulation)
@@ -300,10 +511,18 @@ void Server::handle_http1(Connection& conn) {
         auto remaining_data = std::span<const uint8_t>(conn.recv_buffer.data() + conn.recv_cursor,
                                                        conn.recv_buffer.size() - conn.recv_cursor);
 
+        // Flight recorder: first sight of this request's bytes. A request
+        // spanning several reads keeps its original mark, so the parse
+        // span covers first byte to parse-complete
+        if (!conn.flight.started() && !remaining_data.empty()) {
+            conn.flight.mark(control::FlightStage::RecvStart);
+        }
+
         // Try to parse HTTP/1.1 request
         auto [result, consumed] = conn.parser.parse_request(remaining_data, conn.request);
 
         if (result == http::ParseResult::Complete) {
+            conn.flight.mark(control::FlightStage::Parsed);
             // Copy ALL string_views to owned storage BEFORE buffer compaction
             // (path/uri/query/headers all point into recv_buffer which may be erased)
 
@@ -375,12 +594,177 @@ void Server::handle_http1(Connection& conn) {
             handle_close(conn.fd);
             return;
         } else {
-            // Incomplete - wait for more data
+            // Incomplete - for large uploads, start forwarding to the
+            // backend once the header block is in rather than buffering
+            // the whole body (see try_begin_request_stream)
+            try_begin_request_stream(conn, remaining_data);
             return;
         }
     }
 }
 
+void Server::try_begin_request_stream(Connection& conn, std::span<const uint8_t> remaining) {
+    const auto& server_config = config_->server;
+    if (server_config.stream_request_min_body_size == 0 || conn.protocol != Protocol::HTTP_1_1 ||
+        conn.backend_conn || conn.hedge_conn || conn.request_streaming) {
+        return;
+    }
+
+    // The header block must be complete before anything can be forwarded
+    static constexpr uint8_t kHeaderEnd[] = {'\r', '\n', '\r', '\n'};
+    auto it = std::search(remaining.begin(), remaining.end(), std::begin(kHeaderEnd),
+                          std::end(kHeaderEnd));
+    if (it == remaining.end()) {
+        return;
+    }
+
+    conn.request = http::Request{};
+    auto [result, header_bytes] = conn.parser.parse_request_headers(remaining, conn.request);
+    if (result != http::ParseResult::Complete) {
+        return;  // Malformed headers surface through the normal parse path
+    }
+
+    // Only simply-framed bodies stream; chunked uploads stay buffered.
+    // Upgrade requests (WebSocket) never carry large bodies and take the
+    // buffered path too.
+    if (conn.request.has_header(http::WellKnownHeader::TransferEncoding) ||
+        conn.request.has_header(http::WellKnownHeader::Upgrade)) {
+        return;
+    }
+    size_t content_length = conn.request.content_length();
+    if (content_length < server_config.stream_request_min_body_size) {
+        return;
+    }
+
+    // Copy all views to owned storage, same as the buffered path - the
+    // body bytes about to flow through recv_buffer would invalidate them
+    conn.owned_request_path = conn.request.path;
+    conn.owned_request_uri = conn.request.uri;
+    conn.owned_request_query = conn.request.query;
+    conn.request_header_storage.clear();
+    conn.request_header_storage.reserve(conn.request.headers.size());
+    for (const auto& header : conn.request.headers) {
+        conn.request_header_storage.emplace_back(std::string(header.name),
+                                                 std::string(header.value));
+    }
+    conn.request.path = conn.owned_request_path;
+    conn.request.uri = conn.owned_request_uri;
+    conn.request.query = conn.owned_request_query;
+    conn.request.headers.clear();
+    conn.request.headers.reserve(conn.request_header_storage.size());
+    for (const auto& [name, value] : conn.request_header_storage) {
+        conn.request.headers.push_back({name, value});
+    }
+    conn.request.body = {};  // Streams through, never materialized
+
+    LOG_DEBUG(logger_, "Streaming {}-byte request body for fd={}", content_length, conn.fd);
+
+    // Flags go up before process_request: a response sent from inside it
+    // (middleware stop, proxy failure) must see the upload in progress so
+    // send_response closes instead of trying to resync mid-body
+    conn.request_streaming = true;
+    conn.request_stream_remaining = content_length;
+    conn.recv_cursor += header_bytes;
+
+    int client_fd = conn.fd;
+    (void)process_request(conn);
+
+    auto* slot = connections_.find(client_fd);
+    if (!slot) {
+        return;  // Answered and closed without a backend
+    }
+    if (!conn.backend_conn) {
+        // Answered without a backend but still open - send_response clears
+        // the flags and forces close, so this is unreachable; belt and
+        // braces against leaving the flags armed
+        conn.request_streaming = false;
+        conn.request_stream_remaining = 0;
+        return;
+    }
+
+    // Forward whatever body bytes arrived alongside the headers
+    (void)stream_request_body(conn);
+}
+
+bool Server::stream_request_body(Connection& conn) {
+    BackendConnection* backend = conn.backend_conn.get();
+    if (!backend) {
+        // Backend died mid-upload; the error path already responded and
+        // closed, so only a stale read can land here
+        handle_close(conn.fd);
+        return false;
+    }
+
+    size_t available = conn.recv_buffer.size() - conn.recv_cursor;
+    size_t take = std::min(available, conn.request_stream_remaining);
+    if (take > 0) {
+        // Already-sent bytes are dead weight during a long upload - drop
+        // them so the queue holds only unsent data (and the watermark
+        // comparison stays a plain size check)
+        if (backend->send_cursor > 65536) {
+            backend->send_buffer.erase(backend->send_buffer.begin(),
+                                       backend->send_buffer.begin() +
+                                           static_cast<ptrdiff_t>(backend->send_cursor));
+            backend->send_cursor = 0;
+        }
+
+        const uint8_t* src = conn.recv_buffer.data() + conn.recv_cursor;
+        backend->send_buffer.insert(backend->send_buffer.end(), src, src + take);
+        conn.recv_cursor += take;
+        conn.request_stream_remaining -= take;
+        backend->send_pending = true;
+
+        // Upload progress counts as activity - push the backend deadline
+        // out, otherwise read_timeout caps total upload duration
+        if (backend->timer_wheel && backend->timeout_timer != TimerWheel::kInvalidTimer &&
+            config_->server.read_timeout > 0) {
+            timer_wheel_.cancel(backend->timeout_timer);
+            int timeout_fd = backend->backend_fd;
+            backend->timeout_timer = timer_wheel_.add(
+                config_->server.read_timeout,
+                [this, timeout_fd] { handle_backend_event(timeout_fd, false, false, true); });
+        }
+
+        // Compact the client buffer periodically (same policy as the
+        // pipelined request loop)
+        if (conn.recv_cursor > 4096 && conn.recv_cursor > conn.recv_buffer.size() / 2) {
+            conn.recv_buffer.erase(conn.recv_buffer.begin(),
+                                   conn.recv_buffer.begin() +
+                                       static_cast<ptrdiff_t>(conn.recv_cursor));
+            conn.recv_cursor = 0;
+        }
+
+        // Kick the send path: with edge-triggered epoll no EPOLLOUT edge is
+        // coming for bytes appended while the socket was already writable
+        if (!backend->connect_pending) {
+            int client_fd = conn.fd;
+            int backend_fd = backend->backend_fd;
+            handle_backend_event(backend_fd, false, true, false);
+            // The send can fail and tear everything down - revalidate
+            auto* slot = connections_.find(client_fd);
+            if (!slot) {
+                return false;
+            }
+            backend = conn.backend_conn.get();
+            if (!backend || backend->backend_fd != backend_fd) {
+                return false;
+            }
+        }
+    }
+
+    if (conn.request_stream_remaining == 0) {
+        conn.request_streaming = false;
+        conn.read_paused = false;
+        return true;
+    }
+
+    // Watermark: stop reading the client while the backend queue is deep;
+    // the drain path in handle_backend_event resumes below the low mark
+    conn.read_paused = (backend->send_buffer.size() - backend->send_cursor) >
+                       config_->server.stream_high_watermark;
+    return true;
+}
+
 void Server::handle_http2(Connection& conn) {
     if (!conn.h2_session) {
         handle_close(conn.fd);
@@ -437,13 +821,15 @@ void Server::handle_http2(Connection& conn) {
 }
 
 void Server::process_http2_stream(Connection& conn, http::H2Stream& stream) {
-    // Match route using stream's request
-    auto match = router_->match(stream.request.method, stream.request.path);
+    // Match route using stream's request (memoized per connection)
+    auto match = match_route(conn, stream.request.method, stream.request.path);
 
     // Build request context
     gateway::RequestContext ctx;
     ctx.request = &stream.request;
     ctx.response = &stream.response;
+    conn.arena.reset();  // Request boundary - all arena-backed views die here
+    ctx.arena = &conn.arena;
     ctx.correlation_id = logging::generate_correlation_id();
     ctx.route_match = match;
     ctx.client_ip = conn.remote_ip;
@@ -479,18 +865,26 @@ void Server::process_http2_stream(Connection& conn, http::H2Stream& stream) {
         // Copy stream.request to conn.request for proxy_to_backend (HTTP/1.1 compatibility)
         conn.request = stream.request;
 
+        // Record the client stream so the HTTP/2 backend path can route the
+        // response back to this stream (reset immediately after)
+        current_h2_client_stream_ = stream.stream_id;
         bool proxy_initiated = proxy_to_backend(conn, ctx);
-
-        if (proxy_initiated && conn.backend_conn) {
-            // HTTP/2 FIX: Move backend connection to per-stream map
-            // This prevents stream state from being overwritten by concurrent requests
-            int backend_fd = conn.backend_conn->backend_fd;
-            auto stream_backend = std::move(conn.backend_conn);
-            stream_backend->stream_id = stream.stream_id;
-            conn.h2_stream_backends[stream.stream_id] = std::move(stream_backend);
-
-            // CRITICAL: Update backend_connections_ map with (client_fd, stream_id)
-            backend_connections_[backend_fd] = {conn.fd, stream.stream_id};
+        current_h2_client_stream_ = -1;
+
+        if (proxy_initiated) {
+            if (conn.backend_conn) {
+                // HTTP/2 FIX: Move backend connection to per-stream map
+                // This prevents stream state from being overwritten by concurrent requests
+                int backend_fd = conn.backend_conn->backend_fd;
+                auto stream_backend = std::move(conn.backend_conn);
+                stream_backend->stream_id = stream.stream_id;
+                conn.h2_stream_backends[stream.stream_id] = std::move(stream_backend);
+
+                // CRITICAL: Update backend_connections_ map with (client_fd, stream_id)
+                backend_connections_[backend_fd] = {conn.fd, stream.stream_id};
+            }
+            // else: HTTP/2 backend channel path - the stream context is
+            // registered on the channel, nothing to track on the connection
 
             // Don't submit response yet - will be done in handle_backend_event()
             return;
@@ -501,6 +895,13 @@ void Server::process_http2_stream(Connection& conn, http::H2Stream& stream) {
             auto ec = conn.h2_session->submit_response(stream.stream_id, stream.response);
             (void)ec;
         }
+    } else if (!match.static_root.empty()) {
+        // Static file route - the response gets its own body copy (the
+        // session streams it across later loop passes)
+        serve_static_file(conn, stream.request, stream.response, match, /*allow_sendfile=*/false);
+        stream.response_complete = true;
+        auto ec = conn.h2_session->submit_response(stream.stream_id, stream.response);
+        (void)ec;
     } else {
         // Direct response
         stream.response.status = http::StatusCode::OK;
@@ -510,13 +911,78 @@ void Server::process_http2_stream(Connection& conn, http::H2Stream& stream) {
     }
 }
 
+bool Server::handle_client_error(int client_fd) {
+    auto* slot = connections_.find(client_fd);
+    if (!slot) {
+        return false;
+    }
+    Connection& conn = **slot;
+
+    if (conn.zerocopy_inflight > 0) {
+        uint32_t completed = 0;
+        bool healthy = core::drain_zerocopy_completions(client_fd, completed);
+        if (completed > conn.zerocopy_inflight) {
+            completed = conn.zerocopy_inflight;
+        }
+        conn.zerocopy_inflight -= completed;
+        // Completions arrive in send order: release the oldest buffers
+        for (uint32_t i = 0; i < completed && !conn.zerocopy_pinned.empty(); ++i) {
+            buffer_pool_.release(std::move(conn.zerocopy_pinned.front()));
+            conn.zerocopy_pinned.erase(conn.zerocopy_pinned.begin());
+        }
+        if (healthy) {
+            return true;
+        }
+    }
+
+    handle_close(client_fd);
+    return false;
+}
+
+void Server::on_idle_timeout(int client_fd) {
+    auto* slot = connections_.find(client_fd);
+    if (!slot) {
+        return;
+    }
+    Connection& conn = **slot;
+
+    auto now = std::chrono::steady_clock::now();
+    if (conn.idle_deadline > now) {
+        // Reads have pushed the deadline out since this timer was armed -
+        // re-arm for the remainder. A busy connection costs one timer
+        // allocation per idle-timeout period instead of one per read.
+        auto remaining =
+            std::chrono::duration_cast<std::chrono::milliseconds>(conn.idle_deadline - now);
+        conn.idle_timer = timer_wheel_.add(static_cast<uint64_t>(remaining.count()),
+                                           [this, client_fd] { on_idle_timeout(client_fd); });
+        return;
+    }
+
+    // Genuinely idle; the fired id is already spent, so clear it before
+    // handle_close tears the connection down
+    conn.idle_timer = TimerWheel::kInvalidTimer;
+    LOG_DEBUG(logger_, "Idle timeout: closing fd={}", client_fd);
+    handle_close(client_fd);
+}
+
 void Server::handle_close(int client_fd) {
-    auto it = connections_.find(client_fd);
-    if (it == connections_.end()) {
+    auto* slot = connections_.find(client_fd);
+    if (!slot) {
         return;
     }
 
-    Connection& conn = *it->second;
+    Connection& conn = **slot;
+
+    // Unsubscribe broadcast WebSocket connections from their channel
+    if (conn.ws_conn && !conn.ws_conn->broadcast_channel.empty()) {
+        auto it = ws_channels_.find(conn.ws_conn->broadcast_channel);
+        if (it != ws_channels_.end()) {
+            std::erase(it->second, client_fd);
+            if (it->second.empty()) {
+                ws_channels_.erase(it);
+            }
+        }
+    }
 
     // Clean up WebSocket backend connection if exists
     if (conn.ws_conn && conn.ws_conn->backend_fd >= 0) {
@@ -543,6 +1009,10 @@ void Server::handle_close(int client_fd) {
     if (conn.backend_conn) {
         int backend_fd = conn.backend_conn->backend_fd;
 
+        // If this connection led a coalesced fetch, its response will never
+        // arrive - answer the parked duplicates now
+        fail_coalesced_waiters(*conn.backend_conn);
+
         // Remove from backend_connections map
         backend_connections_.erase(backend_fd);
 
@@ -563,6 +1033,14 @@ void Server::handle_close(int client_fd) {
         // Reset will be automatic when Connection is destroyed
     }
 
+    // Clean up hedged racer if exists
+    if (conn.hedge_conn) {
+        int backend_fd = conn.hedge_conn->backend_fd;
+        backend_connections_.erase(backend_fd);
+        (void)remove_backend_from_epoll(backend_fd);
+        close_fd(backend_fd);
+    }
+
     // HTTP/2 FIX: Clean up all HTTP/2 stream backend connections
     for (auto& [stream_id, stream_backend] : conn.h2_stream_backends) {
         if (stream_backend) {
@@ -591,8 +1069,109 @@ void Server::handle_close(int client_fd) {
     // Clean up SSL connection if exists
     ssl_connections_.erase(client_fd);
 
-    close_fd(it->second->fd);
-    connections_.erase(it);
+    close_fd(conn.fd);
+    connections_.erase(client_fd);
+}
+
+gateway::RouteMatch Server::match_route(Connection& conn, http::Method method,
+                                        std::string_view path) {
+    const uint64_t hash = std::hash<std::string_view>{}(path);
+    for (const auto& entry : conn.route_memo) {
+        if (entry.path_hash == hash && entry.method == method &&
+            entry.generation == config_generation_seen_ && entry.path == path) {
+            return entry.match;
+        }
+    }
+
+    auto match = router_->match(method, path);
+
+    // Memoize only self-contained matches: param and wildcard views
+    // reference the path buffer of the request that produced them, so
+    // replaying those on a later request would serve stale bytes
+    if (match.matched() && match.params.empty() && match.wildcard.empty()) {
+        auto& entry = conn.route_memo[conn.route_memo_next];
+        conn.route_memo_next =
+            static_cast<uint8_t>((conn.route_memo_next + 1) % conn.route_memo.size());
+        entry.path_hash = hash;
+        entry.method = method;
+        entry.generation = config_generation_seen_;
+        entry.path.assign(path);
+        entry.match = match;
+    }
+    return match;
+}
+
+void Server::serve_static_file(Connection& conn, http::Request& request, http::Response& response,
+                               const gateway::RouteMatch& match, bool allow_sendfile) {
+    if (request.method != http::Method::GET) {
+        response.status = http::StatusCode::MethodNotAllowed;
+        response.add_middleware_header("Allow", "GET");
+        return;
+    }
+
+    // Wildcard routes ("/assets/*") select by the remainder; an exact
+    // route path serves the root's index.html
+    const auto* entry = static_files_.lookup(match.static_root, match.wildcard);
+    if (!entry) {
+        response.status = http::StatusCode::NotFound;
+        return;
+    }
+
+    response.add_middleware_header("ETag", entry->etag);
+    response.add_middleware_header("Content-Type", entry->content_type);
+    if (!entry->variants.empty()) {
+        // Encoding is negotiated per request, so shared caches must key
+        // on it even when this response goes out identity-coded
+        response.add_middleware_header("Vary", "Accept-Encoding");
+    }
+
+    // Conditional GET: strong ETag compare against If-None-Match
+    if (request.get_header(http::WellKnownHeader::IfNoneMatch) == entry->etag) {
+        response.status = http::StatusCode::NotModified;
+        return;
+    }
+
+    // Precompressed variant if the client accepts its encoding (variants
+    // are stored in preference order: br, zstd, gzip)
+    const uint8_t* data = entry->data;
+    size_t size = entry->size;
+    int file_fd = entry->fd;
+    std::string_view accept = request.get_header(http::WellKnownHeader::AcceptEncoding);
+    if (!accept.empty()) {
+        for (const auto& v : entry->variants) {
+            if (accept.find(v.encoding) != std::string_view::npos) {
+                response.add_middleware_header("Content-Encoding", v.encoding);
+                data = v.data;
+                size = v.size;
+                file_fd = v.fd;
+                break;
+            }
+        }
+    }
+
+    response.status = http::StatusCode::OK;
+#ifdef __linux__
+    if (allow_sendfile && !conn.tls_enabled) {
+        // Cleartext HTTP/1.1: page cache straight to the socket, no copy
+        // through userspace (send_response consumes these fields)
+        conn.sendfile_fd = file_fd;
+        conn.sendfile_len = size;
+        return;
+    }
+#else
+    (void)conn;
+#endif
+    (void)file_fd;
+    if (allow_sendfile) {
+        // TLS HTTP/1.1: send_response writes synchronously within this
+        // event-loop pass, before poll() could invalidate the mapping
+        response.body = {data, size};
+    } else {
+        // HTTP/2: the session streams the body across later loop passes,
+        // so it gets its own copy
+        response.body_storage.assign(data, data + size);
+        response.body = response.body_storage;
+    }
 }
 
 bool Server::process_request(Connection& conn) {
@@ -600,13 +1179,15 @@ bool Server::process_request(Connection& conn) {
     // This ensures they're not exposed on public-facing port 8080
     // Admin server runs on port 9090 (configurable via metrics.port)
 
-    // Match route (uses SIMD-accelerated router for longer paths)
-    auto match = router_->match(conn.request.method, conn.request.path);
+    // Match route (memoized per connection; radix descent on miss)
+    auto match = match_route(conn, conn.request.method, conn.request.path);
 
     // Build request context
     gateway::RequestContext ctx;
     ctx.request = &conn.request;
     ctx.response = &conn.response;
+    conn.arena.reset();  // Request boundary - all arena-backed views die here
+    ctx.arena = &conn.arena;
     ctx.correlation_id = logging::generate_correlation_id();
     ctx.route_match = match;
     ctx.client_ip = conn.remote_ip;
@@ -637,8 +1218,29 @@ bool Server::process_request(Connection& conn) {
 
     // Execute request middleware
     auto middleware_result = pipeline_->execute_request(ctx);
+    conn.flight.mark(control::FlightStage::PipelineDone);
+    conn.flight_route_id = match.metrics_id;
 
     if (middleware_result == gateway::MiddlewareResult::Stop) {
+        // Canned fast path: middleware that fully handled the request
+        // (CORS preflight) supplied pre-serialized bytes - one write,
+        // no per-request header serialization. Mid-upload stops keep the
+        // send_response() path for its stream-abort handling.
+        if (!ctx.canned_response.empty() && !ctx.canned_response_close.empty() &&
+            !conn.request_streaming) {
+            auto bytes = client_wants_keepalive ? ctx.canned_response : ctx.canned_response_close;
+            if (conn.tls_enabled) {
+                (void)ssl_write_nonblocking(conn.ssl, bytes);
+            } else {
+                (void)send(conn.fd, bytes.data(), bytes.size(), 0);
+            }
+            commit_flight(conn);
+            if (!client_wants_keepalive) {
+                handle_close(conn.fd);
+            }
+            return client_wants_keepalive;
+        }
+
         // Middleware handled the request (e.g., auth failure, rate limit)
         // Response status/body already set by middleware
         send_response(conn, client_wants_keepalive);
@@ -666,12 +1268,25 @@ bool Server::process_request(Connection& conn) {
             return client_wants_keepalive;
         }
 
-        // Async proxy initiated successfully
+        // Async proxy initiated successfully; the flight trace follows
+        // the backend leg and commits when the response goes out
+        if (conn.backend_conn) {
+            conn.backend_conn->flight = conn.flight;
+        }
+        conn.flight.reset();
+
         // Response will be sent later by handle_backend_event()
         // Return true to keep connection alive for async response
         return true;
     }
 
+    // Static file route - serve from the mmap cache
+    if (!match.static_root.empty()) {
+        serve_static_file(conn, conn.request, conn.response, match, /*allow_sendfile=*/true);
+        send_response(conn, client_wants_keepalive);
+        return client_wants_keepalive;
+    }
+
     // No upstream configured - return direct response or 404
     if (match.handler_id.empty()) {
         conn.response.status = http::StatusCode::NotFound;
@@ -683,12 +1298,25 @@ bool Server::process_request(Connection& conn) {
 }
 
 void Server::send_response(Connection& conn, bool keep_alive) {
-    // Build response string
+    // A response sent mid-upload (middleware stop, backend failure) leaves
+    // the rest of a streamed body unread on the wire; there is no resyncing
+    // an HTTP/1.1 connection from the middle of a discarded upload
+    if (conn.request_streaming) {
+        conn.request_streaming = false;
+        conn.request_stream_remaining = 0;
+        conn.read_paused = false;
+        keep_alive = false;
+    }
+
+    // Build the header block only - the body goes out from its own buffer
+    // via vectored I/O below instead of being copied in after the headers
     std::string response_str;
 
-    // Pre-reserve capacity to avoid allocations (estimate: 200 bytes headers + body size)
-    size_t body_size = conn.response.body.empty() ? 0 : conn.response.body.size();
-    size_t estimated_size = 200 + body_size;
+    // Pre-reserve capacity to avoid allocations (estimate: 200 bytes headers)
+    // A static file armed for sendfile has no body span; its length still
+    // frames the response
+    size_t body_size = conn.sendfile_fd >= 0 ? conn.sendfile_len : conn.response.body.size();
+    size_t estimated_size = 200;
     // Estimate header sizes using all_headers iterator (backend + middleware)
     for (auto it = conn.response.all_headers_begin(); it != conn.response.all_headers_end(); ++it) {
         auto [name, value] = *it;
@@ -728,24 +1356,90 @@ void Server::send_response(Connection& conn, bool keep_alive) {
     } else {
         response_str += "Connection: close\r\n";
     }
-    response_str += "\r\n";
 
-    // Add body if present
-    if (!conn.response.body.empty()) {
-        response_str.append(reinterpret_cast<const char*>(conn.response.body.data()),
-                            conn.response.body.size());
+    // HTTP/3 advertisement (RFC 7838) when configured: steers capable
+    // clients toward the QUIC endpoint deployed in front of the gateway
+    if (!config_->server.alt_svc.empty()) {
+        response_str += "Alt-Svc: ";
+        response_str += config_->server.alt_svc;
+        response_str += "\r\n";
     }
+    response_str += "\r\n";
 
-    // Send (use TLS if enabled)
+    // Send headers + body as one gather write (responses are always
+    // Content-Length framed here, so the vector is just the two slices)
     if (conn.tls_enabled) {
+        // TLS: records are framed per SSL_write call, so coalescing into
+        // one buffer buys nothing - write the two slices back to back
         (void)ssl_write_nonblocking(
             conn.ssl,
             std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(response_str.data()),
                                      response_str.size()));
+        if (!conn.response.body.empty()) {
+            (void)ssl_write_nonblocking(conn.ssl, conn.response.body);
+        }
     } else {
-        send(conn.fd, response_str.data(), response_str.size(), 0);
+        // Large bodies on zero-copy sockets go out with MSG_ZEROCOPY: the
+        // kernel reads the pages in place and posts a completion on the
+        // error queue, so the body buffer is pinned until it arrives.
+        // Keep-alive only - a connection closing right after the send
+        // would free the buffer while bytes may still be in flight.
+        bool zerocopy = conn.zerocopy_enabled && keep_alive &&
+                        body_size >= config_->server.zerocopy_min_send_size &&
+                        !conn.response.body.empty() &&
+                        conn.response.body.data() == conn.response_body.data();
+        if (conn.sendfile_fd >= 0) {
+#ifdef __linux__
+            // Static file: headers first, then the cached entry's fd
+            // straight to the socket - the body never touches userspace.
+            // Best-effort like the writev path: EAGAIN drops the rest.
+            (void)send(conn.fd, response_str.data(), response_str.size(), MSG_MORE);
+            off_t offset = 0;
+            size_t remaining = conn.sendfile_len;
+            while (remaining > 0) {
+                ssize_t sent = sendfile(conn.fd, conn.sendfile_fd, &offset, remaining);
+                if (sent <= 0) {
+                    break;
+                }
+                remaining -= static_cast<size_t>(sent);
+            }
+#endif
+        } else if (zerocopy) {
+            // Headers copy normally: the string dies at return and is tiny
+            (void)send(conn.fd, response_str.data(), response_str.size(), MSG_MORE);
+            ssize_t sent = send(conn.fd, conn.response.body.data(), body_size, MSG_ZEROCOPY);
+            if (sent > 0) {
+                conn.zerocopy_inflight++;
+                conn.zerocopy_pinned.push_back(std::move(conn.response_body));
+                conn.response_body = buffer_pool_.acquire(BufferPool::kMedium);
+            } else {
+                // Kernel refused the pin (ENOBUFS under optmem pressure) -
+                // fall back to a plain copying send
+                (void)send(conn.fd, conn.response.body.data(), body_size, 0);
+            }
+        } else {
+            struct iovec iov[2];
+            iov[0].iov_base = response_str.data();
+            iov[0].iov_len = response_str.size();
+            int iov_count = 1;
+            if (!conn.response.body.empty()) {
+                iov[1].iov_base = const_cast<uint8_t*>(conn.response.body.data());
+                iov[1].iov_len = conn.response.body.size();
+                iov_count = 2;
+            }
+            (void)writev(conn.fd, iov, iov_count);
+        }
     }
 
+    // Sendfile handoff is per response; the fd stays owned by the cache
+    conn.sendfile_fd = -1;
+    conn.sendfile_len = 0;
+
+    // Flight recorder: response handed to the socket. A trace that moved
+    // to a BackendConnection at proxy start is no longer on conn, so
+    // proxied responses commit through record_route_metrics instead
+    commit_flight(conn);
+
     // Close connection only if not keep-alive
     if (!keep_alive) {
         handle_close(conn.fd);
@@ -767,15 +1461,28 @@ bool Server::proxy_to_backend(Connection& conn, gateway::RequestContext& ctx) {
         return false;
     }
 
-    // Find first available backend (health + circuit breaker check)
-    const gateway::Backend* selected_backend = nullptr;
-    for (const auto& backend : backends) {
-        if (backend.can_accept_connection()) {
-            selected_backend = &backend;
-            break;
+    // Request coalescing: if an identical idempotent request is already in
+    // flight on this worker, park this connection and share the leader's
+    // response from handle_backend_event. HTTP/1.1 only - HTTP/2 streams
+    // multiplex on one connection and carry their own response path.
+    bool coalescable = conn.protocol == Protocol::HTTP_1_1 && !upstream->http2() &&
+                       is_coalescable(conn.request);
+    uint64_t coalesce_key = 0;
+    if (coalescable) {
+        coalesce_key = coalesce_hash(conn.request, upstream->name());
+        if (coalesce_inflight_.contains(coalesce_key)) {
+            coalesce_waiters_[coalesce_key].emplace_back(conn.fd,
+                                                         connections_.generation(conn.fd));
+            return true;
         }
     }
 
+    // Configured load balancer picks the backend (health + circuit breaker
+    // checks happen inside); consistent hashing keys on the configured
+    // request attribute for backend cache affinity
+    const gateway::Backend* selected_backend =
+        upstream->select_backend(backend_hash_key(conn, *upstream));
+
     if (!selected_backend) {
         // No healthy/available backends (all unhealthy or circuit breakers open)
         return false;
@@ -783,9 +1490,18 @@ bool Server::proxy_to_backend(Connection& conn, gateway::RequestContext& ctx) {
 
     const auto& backend = *selected_backend;
 
+    // HTTP/2 upstreams multiplex onto one pooled channel per backend instead
+    // of a dedicated TCP connection per request
+    if (upstream->http2()) {
+        return proxy_to_backend_h2(conn, ctx, *upstream, backend);
+    }
+
     // Create async backend connection
     conn.backend_conn = std::make_unique<BackendConnection>();
     conn.backend_conn->client_fd = conn.fd;
+    conn.backend_conn->buffer_pool = &buffer_pool_;
+    conn.backend_conn->send_buffer = buffer_pool_.acquire(BufferPool::kSmall);
+    conn.backend_conn->recv_buffer = buffer_pool_.acquire(BufferPool::kMedium);
     conn.backend_conn->upstream_name = std::string(upstream->name());
     conn.backend_conn->backend_host = backend.host;
     conn.backend_conn->backend_port = backend.port;
@@ -796,6 +1512,7 @@ bool Server::proxy_to_backend(Connection& conn, gateway::RequestContext& ctx) {
     conn.backend_conn->metadata["correlation_id"] = ctx.correlation_id;
     conn.backend_conn->route_match = ctx.route_match;
     conn.backend_conn->header_transforms = std::move(ctx.header_transforms);
+    conn.backend_conn->config_pin = snapshot_pin_;  // route_match views the live router
 
     // Preserve request for response middleware (HTTP/1.1 keep-alive safety)
     // conn.request will be overwritten by next pipelined request, so copy it now
@@ -839,6 +1556,7 @@ bool Server::proxy_to_backend(Connection& conn, gateway::RequestContext& ctx) {
     } else {
         // Acquired from pool - connection is established but removed from epoll
         conn.backend_conn->connect_pending = false;
+        conn.flight.mark(control::FlightStage::BackendConnected);
 
         // Reset state from previous request
         conn.backend_conn->send_cursor = 0;
@@ -846,11 +1564,19 @@ bool Server::proxy_to_backend(Connection& conn, gateway::RequestContext& ctx) {
         conn.backend_conn->recv_buffer.clear();
         conn.backend_conn->send_pending = false;
         conn.backend_conn->recv_pending = false;
+        conn.backend_conn->chunked_streaming = false;
+        conn.backend_conn->chunked_cursor = 0;
+        conn.backend_conn->chunked_header_len = 0;
+        conn.backend_conn->chunked_decoder.reset();
+        conn.backend_conn->chunked_slices.clear();
     }
 
-    // Build request and store in send buffer (use transformed path/query from metadata if present)
-    std::string request_str = build_backend_request(conn.request, conn.backend_conn->metadata,
-                                                    conn.backend_conn->header_transforms);
+    // Build request and store in send buffer (arena-backed transformed
+    // path/query from TransformMiddleware, metadata fallback inside)
+    std::string request_str =
+        build_backend_request(conn.request, conn.backend_conn->metadata,
+                              conn.backend_conn->header_transforms, ctx.transformed_path,
+                              ctx.transformed_query);
     conn.backend_conn->send_buffer.assign(
         reinterpret_cast<const uint8_t*>(request_str.data()),
         reinterpret_cast<const uint8_t*>(request_str.data() + request_str.size()));
@@ -870,58 +1596,360 @@ bool Server::proxy_to_backend(Connection& conn, gateway::RequestContext& ctx) {
     // Register in backend_connections map (client_fd, stream_id=-1 for HTTP/1.1)
     backend_connections_[conn.backend_conn->backend_fd] = {conn.fd, -1};
 
+    // First coalescable request for this key becomes the leader; concurrent
+    // duplicates park above until its response (or error) fans out
+    if (coalescable) {
+        coalesce_inflight_.insert(coalesce_key);
+        conn.backend_conn->coalesced_leader = true;
+        conn.backend_conn->coalesce_key = coalesce_key;
+    }
+
+    // Arm backend timeout (covers connect + response). The timer is
+    // cancelled by ~BackendConnection, so completion and error paths need
+    // no explicit bookkeeping; on expiry the normal error path sends a 502.
+    if (config_->server.read_timeout > 0) {
+        conn.backend_conn->timer_wheel = &timer_wheel_;
+        int timeout_fd = conn.backend_conn->backend_fd;
+        conn.backend_conn->timeout_timer = timer_wheel_.add(
+            config_->server.read_timeout,
+            [this, timeout_fd] { handle_backend_event(timeout_fd, false, false, true); });
+    }
+
+    // Arm the hedge timer for idempotent requests: if the primary hasn't
+    // produced response bytes by the delay (a worker latency percentile,
+    // refreshed each timer sweep), launch_hedge races a duplicate against
+    // a different backend. Coalesced leaders are excluded - the fan-out
+    // bookkeeping lives on the leader's primary connection.
+    upstream->note_proxied_request();
+    if (upstream->hedging().enabled && conn.request.method == http::Method::GET &&
+        !coalescable && upstream->backends().size() > 1 && upstream->hedge_delay_ms() > 0) {
+        int primary_fd = conn.backend_conn->backend_fd;
+        conn.backend_conn->timer_wheel = &timer_wheel_;
+        conn.backend_conn->hedge_timer = timer_wheel_.add(
+            upstream->hedge_delay_ms(), [this, primary_fd] { launch_hedge(primary_fd); });
+    }
+
+    // Shadow mirroring: duplicate a sample of this route's traffic to the
+    // mirror upstream. Fired last - the primary is fully armed above, so
+    // nothing on the mirror path can fail or delay it.
+    if (!ctx.route_match.mirror_upstream.empty()) {
+        launch_mirror(ctx.route_match, conn.backend_conn->send_buffer);
+    }
+
     // Return true - request will be handled asynchronously
     // handle_backend_event() will be called when backend socket is ready
     return true;
 }
 
-int Server::connect_to_backend(const std::string& host, uint16_t port) {
-    // Create socket
-    int sockfd = socket(AF_INET, SOCK_STREAM, 0);
-    if (sockfd < 0) {
-        return -1;
+void Server::launch_mirror(const gateway::RouteMatch& match,
+                           std::span<const uint8_t> request_bytes) {
+    // Sampling decides first: the common non-sampled case does no work
+    mirror_rng_ ^= mirror_rng_ << 13;
+    mirror_rng_ ^= mirror_rng_ >> 7;
+    mirror_rng_ ^= mirror_rng_ << 17;
+    if (match.mirror_sample_percent < 100 && mirror_rng_ % 100 >= match.mirror_sample_percent) {
+        return;
     }
 
-    // Resolve hostname
-    struct sockaddr_in addr{};
-    addr.sin_family = AF_INET;
-    addr.sin_port = htons(port);
-
-    // Try direct IP first (fastest path)
-    if (inet_pton(AF_INET, host.c_str(), &addr.sin_addr) != 1) {
-        // Check DNS cache before doing expensive resolution
-        auto cache_it = dns_cache_.find(host);
-        if (cache_it != dns_cache_.end()) {
-            // Cache hit - reuse resolved address
-            addr = cache_it->second;
-            addr.sin_port = htons(port);  // Port might differ
-        } else {
-            // Cache miss - perform DNS resolution
-            struct addrinfo hints{}, *result = nullptr;
-            hints.ai_family = AF_INET;
-            hints.ai_socktype = SOCK_STREAM;
+    auto* upstream = upstream_manager_->get_upstream(match.mirror_upstream);
+    if (!upstream) {
+        return;
+    }
+    const gateway::Backend* backend = upstream->select_backend();
+    if (!backend) {
+        return;
+    }
 
-            if (getaddrinfo(host.c_str(), nullptr, &hints, &result) != 0 || !result) {
-                close_fd(sockfd);
-                return -1;
-            }
+    int fd = connect_to_backend_async(backend->host, backend->port);
+    if (fd < 0) {
+        return;
+    }
+    if (!add_backend_to_epoll(fd, EPOLLOUT | EPOLLIN)) {
+        close_fd(fd);
+        return;
+    }
 
-            addr = *reinterpret_cast<struct sockaddr_in*>(result->ai_addr);
-            addr.sin_port = htons(port);
-            freeaddrinfo(result);
+    // Sentinel entry: events on this fd dispatch to handle_shadow_event
+    backend_connections_[fd] = {kShadowMirrorFd, -1};
+    ShadowMirror& mirror = shadow_mirrors_[fd];
+    mirror.fd = fd;
+    mirror.send_buffer.assign(request_bytes.begin(), request_bytes.end());
+    mirror.started = std::chrono::steady_clock::now();
+}
 
-            // Store in cache for future connections
-            dns_cache_[host] = addr;
-        }
+void Server::handle_shadow_event(int shadow_fd, bool readable, bool writable, bool error) {
+    auto it = shadow_mirrors_.find(shadow_fd);
+    if (it == shadow_mirrors_.end()) {
+        // Already torn down - stale event
+        backend_connections_.erase(shadow_fd);
+        return;
     }
+    ShadowMirror& mirror = it->second;
 
-    // Connect (blocking for MVP - TODO: non-blocking + io_uring)
-    if (connect(sockfd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0) {
-        close_fd(sockfd);
-        return -1;
+    if (error) {
+        close_shadow(shadow_fd);
+        return;
     }
 
-    // Enable TCP_NODELAY to reduce latency (disable Nagle's algorithm)
+    if (writable) {
+        if (mirror.connect_pending) {
+            int err = 0;
+            socklen_t len = sizeof(err);
+            if (getsockopt(shadow_fd, SOL_SOCKET, SO_ERROR, &err, &len) != 0 || err != 0) {
+                close_shadow(shadow_fd);
+                return;
+            }
+            mirror.connect_pending = false;
+        }
+        while (mirror.send_cursor < mirror.send_buffer.size()) {
+            ssize_t sent = send(shadow_fd, mirror.send_buffer.data() + mirror.send_cursor,
+                                mirror.send_buffer.size() - mirror.send_cursor, MSG_NOSIGNAL);
+            if (sent <= 0) {
+                if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                    break;  // Socket full - the next writable event resumes
+                }
+                close_shadow(shadow_fd);
+                return;
+            }
+            mirror.send_cursor += static_cast<size_t>(sent);
+        }
+    }
+
+    if (readable) {
+        // Drain and discard - the shadow's answer is never inspected
+        uint8_t scratch[16384];
+        for (;;) {
+            ssize_t n = recv(shadow_fd, scratch, sizeof(scratch), 0);
+            if (n > 0) {
+                continue;
+            }
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                break;
+            }
+            close_shadow(shadow_fd);  // EOF or error - the mirror is done
+            return;
+        }
+    }
+}
+
+void Server::close_shadow(int shadow_fd) {
+    (void)remove_backend_from_epoll(shadow_fd);
+    backend_connections_.erase(shadow_fd);
+    shadow_mirrors_.erase(shadow_fd);
+    close_fd(shadow_fd);
+}
+
+bool Server::proxy_to_backend_h2(Connection& conn, gateway::RequestContext& ctx,
+                                 gateway::Upstream& upstream, const gateway::Backend& backend) {
+    // One multiplexed channel per backend per worker, dialed lazily. h2c with
+    // prior knowledge (RFC 7540 §3.4): backends are cleartext TCP, so the
+    // client preface goes out right after connect - no ALPN round trip.
+    std::string channel_key = backend.host;
+    channel_key += ':';
+    channel_key += std::to_string(backend.port);
+
+    H2BackendChannel* channel = nullptr;
+    if (auto it = h2_backend_channels_.find(channel_key); it != h2_backend_channels_.end()) {
+        channel = it->second.get();
+        if (channel->session->should_close()) {
+            if (channel->session_busy) {
+                // GOAWAY noticed mid-recv: the event handler tears the channel
+                // down once its loop unwinds - just refuse this request
+                return false;
+            }
+            // Backend sent GOAWAY - retire the channel and dial a fresh one
+            fail_h2_channel(*channel);
+            channel = nullptr;
+        }
+    }
+
+    if (!channel) {
+        int fd = connect_to_backend_async(backend.host, backend.port);
+        if (fd < 0) {
+            return false;
+        }
+
+        auto new_channel = std::make_unique<H2BackendChannel>();
+        new_channel->fd = fd;
+        new_channel->connect_pending = true;
+        new_channel->host = backend.host;
+        new_channel->port = backend.port;
+        new_channel->upstream_name = std::string(upstream.name());
+        new_channel->session =
+            std::make_unique<http::H2Session>(false, config_->server.h2_max_window);  // Client mode
+
+        // Completed (or reset) backend streams surface through the session's
+        // close callback, while the stream's response is still readable
+        H2BackendChannel* channel_ptr = new_channel.get();
+        new_channel->session->set_stream_close_callback(
+            [this, channel_ptr](int32_t stream_id) { complete_h2_stream(*channel_ptr, stream_id); });
+
+        if (!add_backend_to_epoll(fd, EPOLLOUT | EPOLLIN)) {
+            close_fd(fd);
+            return false;
+        }
+
+        // Sentinel entry: events on this fd dispatch to handle_h2_backend_event
+        backend_connections_[fd] = {kH2BackendChannelFd, -1};
+
+        channel = new_channel.get();
+        h2_backend_channels_[channel_key] = std::move(new_channel);
+    }
+
+    // Per-stream context: everything the response path needs, with owned
+    // string storage (conn.recv_buffer is reused before the response lands)
+    auto sctx = std::make_unique<H2BackendStream>();
+    sctx->client_fd = conn.fd;
+    sctx->client_generation = connections_.generation(conn.fd);
+    sctx->client_stream_id = current_h2_client_stream_;
+    sctx->start_time = ctx.start_time;
+    sctx->flight = conn.flight;  // Trace follows the stream context
+    conn.flight.reset();
+    sctx->metadata = std::move(ctx.metadata);
+    sctx->metadata["correlation_id"] = ctx.correlation_id;
+    sctx->route_match = ctx.route_match;
+    sctx->config_pin = snapshot_pin_;  // route_match views the live router
+    sctx->header_transforms = std::move(ctx.header_transforms);
+
+    // Apply path/query rewrites from TransformMiddleware (arena-backed
+    // overrides, metadata fallback - same precedence as build_backend_request)
+    std::string_view actual_path = conn.request.path;
+    std::string_view actual_query = conn.request.query;
+    if (!ctx.transformed_path.empty()) {
+        actual_path = ctx.transformed_path;
+    } else if (auto it = sctx->metadata.find("transformed_path"); it != sctx->metadata.end()) {
+        actual_path = it->second;
+    }
+    if (!ctx.transformed_query.empty()) {
+        actual_query = ctx.transformed_query;
+    } else if (auto it = sctx->metadata.find("transformed_query"); it != sctx->metadata.end()) {
+        actual_query = it->second;
+    }
+
+    sctx->owned_path = actual_path;
+    sctx->owned_query = actual_query;
+    sctx->owned_uri = sctx->owned_path;
+    if (!sctx->owned_query.empty()) {
+        sctx->owned_uri += '?';
+        sctx->owned_uri += sctx->owned_query;
+    }
+
+    // Header transforms are applied up front into owned storage - there is no
+    // HTTP/1.1 serialization step to do it in
+    std::unordered_set<std::string_view> headers_to_remove;
+    if (sctx->header_transforms.has_value()) {
+        for (const auto& header_name : sctx->header_transforms->remove) {
+            headers_to_remove.insert(header_name);
+        }
+    }
+
+    bool has_host = false;
+    sctx->request_header_storage.reserve(conn.request.headers.size());
+    for (const auto& header : conn.request.headers) {
+        if (headers_to_remove.count(header.name) > 0) {
+            continue;
+        }
+        if (http::header_name_equals(header.name, "Host")) {
+            has_host = true;
+        }
+
+        std::string_view value = header.value;
+        if (sctx->header_transforms.has_value()) {
+            for (const auto& [modify_name, modify_value] : sctx->header_transforms->modify) {
+                if (header.name == modify_name) {
+                    value = modify_value;
+                    break;
+                }
+            }
+        }
+        sctx->request_header_storage.emplace_back(std::string(header.name), std::string(value));
+    }
+    if (sctx->header_transforms.has_value()) {
+        for (const auto& [header_name, header_value] : sctx->header_transforms->add) {
+            sctx->request_header_storage.emplace_back(std::string(header_name),
+                                                      std::string(header_value));
+        }
+    }
+    if (!has_host) {
+        // Becomes :authority in submit_request
+        sctx->request_header_storage.emplace_back("Host", channel_key);
+    }
+
+    // Preserve the request for response middleware, views into owned storage
+    sctx->preserved_request = conn.request;
+    sctx->preserved_request.path = sctx->owned_path;
+    sctx->preserved_request.uri = sctx->owned_uri;
+    sctx->preserved_request.query = sctx->owned_query;
+    sctx->preserved_request.headers.clear();
+    sctx->preserved_request.headers.reserve(sctx->request_header_storage.size());
+    for (const auto& [name, value] : sctx->request_header_storage) {
+        sctx->preserved_request.headers.push_back({name, value});
+    }
+
+    // Submit as a new stream. :path carries the query; the session copies
+    // headers and body into its own storage before this function returns.
+    http::Request h2_request = sctx->preserved_request;
+    h2_request.path = sctx->owned_uri;
+
+    int32_t backend_stream_id = -1;
+    if (auto ec = channel->session->submit_request(h2_request, backend_stream_id); ec) {
+        return false;
+    }
+
+    channel->streams[backend_stream_id] = std::move(sctx);
+
+    // Flush HEADERS (and preface on a fresh channel) unless the connect is
+    // still pending - handle_h2_backend_event flushes on connect completion
+    if (!channel->connect_pending) {
+        flush_h2_channel(*channel);
+    }
+
+    return true;
+}
+
+int Server::connect_to_backend(const std::string& host, uint16_t port) {
+    // Create socket
+    int sockfd = socket(AF_INET, SOCK_STREAM, 0);
+    if (sockfd < 0) {
+        return -1;
+    }
+
+    // Resolve hostname
+    struct sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+
+    // Try direct IP first (fastest path)
+    if (inet_pton(AF_INET, host.c_str(), &addr.sin_addr) != 1) {
+        // Non-blocking lookup against the background resolver cache
+        auto& resolver = upstream_manager_->dns_resolver();
+        auto resolved = resolver.lookup(host);
+        if (!resolved) {
+            // First-ever sighting of this host - pay the blocking cost once;
+            // the resolver refreshes it in the background afterwards
+            resolved = resolver.resolve_now(host);
+        }
+        if (!resolved) {
+            close_fd(sockfd);
+            return -1;
+        }
+        addr = *resolved;
+        addr.sin_port = htons(port);  // Resolver doesn't store the port
+    }
+
+    // Fast Open toward the backend: with a cached cookie the request
+    // rides the SYN (transparent to the plain connect/write below)
+    if (config_->server.backend_tcp_fastopen) {
+        (void)core::set_tcp_fastopen_connect(sockfd);
+    }
+
+    // Connect (blocking for MVP - TODO: non-blocking + io_uring)
+    if (connect(sockfd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0) {
+        close_fd(sockfd);
+        return -1;
+    }
+
+    // Enable TCP_NODELAY to reduce latency (disable Nagle's algorithm)
     // This is critical for API gateway workloads with small messages
     int flag = 1;
     setsockopt(sockfd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(int));
@@ -945,6 +1973,12 @@ int Server::connect_to_backend_async(const std::string& host, uint16_t port) {
     int flag = 1;
     setsockopt(sockfd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(int));
 
+    // Fast Open toward the backend: with a cached cookie connect()
+    // completes immediately and the request goes out in the SYN
+    if (config_->server.backend_tcp_fastopen) {
+        (void)core::set_tcp_fastopen_connect(sockfd);
+    }
+
     // Resolve address (same as blocking version)
     sockaddr_in addr{};
     addr.sin_family = AF_INET;
@@ -952,28 +1986,20 @@ int Server::connect_to_backend_async(const std::string& host, uint16_t port) {
 
     // Try direct IP first
     if (inet_pton(AF_INET, host.c_str(), &addr.sin_addr) != 1) {
-        // Check DNS cache
-        auto cache_it = dns_cache_.find(host);
-        if (cache_it != dns_cache_.end()) {
-            addr = cache_it->second;
-            addr.sin_port = htons(port);
-        } else {
-            // DNS resolution (still blocking for now - TODO: async DNS)
-            struct addrinfo hints{}, *result = nullptr;
-            hints.ai_family = AF_INET;
-            hints.ai_socktype = SOCK_STREAM;
-
-            if (getaddrinfo(host.c_str(), nullptr, &hints, &result) != 0 || !result) {
-                close_fd(sockfd);
-                return -1;
-            }
-
-            addr = *reinterpret_cast<struct sockaddr_in*>(result->ai_addr);
-            addr.sin_port = htons(port);
-            freeaddrinfo(result);
-
-            dns_cache_[host] = addr;
+        // Resolved by the background DNS resolver - never blocks the loop
+        // for known hosts (stale addresses are served while refreshing)
+        auto& resolver = upstream_manager_->dns_resolver();
+        auto resolved = resolver.lookup(host);
+        if (!resolved) {
+            // First-ever sighting - blocking fallback, cached afterwards
+            resolved = resolver.resolve_now(host);
+        }
+        if (!resolved) {
+            close_fd(sockfd);
+            return -1;
         }
+        addr = *resolved;
+        addr.sin_port = htons(port);
     }
 
     // Non-blocking connect - will return EINPROGRESS
@@ -993,21 +2019,26 @@ int Server::connect_to_backend_async(const std::string& host, uint16_t port) {
 
 std::string Server::build_backend_request(
     const http::Request& request, const titan::core::fast_map<std::string, std::string>& metadata,
-    const std::optional<gateway::HeaderTransformations>& header_transforms) {
+    const std::optional<gateway::HeaderTransformations>& header_transforms,
+    std::string_view path_override, std::string_view query_override) {
     std::string req;
 
-    // Use transformed path/query from metadata if present (from TransformMiddleware)
+    // Use transformed path/query if present (from TransformMiddleware).
+    // Arena-backed overrides are preferred; metadata is the fallback for
+    // contexts created without an arena.
     std::string_view actual_path = request.path;
     std::string_view actual_query = request.query;
 
-    auto transformed_path_it = metadata.find("transformed_path");
-    if (transformed_path_it != metadata.end()) {
-        actual_path = transformed_path_it->second;
+    if (!path_override.empty()) {
+        actual_path = path_override;
+    } else if (auto it = metadata.find("transformed_path"); it != metadata.end()) {
+        actual_path = it->second;
     }
 
-    auto transformed_query_it = metadata.find("transformed_query");
-    if (transformed_query_it != metadata.end()) {
-        actual_query = transformed_query_it->second;
+    if (!query_override.empty()) {
+        actual_query = query_override;
+    } else if (auto it = metadata.find("transformed_query"); it != metadata.end()) {
+        actual_query = it->second;
     }
 
     // Calculate size to avoid reallocation
@@ -1219,27 +2250,54 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
     LOG_DEBUG(logger_, "Backend event: fd={} readable={} writable={} error={}", backend_fd,
               readable, writable, error);
 
-    auto it = backend_connections_.find(backend_fd);
-    if (it == backend_connections_.end()) {
+    // The offload eventfd rides the backend epoll; a readable event means
+    // compressor threads delivered finished jobs to the mailbox
+    if (backend_fd == offload_eventfd_) {
+        process_offload_completions();
+        return;
+    }
+
+    auto* entry = backend_connections_.find(backend_fd);
+    if (!entry) {
         LOG_DEBUG(logger_, "Backend fd={} not found in connections map", backend_fd);
         return;
     }
 
-    // Get client_fd and stream_id from map (no longer storing raw pointers)
-    int client_fd = it->second.first;
-    int32_t stream_id = it->second.second;
+    // Get client_fd and stream_id from table (no longer storing raw pointers)
+    int client_fd = entry->first;
+    int32_t stream_id = entry->second;
+
+    // HTTP/2 backend channel: not tied to a single client connection -
+    // streams carry their own routing, so dispatch to the channel handler
+    if (client_fd == kH2BackendChannelFd) {
+        for (auto& [key, channel] : h2_backend_channels_) {
+            if (channel->fd == backend_fd) {
+                handle_h2_backend_event(*channel, readable, writable, error);
+                return;
+            }
+        }
+        // Channel already torn down - stale event
+        backend_connections_.erase(backend_fd);
+        return;
+    }
+
+    // Shadow mirror socket: fire-and-forget, never tied to a client
+    if (client_fd == kShadowMirrorFd) {
+        handle_shadow_event(backend_fd, readable, writable, error);
+        return;
+    }
 
-    auto conn_it = connections_.find(client_fd);
-    if (conn_it == connections_.end()) {
+    auto* conn_slot = connections_.find(client_fd);
+    if (!conn_slot) {
         // Client connection closed, cleanup backend
         LOG_DEBUG(logger_, "Client fd={} not found, cleaning up backend fd={}", client_fd,
                   backend_fd);
-        backend_connections_.erase(it);
+        backend_connections_.erase(backend_fd);
         close_fd(backend_fd);
         return;
     }
 
-    Connection& client_conn = *conn_it->second;
+    Connection& client_conn = **conn_slot;
 
     // Handle WebSocket backend events
     if (client_conn.protocol == Protocol::WEBSOCKET && client_conn.ws_conn) {
@@ -1257,6 +2315,10 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
     if (stream_id == -1) {
         // HTTP/1.1: Get from single backend connection
         backend_conn = client_conn.backend_conn.get();
+        // Hedged pair: the event may belong to the second racer
+        if (client_conn.hedge_conn && (!backend_conn || backend_conn->backend_fd != backend_fd)) {
+            backend_conn = client_conn.hedge_conn.get();
+        }
     } else {
         // HTTP/2: Get from per-stream backends
         auto stream_it = client_conn.h2_stream_backends.find(stream_id);
@@ -1267,15 +2329,34 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
 
     if (!backend_conn) {
         // Backend connection was already cleaned up, remove from map
-        backend_connections_.erase(it);
+        backend_connections_.erase(backend_fd);
         close_fd(backend_fd);
         return;
     }
 
+    // Active splice stream: pump regardless of which side woke us up
+    // (backend_fd readable, or client fd writable after a full socket buffer)
+    if (backend_conn->splice_active) {
+        if (error) {
+            finish_splice(client_conn, *backend_conn, false);
+        } else {
+            pump_splice(client_conn, *backend_conn);
+        }
+        return;
+    }
+
+    // Hedged pair: one racer failing (or timing out) is not a request
+    // failure - drop just that racer and let the survivor keep racing.
+    // The error paths below only ever see the last remaining racer.
+    if (error && stream_id == -1 && drop_hedge_racer(client_conn, backend_fd)) {
+        return;
+    }
+
     // Handle error
     if (error) {
         // Backend connection failed or closed
-        backend_connections_.erase(it);
+        fail_coalesced_waiters(*backend_conn);
+        backend_connections_.erase(backend_fd);
         close_fd(backend_fd);
 
         // HTTP/2 FIX: Remove from correct location based on protocol
@@ -1292,6 +2373,7 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
         client_conn.response.status = http::StatusCode::BadGateway;
         client_conn.response.reason_phrase = "Bad Gateway";
         client_conn.response.headers.clear();
+        client_conn.response.well_known.fill(0);
         client_conn.response.backend_headers.clear();
         client_conn.response.middleware_headers.clear();
         client_conn.response_body.clear();
@@ -1306,6 +2388,10 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
         socklen_t len = sizeof(connect_error);
         if (getsockopt(backend_fd, SOL_SOCKET, SO_ERROR, &connect_error, &len) < 0) {
             // getsockopt failed
+            if (stream_id == -1 && drop_hedge_racer(client_conn, backend_fd)) {
+                return;
+            }
+            fail_coalesced_waiters(*backend_conn);
 
             // Record circuit breaker failure before cleanup
             auto* upstream = upstream_manager_->get_upstream(backend_conn->upstream_name);
@@ -1313,6 +2399,7 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
                 for (auto& backend : upstream->backends()) {
                     if (backend.host == backend_conn->backend_host &&
                         backend.port == backend_conn->backend_port) {
+                        const_cast<gateway::Backend&>(backend).record_result(true);
                         if (backend.circuit_breaker) {
                             backend.circuit_breaker->record_failure();
                         }
@@ -1321,7 +2408,7 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
                 }
             }
 
-            backend_connections_.erase(it);
+            backend_connections_.erase(backend_fd);
             close_fd(backend_fd);
 
             // HTTP/2 FIX: Remove from correct location
@@ -1344,6 +2431,10 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
 
         if (connect_error != 0) {
             // Connect failed
+            if (stream_id == -1 && drop_hedge_racer(client_conn, backend_fd)) {
+                return;
+            }
+            fail_coalesced_waiters(*backend_conn);
 
             // Record circuit breaker failure before cleanup
             auto* upstream = upstream_manager_->get_upstream(backend_conn->upstream_name);
@@ -1351,6 +2442,7 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
                 for (auto& backend : upstream->backends()) {
                     if (backend.host == backend_conn->backend_host &&
                         backend.port == backend_conn->backend_port) {
+                        const_cast<gateway::Backend&>(backend).record_result(true);
                         if (backend.circuit_breaker) {
                             backend.circuit_breaker->record_failure();
                         }
@@ -1359,7 +2451,7 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
                 }
             }
 
-            backend_connections_.erase(it);
+            backend_connections_.erase(backend_fd);
             close_fd(backend_fd);
 
             // HTTP/2 FIX: Remove from correct location
@@ -1382,6 +2474,7 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
 
         // Connect succeeded!
         backend_conn->connect_pending = false;
+        backend_conn->flight.mark(control::FlightStage::BackendConnected);
         // send_pending is still true, will be handled below
     }
 
@@ -1393,6 +2486,17 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
 
         if (sent > 0) {
             backend_conn->send_cursor += sent;
+            // Streamed upload drained below the low watermark: resume
+            // client reads. Deferred via the timer wheel - the client read
+            // path re-enters this function to flush, so resuming inline
+            // would recurse into a frame that still holds backend_conn.
+            if (client_conn.request_streaming && client_conn.read_paused &&
+                backend_conn->send_buffer.size() - backend_conn->send_cursor <
+                    config_->server.stream_low_watermark) {
+                client_conn.read_paused = false;
+                int resume_fd = client_conn.fd;
+                (void)timer_wheel_.add(0, [this, resume_fd] { handle_read(resume_fd); });
+            }
             if (backend_conn->send_cursor >= backend_conn->send_buffer.size()) {
                 // All data sent, now wait for response
                 backend_conn->send_pending = false;
@@ -1400,6 +2504,10 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
             }
         } else if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
             // Send failed
+            if (stream_id == -1 && drop_hedge_racer(client_conn, backend_fd)) {
+                return;
+            }
+            fail_coalesced_waiters(*backend_conn);
 
             // Record circuit breaker failure before cleanup
             auto* upstream = upstream_manager_->get_upstream(backend_conn->upstream_name);
@@ -1407,6 +2515,7 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
                 for (auto& backend : upstream->backends()) {
                     if (backend.host == backend_conn->backend_host &&
                         backend.port == backend_conn->backend_port) {
+                        const_cast<gateway::Backend&>(backend).record_result(true);
                         if (backend.circuit_breaker) {
                             backend.circuit_breaker->record_failure();
                         }
@@ -1415,7 +2524,7 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
                 }
             }
 
-            backend_connections_.erase(it);
+            backend_connections_.erase(backend_fd);
             close_fd(backend_fd);
 
             // HTTP/2 FIX: Remove from correct location
@@ -1468,27 +2577,96 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
             }
         }
 
+        // The race is decided by the first racer to produce response
+        // bytes: cancel the loser before committing this response to the
+        // client (promotes the hedge into backend_conn when it won)
+        if (stream_id == -1 && client_conn.hedge_conn && !should_send_error &&
+            !backend_conn->recv_buffer.empty()) {
+            cancel_hedge_loser(client_conn, backend_fd);
+            backend_conn = client_conn.backend_conn.get();
+        }
+
+        // Large responses: once the header block is complete, switch to
+        // kernel-to-kernel splice() streaming instead of buffering the body
+        // (Linux, cleartext or kTLS HTTP/1.1 clients - see try_start_splice).
+        // Chunked responses are never splice-eligible, so skip the header
+        // rescan once the incremental decoder has taken over
+        if (!should_send_error && !backend_conn->chunked_streaming &&
+            try_start_splice(client_conn, *backend_conn)) {
+            return;
+        }
+
         // Now try parsing the complete buffer (AFTER all reading is done)
         bool response_complete = false;
         http::Response response;
 
         if (!should_send_error && !backend_conn->recv_buffer.empty()) {
-            http::Parser parser;
-            auto [result, consumed] = parser.parse_response(
-                std::span<const uint8_t>(backend_conn->recv_buffer), response);
-
-            if (result == http::ParseResult::Complete) {
-                response_complete = true;
-            } else if (result == http::ParseResult::Error) {
-                should_send_error = true;
+            // Streaming backends (LLM-style APIs) deliver chunked bodies as
+            // thousands of tiny chunks across as many epoll events, and
+            // re-running llhttp over the whole accumulated buffer per event
+            // is quadratic in that chunk count. Once the header block
+            // announces chunked framing, switch to the incremental decoder:
+            // each event feeds only the newly arrived bytes and records the
+            // payload runs as recv_buffer offsets - no compaction pass
+            if (!backend_conn->chunked_streaming) {
+                maybe_start_chunked_decode(*backend_conn);
+            }
+
+            if (backend_conn->chunked_streaming) {
+                auto& buf = backend_conn->recv_buffer;
+                chunk_slice_scratch_.clear();
+                auto [chunk_result, consumed] = backend_conn->chunked_decoder.feed(
+                    std::span<const uint8_t>(buf).subspan(backend_conn->chunked_cursor),
+                    chunk_slice_scratch_);
+                // The spans point into buf's current allocation; persist
+                // them as offsets before the next insert can reallocate
+                for (const auto& slice : chunk_slice_scratch_) {
+                    backend_conn->chunked_slices.emplace_back(
+                        static_cast<size_t>(slice.data() - buf.data()), slice.size());
+                }
+                backend_conn->chunked_cursor += consumed;
+
+                if (chunk_result == http::ChunkedResult::Error) {
+                    should_send_error = true;
+                } else if (chunk_result == http::ChunkedResult::Complete) {
+                    // Body framing is done; re-parse the (short) header
+                    // block for status and headers
+                    http::Parser parser;
+                    auto [result, header_consumed] = parser.parse_response_headers(
+                        std::span<const uint8_t>(buf.data(), backend_conn->chunked_header_len),
+                        response);
+                    if (result == http::ParseResult::Complete) {
+                        response_complete = true;
+                    } else {
+                        should_send_error = true;
+                    }
+                } else {
+                    // Incomplete - wait for next epoll event to read more data
+                    return;
+                }
             } else {
-                // Incomplete - wait for next epoll event to read more data
-                return;  // Don't process response yet, wait for more data
+                http::Parser parser;
+                auto [result, consumed] = parser.parse_response(
+                    std::span<const uint8_t>(backend_conn->recv_buffer), response);
+
+                if (result == http::ParseResult::Complete) {
+                    response_complete = true;
+                } else if (result == http::ParseResult::Error) {
+                    should_send_error = true;
+                } else {
+                    // Incomplete - wait for next epoll event to read more data
+                    return;  // Don't process response yet, wait for more data
+                }
             }
         }
 
         // Handle error cases - send 502 Bad Gateway to client
         if (should_send_error) {
+            if (stream_id == -1 && drop_hedge_racer(client_conn, backend_fd)) {
+                return;
+            }
+            fail_coalesced_waiters(*backend_conn);
+
             // Send error response using existing client_conn reference
             client_conn.response.status = http::StatusCode::BadGateway;
             client_conn.response.reason_phrase = "Bad Gateway";
@@ -1501,7 +2679,7 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
             // Cleanup backend connection
             close_fd(backend_fd);
             (void)remove_backend_from_epoll(backend_fd);
-            backend_connections_.erase(it);
+            backend_connections_.erase(backend_fd);
             return;
         }
 
@@ -1530,8 +2708,21 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
                 client_conn.response.headers.push_back({name, value});
             }
 
-            // Copy body to owned buffer
-            client_conn.response_body.assign(response.body.begin(), response.body.end());
+            // Copy body to owned buffer. Chunked responses assemble from
+            // the decoder's recorded payload runs: one reserve and ordered
+            // copies out of recv_buffer, skipping the framing bytes
+            if (backend_conn->chunked_streaming) {
+                const uint8_t* base = backend_conn->recv_buffer.data();
+                client_conn.response_body.clear();
+                client_conn.response_body.reserve(
+                    backend_conn->chunked_decoder.decoded_bytes());
+                for (const auto& [offset, length] : backend_conn->chunked_slices) {
+                    client_conn.response_body.insert(client_conn.response_body.end(),
+                                                     base + offset, base + offset + length);
+                }
+            } else {
+                client_conn.response_body.assign(response.body.begin(), response.body.end());
+            }
             client_conn.response.body = client_conn.response_body;
 
             // CRITICAL: Clear middleware_headers before response middleware runs
@@ -1553,6 +2744,12 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
             resp_ctx.start_time = backend_conn->start_time;
             resp_ctx.metadata = backend_conn->metadata;
 
+            // HTTP/1.1 clients can have large-body compression offloaded
+            // (the deferred send only exists on the 1.1 path)
+            if (client_conn.protocol != Protocol::HTTP_2 && offload_eventfd_ >= 0) {
+                resp_ctx.set_metadata("compression_offload_capable", "1");
+            }
+
             // Populate backend for circuit breaker feedback
             auto* upstream = upstream_manager_->get_upstream(backend_conn->upstream_name);
             if (upstream) {
@@ -1566,8 +2763,30 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
                 }
             }
 
+            // Feed the backend's latency EWMA (latency-aware balancing)
+            if (resp_ctx.backend) {
+                auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - backend_conn->start_time);
+                resp_ctx.backend->record_latency(static_cast<uint64_t>(elapsed.count()));
+            }
+
+            backend_conn->flight.mark(control::FlightStage::BackendResponded);
             (void)pipeline_->execute_response(resp_ctx);
 
+            // Flight trace: HTTP/1.1 clients get the trace back so the
+            // Complete mark lands after the client write in send_response;
+            // HTTP/2 clients commit below (submit time approximates it)
+            if (client_conn.protocol != Protocol::HTTP_2) {
+                client_conn.flight = backend_conn->flight;
+                client_conn.flight_route_id = backend_conn->route_match.metrics_id;
+                backend_conn->flight.reset();
+            }
+
+            // Per-route stats: array-indexed by the route's dense ID
+            record_route_metrics(backend_conn->route_match, backend_conn->start_time,
+                                 static_cast<uint16_t>(client_conn.response.status),
+                                 &backend_conn->flight);
+
             // Return backend connection to pool (or close if not keep-alive)
             // CRITICAL: Remove from epoll BEFORE returning to pool!
             // Reuse upstream from above (already looked up for circuit breaker)
@@ -1600,8 +2819,10 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
             }
 
             // Cleanup backend connection
-            backend_connections_.erase(it);
+            backend_connections_.erase(backend_fd);
             int32_t stream_id = backend_conn->stream_id;  // Save before reset
+            bool coalesced_leader = backend_conn->coalesced_leader;
+            uint64_t coalesce_key = backend_conn->coalesce_key;
 
             // HTTP/2 FIX: Remove from correct location based on protocol
             if (stream_id >= 0) {
@@ -1615,118 +2836,21 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
             // Send response to client
             if (client_conn.protocol == Protocol::HTTP_2) {
                 // HTTP/2 - submit response to H2 session
-                if (client_conn.h2_session && stream_id >= 0) {
-                    auto* stream = client_conn.h2_session->get_stream(stream_id);
-                    if (stream) {
-                        // Copy response (headers contain string_views that must be converted to
-                        // owned strings)
-                        stream->response.status = client_conn.response.status;
-                        stream->response.reason_phrase = client_conn.response.reason_phrase;
-
-                        // Store headers in persistent storage, then create views to them
-                        // IMPORTANT: Use all_headers iterator to include BOTH backend and
-                        // middleware headers
-                        stream->response_header_storage.clear();
-                        stream->response.headers.clear();
-
-                        // Iterate over all headers (backend + middleware)
-                        for (auto it = client_conn.response.all_headers_begin();
-                             it != client_conn.response.all_headers_end(); ++it) {
-                            auto [name, value] = *it;
-                            stream->response_header_storage.emplace_back(std::string(name),
-                                                                         std::string(value));
-                            const auto& stored = stream->response_header_storage.back();
-                            stream->response.headers.push_back({stored.first, stored.second});
-                        }
-
-                        // Copy body
-                        stream->response_body = std::move(client_conn.response_body);
-                        stream->response.body = stream->response_body;
-                        stream->response_complete = true;
-
-                        // Filter out HTTP/1.1-specific headers forbidden in HTTP/2
-                        // Per RFC 7540 Section 8.1.2: connection-specific headers must not be
-                        // included Also filter out empty headers
-                        auto& headers = stream->response.headers;
-                        headers.erase(std::remove_if(headers.begin(), headers.end(),
-                                                     [](const http::Header& h) {
-                                                         // Remove empty headers
-                                                         if (h.name.empty() || h.value.empty()) {
-                                                             return true;
-                                                         }
-                                                         std::string name_lower(h.name);
-                                                         std::transform(
-                                                             name_lower.begin(), name_lower.end(),
-                                                             name_lower.begin(), ::tolower);
-                                                         return name_lower == "connection" ||
-                                                                name_lower == "keep-alive" ||
-                                                                name_lower == "proxy-connection" ||
-                                                                name_lower == "transfer-encoding" ||
-                                                                name_lower == "upgrade";
-                                                     }),
-                                      headers.end());
-
-                        // Submit response to HTTP/2 session
-                        auto ec =
-                            client_conn.h2_session->submit_response(stream_id, stream->response);
-                        (void)ec;  // Suppress unused variable warning
-
-                        // Serialize and send HTTP/2 frames
-                        auto data = client_conn.h2_session->send_data();
-                        if (!data.empty()) {
-                            ssize_t sent;
-                            if (client_conn.tls_enabled) {
-                                sent = ssl_write_nonblocking(client_conn.ssl, data);
-                            } else {
-                                sent = send(client_conn.fd, data.data(), data.size(), 0);
-                            }
-
-                            if (sent > 0) {
-                                client_conn.h2_session->consume_send_buffer(sent);
-                            }
-                        }
-
-                        // CRITICAL FIX for TLS HTTP/2 multiplexing:
-                        // After sending a response, check if there's more client data buffered in
-                        // SSL. This handles edge-triggered epoll + SSL buffering: when multiple
-                        // HTTP/2 requests arrive in the same TLS record, subsequent requests sit in
-                        // SSL's internal buffer and epoll won't fire again (data already decrypted,
-                        // not at socket layer). Without this, the second request on a multiplexed
-                        // connection hangs forever.
-                        if (client_conn.tls_enabled) {
-                            while (SSL_pending(client_conn.ssl) > 0) {
-                                // Drain SSL internal buffer
-                                size_t available = client_conn.recv_buffer.capacity() -
-                                                   client_conn.recv_buffer.size();
-                                if (available == 0) {
-                                    client_conn.recv_buffer.reserve(
-                                        client_conn.recv_buffer.capacity() + 8192);
-                                    available = client_conn.recv_buffer.capacity() -
-                                                client_conn.recv_buffer.size();
-                                }
-
-                                int n = SSL_read(
-                                    client_conn.ssl,
-                                    client_conn.recv_buffer.data() + client_conn.recv_buffer.size(),
-                                    available);
-                                if (n > 0) {
-                                    client_conn.recv_buffer.resize(client_conn.recv_buffer.size() +
-                                                                   n);
-                                } else {
-                                    break;  // No more data or would block
-                                }
-                            }
+                submit_h2_response_to_client(client_conn, stream_id);
+            } else {
+                // Replay the finished response to parked duplicate requests
+                // first: the waiter copies read from client_conn's owned
+                // header/body storage, which send_response may consume
+                if (coalesced_leader) {
+                    fan_out_coalesced(coalesce_key, client_conn);
+                }
 
-                            // Process any buffered client frames
-                            if (!client_conn.recv_buffer.empty()) {
-                                handle_http2(client_conn);
-                            }
-                        }
-                    }
+                // Large marked bodies go to the compressor pool; the
+                // response is sent when the compressed body comes back
+                if (!try_offload_compression(client_conn, resp_ctx)) {
+                    // HTTP/1.1 - use existing send_response
+                    send_response(client_conn, client_conn.keep_alive);
                 }
-            } else {
-                // HTTP/1.1 - use existing send_response
-                send_response(client_conn, client_conn.keep_alive);
             }
         }
         // If !response_complete: either EAGAIN (wait for more data) or error (already handled in
@@ -1734,62 +2858,1508 @@ void Server::handle_backend_event(int backend_fd, bool readable, bool writable,
     }
 }
 
-void Server::process_backend_operations() {
-    // This method is called periodically to process any pending backend operations
-    // For now, it's a placeholder - most processing happens in handle_backend_event()
-    // In the future, this could handle timeouts, retries, etc.
-}
+void Server::submit_h2_response_to_client(Connection& client_conn, int32_t stream_id) {
+    if (!client_conn.h2_session || stream_id < 0) {
+        return;
+    }
+    auto* stream = client_conn.h2_session->get_stream(stream_id);
+    if (!stream) {
+        return;
+    }
 
-bool Server::add_backend_to_epoll(int backend_fd, uint32_t events) {
-#ifdef __linux__
-    epoll_event ev{};
-    ev.events = events | EPOLLET;  // Edge-triggered
-    ev.data.fd = backend_fd;
-    return epoll_ctl(backend_epoll_fd_, EPOLL_CTL_ADD, backend_fd, &ev) == 0;
-#elif defined(__APPLE__) || defined(__FreeBSD__)
-    // For kqueue, we need to add separate kevents for read and write
-    struct kevent kevs[2];
-    int nchanges = 0;
+    // Copy response (headers contain string_views that must be converted to
+    // owned strings)
+    stream->response.status = client_conn.response.status;
+    stream->response.reason_phrase = client_conn.response.reason_phrase;
 
-    if (events & EPOLLIN) {
-        EV_SET(&kevs[nchanges++], backend_fd, EVFILT_READ, EV_ADD | EV_ENABLE | EV_CLEAR, 0, 0,
-               nullptr);
-    }
-    if (events & EPOLLOUT) {
-        EV_SET(&kevs[nchanges++], backend_fd, EVFILT_WRITE, EV_ADD | EV_ENABLE | EV_CLEAR, 0, 0,
-               nullptr);
+    // Store headers in persistent storage, then create views to them
+    // IMPORTANT: Use all_headers iterator to include BOTH backend and
+    // middleware headers
+    stream->response_header_storage.clear();
+    stream->response.headers.clear();
+
+    // Iterate over all headers (backend + middleware)
+    for (auto it = client_conn.response.all_headers_begin();
+         it != client_conn.response.all_headers_end(); ++it) {
+        auto [name, value] = *it;
+        stream->response_header_storage.emplace_back(std::string(name), std::string(value));
+        const auto& stored = stream->response_header_storage.back();
+        stream->response.headers.push_back(
+            {stored.first, stored.second, http::well_known_header_id(stored.first)});
     }
 
-    if (nchanges > 0) {
-        return kevent(backend_epoll_fd_, kevs, nchanges, nullptr, 0, nullptr) == 0;
+    // Copy body
+    stream->response_body = std::move(client_conn.response_body);
+    stream->response.body = stream->response_body;
+    stream->response_complete = true;
+
+    // Filter out HTTP/1.1-specific headers forbidden in HTTP/2
+    // Per RFC 7540 Section 8.1.2: connection-specific headers must not be
+    // included Also filter out empty headers
+    auto& headers = stream->response.headers;
+    headers.erase(std::remove_if(headers.begin(), headers.end(),
+                                 [](const http::Header& h) {
+                                     // Remove empty headers
+                                     if (h.name.empty() || h.value.empty()) {
+                                         return true;
+                                     }
+                                     // Well-known names settle on the inline ID
+                                     if (h.known_id == http::WellKnownHeader::Connection ||
+                                         h.known_id == http::WellKnownHeader::TransferEncoding ||
+                                         h.known_id == http::WellKnownHeader::Upgrade) {
+                                         return true;
+                                     }
+                                     if (h.known_id != http::WellKnownHeader::Unknown) {
+                                         return false;
+                                     }
+                                     std::string name_lower(h.name);
+                                     std::transform(name_lower.begin(), name_lower.end(),
+                                                    name_lower.begin(), ::tolower);
+                                     return name_lower == "keep-alive" ||
+                                            name_lower == "proxy-connection";
+                                 }),
+                  headers.end());
+
+    // HTTP/3 advertisement, added after the filter so it survives it.
+    // Views point at the config snapshot, which outlives any in-flight
+    // response (retired snapshots are held until quiescent).
+    if (!config_->server.alt_svc.empty()) {
+        headers.push_back({"alt-svc", config_->server.alt_svc, http::WellKnownHeader::Unknown});
     }
-    return false;
-#else
-    return false;
-#endif
-}
 
-bool Server::remove_backend_from_epoll(int backend_fd) {
-#ifdef __linux__
-    // On Linux, EPOLL_CTL_DEL doesn't need an event structure (can be nullptr)
-    return epoll_ctl(backend_epoll_fd_, EPOLL_CTL_DEL, backend_fd, nullptr) == 0;
-#elif defined(__APPLE__) || defined(__FreeBSD__)
-    // For kqueue, we need to delete both READ and WRITE filters
-    struct kevent kevs[2];
-    EV_SET(&kevs[0], backend_fd, EVFILT_READ, EV_DELETE, 0, 0, nullptr);
-    EV_SET(&kevs[1], backend_fd, EVFILT_WRITE, EV_DELETE, 0, 0, nullptr);
+    // Submit response to HTTP/2 session
+    auto ec = client_conn.h2_session->submit_response(stream_id, stream->response);
+    (void)ec;  // Suppress unused variable warning
 
-    // It's OK if some filters don't exist (returns error but we ignore it)
-    kevent(backend_epoll_fd_, kevs, 2, nullptr, 0, nullptr);
-    return true;  // Always return true since partial success is OK
-#else
-    return false;
-#endif
-}
+    // Serialize and send HTTP/2 frames
+    auto data = client_conn.h2_session->send_data();
+    if (!data.empty()) {
+        ssize_t sent;
+        if (client_conn.tls_enabled) {
+            sent = ssl_write_nonblocking(client_conn.ssl, data);
+        } else {
+            sent = send(client_conn.fd, data.data(), data.size(), 0);
+        }
 
-// ============================================================================
-// WebSocket Support (RFC 6455)
-// ============================================================================
+        if (sent > 0) {
+            client_conn.h2_session->consume_send_buffer(sent);
+        }
+    }
+
+    // CRITICAL FIX for TLS HTTP/2 multiplexing:
+    // After sending a response, check if there's more client data buffered in
+    // SSL. This handles edge-triggered epoll + SSL buffering: when multiple
+    // HTTP/2 requests arrive in the same TLS record, subsequent requests sit in
+    // SSL's internal buffer and epoll won't fire again (data already decrypted,
+    // not at socket layer). Without this, the second request on a multiplexed
+    // connection hangs forever.
+    if (client_conn.tls_enabled) {
+        while (SSL_pending(client_conn.ssl) > 0) {
+            // Drain SSL internal buffer
+            size_t available = client_conn.recv_buffer.capacity() - client_conn.recv_buffer.size();
+            if (available == 0) {
+                client_conn.recv_buffer.reserve(client_conn.recv_buffer.capacity() + 8192);
+                available = client_conn.recv_buffer.capacity() - client_conn.recv_buffer.size();
+            }
+
+            int n = SSL_read(client_conn.ssl,
+                             client_conn.recv_buffer.data() + client_conn.recv_buffer.size(),
+                             available);
+            if (n > 0) {
+                client_conn.recv_buffer.resize(client_conn.recv_buffer.size() + n);
+            } else {
+                break;  // No more data or would block
+            }
+        }
+
+        // Process any buffered client frames
+        if (!client_conn.recv_buffer.empty()) {
+            handle_http2(client_conn);
+        }
+    }
+}
+
+void Server::handle_h2_backend_event(H2BackendChannel& channel, bool readable, bool writable,
+                                     bool error) {
+    // Connection-level failure kills every multiplexed stream at once
+    if (error) {
+        auto* upstream = upstream_manager_->get_upstream(channel.upstream_name);
+        if (upstream) {
+            for (auto& backend : upstream->backends()) {
+                if (backend.host == channel.host && backend.port == channel.port) {
+                    const_cast<gateway::Backend&>(backend).record_result(true);
+                    if (backend.circuit_breaker) {
+                        backend.circuit_breaker->record_failure();
+                    }
+                    break;
+                }
+            }
+        }
+        fail_h2_channel(channel);
+        return;
+    }
+
+    // Connect completion (EPOLLOUT fires when the non-blocking connect ends)
+    if (writable && channel.connect_pending) {
+        int connect_error = 0;
+        socklen_t len = sizeof(connect_error);
+        if (getsockopt(channel.fd, SOL_SOCKET, SO_ERROR, &connect_error, &len) < 0 ||
+            connect_error != 0) {
+            handle_h2_backend_event(channel, false, false, true);  // Reuse error path
+            return;
+        }
+        channel.connect_pending = false;
+        // Preface, SETTINGS and any streams queued while connecting go out now
+    }
+
+    if (!channel.connect_pending && (writable || channel.session->want_write())) {
+        flush_h2_channel(channel);
+    }
+
+    if (readable) {
+        // Edge-triggered: drain the socket, feeding frames to nghttp2. Stream
+        // completions fire synchronously through the session close callback.
+        uint8_t buf[16 * 1024];
+        channel.session_busy = true;
+        while (true) {
+            ssize_t n = recv(channel.fd, buf, sizeof(buf), 0);
+            if (n > 0) {
+                size_t consumed = 0;
+                auto ec = channel.session->recv(
+                    std::span<const uint8_t>(buf, static_cast<size_t>(n)), consumed);
+                if (ec) {
+                    channel.session_busy = false;
+                    fail_h2_channel(channel);
+                    return;
+                }
+            } else if (n == 0) {
+                // Backend closed the channel
+                channel.session_busy = false;
+                fail_h2_channel(channel);
+                return;
+            } else {
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    break;
+                }
+                channel.session_busy = false;
+                fail_h2_channel(channel);
+                return;
+            }
+        }
+        channel.session_busy = false;
+
+        // SETTINGS ACKs, WINDOW_UPDATEs and streams submitted from completion
+        // callbacks are pending now
+        flush_h2_channel(channel);
+    }
+
+    if (channel.session->should_close()) {
+        // GOAWAY - remaining streams will never complete
+        fail_h2_channel(channel);
+    }
+}
+
+void Server::flush_h2_channel(H2BackendChannel& channel) {
+    // Never drive nghttp2 reentrantly from inside this channel's own recv or
+    // send - handle_h2_backend_event flushes once its loop unwinds
+    if (channel.session_busy || channel.connect_pending) {
+        return;
+    }
+
+    channel.session_busy = true;
+    auto data = channel.session->send_data();
+    channel.session_busy = false;
+    if (!data.empty()) {
+        ssize_t sent = send(channel.fd, data.data(), data.size(), 0);
+        if (sent > 0) {
+            channel.session->consume_send_buffer(static_cast<size_t>(sent));
+        }
+        // Partial/blocked sends stay queued in the session buffer; the next
+        // EPOLLOUT edge flushes the remainder
+    }
+}
+
+void Server::complete_h2_stream(H2BackendChannel& channel, int32_t stream_id) {
+    auto it = channel.streams.find(stream_id);
+    if (it == channel.streams.end()) {
+        return;  // Untracked stream (already failed or never ours)
+    }
+    auto sctx = std::move(it->second);
+    channel.streams.erase(it);
+
+    // Client may have closed while the stream was in flight; the generation
+    // check also catches the fd being recycled by an unrelated connection
+    if (connections_.generation(sctx->client_fd) != sctx->client_generation) {
+        return;
+    }
+    auto* slot = connections_.find(sctx->client_fd);
+    if (!slot) {
+        return;
+    }
+    Connection& client_conn = **slot;
+
+    // Called from the session's stream close callback, so the backend stream
+    // is still readable here
+    auto* bstream = channel.session->get_stream(stream_id);
+
+    if (!bstream || !bstream->response_complete) {
+        // Stream reset without a full response - 502 to the client
+        client_conn.response.status = http::StatusCode::BadGateway;
+        client_conn.response.reason_phrase = "Bad Gateway";
+        client_conn.response.headers.clear();
+        client_conn.response.well_known.fill(0);
+        client_conn.response.backend_headers.clear();
+        client_conn.response.middleware_headers.clear();
+        client_conn.response_body.clear();
+        client_conn.response.body = std::span<const uint8_t>();
+        if (client_conn.protocol == Protocol::HTTP_2) {
+            submit_h2_response_to_client(client_conn, sctx->client_stream_id);
+        } else {
+            send_response(client_conn, false);
+        }
+        return;
+    }
+
+    // Copy the response into the client connection's owned storage (same
+    // shape as the HTTP/1.1 backend completion path)
+    client_conn.response.status = bstream->response.status;
+    client_conn.response.reason_phrase = http::to_reason_phrase(bstream->response.status);
+
+    client_conn.response_header_storage = bstream->response_header_storage;
+    client_conn.response.headers.clear();
+    client_conn.response.backend_headers.clear();
+    client_conn.response.middleware_headers.clear();
+    client_conn.response.headers.reserve(client_conn.response_header_storage.size());
+    for (const auto& [name, value] : client_conn.response_header_storage) {
+        client_conn.response.headers.push_back({name, value});
+    }
+
+    client_conn.response_body = std::move(bstream->response_body);
+    client_conn.response.body = client_conn.response_body;
+
+    // Execute response middleware
+    gateway::ResponseContext resp_ctx;
+    resp_ctx.request = &sctx->preserved_request;
+    resp_ctx.response = &client_conn.response;
+    resp_ctx.correlation_id = sctx->metadata["correlation_id"];
+    resp_ctx.route_match = sctx->route_match;
+    resp_ctx.client_ip = client_conn.remote_ip;
+    resp_ctx.client_port = client_conn.remote_port;
+    resp_ctx.start_time = sctx->start_time;
+    resp_ctx.metadata = sctx->metadata;
+
+    // HTTP/1.1 clients can have large-body compression offloaded
+    if (client_conn.protocol != Protocol::HTTP_2 && offload_eventfd_ >= 0) {
+        resp_ctx.set_metadata("compression_offload_capable", "1");
+    }
+
+    // Circuit breaker / latency feedback for the channel's backend
+    auto* upstream = upstream_manager_->get_upstream(channel.upstream_name);
+    if (upstream) {
+        for (auto& backend : upstream->backends()) {
+            if (backend.host == channel.host && backend.port == channel.port) {
+                resp_ctx.backend = const_cast<gateway::Backend*>(&backend);
+                break;
+            }
+        }
+    }
+    if (resp_ctx.backend) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - sctx->start_time);
+        resp_ctx.backend->record_latency(static_cast<uint64_t>(elapsed.count()));
+    }
+
+    sctx->flight.mark(control::FlightStage::BackendResponded);
+    (void)pipeline_->execute_response(resp_ctx);
+
+    // Flight trace: same handoff as the h1 backend path - HTTP/1.1
+    // clients commit in send_response after the client write
+    if (client_conn.protocol != Protocol::HTTP_2) {
+        client_conn.flight = sctx->flight;
+        client_conn.flight_route_id = sctx->route_match.metrics_id;
+        sctx->flight.reset();
+    }
+
+    // Per-route stats: array-indexed by the route's dense ID
+    record_route_metrics(sctx->route_match, sctx->start_time,
+                         static_cast<uint16_t>(client_conn.response.status), &sctx->flight);
+
+    if (client_conn.protocol == Protocol::HTTP_2) {
+        submit_h2_response_to_client(client_conn, sctx->client_stream_id);
+    } else if (!try_offload_compression(client_conn, resp_ctx)) {
+        send_response(client_conn, client_conn.keep_alive);
+    }
+}
+
+void Server::fail_h2_channel(H2BackendChannel& channel) {
+    // Take ownership out of the registry first: answering streams below can
+    // re-enter proxy_to_backend_h2, which must dial a fresh channel rather
+    // than find this dying one
+    std::unique_ptr<H2BackendChannel> owned;
+    for (auto it = h2_backend_channels_.begin(); it != h2_backend_channels_.end(); ++it) {
+        if (it->second.get() == &channel) {
+            owned = std::move(it->second);
+            h2_backend_channels_.erase(it);
+            break;
+        }
+    }
+
+    backend_connections_.erase(channel.fd);
+    (void)remove_backend_from_epoll(channel.fd);
+    close_fd(channel.fd);
+
+    // Answer every in-flight stream with 502
+    auto streams = std::move(channel.streams);
+    channel.streams.clear();
+    for (auto& [stream_id, sctx] : streams) {
+        if (connections_.generation(sctx->client_fd) != sctx->client_generation) {
+            continue;
+        }
+        auto* slot = connections_.find(sctx->client_fd);
+        if (!slot) {
+            continue;
+        }
+        Connection& client_conn = **slot;
+
+        client_conn.response.status = http::StatusCode::BadGateway;
+        client_conn.response.reason_phrase = "Bad Gateway";
+        client_conn.response.headers.clear();
+        client_conn.response.well_known.fill(0);
+        client_conn.response.backend_headers.clear();
+        client_conn.response.middleware_headers.clear();
+        client_conn.response_body.clear();
+        client_conn.response.body = std::span<const uint8_t>();
+        if (client_conn.protocol == Protocol::HTTP_2) {
+            submit_h2_response_to_client(client_conn, sctx->client_stream_id);
+        } else {
+            send_response(client_conn, false);
+        }
+    }
+    // `owned` destroys the channel (and its session) here
+}
+
+void Server::fan_out_coalesced(uint64_t key, Connection& leader_conn) {
+    coalesce_inflight_.erase(key);
+
+    auto it = coalesce_waiters_.find(key);
+    if (it == coalesce_waiters_.end()) {
+        return;
+    }
+    auto waiters = std::move(it->second);
+    coalesce_waiters_.erase(it);
+
+    for (const auto& [fd, generation] : waiters) {
+        // Generation mismatch means the waiter closed and the fd was
+        // recycled by an unrelated connection - skip it
+        if (fd == leader_conn.fd || connections_.generation(fd) != generation) {
+            continue;
+        }
+        auto* slot = connections_.find(fd);
+        if (!slot) {
+            continue;
+        }
+        Connection& waiter = **slot;
+
+        // Deep-copy the leader's response into the waiter's owned storage
+        // (the leader's string_views die with its connection state)
+        waiter.response.status = leader_conn.response.status;
+        waiter.response_header_storage.clear();
+        for (auto hit = leader_conn.response.all_headers_begin();
+             hit != leader_conn.response.all_headers_end(); ++hit) {
+            auto [name, value] = *hit;
+            waiter.response_header_storage.emplace_back(std::string(name), std::string(value));
+        }
+        waiter.response.headers.clear();
+        waiter.response.backend_headers.clear();
+        waiter.response.middleware_headers.clear();
+        waiter.response.headers.reserve(waiter.response_header_storage.size());
+        for (const auto& [name, value] : waiter.response_header_storage) {
+            waiter.response.headers.push_back({name, value});
+        }
+        waiter.response_body.assign(leader_conn.response.body.begin(),
+                                    leader_conn.response.body.end());
+        waiter.response.body = waiter.response_body;
+        waiter.response.reason_phrase = http::to_reason_phrase(waiter.response.status);
+
+        send_response(waiter, waiter.keep_alive);
+    }
+}
+
+void Server::fail_coalesced_waiters(BackendConnection& bc) {
+    if (!bc.coalesced_leader) {
+        return;
+    }
+    bc.coalesced_leader = false;
+    coalesce_inflight_.erase(bc.coalesce_key);
+
+    auto it = coalesce_waiters_.find(bc.coalesce_key);
+    if (it == coalesce_waiters_.end()) {
+        return;
+    }
+    auto waiters = std::move(it->second);
+    coalesce_waiters_.erase(it);
+
+    for (const auto& [fd, generation] : waiters) {
+        if (connections_.generation(fd) != generation) {
+            continue;
+        }
+        auto* slot = connections_.find(fd);
+        if (!slot) {
+            continue;
+        }
+        Connection& waiter = **slot;
+
+        // Same 502 the leader gets on its own error path
+        waiter.response.status = http::StatusCode::BadGateway;
+        waiter.response.reason_phrase = "Bad Gateway";
+        waiter.response.headers.clear();
+        waiter.response.backend_headers.clear();
+        waiter.response.middleware_headers.clear();
+        waiter.response_body.clear();
+        waiter.response.body = std::span<const uint8_t>();
+        send_response(waiter, false);
+    }
+}
+
+void Server::poll_tls_reload() {
+    time_t cert_mtime = file_mtime(config_->server.tls_certificate_path);
+    time_t key_mtime = file_mtime(config_->server.tls_private_key_path);
+    if (cert_mtime == 0 || key_mtime == 0 ||
+        (cert_mtime == tls_cert_mtime_ && key_mtime == tls_key_mtime_)) {
+        return;
+    }
+
+    std::error_code error;
+    auto result = TlsContext::create(config_->server.tls_certificate_path,
+                                     config_->server.tls_private_key_path,
+                                     config_->server.tls_alpn_protocols, error,
+                                     config_->server.tls_ktls_enabled);
+    if (!result) {
+        // Keep serving on the old certificate. A half-written rotation
+        // (cert rewritten, key not yet) lands here and retries on the
+        // next sweep; mtimes are only recorded on success.
+        LOG_ERROR(logger_, "TLS reload failed, keeping old certificate: {}", error.message());
+        return;
+    }
+
+    // New handshakes use the fresh context from here on. SSL objects
+    // created from the old one hold their own SSL_CTX reference, so
+    // established connections finish undisturbed.
+    tls_context_ = std::move(*result);
+    tls_cert_mtime_ = cert_mtime;
+    tls_key_mtime_ = key_mtime;
+    LOG_INFO(logger_, "TLS certificate reloaded from {}", config_->server.tls_certificate_path);
+}
+
+int Server::process_timers() {
+    auto now = std::chrono::steady_clock::now();
+
+    // Fan published broadcast frames out to local subscribers. Runs every
+    // pass (not time-gated) - the idle check is one atomic load, and
+    // market-data style feeds care about per-message latency
+    poll_ws_broadcasts();
+
+    // Drain static file inotify events so a deploy that rewrites assets
+    // invalidates cached mappings (cheap non-blocking read, but no need
+    // to pay the syscall every loop pass)
+    if (now - last_static_poll_ >= std::chrono::seconds(1)) {
+        static_files_.poll();
+        last_static_poll_ = now;
+    }
+
+    // Publish a coherent metrics snapshot for the admin thread's scrape
+    // (double-buffered epoch protocol - see ThreadMetrics). Accept-queue
+    // occupancy and the host-wide overflow counters are sampled first so
+    // the snapshot carries fresh values.
+    if (metrics_ && now - last_metrics_publish_ >= std::chrono::seconds(1)) {
+        ListenQueueStats queue_stats;
+        if (listen_fd_ >= 0 && get_listen_queue_stats(listen_fd_, queue_stats)) {
+            metrics_->record_accept_queue(queue_stats.depth, queue_stats.limit);
+        }
+        uint64_t overflows = 0;
+        uint64_t drops = 0;
+        if (read_listen_overflow_counters(overflows, drops)) {
+            metrics_->record_listen_overflows(overflows, drops);
+        }
+        metrics_->publish_snapshot();
+        last_metrics_publish_ = now;
+    }
+
+    // Fold active probe results into this worker's backends (status via
+    // the circuit-breaker-aware transition, probe RTT into the latency
+    // EWMA - see HealthProber::apply)
+    if (now - last_health_apply_ >= std::chrono::seconds(1)) {
+        if (const auto* prober = g_health_prober_for_workers.load(std::memory_order_acquire)) {
+            prober->apply(*upstream_manager_, health_probe_seq_);
+        }
+        last_health_apply_ = now;
+    }
+
+    // TLS certificate rotation: rebuild the context when the cert/key
+    // files changed on disk (new handshakes only; established
+    // connections finish on the old context)
+    if (tls_context_ && now - last_tls_check_ >= std::chrono::seconds(10)) {
+        poll_tls_reload();
+        last_tls_check_ = now;
+    }
+
+    // Shadow mirrors are fire-and-forget, not leak-and-forget: reap any
+    // still holding a socket past the timeout (slow or silent shadow)
+    if (!shadow_mirrors_.empty()) {
+        constexpr auto kShadowMirrorTimeout = std::chrono::seconds(5);
+        std::vector<int> expired;
+        for (const auto& [fd, mirror] : shadow_mirrors_) {
+            if (now - mirror.started >= kShadowMirrorTimeout) {
+                expired.push_back(fd);
+            }
+        }
+        for (int fd : expired) {
+            close_shadow(fd);
+        }
+    }
+
+    // Give back pooled buffers above the recent demand peak so a traffic
+    // spike doesn't pin its high-water RSS forever
+    if (now - last_pool_trim_ >= std::chrono::seconds(10)) {
+        buffer_pool_.trim();
+
+        // Evict idle pooled backend connections, sparing the warm stock
+        if (upstream_manager_) {
+            for (const auto& upstream : upstream_manager_->upstreams()) {
+                upstream->backend_pool().cleanup_stale(upstream->warm_target());
+            }
+        }
+        last_pool_trim_ = now;
+    }
+
+    // Sample this worker's CPU utilization for adaptive consumers
+    // (compression level selection reads control::t_worker_cpu_utilization)
+#ifdef RUSAGE_THREAD
+    if (now - last_cpu_sample_ >= std::chrono::seconds(1)) {
+        rusage usage{};
+        if (getrusage(RUSAGE_THREAD, &usage) == 0) {
+            uint64_t cpu_us =
+                static_cast<uint64_t>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1'000'000 +
+                static_cast<uint64_t>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+            if (last_cpu_sample_.time_since_epoch().count() != 0) {
+                auto wall_us =
+                    std::chrono::duration_cast<std::chrono::microseconds>(now - last_cpu_sample_)
+                        .count();
+                if (wall_us > 0) {
+                    double util = static_cast<double>(cpu_us - last_cpu_usage_us_) /
+                                  static_cast<double>(wall_us);
+                    util = std::clamp(util, 0.0, 1.0);
+                    // Half-weight smoothing so one busy second doesn't flap
+                    // every adaptive decision downstream
+                    control::t_worker_cpu_utilization =
+                        0.5 * control::t_worker_cpu_utilization + 0.5 * util;
+                }
+            }
+            last_cpu_usage_us_ = cpu_us;
+            last_cpu_sample_ = now;
+        }
+    }
+#endif
+
+    // Scan circuit breaker windows and trip any that crossed a threshold.
+    // Once a second matches the windows' bucket resolution and keeps the
+    // trip decision off the request path entirely.
+    if (upstream_manager_ && now - last_breaker_eval_ >= std::chrono::seconds(1)) {
+        for (const auto& upstream : upstream_manager_->upstreams()) {
+            for (const auto& backend : upstream->backends()) {
+                if (backend.circuit_breaker) {
+                    backend.circuit_breaker->evaluate();
+                }
+            }
+            upstream->evaluate_outliers();
+
+            // Refresh the hedge delay from the worker's latency histogram
+            const auto& hedging = upstream->hedging();
+            if (hedging.enabled && metrics_) {
+                uint64_t p_us =
+                    metrics_->snapshot().latency_percentile_us(hedging.delay_percentile);
+                upstream->set_hedge_delay_ms(static_cast<uint32_t>(
+                    std::clamp<uint64_t>(p_us / 1000, hedging.min_delay_ms,
+                                         hedging.max_delay_ms)));
+            }
+        }
+        warm_backend_pools();
+        last_breaker_eval_ = now;
+    }
+
+    return timer_wheel_.advance(now);
+}
+
+void Server::warm_backend_pools() {
+    // Finalize connects started on earlier sweeps. A non-blocking connect
+    // to a reachable backend completes long before the next sweep, so the
+    // zero-timeout poll() below is just reading a finished result.
+    auto now = std::chrono::steady_clock::now();
+    for (auto it = warming_connects_.begin(); it != warming_connects_.end();) {
+        struct pollfd pfd {
+            it->fd, POLLOUT, 0
+        };
+        bool connected = false;
+        bool failed = false;
+        if (poll(&pfd, 1, 0) > 0) {
+            if (pfd.revents & (POLLERR | POLLHUP)) {
+                failed = true;
+            } else if (pfd.revents & POLLOUT) {
+                int err = 0;
+                socklen_t len = sizeof(err);
+                if (getsockopt(it->fd, SOL_SOCKET, SO_ERROR, &err, &len) < 0 || err != 0) {
+                    failed = true;
+                } else {
+                    connected = true;
+                }
+            }
+        }
+        if (!connected && !failed && now - it->started > std::chrono::seconds(5)) {
+            failed = true;  // Handshake never completed - give up on this probe
+        }
+
+        if (connected) {
+            auto* upstream = upstream_manager_->get_upstream(it->upstream_name);
+            if (upstream) {
+                upstream->backend_pool().release(it->fd, it->host, it->port);
+            } else {
+                close_fd(it->fd);  // Upstream retired by a config swap mid-handshake
+            }
+            it = warming_connects_.erase(it);
+        } else if (failed) {
+            close_fd(it->fd);
+            it = warming_connects_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    if (!upstream_manager_) {
+        return;
+    }
+
+    // Start connects toward any warm-target deficit. Capped per backend
+    // per sweep so a freshly raised target (or prewarm() boost) ramps up
+    // over a few seconds instead of bursting a connect storm at the
+    // backend.
+    constexpr size_t kMaxConnectsPerSweep = 4;
+    for (const auto& upstream : upstream_manager_->upstreams()) {
+        size_t target = upstream->warm_target();
+        if (target == 0) {
+            continue;
+        }
+        for (const auto& backend : upstream->backends()) {
+            // Ejected/unhealthy backends aren't warmed - their pool refills
+            // on the first sweep after they rejoin rotation
+            if (!backend.is_available() || backend.outlier_ejected) {
+                continue;
+            }
+
+            size_t have = upstream->backend_pool().count(backend.host, backend.port);
+            for (const auto& warming : warming_connects_) {
+                if (warming.upstream_name == upstream->name() && warming.host == backend.host &&
+                    warming.port == backend.port) {
+                    ++have;
+                }
+            }
+            if (have >= target) {
+                continue;
+            }
+
+            size_t want = std::min(target - have, kMaxConnectsPerSweep);
+            for (size_t i = 0; i < want; ++i) {
+                int fd = connect_to_backend_async(backend.host, backend.port);
+                if (fd < 0) {
+                    break;
+                }
+                warming_connects_.push_back(
+                    {fd, backend.host, backend.port, std::string(upstream->name()), now});
+            }
+        }
+    }
+}
+
+void Server::launch_hedge(int primary_fd) {
+    // Re-validate everything: the request may have completed, the client
+    // may be gone, or the fd recycled since the timer was armed
+    auto* entry = backend_connections_.find(primary_fd);
+    if (!entry || entry->second != -1) {
+        return;
+    }
+    auto* slot = connections_.find(entry->first);
+    if (!slot) {
+        return;
+    }
+    Connection& conn = **slot;
+    BackendConnection* primary = conn.backend_conn.get();
+    if (!primary || primary->backend_fd != primary_fd || conn.hedge_conn) {
+        return;
+    }
+    primary->hedge_timer = TimerWheel::kInvalidTimer;  // Fired, nothing to cancel
+
+    // Primary already has response bytes flowing - nothing left to win
+    if (!primary->recv_buffer.empty() || primary->splice_active) {
+        return;
+    }
+
+    auto* upstream = upstream_manager_->get_upstream(primary->upstream_name);
+    if (!upstream || !upstream->try_spend_hedge()) {
+        return;
+    }
+
+    // Race against a backend other than the one already serving - the
+    // straggler being hedged around is usually backend-local (GC pause,
+    // overload), so the same backend would just straggle twice
+    gateway::Backend* alt = nullptr;
+    for (const auto& backend : upstream->backends()) {
+        if (backend.host == primary->backend_host && backend.port == primary->backend_port) {
+            continue;
+        }
+        if (backend.can_accept_connection()) {
+            alt = const_cast<gateway::Backend*>(&backend);
+            break;
+        }
+    }
+    if (!alt) {
+        return;
+    }
+
+    auto hedge = std::make_unique<BackendConnection>();
+    hedge->buffer_pool = &buffer_pool_;
+    hedge->client_fd = conn.fd;
+    hedge->upstream_name = primary->upstream_name;
+    hedge->backend_host = alt->host;
+    hedge->backend_port = alt->port;
+    hedge->start_time = primary->start_time;  // Latency counts from the original request
+    hedge->metadata = primary->metadata;
+    hedge->route_match = primary->route_match;
+    hedge->header_transforms = primary->header_transforms;
+    hedge->config_pin = primary->config_pin;  // Same snapshot as the primary leg
+    hedge->send_buffer = primary->send_buffer;  // Identical request bytes
+
+    // Deep-copy the preserved request: its string_views must point into
+    // the hedge's own storage, since either racer can outlive the other
+    hedge->owned_path = primary->owned_path;
+    hedge->owned_uri = primary->owned_uri;
+    hedge->owned_query = primary->owned_query;
+    hedge->request_header_storage = primary->request_header_storage;
+    hedge->preserved_request = primary->preserved_request;
+    hedge->preserved_request.path = hedge->owned_path;
+    hedge->preserved_request.uri = hedge->owned_uri;
+    hedge->preserved_request.query = hedge->owned_query;
+    hedge->preserved_request.headers.clear();
+    hedge->preserved_request.headers.reserve(hedge->request_header_storage.size());
+    for (const auto& [name, value] : hedge->request_header_storage) {
+        hedge->preserved_request.headers.push_back({name, value});
+    }
+
+    hedge->backend_fd = upstream->backend_pool().acquire(alt->host, alt->port);
+    if (hedge->backend_fd < 0) {
+        hedge->backend_fd = connect_to_backend_async(alt->host, alt->port);
+        if (hedge->backend_fd < 0) {
+            return;
+        }
+        hedge->connect_pending = true;
+    }
+    hedge->send_pending = true;
+
+    if (!add_backend_to_epoll(hedge->backend_fd, EPOLLOUT | EPOLLIN)) {
+        close_fd(hedge->backend_fd);
+        return;
+    }
+    backend_connections_[hedge->backend_fd] = {conn.fd, -1};
+
+    if (config_->server.read_timeout > 0) {
+        hedge->timer_wheel = &timer_wheel_;
+        int timeout_fd = hedge->backend_fd;
+        hedge->timeout_timer = timer_wheel_.add(
+            config_->server.read_timeout,
+            [this, timeout_fd] { handle_backend_event(timeout_fd, false, false, true); });
+    }
+
+    if (metrics_) {
+        metrics_->record_hedge(false);
+    }
+    conn.hedge_conn = std::move(hedge);
+}
+
+void Server::cancel_hedge_loser(Connection& conn, int winner_fd) {
+    if (!conn.hedge_conn || !conn.backend_conn) {
+        return;
+    }
+
+    std::unique_ptr<BackendConnection> loser;
+    if (conn.hedge_conn->backend_fd == winner_fd) {
+        // The hedge won: promote it into the primary slot
+        loser = std::move(conn.backend_conn);
+        conn.backend_conn = std::move(conn.hedge_conn);
+        if (metrics_) {
+            metrics_->record_hedge(true);
+        }
+    } else {
+        loser = std::move(conn.hedge_conn);
+    }
+
+    // The loser's socket is mid-request (response abandoned or never
+    // started) - it can't be pooled, only closed
+    (void)remove_backend_from_epoll(loser->backend_fd);
+    backend_connections_.erase(loser->backend_fd);
+    close_fd(loser->backend_fd);
+}
+
+bool Server::drop_hedge_racer(Connection& conn, int backend_fd) {
+    if (!conn.hedge_conn || !conn.backend_conn) {
+        return false;
+    }
+    bool failed_is_hedge = conn.hedge_conn->backend_fd == backend_fd;
+    if (!failed_is_hedge && conn.backend_conn->backend_fd != backend_fd) {
+        return false;
+    }
+
+    std::unique_ptr<BackendConnection> failed;
+    if (failed_is_hedge) {
+        failed = std::move(conn.hedge_conn);
+    } else {
+        // The primary failed: the hedge takes over as the sole racer
+        failed = std::move(conn.backend_conn);
+        conn.backend_conn = std::move(conn.hedge_conn);
+    }
+
+    (void)remove_backend_from_epoll(failed->backend_fd);
+    backend_connections_.erase(failed->backend_fd);
+    close_fd(failed->backend_fd);
+    return true;
+}
+
+void Server::process_backend_operations() {
+    // This method is called periodically to process any pending backend operations
+    // For now, it's a placeholder - most processing happens in handle_backend_event()
+    // In the future, this could handle timeouts, retries, etc.
+}
+
+bool Server::try_offload_compression(Connection& client_conn,
+                                     gateway::ResponseContext& resp_ctx) {
+    if (offload_eventfd_ < 0 || client_conn.protocol == Protocol::HTTP_2) {
+        return false;
+    }
+
+    auto token = resp_ctx.get_metadata("compression_offload");
+    if (token.empty()) {
+        return false;  // Middleware compressed inline (or skipped)
+    }
+    auto encoding = encoding_from_string(token);
+    if (encoding == CompressionEncoding::NONE) {
+        return false;
+    }
+
+    int level = 0;
+    auto level_meta = resp_ctx.get_metadata("compression_offload_level");
+    std::from_chars(level_meta.data(), level_meta.data() + level_meta.size(), level);
+    if (level <= 0) {
+        return false;
+    }
+
+    auto job = std::make_unique<CompressionJob>();
+    job->client_fd = client_conn.fd;
+    job->client_generation = connections_.generation(client_conn.fd);
+    job->keep_alive = client_conn.keep_alive;
+    job->encoding = encoding;
+    job->level = level;
+    job->input = std::move(client_conn.response_body);
+    job->input_size = job->input.size();
+    job->wake_eventfd = offload_eventfd_;
+    job->completions = &offload_completions_;
+
+    size_t body_size = job->input_size;
+    if (!CompressionOffloadPool::instance().submit(job)) {
+        // Cap reached between the middleware's capacity check and now:
+        // restore the body and let the normal path send identity
+        client_conn.response_body = std::move(job->input);
+        client_conn.response.body = client_conn.response_body;
+        return false;
+    }
+
+    // Body now lives in the job; the span must not dangle into it
+    client_conn.response.body = std::span<const uint8_t>();
+    LOG_DEBUG(logger_, "Offloaded {} byte body for fd={} ({} level {})", body_size, client_conn.fd,
+              token, level);
+    return true;
+}
+
+void Server::process_offload_completions() {
+    // Clear the eventfd counter first so its readiness level drops
+    uint64_t counter = 0;
+    while (read(offload_eventfd_, &counter, sizeof(counter)) > 0) {
+    }
+
+    std::vector<std::unique_ptr<CompressionJob>> done;
+    {
+        std::lock_guard<std::mutex> lock(offload_completions_.mutex);
+        done.swap(offload_completions_.done);
+    }
+
+    for (auto& job : done) {
+        if (connections_.generation(job->client_fd) != job->client_generation) {
+            continue;  // Client went away while the body was offloaded
+        }
+        auto* slot = connections_.find(job->client_fd);
+        if (!slot) {
+            continue;
+        }
+        Connection& conn = **slot;
+
+        if (job->output.empty()) {
+            // Compression failed: the input was kept, send it as identity
+            conn.response_body = std::move(job->input);
+            conn.response.body = conn.response_body;
+            send_response(conn, job->keep_alive);
+            continue;
+        }
+
+        conn.response_body = std::move(job->output);
+        conn.response.body = conn.response_body;
+
+        // Finish the header work the middleware deferred (same shape as
+        // CompressionMiddleware::update_headers)
+        conn.response.add_middleware_header("Content-Encoding", encoding_to_string(job->encoding));
+        auto existing_vary = conn.response.get_header(http::WellKnownHeader::Vary);
+        if (existing_vary.empty()) {
+            conn.response.add_middleware_header("Vary", "Accept-Encoding");
+        } else if (existing_vary.find("Accept-Encoding") == std::string_view::npos) {
+            std::string new_vary = std::string(existing_vary) + ", Accept-Encoding";
+            conn.response.remove_header("Vary");
+            conn.response.add_middleware_header("Vary", new_vary);
+        }
+        auto etag = conn.response.get_header(http::WellKnownHeader::ETag);
+        if (!etag.empty() && etag[0] != 'W') {
+            std::string weak_etag = "W/" + std::string(etag);
+            conn.response.remove_header("ETag");
+            conn.response.add_middleware_header("ETag", weak_etag);
+        }
+
+        // This worker thread owns the thread-local compression metrics
+        auto& cm = gateway::compression_metrics;
+        cm.requests_compressed++;
+        cm.bytes_in += job->input_size;
+        cm.bytes_out += conn.response_body.size();
+        switch (job->encoding) {
+            case CompressionEncoding::GZIP:
+                cm.gzip_count++;
+                break;
+            case CompressionEncoding::ZSTD:
+                cm.zstd_count++;
+                break;
+            case CompressionEncoding::BROTLI:
+                cm.brotli_count++;
+                break;
+            default:
+                break;
+        }
+
+        send_response(conn, job->keep_alive);
+    }
+}
+
+void Server::record_route_metrics(const gateway::RouteMatch& route_match,
+                                  std::chrono::steady_clock::time_point start_time,
+                                  uint16_t status, control::FlightTrace* flight) {
+    if (!metrics_) {
+        return;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time);
+    metrics_->record_route(route_match.metrics_id, static_cast<uint64_t>(elapsed.count()),
+                           status >= 500);
+    if (flight && flight->started()) {
+        flight->mark(control::FlightStage::Complete);
+        metrics_->flight_recorder().commit(*flight, route_match.metrics_id, status);
+        flight->reset();
+    }
+}
+
+void Server::commit_flight(Connection& conn) {
+    if (metrics_ && conn.flight.started()) {
+        conn.flight.mark(control::FlightStage::Complete);
+        metrics_->flight_recorder().commit(conn.flight, conn.flight_route_id,
+                                           static_cast<uint16_t>(conn.response.status));
+    }
+    conn.flight.reset();
+}
+
+void Server::set_config_source(const control::ConfigManager* manager, SnapshotFactory factory) {
+    config_manager_ = manager;
+    snapshot_factory_ = std::move(factory);
+    if (config_manager_) {
+        // Startup components were built from the current generation
+        config_generation_seen_ = config_manager_->generation();
+    }
+}
+
+void Server::poll_config_update() {
+    // Drain the retired list first: a displaced snapshot can only be freed
+    // once no in-flight proxy state holds RouteMatch views into its Router.
+    // Every holder (backend connections, hedges, HTTP/2 backend streams)
+    // carries a SnapshotPin cloned from snapshot_pin_, so each snapshot is
+    // freed exactly when its own pin count reaches zero - long-lived
+    // bystanders (WebSocket legs, idle HTTP/2 channels, shadow mirrors)
+    // hold no route views and never delay the drain.
+    if (!retired_snapshots_.empty()) {
+        std::erase_if(retired_snapshots_,
+                      [](const ConfigSnapshot& snapshot) { return snapshot.users.expired(); });
+    }
+
+    if (!config_manager_ || !snapshot_factory_) {
+        return;
+    }
+
+    uint64_t generation = config_manager_->generation();
+    if (generation == config_generation_seen_) {
+        return;  // Common case: one relaxed-ish load per loop iteration
+    }
+    config_generation_seen_ = generation;
+
+    auto new_config = config_manager_->get();
+    if (!new_config) {
+        return;
+    }
+
+    // Diff against the running snapshot so the factory rebuilds only the
+    // sections that changed. No previous snapshot (startup components were
+    // built straight from the boot config) means a default delta: rebuild
+    // everything.
+    control::ConfigDelta delta;
+    if (config_snapshot_) {
+        delta = control::ConfigLoader::diff(*config_snapshot_, *new_config);
+    }
+
+    // Displace the live components first, then build the replacement
+    // worker-locally (no other thread touches these) - the factory steals
+    // unchanged pieces out of `old` and builds the rest. The swap happens
+    // at this loop-iteration boundary: requests already being proxied keep
+    // the objects they started with (shared upstreams never move, and the
+    // rest of `old` parks in retired_snapshots_ until drained); everything
+    // accepted from here on sees the new bundle.
+    ConfigSnapshot old;
+    old.config = std::move(config_snapshot_);
+    old.router = std::move(router_);
+    old.upstream_manager = std::move(upstream_manager_);
+    old.pipeline = std::move(pipeline_);
+
+    ConfigSnapshot fresh = snapshot_factory_(new_config, delta, old);
+
+    const bool router_reused = old.router == nullptr;
+    const size_t upstreams_reused = delta.unchanged_upstreams.size();
+    // Hand the displaced bundle its users handle and start a fresh pin for
+    // everything routed against the new tables
+    old.users = snapshot_pin_;
+    snapshot_pin_ = std::make_shared<const uint64_t>(generation);
+    retired_snapshots_.push_back(std::move(old));
+
+    config_snapshot_ = std::move(fresh.config);
+    config_ = config_snapshot_.get();
+    router_ = std::move(fresh.router);
+    upstream_manager_ = std::move(fresh.upstream_manager);
+    pipeline_ = std::move(fresh.pipeline);
+
+    // Rebuild the per-route stats table against the new router's dense IDs.
+    // The displaced table is retained by ThreadMetrics, so an exporter
+    // mid-read never sees it freed.
+    if (metrics_) {
+        std::vector<std::string> route_names;
+        route_names.reserve(router_->routes().size());
+        for (const auto& route : router_->routes()) {
+            route_names.push_back(route.handler_id);
+        }
+        metrics_->configure_routes(std::move(route_names));
+    }
+
+    // If this worker's manager is the one published for /metrics (worker 0),
+    // repoint the export before the displaced manager drains out
+    const gateway::UpstreamManager* expected = retired_snapshots_.back().upstream_manager.get();
+    g_upstream_manager_for_metrics.compare_exchange_strong(expected, upstream_manager_.get(),
+                                                           std::memory_order_acq_rel);
+
+    if (logger_) {
+        LOG_INFO(logger_,
+                 "Config swap: generation {} active (router {}, {} upstream(s) carried over), "
+                 "{} snapshot(s) awaiting drain",
+                 generation, router_reused ? "reused" : "rebuilt", upstreams_reused,
+                 retired_snapshots_.size());
+    }
+}
+
+bool Server::add_backend_to_epoll(int backend_fd, uint32_t events) {
+#ifdef __linux__
+    epoll_event ev{};
+    ev.events = events | EPOLLET;  // Edge-triggered
+    ev.data.fd = backend_fd;
+    return epoll_ctl(backend_epoll_fd_, EPOLL_CTL_ADD, backend_fd, &ev) == 0;
+#elif defined(__APPLE__) || defined(__FreeBSD__)
+    // For kqueue, we need to add separate kevents for read and write
+    struct kevent kevs[2];
+    int nchanges = 0;
+
+    if (events & EPOLLIN) {
+        EV_SET(&kevs[nchanges++], backend_fd, EVFILT_READ, EV_ADD | EV_ENABLE | EV_CLEAR, 0, 0,
+               nullptr);
+    }
+    if (events & EPOLLOUT) {
+        EV_SET(&kevs[nchanges++], backend_fd, EVFILT_WRITE, EV_ADD | EV_ENABLE | EV_CLEAR, 0, 0,
+               nullptr);
+    }
+
+    if (nchanges > 0) {
+        return kevent(backend_epoll_fd_, kevs, nchanges, nullptr, 0, nullptr) == 0;
+    }
+    return false;
+#else
+    return false;
+#endif
+}
+
+bool Server::remove_backend_from_epoll(int backend_fd) {
+#ifdef __linux__
+    // On Linux, EPOLL_CTL_DEL doesn't need an event structure (can be nullptr)
+    return epoll_ctl(backend_epoll_fd_, EPOLL_CTL_DEL, backend_fd, nullptr) == 0;
+#elif defined(__APPLE__) || defined(__FreeBSD__)
+    // For kqueue, we need to delete both READ and WRITE filters
+    struct kevent kevs[2];
+    EV_SET(&kevs[0], backend_fd, EVFILT_READ, EV_DELETE, 0, 0, nullptr);
+    EV_SET(&kevs[1], backend_fd, EVFILT_WRITE, EV_DELETE, 0, 0, nullptr);
+
+    // It's OK if some filters don't exist (returns error but we ignore it)
+    kevent(backend_epoll_fd_, kevs, 2, nullptr, 0, nullptr);
+    return true;  // Always return true since partial success is OK
+#else
+    return false;
+#endif
+}
+
+// ============================================================================
+// splice() Streaming Proxy (Linux zero-copy path for large bodies)
+// ============================================================================
+
+bool Server::try_start_splice(Connection& conn, BackendConnection& bc) {
+#ifdef __linux__
+    if (!config_->server.splice_proxy_enabled) {
+        return false;
+    }
+
+    // Eligibility: HTTP/1.1 clients whose send path the kernel can encrypt.
+    // Cleartext always qualifies; TLS qualifies only when kTLS took the TX
+    // keys (plain send()/splice() then produce valid records in-kernel).
+    // Userspace-crypto TLS and HTTP/2 framing keep the buffered path.
+    if (conn.protocol != Protocol::HTTP_1_1 || (conn.tls_enabled && !conn.ktls_tx) ||
+        bc.stream_id != -1) {
+        return false;
+    }
+
+    // Coalescing leaders must buffer the full response so it can be
+    // replayed to parked waiters - splice would stream it past us
+    if (bc.coalesced_leader) {
+        return false;
+    }
+
+    // Need the complete header block before we can commit to streaming
+    std::string_view view(reinterpret_cast<const char*>(bc.recv_buffer.data()),
+                          bc.recv_buffer.size());
+    size_t header_end = view.find("\r\n\r\n");
+    if (header_end == std::string_view::npos) {
+        return false;
+    }
+    size_t body_start = header_end + 4;
+
+    size_t line_end = view.find("\r\n");
+    std::string_view status_line = view.substr(0, line_end);
+    if (!status_line.starts_with("HTTP/1.")) {
+        return false;
+    }
+
+    auto iequals = [](std::string_view a, std::string_view b) {
+        if (a.size() != b.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (::tolower(static_cast<unsigned char>(a[i])) !=
+                ::tolower(static_cast<unsigned char>(b[i]))) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Scan headers: need a Content-Length (chunked encoding stays buffered),
+    // and we rewrite the Connection header ourselves
+    size_t content_length = 0;
+    bool have_content_length = false;
+    bool backend_close = false;
+    std::string out_headers;
+    out_headers.reserve(header_end + 64);
+    out_headers.append(status_line);
+    out_headers.append("\r\n");
+
+    size_t pos = line_end + 2;
+    while (pos < header_end) {
+        size_t eol = view.find("\r\n", pos);
+        if (eol == std::string_view::npos || eol > header_end) {
+            eol = header_end;
+        }
+        std::string_view line = view.substr(pos, eol - pos);
+        pos = eol + 2;
+
+        size_t colon = line.find(':');
+        if (colon == std::string_view::npos) {
+            continue;
+        }
+        std::string_view name = line.substr(0, colon);
+        std::string_view value = line.substr(colon + 1);
+        while (!value.empty() && value.front() == ' ') {
+            value.remove_prefix(1);
+        }
+
+        if (iequals(name, "transfer-encoding")) {
+            return false;  // Chunked responses use the buffered path
+        }
+        if (iequals(name, "content-length")) {
+            auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(),
+                                             content_length);
+            if (ec != std::errc{}) {
+                return false;
+            }
+            have_content_length = true;
+        } else if (iequals(name, "connection") || iequals(name, "keep-alive")) {
+            if (value.find("close") != std::string_view::npos ||
+                value.find("Close") != std::string_view::npos) {
+                backend_close = true;
+            }
+            continue;  // Hop-by-hop, rewritten below
+        }
+        out_headers.append(line);
+        out_headers.append("\r\n");
+    }
+
+    if (!have_content_length || content_length < config_->server.splice_min_body_size) {
+        return false;
+    }
+
+    size_t buffered_body = bc.recv_buffer.size() - body_start;
+    if (buffered_body >= content_length) {
+        return false;  // Entire body already in memory - buffered path is cheaper
+    }
+
+    if (pipe2(bc.splice_pipe, O_NONBLOCK | O_CLOEXEC) < 0) {
+        return false;
+    }
+
+    out_headers.append(conn.keep_alive ? "Connection: keep-alive\r\n\r\n"
+                                       : "Connection: close\r\n\r\n");
+
+    // Queue headers plus whatever body bytes we already read; pump_splice
+    // flushes these with send() before splicing the rest kernel-to-kernel
+    bc.splice_header_remainder.assign(out_headers.begin(), out_headers.end());
+    bc.splice_header_remainder.insert(bc.splice_header_remainder.end(),
+                                      bc.recv_buffer.begin() + body_start, bc.recv_buffer.end());
+    bc.splice_remaining = content_length - buffered_body;
+    bc.splice_backend_close = backend_close;
+    bc.splice_active = true;
+    bc.recv_buffer.clear();
+
+    // A large transfer can legitimately outlive the response timeout once
+    // bytes are flowing; progress-based timeouts are out of scope here
+    if (bc.timer_wheel && bc.timeout_timer != TimerWheel::kInvalidTimer) {
+        bc.timer_wheel->cancel(bc.timeout_timer);
+        bc.timeout_timer = TimerWheel::kInvalidTimer;
+    }
+
+    LOG_DEBUG(logger_, "Splice streaming engaged: backend_fd={} client_fd={} body_bytes={}",
+              bc.backend_fd, conn.fd, content_length);
+
+    pump_splice(conn, bc);
+    return true;
+#else
+    (void)conn;
+    (void)bc;
+    return false;
+#endif
+}
+
+void Server::pump_splice(Connection& conn, BackendConnection& bc) {
+#ifdef __linux__
+    // Phase 1: flush headers (and any pre-buffered body bytes) with send()
+    while (!bc.splice_header_remainder.empty()) {
+        ssize_t sent = send(conn.fd, bc.splice_header_remainder.data(),
+                            bc.splice_header_remainder.size(), MSG_NOSIGNAL);
+        if (sent > 0) {
+            bc.splice_header_remainder.erase(bc.splice_header_remainder.begin(),
+                                             bc.splice_header_remainder.begin() + sent);
+        } else if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            // Client socket full - wait for writable on the backend epoll
+            if (!bc.splice_client_out) {
+                if (!add_backend_to_epoll(conn.fd, EPOLLOUT)) {
+                    finish_splice(conn, bc, false);
+                    return;
+                }
+                backend_connections_[conn.fd] = {conn.fd, -1};
+                bc.splice_client_out = true;
+            }
+            return;
+        } else {
+            finish_splice(conn, bc, false);
+            return;
+        }
+    }
+
+    // Phase 2: move body bytes backend -> pipe -> client without copies
+    while (bc.splice_remaining > 0 || bc.splice_buffered > 0) {
+        bool input_stalled = false;
+
+        if (bc.splice_remaining > 0) {
+            size_t want = std::min(bc.splice_remaining, kSpliceMaxChunk);
+            ssize_t n = splice(bc.backend_fd, nullptr, bc.splice_pipe[1], nullptr, want,
+                               SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+            if (n > 0) {
+                bc.splice_remaining -= static_cast<size_t>(n);
+                bc.splice_buffered += static_cast<size_t>(n);
+            } else if (n == 0) {
+                // Backend closed before sending the advertised Content-Length
+                finish_splice(conn, bc, false);
+                return;
+            } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                input_stalled = true;
+            } else {
+                finish_splice(conn, bc, false);
+                return;
+            }
+        }
+
+        if (bc.splice_buffered > 0) {
+            ssize_t m = splice(bc.splice_pipe[0], nullptr, conn.fd, nullptr, bc.splice_buffered,
+                               SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+            if (m > 0) {
+                bc.splice_buffered -= static_cast<size_t>(m);
+                continue;
+            }
+            if (m < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                // Client can't keep up - park bytes in the pipe, resume on EPOLLOUT
+                if (!bc.splice_client_out) {
+                    if (!add_backend_to_epoll(conn.fd, EPOLLOUT)) {
+                        finish_splice(conn, bc, false);
+                        return;
+                    }
+                    backend_connections_[conn.fd] = {conn.fd, -1};
+                    bc.splice_client_out = true;
+                }
+                return;
+            }
+            finish_splice(conn, bc, false);
+            return;
+        }
+
+        if (input_stalled) {
+            return;  // Wait for the next backend readable event
+        }
+    }
+
+    finish_splice(conn, bc, true);
+#else
+    (void)conn;
+    (void)bc;
+#endif
+}
+
+void Server::finish_splice(Connection& conn, BackendConnection& bc, bool success) {
+    // Copy out everything we need - resetting conn.backend_conn destroys bc
+    int backend_fd = bc.backend_fd;
+    int client_fd = conn.fd;
+    bool backend_reusable = success && !bc.splice_backend_close;
+    std::string upstream_name = bc.upstream_name;
+    std::string backend_host = bc.backend_host;
+    uint16_t backend_port = bc.backend_port;
+
+    for (int& pfd : bc.splice_pipe) {
+        if (pfd >= 0) {
+            close(pfd);
+            pfd = -1;
+        }
+    }
+
+    if (bc.splice_client_out) {
+        (void)remove_backend_from_epoll(client_fd);
+        backend_connections_.erase(client_fd);
+        bc.splice_client_out = false;
+    }
+
+    (void)remove_backend_from_epoll(backend_fd);
+    backend_connections_.erase(backend_fd);
+
+    // We consumed exactly Content-Length bytes, so on success the backend
+    // connection is at a message boundary and safe to pool
+    if (backend_reusable) {
+        auto* upstream = upstream_manager_->get_upstream(upstream_name);
+        if (upstream) {
+            upstream->backend_pool().release(backend_fd, backend_host, backend_port);
+        } else {
+            close_fd(backend_fd);
+        }
+    } else {
+        close_fd(backend_fd);
+    }
+
+    bool keep_client = success && conn.keep_alive;
+    conn.backend_conn.reset();
+
+    if (!keep_client) {
+        handle_close(client_fd);
+    }
+}
+
+void Server::maybe_start_chunked_decode(BackendConnection& bc) {
+    // Need the complete header block before we can commit to the decoder
+    std::string_view view(reinterpret_cast<const char*>(bc.recv_buffer.data()),
+                          bc.recv_buffer.size());
+    size_t header_end = view.find("\r\n\r\n");
+    if (header_end == std::string_view::npos) {
+        return;
+    }
+    size_t header_len = header_end + 4;
+
+    // Parse just the header block; oddities stay on the llhttp path so
+    // its framing rules (and error reporting) remain authoritative
+    http::Response head;
+    http::Parser parser;
+    auto [result, consumed] = parser.parse_response_headers(
+        std::span<const uint8_t>(bc.recv_buffer.data(), header_len), head);
+    if (result != http::ParseResult::Complete) {
+        return;
+    }
+
+    // Skip responses llhttp frames specially: interim responses and the
+    // no-body statuses never carry a chunked body, and HEAD responses may
+    // announce framing for a body that is not sent
+    auto status = static_cast<uint16_t>(head.status);
+    if (status < 200 || status == 204 || status == 304) {
+        return;
+    }
+    if (bc.preserved_request.method == http::Method::HEAD) {
+        return;
+    }
+
+    // Only plain "chunked" framing; stacked codings keep the buffered path
+    std::string_view te = head.get_header(http::WellKnownHeader::TransferEncoding);
+    if (te.size() != 7 || !http::simd::strcasecmp_eq(te.data(), "chunked", te.size())) {
+        return;
+    }
+
+    bc.chunked_streaming = true;
+    bc.chunked_header_len = header_len;
+    bc.chunked_cursor = header_len;
+    bc.chunked_decoder.reset();
+    bc.chunked_slices.clear();
+}
+
+// ============================================================================
+// WebSocket Support (RFC 6455)
+// ============================================================================
 
 void Server::handle_websocket_upgrade(Connection& conn) {
     // Phase 3: WebSocket upgrade and proxy establishment
@@ -1802,7 +4372,7 @@ void Server::handle_websocket_upgrade(Connection& conn) {
     // 7. Register both client and backend FDs in epoll for frame forwarding
 
     // Match route to find backend upstream
-    auto route_match = router_->match(conn.request.method, conn.request.path);
+    auto route_match = match_route(conn, conn.request.method, conn.request.path);
     if (route_match.handler_id.empty()) {
         LOG_WARNING(logger_, "WebSocket upgrade failed: No route match for path={}",
                     conn.request.path);
@@ -1837,6 +4407,57 @@ void Server::handle_websocket_upgrade(Connection& conn) {
         }
     }
 
+    // Broadcast fan-out route: Titan terminates the WebSocket itself and
+    // the connection becomes a subscriber of the configured channel - no
+    // backend leg. Published frames (see http/ws_broadcast.hpp) are
+    // serialized once and queued here by reference.
+    if (!route_match.ws_broadcast_channel.empty()) {
+        std::string_view sub_key;
+        for (const auto& [name, value] : conn.request.headers) {
+            if (name == "Sec-WebSocket-Key") {
+                sub_key = value;
+                break;
+            }
+        }
+        if (sub_key.empty()) {
+            LOG_ERROR(logger_, "WebSocket upgrade failed: Missing Sec-WebSocket-Key header");
+            conn.response.status = http::StatusCode::BadRequest;
+            std::string_view error_msg = "Missing Sec-WebSocket-Key header";
+            conn.response_body.assign(error_msg.begin(), error_msg.end());
+            conn.response.body = conn.response_body;
+            send_response(conn, false);
+            return;
+        }
+
+        std::string accept_key = http::WebSocketUtils::compute_accept_key(sub_key);
+        std::string client_response = http::WebSocketUtils::create_upgrade_response(accept_key);
+        ssize_t sent = write(conn.fd, client_response.data(), client_response.size());
+        if (sent < 0 || static_cast<size_t>(sent) != client_response.size()) {
+            LOG_ERROR(logger_, "WebSocket upgrade failed: Cannot send 101 response to client");
+            handle_close(conn.fd);
+            return;
+        }
+
+        conn.ws_conn = std::make_unique<http::WebSocketConnection>();
+        conn.ws_conn->client_fd = conn.fd;
+        conn.ws_conn->backend_fd = -1;  // Subscriber: no backend leg
+        conn.ws_conn->state = http::WebSocketState::OPEN;
+        conn.ws_conn->route_path = std::string(conn.request.path);
+        conn.ws_conn->connected_at = std::chrono::steady_clock::now();
+        conn.ws_conn->last_activity = std::chrono::steady_clock::now();
+        conn.ws_conn->broadcast_channel = std::string(route_match.ws_broadcast_channel);
+        conn.protocol = Protocol::WEBSOCKET;
+
+        if (!ws_mailbox_) {
+            ws_mailbox_ = http::WsBroadcastBus::instance().register_worker();
+        }
+        ws_channels_[conn.ws_conn->broadcast_channel].push_back(conn.fd);
+
+        LOG_INFO(logger_, "WebSocket subscribed: client_fd={} channel={} path={}", conn.fd,
+                 conn.ws_conn->broadcast_channel, conn.request.path);
+        return;
+    }
+
     // Get upstream from route
     auto upstream = upstream_manager_->get_upstream(route_match.upstream_name);
     if (!upstream) {
@@ -1869,6 +4490,13 @@ void Server::handle_websocket_upgrade(Connection& conn) {
         return;
     }
 
+    // Negotiate permessage-deflate with the client (RFC 7692). The
+    // extension terminates at the gateway: it is stripped from the upgrade
+    // forwarded to the backend, so WAN traffic is compressed while the
+    // LAN leg to the backend stays plain.
+    auto pmd_params =
+        http::PerMessageDeflate::negotiate(conn.request.get_header(http::WellKnownHeader::SecWebSocketExtensions));
+
     // Select backend using load balancer with circuit breaker check
     const auto& backends = upstream->backends();
     if (backends.empty()) {
@@ -1882,14 +4510,10 @@ void Server::handle_websocket_upgrade(Connection& conn) {
         return;
     }
 
-    // Find first available backend (health + circuit breaker check)
-    const gateway::Backend* selected_backend = nullptr;
-    for (const auto& backend : backends) {
-        if (backend.can_accept_connection()) {
-            selected_backend = &backend;
-            break;
-        }
-    }
+    // Configured load balancer picks the backend (health + circuit breaker
+    // checks happen inside)
+    const gateway::Backend* selected_backend =
+        upstream->select_backend(backend_hash_key(conn, *upstream));
 
     if (!selected_backend) {
         LOG_ERROR(logger_, "WebSocket upgrade failed: No healthy backend for upstream '{}'",
@@ -1932,9 +4556,11 @@ void Server::handle_websocket_upgrade(Connection& conn) {
     backend_request += "Sec-WebSocket-Version: 13\r\n";
 
     // Forward other headers from client (e.g., Sec-WebSocket-Protocol, Origin)
+    // Sec-WebSocket-Extensions is excluded: compression terminates here
     for (const auto& [name, value] : conn.request.headers) {
         if (name != "Host" && name != "Upgrade" && name != "Connection" &&
-            name != "Sec-WebSocket-Key" && name != "Sec-WebSocket-Version") {
+            name != "Sec-WebSocket-Key" && name != "Sec-WebSocket-Version" &&
+            name != "Sec-WebSocket-Extensions") {
             backend_request += name;
             backend_request += ": ";
             backend_request += value;
@@ -1990,7 +4616,10 @@ void Server::handle_websocket_upgrade(Connection& conn) {
     std::string accept_key = http::WebSocketUtils::compute_accept_key(ws_key);
 
     // Send 101 Switching Protocols to client
-    std::string client_response = http::WebSocketUtils::create_upgrade_response(accept_key);
+    std::string extensions_value =
+        pmd_params ? http::PerMessageDeflate::response_value(*pmd_params) : std::string{};
+    std::string client_response =
+        http::WebSocketUtils::create_upgrade_response(accept_key, "", extensions_value);
     ssize_t client_sent = write(conn.fd, client_response.data(), client_response.size());
     if (client_sent < 0 || static_cast<size_t>(client_sent) != client_response.size()) {
         LOG_ERROR(logger_, "WebSocket upgrade failed: Cannot send 101 response to client");
@@ -2008,6 +4637,9 @@ void Server::handle_websocket_upgrade(Connection& conn) {
     conn.ws_conn->upstream_name = std::string(route_match.upstream_name);
     conn.ws_conn->connected_at = std::chrono::steady_clock::now();
     conn.ws_conn->last_activity = std::chrono::steady_clock::now();
+    if (pmd_params) {
+        conn.ws_conn->pmd = std::make_unique<http::PerMessageDeflate>(*pmd_params);
+    }
 
     // Mark protocol as WebSocket
     conn.protocol = Protocol::WEBSOCKET;
@@ -2030,8 +4662,9 @@ void Server::handle_websocket_upgrade(Connection& conn) {
         return;
     }
 
-    LOG_INFO(logger_, "WebSocket upgraded: client_fd={} backend_fd={} path={} upstream={}", conn.fd,
-             backend_fd, conn.request.path, route_match.upstream_name);
+    LOG_INFO(logger_, "WebSocket upgraded: client_fd={} backend_fd={} path={} upstream={} pmd={}",
+             conn.fd, backend_fd, conn.request.path, route_match.upstream_name,
+             pmd_params.has_value());
 }
 
 void Server::handle_websocket_frame(Connection& conn, bool from_client) {
@@ -2109,10 +4742,13 @@ void Server::handle_websocket_frame(Connection& conn, bool from_client) {
                         if (frame.opcode == http::WebSocketOpcode::CLOSE) {
                             LOG_INFO(logger_, "WebSocket close frame from client_fd={}", conn.fd);
 
-                            // Send close frame to backend
+                            // Send close frame to backend (broadcast
+                            // subscribers have no backend leg)
                             auto close_frame = http::WebSocketUtils::create_close_frame(
                                 http::WebSocketCloseCode::NORMAL_CLOSURE, "Client closed");
-                            write(ws.backend_fd, close_frame.data(), close_frame.size());
+                            if (ws.backend_fd >= 0) {
+                                write(ws.backend_fd, close_frame.data(), close_frame.size());
+                            }
 
                             // Send close frame to client
                             write(conn.fd, close_frame.data(), close_frame.size());
@@ -2129,24 +4765,32 @@ void Server::handle_websocket_frame(Connection& conn, bool from_client) {
                             write(conn.fd, pong_frame.data(), pong_frame.size());
 
                             // Also forward ping to backend (must be masked - RFC 6455)
-                            std::vector<uint8_t> forward_frame;
-                            uint32_t mask_key = static_cast<uint32_t>(std::rand());
-                            http::WebSocketUtils::encode_frame_header(
-                                forward_frame, frame.fin, frame.opcode, true,  // masked=true!
-                                payload_copy.size(), mask_key);
-
-                            // Apply masking to payload
-                            std::vector<uint8_t> masked_payload = payload_copy;
-                            for (size_t i = 0; i < masked_payload.size(); ++i) {
-                                masked_payload[i] ^= (mask_key >> (8 * (3 - (i % 4)))) & 0xFF;
+                            if (ws.backend_fd >= 0) {
+                                std::vector<uint8_t> forward_frame;
+                                uint32_t mask_key = static_cast<uint32_t>(std::rand());
+                                http::WebSocketUtils::encode_frame_header(
+                                    forward_frame, frame.fin, frame.opcode, true,  // masked=true!
+                                    payload_copy.size(), mask_key);
+
+                                // Apply masking to payload
+                                std::vector<uint8_t> masked_payload = payload_copy;
+                                for (size_t i = 0; i < masked_payload.size(); ++i) {
+                                    masked_payload[i] ^= (mask_key >> (8 * (3 - (i % 4)))) & 0xFF;
+                                }
+                                forward_frame.insert(forward_frame.end(), masked_payload.begin(),
+                                                     masked_payload.end());
+                                write(ws.backend_fd, forward_frame.data(), forward_frame.size());
                             }
-                            forward_frame.insert(forward_frame.end(), masked_payload.begin(),
-                                                 masked_payload.end());
-                            write(ws.backend_fd, forward_frame.data(), forward_frame.size());
                         } else if (frame.opcode == http::WebSocketOpcode::PONG) {
                             LOG_DEBUG(logger_, "WebSocket pong from client_fd={}", conn.fd);
                             ws.pong_pending = false;
                         }
+                    } else if (ws.backend_fd < 0) {
+                        // Broadcast subscribers are receive-only; inbound
+                        // data frames are dropped (publishing goes through
+                        // the admin endpoint, not the subscribers)
+                        ws.frames_received++;
+                        ws.bytes_received += consumed;
                     } else {
                         // Data frame - forward to backend (unmask before forwarding)
                         LOG_DEBUG(logger_,
@@ -2155,37 +4799,97 @@ void Server::handle_websocket_frame(Connection& conn, bool from_client) {
                                   static_cast<int>(frame.opcode), frame.fin, frame.payload_length,
                                   payload_copy.size());
 
-                        // RFC 6455: Titan is a WebSocket CLIENT to the backend, so frames MUST be
-                        // masked
-                        std::vector<uint8_t> forward_frame;
-                        uint32_t mask_key =
-                            static_cast<uint32_t>(std::rand());  // Simple masking key
-                        http::WebSocketUtils::encode_frame_header(
-                            forward_frame, frame.fin, frame.opcode, true,  // masked=true!
-                            payload_copy.size(), mask_key);
-
-                        // Apply masking to payload
-                        std::vector<uint8_t> masked_payload = payload_copy;
-                        for (size_t i = 0; i < masked_payload.size(); ++i) {
-                            masked_payload[i] ^= (mask_key >> (8 * (3 - (i % 4)))) & 0xFF;
-                        }
-                        forward_frame.insert(forward_frame.end(), masked_payload.begin(),
-                                             masked_payload.end());
-
-                        LOG_DEBUG(logger_, "Forwarding to backend: frame_size={} bytes",
-                                  forward_frame.size());
-                        ssize_t sent =
-                            write(ws.backend_fd, forward_frame.data(), forward_frame.size());
-                        if (sent < 0 || static_cast<size_t>(sent) != forward_frame.size()) {
-                            LOG_ERROR(logger_, "Failed to forward frame to backend_fd={}",
-                                      ws.backend_fd);
-                            handle_close(conn.fd);
-                            return;
+                        // permessage-deflate: compressed messages can only be
+                        // inflated whole, so reassemble fragments and inflate
+                        // before forwarding (the backend leg is uncompressed)
+                        std::span<const uint8_t> out_payload(payload_copy);
+                        std::vector<uint8_t> inflated;
+                        uint8_t out_opcode = frame.opcode;
+                        bool message_ready = true;
+                        if (ws.pmd) {
+                            constexpr size_t kMaxMessageBytes = 16 * 1024 * 1024;
+                            if (frame.opcode != http::WebSocketOpcode::CONTINUATION) {
+                                ws.client_message_opcode = frame.opcode;
+                                ws.client_message_compressed = frame.rsv1;
+                                ws.client_message.clear();
+                            }
+                            ws.client_message.insert(ws.client_message.end(), payload_copy.begin(),
+                                                     payload_copy.end());
+                            if (ws.client_message.size() > kMaxMessageBytes) {
+                                LOG_ERROR(logger_, "WebSocket message too big from client_fd={}",
+                                          conn.fd);
+                                auto close_frame = http::WebSocketUtils::create_close_frame(
+                                    http::WebSocketCloseCode::MESSAGE_TOO_BIG, "Message too big");
+                                write(conn.fd, close_frame.data(), close_frame.size());
+                                handle_close(conn.fd);
+                                return;
+                            }
+                            if (!frame.fin) {
+                                message_ready = false;  // Wait for continuation frames
+                            } else {
+                                out_opcode = ws.client_message_opcode;
+                                if (ws.client_message_compressed) {
+                                    auto result =
+                                        ws.pmd->decompress(ws.client_message, kMaxMessageBytes);
+                                    if (!result) {
+                                        LOG_ERROR(logger_,
+                                                  "permessage-deflate inflate error from "
+                                                  "client_fd={}",
+                                                  conn.fd);
+                                        auto close_frame =
+                                            http::WebSocketUtils::create_close_frame(
+                                                http::WebSocketCloseCode::INVALID_FRAME_PAYLOAD,
+                                                "Invalid compressed payload");
+                                        write(conn.fd, close_frame.data(), close_frame.size());
+                                        handle_close(conn.fd);
+                                        return;
+                                    }
+                                    inflated = std::move(*result);
+                                    out_payload = inflated;
+                                } else {
+                                    out_payload = ws.client_message;
+                                }
+                            }
                         }
-                        LOG_DEBUG(logger_, "Successfully sent {} bytes to backend", sent);
 
-                        ws.frames_sent++;
-                        ws.bytes_sent += forward_frame.size();
+                        if (message_ready) {
+                            // RFC 6455: Titan is a WebSocket CLIENT to the backend, so frames
+                            // MUST be masked
+                            std::vector<uint8_t> forward_frame;
+                            uint32_t mask_key =
+                                static_cast<uint32_t>(std::rand());  // Simple masking key
+                            http::WebSocketUtils::encode_frame_header(
+                                forward_frame, ws.pmd ? true : frame.fin, out_opcode,
+                                true,  // masked=true!
+                                out_payload.size(), mask_key);
+
+                            // Apply masking to payload
+                            std::vector<uint8_t> masked_payload(out_payload.begin(),
+                                                                out_payload.end());
+                            for (size_t i = 0; i < masked_payload.size(); ++i) {
+                                masked_payload[i] ^= (mask_key >> (8 * (3 - (i % 4)))) & 0xFF;
+                            }
+                            forward_frame.insert(forward_frame.end(), masked_payload.begin(),
+                                                 masked_payload.end());
+
+                            LOG_DEBUG(logger_, "Forwarding to backend: frame_size={} bytes",
+                                      forward_frame.size());
+                            ssize_t sent =
+                                write(ws.backend_fd, forward_frame.data(), forward_frame.size());
+                            if (sent < 0 || static_cast<size_t>(sent) != forward_frame.size()) {
+                                LOG_ERROR(logger_, "Failed to forward frame to backend_fd={}",
+                                          ws.backend_fd);
+                                handle_close(conn.fd);
+                                return;
+                            }
+                            LOG_DEBUG(logger_, "Successfully sent {} bytes to backend", sent);
+
+                            ws.frames_sent++;
+                            ws.bytes_sent += forward_frame.size();
+                            if (ws.pmd) {
+                                ws.client_message.clear();  // Keep capacity for the next message
+                            }
+                        }
                     }
                 } else {
                     // Unmasked frame from client - protocol violation
@@ -2314,10 +5018,55 @@ void Server::handle_websocket_frame(Connection& conn, bool from_client) {
                     frame.payload.size());
 
                 std::vector<uint8_t> forward_frame;
-                http::WebSocketUtils::encode_frame_header(forward_frame, frame.fin, frame.opcode,
-                                                          false, frame.payload_length, 0);
-                forward_frame.insert(forward_frame.end(), frame.payload.begin(),
-                                     frame.payload.end());
+                if (ws.pmd && frame.is_data_frame()) {
+                    // permessage-deflate: reassemble the backend message and
+                    // deflate it whole toward the client (WAN side)
+                    constexpr size_t kMaxMessageBytes = 16 * 1024 * 1024;
+                    constexpr size_t kCompressThreshold = 64;
+                    if (frame.opcode != http::WebSocketOpcode::CONTINUATION) {
+                        ws.backend_message_opcode = frame.opcode;
+                        ws.backend_message.clear();
+                    }
+                    ws.backend_message.insert(ws.backend_message.end(), frame.payload.begin(),
+                                              frame.payload.end());
+                    if (ws.backend_message.size() > kMaxMessageBytes) {
+                        LOG_ERROR(logger_, "WebSocket message too big from backend_fd={}",
+                                  ws.backend_fd);
+                        auto close_frame = http::WebSocketUtils::create_close_frame(
+                            http::WebSocketCloseCode::MESSAGE_TOO_BIG, "Message too big");
+                        write(conn.fd, close_frame.data(), close_frame.size());
+                        handle_close(conn.fd);
+                        return;
+                    }
+                    if (!frame.fin) {
+                        continue;  // Wait for continuation frames
+                    }
+
+                    // Tiny payloads skip compression (deflate overhead
+                    // exceeds the savings); fall back to plain on error
+                    std::span<const uint8_t> out_payload(ws.backend_message);
+                    std::vector<uint8_t> deflated;
+                    bool compressed = false;
+                    if (ws.backend_message.size() >= kCompressThreshold) {
+                        if (auto result = ws.pmd->compress(ws.backend_message)) {
+                            deflated = std::move(*result);
+                            out_payload = deflated;
+                            compressed = true;
+                        }
+                    }
+
+                    http::WebSocketUtils::encode_frame_header(forward_frame, true,
+                                                              ws.backend_message_opcode, false,
+                                                              out_payload.size(), 0, compressed);
+                    forward_frame.insert(forward_frame.end(), out_payload.begin(),
+                                         out_payload.end());
+                    ws.backend_message.clear();  // Keep capacity for the next message
+                } else {
+                    http::WebSocketUtils::encode_frame_header(
+                        forward_frame, frame.fin, frame.opcode, false, frame.payload_length, 0);
+                    forward_frame.insert(forward_frame.end(), frame.payload.begin(),
+                                         frame.payload.end());
+                }
 
                 LOG_DEBUG(logger_, "Forward frame size: {} bytes (header + payload)",
                           forward_frame.size());
@@ -2353,4 +5102,135 @@ void Server::handle_websocket_frame(Connection& conn, bool from_client) {
     }  // end else (backend → client)
 }
 
+void Server::poll_ws_broadcasts() {
+    bool has_new = ws_mailbox_ && ws_mailbox_->has_pending();
+    if (!has_new && ws_flush_pending_.empty()) {
+        return;
+    }
+
+    if (has_new) {
+        ws_mailbox_->drain(ws_publications_);
+
+        // Queue each publication's shared frame buffer to every local
+        // subscriber of its channel. Evictions are deferred past the loop:
+        // handle_close unsubscribes, which would invalidate the subscriber
+        // vector under our feet.
+        std::vector<int> evict;
+        for (const auto& pub : ws_publications_) {
+            auto it = ws_channels_.find(pub.channel);
+            if (it == ws_channels_.end()) {
+                continue;  // No subscribers on this worker
+            }
+            for (int fd : it->second) {
+                auto* slot = connections_.find(fd);
+                if (!slot || !(*slot)->ws_conn) {
+                    continue;
+                }
+                auto& ws = *(*slot)->ws_conn;
+                if (ws.broadcast_backlog_bytes + pub.frame->bytes.size() >
+                    kWsBroadcastMaxBacklog) {
+                    // Dropping frames would leave the subscriber with a gap
+                    // it can't detect, so cut it loose instead
+                    evict.push_back(fd);
+                    continue;
+                }
+                if (ws.broadcast_queue.empty()) {
+                    ws_flush_pending_.push_back(fd);
+                }
+                ws.broadcast_backlog_bytes += pub.frame->bytes.size();
+                ws.broadcast_queue.push_back(pub.frame);
+            }
+        }
+        for (int fd : evict) {
+            auto* slot = connections_.find(fd);
+            if (!slot) {
+                continue;  // Several publications flagged the same fd
+            }
+            LOG_WARNING(logger_, "Evicting slow WebSocket subscriber: client_fd={} backlog={}",
+                        fd, (*slot)->ws_conn->broadcast_backlog_bytes);
+            auto close_frame = http::WebSocketUtils::create_close_frame(
+                http::WebSocketCloseCode::POLICY_VIOLATION, "Subscriber too slow");
+            write(fd, close_frame.data(), close_frame.size());
+            handle_close(fd);
+        }
+    }
+
+    // Flush everyone with queued frames; keep only those that hit EAGAIN
+    // (they retry on the next loop pass). Invariant: an fd sits in
+    // ws_flush_pending_ exactly while its queue is non-empty, so the
+    // enqueue loop above never double-adds.
+    std::vector<int> failed;
+    size_t keep = 0;
+    for (size_t i = 0; i < ws_flush_pending_.size(); ++i) {
+        int fd = ws_flush_pending_[i];
+        auto* slot = connections_.find(fd);
+        if (!slot || !(*slot)->ws_conn || (*slot)->ws_conn->broadcast_queue.empty()) {
+            continue;  // Closed or evicted above
+        }
+        if (!flush_ws_broadcast(**slot)) {
+            failed.push_back(fd);
+            continue;
+        }
+        if (!(*slot)->ws_conn->broadcast_queue.empty()) {
+            ws_flush_pending_[keep++] = fd;
+        }
+    }
+    ws_flush_pending_.resize(keep);
+
+    for (int fd : failed) {
+        handle_close(fd);
+    }
+}
+
+bool Server::flush_ws_broadcast(Connection& conn) {
+    auto& ws = *conn.ws_conn;
+
+    while (!ws.broadcast_queue.empty()) {
+        // Batch queued frames into one writev; the first entry may start
+        // mid-frame after an earlier short write
+        std::array<struct iovec, 16> iov;
+        size_t iov_count = 0;
+        for (const auto& frame : ws.broadcast_queue) {
+            if (iov_count == iov.size()) {
+                break;
+            }
+            size_t offset = iov_count == 0 ? ws.broadcast_send_offset : 0;
+            iov[iov_count].iov_base = const_cast<uint8_t*>(frame->bytes.data() + offset);
+            iov[iov_count].iov_len = frame->bytes.size() - offset;
+            ++iov_count;
+        }
+
+        ssize_t sent = writev(conn.fd, iov.data(), static_cast<int>(iov_count));
+        if (sent < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return true;  // Socket full - caller keeps us in the retry list
+            }
+            LOG_ERROR(logger_, "Broadcast write error on client_fd={}: {}", conn.fd,
+                      strerror(errno));
+            return false;
+        }
+
+        ws.broadcast_backlog_bytes -= static_cast<size_t>(sent);
+        ws.bytes_sent += static_cast<size_t>(sent);
+
+        // Advance past fully sent frames, record partial progress into the
+        // next one (its refcount pins the buffer until then)
+        size_t remaining = static_cast<size_t>(sent);
+        while (remaining > 0) {
+            const auto& front = ws.broadcast_queue.front();
+            size_t unsent = front->bytes.size() - ws.broadcast_send_offset;
+            if (remaining >= unsent) {
+                remaining -= unsent;
+                ws.broadcast_send_offset = 0;
+                ws.broadcast_queue.erase(ws.broadcast_queue.begin());
+                ws.frames_sent++;
+            } else {
+                ws.broadcast_send_offset += remaining;
+                remaining = 0;
+            }
+        }
+    }
+    return true;
+}
+
 }  // namespace titan::core
@@ -23,6 +23,8 @@
 #include <openssl/ssl.h>
 #include <quill/Logger.h>
 
+#include <array>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -33,11 +35,17 @@
 #include "../gateway/pipeline.hpp"
 #include "../gateway/router.hpp"
 #include "../gateway/upstream.hpp"
+#include "../http/chunked.hpp"
 #include "../http/h2.hpp"
 #include "../http/parser.hpp"
+#include "../http/ws_broadcast.hpp"
+#include "compression_offload.hpp"
 #include "containers.hpp"
 #include "core.hpp"
+#include "memory.hpp"
 #include "socket.hpp"
+#include "static_files.hpp"
+#include "timer_wheel.hpp"
 #include "tls.hpp"
 
 // Forward declaration for test access
@@ -58,6 +66,13 @@ enum class Protocol : uint8_t {
     WEBSOCKET,  // WebSocket (RFC 6455)
 };
 
+/// Pin tying in-flight proxy state to the config snapshot it was routed
+/// with. RouteMatch holds views into that snapshot's Router, so every
+/// holder clones the worker's current pin; a displaced snapshot is freed
+/// once its own pin count reaches zero (see Server::poll_config_update).
+/// The pointee is the config generation the pin belongs to.
+using SnapshotPin = std::shared_ptr<const uint64_t>;
+
 /// Backend connection state for async proxy operations
 struct BackendConnection {
     int backend_fd = -1;               // Backend socket file descriptor
@@ -76,10 +91,48 @@ struct BackendConnection {
 
     // Timing for response middleware
     std::chrono::steady_clock::time_point start_time;
+    control::FlightTrace flight;  // Stage timestamps (moved off Connection at proxy start)
     titan::core::fast_map<std::string, std::string> metadata;  // For middleware communication
     gateway::RouteMatch route_match;                           // Route match for per-route config
     std::optional<gateway::HeaderTransformations>
         header_transforms;  // Zero-copy header modifications
+    SnapshotPin config_pin;  // Keeps the snapshot behind route_match alive
+
+    // splice() streaming state (zero-copy large-body mode, Linux only)
+    bool splice_active = false;      // Body is moving kernel-to-kernel
+    bool splice_backend_close = false;  // Backend sent Connection: close
+    bool splice_client_out = false;  // client_fd registered for EPOLLOUT
+    int splice_pipe[2] = {-1, -1};   // Pipe pair between backend and client fd
+    size_t splice_remaining = 0;     // Body bytes still to pull from backend
+    size_t splice_buffered = 0;      // Bytes parked in the pipe
+    std::vector<uint8_t> splice_header_remainder;  // Header bytes not yet sent
+
+    // Incremental chunked-response decode: once the header block announces
+    // Transfer-Encoding: chunked, each epoll event feeds only the newly
+    // arrived bytes through the decoder instead of re-running llhttp over
+    // the whole accumulated buffer. Payload runs are recorded as offsets
+    // into recv_buffer (it reallocates as it grows, so spans can't be kept)
+    bool chunked_streaming = false;    // Decoder active for this response
+    size_t chunked_cursor = 0;         // recv_buffer offset of first unfed byte
+    size_t chunked_header_len = 0;     // Header block length (incl. blank line)
+    http::ChunkedDecoder chunked_decoder;
+    std::vector<std::pair<size_t, size_t>> chunked_slices;  // (offset, length)
+
+    // Request coalescing: this request is the single in-flight leader for
+    // its key; identical GETs arriving meanwhile park as waiters and are
+    // fanned the leader's response on completion
+    bool coalesced_leader = false;
+    uint64_t coalesce_key = 0;
+
+    // Timeout tracking (cancelled automatically when this object dies)
+    TimerWheel* timer_wheel = nullptr;
+    TimerWheel::TimerId timeout_timer = TimerWheel::kInvalidTimer;
+
+    // Pending hedge launch for this request (see Server::launch_hedge)
+    TimerWheel::TimerId hedge_timer = TimerWheel::kInvalidTimer;
+
+    // I/O buffers are returned here on destruction (worker's BufferPool)
+    BufferPool* buffer_pool = nullptr;
 
     // Request preservation for async response middleware (HTTP/1.1)
     http::Request preserved_request;  // Copy of original request (for response middleware)
@@ -88,6 +141,67 @@ struct BackendConnection {
     std::string owned_path;      // Owned path string (request.path points here)
     std::string owned_uri;       // Owned URI string (request.uri points here)
     std::string owned_query;     // Owned query string (request.query points here)
+
+    ~BackendConnection() {
+        if (timer_wheel && timeout_timer != TimerWheel::kInvalidTimer) {
+            timer_wheel->cancel(timeout_timer);
+        }
+        if (timer_wheel && hedge_timer != TimerWheel::kInvalidTimer) {
+            timer_wheel->cancel(hedge_timer);
+        }
+        if (buffer_pool) {
+            buffer_pool->release(std::move(send_buffer));
+            buffer_pool->release(std::move(recv_buffer));
+        }
+    }
+};
+
+/// Per-request state for a stream multiplexed onto an HTTP/2 backend channel.
+/// Carries the same middleware/bookkeeping payload as BackendConnection but no
+/// socket of its own - the channel owns the fd and the H2Session.
+struct H2BackendStream {
+    int client_fd = -1;              // Owning client connection
+    uint32_t client_generation = 0;  // Guards against client fd recycling
+    int32_t client_stream_id = -1;   // Client-side HTTP/2 stream (-1 for HTTP/1.1 clients)
+
+    // Timing for response middleware
+    std::chrono::steady_clock::time_point start_time;
+    control::FlightTrace flight;  // Stage timestamps (carried over from the client Connection)
+    titan::core::fast_map<std::string, std::string> metadata;  // For middleware communication
+    gateway::RouteMatch route_match;                           // Route match for per-route config
+    std::optional<gateway::HeaderTransformations>
+        header_transforms;  // Zero-copy header modifications
+    SnapshotPin config_pin;  // Keeps the snapshot behind route_match alive
+
+    // Request preservation for async response middleware
+    http::Request preserved_request;  // Copy of original request (for response middleware)
+    std::vector<std::pair<std::string, std::string>>
+        request_header_storage;  // Owned header strings (for preserved_request)
+    std::string owned_path;      // Owned path string (request.path points here)
+    std::string owned_uri;       // Owned URI string (request.uri points here)
+    std::string owned_query;     // Owned query string (request.query points here)
+};
+
+/// One pooled HTTP/2 connection to a backend (h2c prior knowledge), shared by
+/// all requests this worker routes to that backend: streams multiplex onto a
+/// single socket instead of one TCP connection per in-flight request
+struct H2BackendChannel {
+    int fd = -1;                  // Backend socket (registered in backend epoll)
+    bool connect_pending = true;  // Waiting for non-blocking connect to complete
+    std::string host;             // Backend host (for latency/circuit breaker lookup)
+    uint16_t port = 0;            // Backend port
+    std::string upstream_name;    // Owning upstream
+
+    std::unique_ptr<http::H2Session> session;  // Client-mode nghttp2 session
+
+    // Guards against reentrant nghttp2 session calls: stream completion fires
+    // from inside session->recv()/send_data() and may submit new streams or
+    // trigger flushes on this same channel
+    bool session_busy = false;
+
+    // In-flight streams by backend-side stream ID (heap-allocated so the
+    // preserved request's string_views stay stable across map rehash)
+    titan::core::fast_map<int32_t, std::unique_ptr<H2BackendStream>> streams;
 };
 
 /// Active client connection
@@ -112,6 +226,7 @@ struct Connection {
     SSL* ssl = nullptr;        // OpenSSL connection object (owned by unique_ptr in Server)
     bool tls_enabled = false;  // Whether this connection uses TLS
     bool tls_handshake_complete = false;  // TLS handshake completion state
+    bool ktls_tx = false;  // Kernel encrypts the send path (enables splice)
 
     // HTTP/1.1 state
     http::Parser parser;
@@ -119,6 +234,25 @@ struct Connection {
     http::Response response;
     bool keep_alive = true;
 
+    // Flight-recorder trace for the request currently being parsed or
+    // processed; handed to the BackendConnection when a proxy launches
+    control::FlightTrace flight;
+    uint32_t flight_route_id = gateway::kInvalidRouteMetricsId;  // For commit at send time
+
+    // Route-match memo: keep-alive clients repeat the same few paths, so
+    // parameterless matches are cached here and answered with a hash
+    // compare instead of the radix descent (see Server::match_route).
+    // Entries from an older config generation are simply never returned.
+    struct RouteMemoEntry {
+        uint64_t path_hash = 0;
+        uint64_t generation = 0;
+        http::Method method = http::Method::UNKNOWN;
+        std::string path;  // Full path, guards against hash collisions
+        gateway::RouteMatch match;
+    };
+    std::array<RouteMemoEntry, 4> route_memo;
+    uint8_t route_memo_next = 0;  // Round-robin replacement slot
+
     // HTTP/2 state
     std::unique_ptr<http::H2Session> h2_session;
     // Map stream_id → backend connection (for HTTP/2 multiplexing)
@@ -127,8 +261,72 @@ struct Connection {
     // Backend proxy state (for async operations - HTTP/1.1 only)
     std::unique_ptr<BackendConnection> backend_conn;
 
+    // Streamed request-body forwarding (large uploads; see handle_http1).
+    // Body bytes bypass the parser straight into backend_conn's send
+    // buffer; while the backend's queue sits above the high watermark the
+    // client socket simply isn't read, so the TCP window closes and the
+    // upload stalls at the sender until the backend drains.
+    bool request_streaming = false;
+    size_t request_stream_remaining = 0;  // Body bytes the client still owes
+    bool read_paused = false;             // Reads halted above the high watermark
+
+    // MSG_ZEROCOPY state (cleartext only): buffers handed to the kernel
+    // stay pinned here until their completions arrive on the error queue;
+    // recycling one early would corrupt bytes still on the wire
+    // Static file sendfile handoff (cleartext HTTP/1.1 only): the cached
+    // entry's fd stands in for the response body; send_response streams
+    // it with sendfile() and clears both fields. The fd is owned by the
+    // StaticFileCache, never closed here.
+    int sendfile_fd = -1;
+    size_t sendfile_len = 0;
+
+    bool zerocopy_enabled = false;   // SO_ZEROCOPY set on this socket
+    uint32_t zerocopy_inflight = 0;  // Sends awaiting completion
+    std::vector<std::vector<uint8_t>> zerocopy_pinned;  // Oldest first
+
+    // Hedged racer for backend_conn (HTTP/1.1 GETs only): a duplicate of
+    // the request in flight to a different backend. Whichever produces
+    // response bytes first is promoted to backend_conn; the other is
+    // cancelled. Never set unless hedging is enabled for the upstream.
+    std::unique_ptr<BackendConnection> hedge_conn;
+
     // WebSocket state (for upgraded connections)
     std::unique_ptr<http::WebSocketConnection> ws_conn;
+
+    // Per-request arena: transient strings (transformed paths, middleware
+    // scratch) come from here instead of the heap; reset at request
+    // boundaries, so nothing arena-backed may outlive the request phase
+    titan::core::Arena arena{16 * 1024};
+
+    // Idle timeout tracking (cancelled automatically on destruction).
+    // Reads only push idle_deadline forward; the armed timer is left in
+    // place and re-arms itself against the deadline when it fires, so a
+    // busy connection never churns cancel+add per read (a lazy cancel
+    // strands the dead Timer in its wheel slot for the full timeout)
+    TimerWheel* timer_wheel = nullptr;
+    TimerWheel::TimerId idle_timer = TimerWheel::kInvalidTimer;
+    std::chrono::steady_clock::time_point idle_deadline{};
+
+    // I/O buffers are returned here on destruction (worker's BufferPool)
+    BufferPool* buffer_pool = nullptr;
+
+    ~Connection() {
+        if (timer_wheel && idle_timer != TimerWheel::kInvalidTimer) {
+            timer_wheel->cancel(idle_timer);
+        }
+        if (buffer_pool) {
+            buffer_pool->release(std::move(recv_buffer));
+            buffer_pool->release(std::move(response_body));
+            if (zerocopy_inflight == 0) {
+                for (auto& pinned : zerocopy_pinned) {
+                    buffer_pool->release(std::move(pinned));
+                }
+            }
+            // With completions outstanding the pinned buffers drop to the
+            // allocator instead: the kernel holds its own page references,
+            // so freeing is safe - recycling for new writes is what isn't
+        }
+    }
 };
 
 /// HTTP server managing connections
@@ -154,6 +352,10 @@ public:
 
     [[nodiscard]] int listen_fd() const noexcept { return listen_fd_; }
 
+    /// Adopt a listening socket inherited from a predecessor process
+    /// (binary handover); start() uses it instead of binding a fresh one
+    void set_inherited_listen_fd(int fd) noexcept { inherited_listen_fd_ = fd; }
+
     /// Get upstream manager (for metrics/admin server)
     [[nodiscard]] const gateway::UpstreamManager* upstream_manager() const noexcept {
         return upstream_manager_.get();
@@ -162,15 +364,63 @@ public:
     /// Set logger for this worker
     void set_logger(quill::Logger* logger) noexcept { logger_ = logger; }
 
+    /// Set per-worker metrics collector (TLS handshake/resumption counters)
+    void set_metrics(control::ThreadMetrics* metrics) noexcept { metrics_ = metrics; }
+
+    /// Immutable component bundle built from one config snapshot. Hot reload
+    /// swaps a whole bundle in at a loop-iteration boundary; the displaced
+    /// bundle parks in retired_snapshots_ until no in-flight request can
+    /// still hold views into it (RouteMatch points into the Router), which
+    /// 'users' observes: it expires when the last SnapshotPin cloned while
+    /// this bundle was live is dropped.
+    struct ConfigSnapshot {
+        std::shared_ptr<const control::Config> config;
+        std::unique_ptr<gateway::Router> router;
+        std::unique_ptr<gateway::UpstreamManager> upstream_manager;
+        std::unique_ptr<gateway::Pipeline> pipeline;
+        std::weak_ptr<const uint64_t> users;
+    };
+
+    /// Rebuilds components from a config snapshot (worker-local, no locks).
+    /// Supplied by the orchestrator, which owns the factory dependencies.
+    /// The delta says which sections actually changed and `previous` holds
+    /// the displaced live components - the factory may steal unchanged
+    /// ones (router, individual upstreams) into the new bundle instead of
+    /// rebuilding them, so a one-route deploy doesn't churn 4,000 routes
+    /// and every warmed balancer/breaker structure.
+    using SnapshotFactory = std::function<ConfigSnapshot(
+        std::shared_ptr<const control::Config>, const control::ConfigDelta&, ConfigSnapshot&)>;
+
+    /// Enable RCU-style config hot swap: the worker polls the manager's
+    /// generation counter each loop iteration and swaps in freshly built
+    /// components when it changes. Request processing never takes a lock.
+    void set_config_source(const control::ConfigManager* manager, SnapshotFactory factory);
+
+    /// Pick up a pending config swap and retire drained old snapshots.
+    /// Called once per event-loop iteration; a no-op (two relaxed atomic
+    /// loads) when nothing changed.
+    void poll_config_update();
+
     /// Process incoming connection
     void handle_accept(int client_fd, std::string_view remote_ip, uint16_t remote_port);
 
     /// Process data from connection (reads from socket internally)
     void handle_read(int client_fd);
 
+    /// Client socket reported an error condition. MSG_ZEROCOPY completions
+    /// arrive as EPOLLERR via the error queue, so this drains those first
+    /// and only closes on a genuine error. Returns true if the connection
+    /// survives.
+    bool handle_client_error(int client_fd);
+
     /// Handle connection close
     void handle_close(int client_fd);
 
+    /// Idle timer fired for a client connection. Closes it only if the
+    /// deadline (pushed forward on every read without touching the wheel)
+    /// has actually passed; otherwise re-arms for the remainder.
+    void on_idle_timeout(int client_fd);
+
     /// Backend event handling (dual epoll pattern)
     /// Returns backend epoll fd for worker to monitor
     [[nodiscard]] int backend_epoll_fd() const noexcept { return backend_epoll_fd_; }
@@ -181,6 +431,45 @@ public:
     /// Process pending backend operations (connect, send, recv)
     void process_backend_operations();
 
+    /// Hand a pipeline-marked response body to the offload compressor
+    /// pool instead of sending it now. Returns true when the job was
+    /// queued (the response is sent from process_offload_completions);
+    /// false leaves the connection untouched for the normal send path.
+    [[nodiscard]] bool try_offload_compression(Connection& client_conn,
+                                               gateway::ResponseContext& resp_ctx);
+
+    /// Drain finished offload jobs (fires when the offload eventfd,
+    /// registered in the backend epoll, becomes readable)
+    void process_offload_completions();
+
+    /// Advance the timer wheel, firing expired idle/backend timeouts.
+    /// Returns milliseconds until the next deadline (epoll_wait timeout),
+    /// or -1 if no timers are armed. Call once per event-loop round.
+    int process_timers();
+
+    /// Launch the hedged duplicate of a slow request: fires from the
+    /// hedge timer armed in proxy_to_backend. A no-op if the primary
+    /// already produced response bytes, the budget is spent, or no
+    /// different backend is available.
+    void launch_hedge(int primary_fd);
+
+    /// Cancel the losing racer of a hedged pair once the winner (the
+    /// racer owning winner_fd) produced response bytes. Promotes the
+    /// hedge into backend_conn when it is the winner.
+    void cancel_hedge_loser(Connection& conn, int winner_fd);
+
+    /// One racer of a hedged pair failed: tear down just that racer and
+    /// leave the race to the survivor. Returns true if handled (a live
+    /// sibling remains); false means no hedge pair is active and the
+    /// normal failure path must run.
+    bool drop_hedge_racer(Connection& conn, int backend_fd);
+
+    /// Maintain each upstream's warm connection stock: finalize connects
+    /// started on earlier sweeps (release into the pool once the TCP
+    /// handshake completed) and start non-blocking connects toward any
+    /// warm-target deficit. Runs on the timer sweep, never per request.
+    void warm_backend_pools();
+
     /// Add backend socket to backend epoll for monitoring
     [[nodiscard]] bool add_backend_to_epoll(int backend_fd, uint32_t events);
 
@@ -188,38 +477,179 @@ public:
     [[nodiscard]] bool remove_backend_from_epoll(int backend_fd);
 
 private:
-    const control::Config& config_;
+    // Current config: points at the startup Config initially, then at
+    // config_snapshot_ after a hot swap (the shared_ptr keeps it alive)
+    const control::Config* config_;
     int listen_fd_ = -1;
+    int inherited_listen_fd_ = -1;  // From binary handover; -1 = bind fresh
     bool running_ = false;
 
     std::unique_ptr<gateway::Router> router_;
     std::unique_ptr<gateway::UpstreamManager> upstream_manager_;
     std::unique_ptr<gateway::Pipeline> pipeline_;
 
+    // RCU config hot swap (see poll_config_update)
+    const control::ConfigManager* config_manager_ = nullptr;
+    SnapshotFactory snapshot_factory_;
+    uint64_t config_generation_seen_ = 0;
+    std::shared_ptr<const control::Config> config_snapshot_;
+    std::vector<ConfigSnapshot> retired_snapshots_;
+    // Live pin cloned into every new proxy leg; non-null from construction
+    // so requests routed before the first reload are accounted for too
+    SnapshotPin snapshot_pin_ = std::make_shared<const uint64_t>(0);
+
     quill::Logger* logger_ = nullptr;
+    control::ThreadMetrics* metrics_ = nullptr;
 
     // TLS support
     std::optional<TlsContext> tls_context_;
-    titan::core::fast_map<int, SslPtr> ssl_connections_;  // fd -> SSL object mapping
 
-    titan::core::fast_map<int, std::unique_ptr<Connection>> connections_;
-
-    // DNS resolution cache (hostname -> resolved address)
-    // Cache is never invalidated for simplicity (MVP)
-    // TODO: Add TTL-based expiration for production
-    titan::core::fast_map<std::string, sockaddr_in> dns_cache_;
+    // Certificate hot-reload state (see poll_tls_reload): recorded
+    // mtimes of the cert/key files, refreshed only on successful swap
+    std::chrono::steady_clock::time_point last_tls_check_{};
+    time_t tls_cert_mtime_ = 0;
+    time_t tls_key_mtime_ = 0;
+    titan::core::FdTable<SslPtr> ssl_connections_;  // fd -> SSL object mapping
+
+    // Flat fd-indexed slot table: fds are dense small integers, so direct
+    // indexing avoids per-event hashing and rehash pauses at high
+    // connection counts (generation counters catch stale fds)
+    titan::core::FdTable<std::unique_ptr<Connection>> connections_;
+
+    // Hierarchical timer wheel: client idle timeouts and backend
+    // connect/read timeouts, O(1) per timer (no per-round scans)
+    TimerWheel timer_wheel_;
+
+    // Size-classed I/O buffer recycling: connections draw recv/send
+    // buffers here on accept and return them on close, trimmed back to
+    // the recent demand peak from the timer path
+    BufferPool buffer_pool_;
+    std::chrono::steady_clock::time_point last_pool_trim_{};
+    std::chrono::steady_clock::time_point last_breaker_eval_{};
+
+    // mmap-backed open-file cache for static routes; inotify events are
+    // drained from the timer path (see process_timers)
+    StaticFileCache static_files_;
+    std::chrono::steady_clock::time_point last_static_poll_{};
+
+    // Worker CPU sampling (feeds control::t_worker_cpu_utilization)
+    std::chrono::steady_clock::time_point last_cpu_sample_{};
+    std::chrono::steady_clock::time_point last_metrics_publish_{};
+    uint64_t last_cpu_usage_us_ = 0;
+
+    // Active health checking: highest probe result sequence already
+    // folded into this worker's backends (see HealthProber::apply)
+    std::chrono::steady_clock::time_point last_health_apply_{};
+    uint64_t health_probe_seq_ = 0;
+
+    // In-flight prewarming connects (see warm_backend_pools). The upstream
+    // is tracked by name, not pointer - a config hot swap can retire the
+    // Upstream while a warmup connect is still in the TCP handshake.
+    struct WarmingConnect {
+        int fd = -1;
+        std::string host;
+        uint16_t port = 0;
+        std::string upstream_name;
+        std::chrono::steady_clock::time_point started;
+    };
+    std::vector<WarmingConnect> warming_connects_;
+
+    // Fire-and-forget shadow mirror (see launch_mirror): a sampled copy
+    // of a proxied request in flight to a backend of the route's mirror
+    // upstream. Writes happen only when the socket says writable, the
+    // response is drained and discarded, and teardown is unilateral -
+    // nothing here can block or fail the primary request.
+    struct ShadowMirror {
+        int fd = -1;
+        bool connect_pending = true;
+        std::vector<uint8_t> send_buffer;  // Identical request bytes
+        size_t send_cursor = 0;
+        std::chrono::steady_clock::time_point started;  // For the timeout sweep
+    };
+    titan::core::fast_map<int, ShadowMirror> shadow_mirrors_;
+    uint64_t mirror_rng_ = 0x9e3779b97f4a7c15ULL;  // xorshift state for sampling
+
+    // WebSocket broadcast fan-out (see http/ws_broadcast.hpp): per-worker
+    // channel registry of subscribed client fds, plus this worker's bus
+    // mailbox (registered lazily on the first subscription). The bus
+    // serializes each message once; subscribers queue the shared buffer
+    // and poll_ws_broadcasts writev()s it out.
+    titan::core::fast_map<std::string, std::vector<int>> ws_channels_;
+    http::WsBroadcastMailbox* ws_mailbox_ = nullptr;
+    std::vector<http::WsBroadcastPublication> ws_publications_;  // Drain scratch
+    std::vector<int> ws_flush_pending_;  // Subscribers with unsent queued frames
+
+    // A subscriber this far behind is evicted rather than left with an
+    // undetectable gap in its stream
+    static constexpr size_t kWsBroadcastMaxBacklog = 4 * 1024 * 1024;
+
+    // DNS resolution lives in UpstreamManager's DnsResolver (background
+    // refresh, TTL cache) - no blocking getaddrinfo on the event loop
 
     // Dual epoll for non-blocking backend I/O
     int backend_epoll_fd_ = -1;  // Separate epoll instance for backend sockets
+
+    // Offloaded compression: completed jobs land in this mailbox and the
+    // eventfd (registered in backend_epoll_fd_) wakes the loop to drain it
+    int offload_eventfd_ = -1;
+    CompressionCompletionQueue offload_completions_;
     // Map backend_fd -> (client_fd, stream_id) to avoid storing dangling raw pointers
     // stream_id = -1 for HTTP/1.1, >= 0 for HTTP/2 streams
-    titan::core::fast_map<int, std::pair<int, int32_t>> backend_connections_;
+    titan::core::FdTable<std::pair<int, int32_t>> backend_connections_;
+
+    // Sentinel client_fd marking a backend fd as an HTTP/2 channel; events on
+    // such fds dispatch to handle_h2_backend_event instead of the per-request path
+    static constexpr int kH2BackendChannelFd = -2;
+
+    // Sentinel client_fd marking a backend fd as a shadow mirror socket;
+    // events dispatch to handle_shadow_event
+    static constexpr int kShadowMirrorFd = -3;
+
+    // HTTP/2 backend channels keyed "host:port" - one multiplexed connection
+    // per backend per worker (single-threaded, no locking needed)
+    titan::core::fast_map<std::string, std::unique_ptr<H2BackendChannel>> h2_backend_channels_;
+
+    // Client-side stream ID of the HTTP/2 request currently being proxied;
+    // set around proxy_to_backend in process_http2_stream so the h2 backend
+    // path can route the response back to the right client stream
+    int32_t current_h2_client_stream_ = -1;
 
     /// Process request and send response
     /// returns false if connection was/should be closed
     bool process_request(Connection& conn);
+
+    /// Route match via the connection's memo, falling back to the radix
+    /// descent on miss. Only parameterless matches are memoized: param
+    /// and wildcard views point into the request that produced them.
+    [[nodiscard]] gateway::RouteMatch match_route(Connection& conn, http::Method method,
+                                                  std::string_view path);
+
+    /// Fill `response` for a static file route (GET only, conditional
+    /// GETs and precompressed variants handled here). HTTP/1.1 callers
+    /// pass allow_sendfile=true: cleartext responses arm the connection's
+    /// sendfile fields instead of a body. HTTP/2 responses get an owned
+    /// body copy - the session streams it across later loop passes, and
+    /// cache invalidation must not unmap pages under it.
+    void serve_static_file(Connection& conn, http::Request& request, http::Response& response,
+                           const gateway::RouteMatch& match, bool allow_sendfile);
+
     void send_response(Connection& conn, bool keep_alive);
 
+    /// Rotate certificates without a restart: stat the cert/key paths on
+    /// the timer sweep and rebuild the context when either file changed.
+    /// New handshakes pick up the fresh SSL_CTX immediately; in-flight
+    /// connections hold their own reference to the old one (OpenSSL
+    /// refcounts it) and finish undisturbed. Ticket keys live in the
+    /// shared TlsTicketKeyStore, so resumption survives the swap.
+    void poll_tls_reload();
+
+    /// Streamed request-body forwarding: start forwarding a large upload
+    /// once its header block has parsed, before the body has arrived
+    void try_begin_request_stream(Connection& conn, std::span<const uint8_t> remaining);
+    /// Move buffered body bytes into the backend's send queue and apply
+    /// the watermark pause; returns false if the connection was torn down
+    bool stream_request_body(Connection& conn);
+
     /// Protocol-specific handlers
     void handle_http1(Connection& conn);
     void handle_http2(Connection& conn);
@@ -229,9 +659,58 @@ private:
     void handle_websocket_upgrade(Connection& conn);
     void handle_websocket_frame(Connection& conn, bool from_client = true);
 
+    /// Drain this worker's broadcast mailbox: queue each publication's
+    /// shared frame to every subscriber of its channel, then flush.
+    /// Subscribers whose backlog would exceed the cap are evicted.
+    void poll_ws_broadcasts();
+    /// writev() queued broadcast frames to one subscriber; returns false
+    /// on a write error (caller closes the connection)
+    [[nodiscard]] bool flush_ws_broadcast(Connection& conn);
+
     /// Proxy request to backend using context (for middleware integration)
     bool proxy_to_backend(Connection& conn, gateway::RequestContext& ctx);
 
+    /// Duplicate the just-launched proxied request toward the route's
+    /// mirror upstream, fire-and-forget (percentage-sampled). Runs only
+    /// after the primary is fully armed, so no failure here can reach it.
+    void launch_mirror(const gateway::RouteMatch& match, std::span<const uint8_t> request_bytes);
+    /// Drive one shadow socket: finish the write when writable, drain and
+    /// discard response bytes, tear down on error or EOF
+    void handle_shadow_event(int shadow_fd, bool readable, bool writable, bool error);
+    /// Unregister and close a shadow socket
+    void close_shadow(int shadow_fd);
+
+    /// HTTP/2 backend channels: submit the request as a stream on the pooled
+    /// channel for the selected backend, dialing the channel on first use.
+    /// Responses are delivered per stream from handle_h2_backend_event.
+    bool proxy_to_backend_h2(Connection& conn, gateway::RequestContext& ctx,
+                             gateway::Upstream& upstream, const gateway::Backend& backend);
+    /// Drive a channel socket: finish connect, feed received frames to the
+    /// session, flush pending frames
+    void handle_h2_backend_event(H2BackendChannel& channel, bool readable, bool writable,
+                                 bool error);
+    /// Write the session's pending frames to the channel socket
+    void flush_h2_channel(H2BackendChannel& channel);
+    /// Deliver one completed (or reset) backend stream to its client
+    void complete_h2_stream(H2BackendChannel& channel, int32_t stream_id);
+    /// Tear down a channel, answering every in-flight stream with 502
+    void fail_h2_channel(H2BackendChannel& channel);
+    /// Copy conn.response onto the client's H2 session and flush frames
+    void submit_h2_response_to_client(Connection& client_conn, int32_t stream_id);
+
+    /// Record per-route counters + latency against the route's dense
+    /// metrics ID (array index, no string keys). When a flight trace is
+    /// supplied, its Complete stage is marked here and the trace is
+    /// committed to the worker's flight recorder.
+    void record_route_metrics(const gateway::RouteMatch& route_match,
+                              std::chrono::steady_clock::time_point start_time, uint16_t status,
+                              control::FlightTrace* flight = nullptr);
+
+    /// Commit the connection's flight trace for a request that completed
+    /// without a backend leg (local response, middleware stop, 404);
+    /// no-op when the trace already moved to a BackendConnection
+    void commit_flight(Connection& conn);
+
     /// Connect to backend server (blocking - legacy)
     [[nodiscard]] int connect_to_backend(const std::string& host, uint16_t port);
 
@@ -240,14 +719,47 @@ private:
     [[nodiscard]] int connect_to_backend_async(const std::string& host, uint16_t port);
 
     /// Build HTTP request string to send to backend
+    /// path/query overrides are arena-backed rewrites from TransformMiddleware
     std::string build_backend_request(
         const http::Request& request,
         const titan::core::fast_map<std::string, std::string>& metadata,
-        const std::optional<gateway::HeaderTransformations>& header_transforms = std::nullopt);
+        const std::optional<gateway::HeaderTransformations>& header_transforms = std::nullopt,
+        std::string_view path_override = {}, std::string_view query_override = {});
 
     /// Receive and parse HTTP response from backend
     bool receive_backend_response(int backend_fd, http::Response& response,
                                   std::vector<uint8_t>& body);
+
+    /// Request coalescing (HTTP/1.1 GETs): dedupe identical in-flight
+    /// requests per worker so a stampede issues one backend round trip.
+    /// fan_out replays the leader's completed response to every parked
+    /// waiter; fail_waiters answers them 502 when the leader dies early.
+    void fan_out_coalesced(uint64_t key, Connection& leader_conn);
+    void fail_coalesced_waiters(BackendConnection& bc);
+
+    // Coalescing state: in-flight leader keys and parked waiter
+    // connections as (fd, generation) pairs - the generation guards
+    // against the fd being recycled before fan-out
+    titan::core::fast_set<uint64_t> coalesce_inflight_;
+    titan::core::fast_map<uint64_t, std::vector<std::pair<int, uint32_t>>> coalesce_waiters_;
+
+    /// splice() streaming mode for large response bodies (Linux only).
+    /// try_start_splice: once the backend header block is complete, forward
+    /// headers and switch the body transfer to kernel-to-kernel splice.
+    /// Returns false if the response is not eligible (no-op off Linux).
+    bool try_start_splice(Connection& conn, BackendConnection& bc);
+    /// Pump body bytes backend -> pipe -> client until done or EAGAIN
+    void pump_splice(Connection& conn, BackendConnection& bc);
+    /// Tear down splice state; pools or closes the backend socket
+    void finish_splice(Connection& conn, BackendConnection& bc, bool success);
+
+    /// Incremental chunked-response decode. Once the backend header block
+    /// is complete and announces Transfer-Encoding: chunked (and llhttp
+    /// would not frame the response specially - no HEAD/1xx/204/304),
+    /// arms bc.chunked_decoder so handle_backend_event feeds only newly
+    /// arrived bytes instead of re-parsing the whole buffer per event.
+    void maybe_start_chunked_decode(BackendConnection& bc);
+    std::vector<std::span<const uint8_t>> chunk_slice_scratch_;  // feed() output
 };
 
 }  // namespace titan::core
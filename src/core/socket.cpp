@@ -25,8 +25,14 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <linux/errqueue.h>
+#include <linux/filter.h>
+#endif
+
 #include <atomic>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 
 #include "containers.hpp"
@@ -146,6 +152,226 @@ std::error_code set_reuseaddr(int fd) {
     return {};
 }
 
+std::error_code enable_zerocopy(int fd) {
+#if defined(__linux__) && defined(SO_ZEROCOPY)
+    int opt = 1;
+    if (setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &opt, sizeof(opt)) < 0) {
+        return std::error_code(errno, std::system_category());
+    }
+    return {};
+#else
+    (void)fd;
+    return std::make_error_code(std::errc::not_supported);
+#endif
+}
+
+std::error_code set_notsent_lowat(int fd, uint32_t bytes) {
+#if defined(__linux__) && defined(TCP_NOTSENT_LOWAT)
+    if (setsockopt(fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT, &bytes, sizeof(bytes)) < 0) {
+        return std::error_code(errno, std::system_category());
+    }
+    return {};
+#else
+    (void)fd;
+    (void)bytes;
+    return std::make_error_code(std::errc::not_supported);
+#endif
+}
+
+bool drain_zerocopy_completions(int fd, uint32_t& completed_sends) {
+#if defined(__linux__) && defined(SO_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+    bool genuine_error = false;
+    for (;;) {
+        char control[128];
+        msghdr msg{};
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        ssize_t r = recvmsg(fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT);
+        if (r < 0) {
+            break;  // EAGAIN: queue drained (anything else surfaces elsewhere)
+        }
+
+        for (cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm != nullptr; cm = CMSG_NXTHDR(&msg, cm)) {
+            if ((cm->cmsg_level == SOL_IP && cm->cmsg_type == IP_RECVERR) ||
+                (cm->cmsg_level == SOL_IPV6 && cm->cmsg_type == IPV6_RECVERR)) {
+                auto* serr = reinterpret_cast<sock_extended_err*>(CMSG_DATA(cm));
+                if (serr->ee_errno == 0 && serr->ee_origin == SO_EE_ORIGIN_ZEROCOPY) {
+                    // ee_info..ee_data is an inclusive range of completed
+                    // zero-copy send counters
+                    completed_sends += serr->ee_data - serr->ee_info + 1;
+                } else {
+                    genuine_error = true;
+                }
+            }
+        }
+    }
+    return !genuine_error;
+#else
+    (void)fd;
+    (void)completed_sends;
+    return true;
+#endif
+}
+
+std::error_code set_busy_poll(int fd, uint32_t usec) {
+#if defined(__linux__) && defined(SO_BUSY_POLL)
+    int val = static_cast<int>(usec);
+    if (setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &val, sizeof(val)) < 0) {
+        return std::error_code(errno, std::system_category());
+    }
+    return {};
+#else
+    (void)fd;
+    (void)usec;
+    return std::make_error_code(std::errc::not_supported);
+#endif
+}
+
+std::error_code set_tcp_fastopen(int fd, uint32_t queue_length) {
+#if defined(__linux__) && defined(TCP_FASTOPEN)
+    int qlen = static_cast<int>(queue_length);
+    if (setsockopt(fd, IPPROTO_TCP, TCP_FASTOPEN, &qlen, sizeof(qlen)) < 0) {
+        return std::error_code(errno, std::system_category());
+    }
+    return {};
+#else
+    (void)fd;
+    (void)queue_length;
+    return std::make_error_code(std::errc::not_supported);
+#endif
+}
+
+std::error_code set_tcp_defer_accept(int fd, uint32_t seconds) {
+#if defined(__linux__) && defined(TCP_DEFER_ACCEPT)
+    int val = static_cast<int>(seconds);
+    if (setsockopt(fd, IPPROTO_TCP, TCP_DEFER_ACCEPT, &val, sizeof(val)) < 0) {
+        return std::error_code(errno, std::system_category());
+    }
+    return {};
+#else
+    (void)fd;
+    (void)seconds;
+    return std::make_error_code(std::errc::not_supported);
+#endif
+}
+
+std::error_code set_tcp_fastopen_connect(int fd) {
+#if defined(__linux__) && defined(TCP_FASTOPEN_CONNECT)
+    int opt = 1;
+    if (setsockopt(fd, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, &opt, sizeof(opt)) < 0) {
+        return std::error_code(errno, std::system_category());
+    }
+    return {};
+#else
+    (void)fd;
+    return std::make_error_code(std::errc::not_supported);
+#endif
+}
+
+bool get_listen_queue_stats(int fd, ListenQueueStats& stats) {
+#if defined(__linux__) && defined(TCP_INFO)
+    // For listening sockets the kernel reuses tcp_info fields:
+    // tcpi_unacked is the current accept-queue depth, tcpi_sacked the
+    // configured backlog limit (see tcp_get_info in net/ipv4/tcp.c)
+    struct tcp_info info{};
+    socklen_t len = sizeof(info);
+    if (getsockopt(fd, IPPROTO_TCP, TCP_INFO, &info, &len) < 0) {
+        return false;
+    }
+    stats.depth = info.tcpi_unacked;
+    stats.limit = info.tcpi_sacked;
+    return true;
+#else
+    (void)fd;
+    (void)stats;
+    return false;
+#endif
+}
+
+bool read_listen_overflow_counters(uint64_t& overflows, uint64_t& drops) {
+#ifdef __linux__
+    FILE* f = fopen("/proc/net/netstat", "r");
+    if (!f) {
+        return false;
+    }
+
+    // /proc/net/netstat comes in header/value line pairs; find the TcpExt
+    // pair, locate ListenOverflows and ListenDrops in the header, and pull
+    // the same columns from the value line
+    char header[2048];
+    char values[2048];
+    bool found = false;
+    while (fgets(header, sizeof(header), f)) {
+        if (strncmp(header, "TcpExt:", 7) != 0 || !fgets(values, sizeof(values), f)) {
+            continue;
+        }
+
+        int overflow_col = -1;
+        int drop_col = -1;
+        int col = 0;
+        char* save = nullptr;
+        for (char* tok = strtok_r(header + 7, " \n", &save); tok;
+             tok = strtok_r(nullptr, " \n", &save), ++col) {
+            if (strcmp(tok, "ListenOverflows") == 0) {
+                overflow_col = col;
+            } else if (strcmp(tok, "ListenDrops") == 0) {
+                drop_col = col;
+            }
+        }
+        if (overflow_col < 0 && drop_col < 0) {
+            break;
+        }
+
+        col = 0;
+        save = nullptr;
+        for (char* tok = strtok_r(values + 7, " \n", &save); tok;
+             tok = strtok_r(nullptr, " \n", &save), ++col) {
+            if (col == overflow_col) {
+                overflows = strtoull(tok, nullptr, 10);
+                found = true;
+            } else if (col == drop_col) {
+                drops = strtoull(tok, nullptr, 10);
+                found = true;
+            }
+        }
+        break;
+    }
+    fclose(f);
+    return found;
+#else
+    (void)overflows;
+    (void)drops;
+    return false;
+#endif
+}
+
+std::error_code attach_reuseport_cpu_steering(int fd) {
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+    // Two-instruction classic BPF: load the current CPU id, return it as
+    // the socket index. Listeners join the reuseport group in worker order,
+    // and workers are pinned to cores in the same order, so index == CPU
+    // lands each connection on the worker already running there. If the
+    // returned index exceeds the group size the kernel falls back to the
+    // default hash, so partial worker startup stays safe.
+    struct sock_filter code[] = {
+        {BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+        {BPF_RET | BPF_A, 0, 0, 0},
+    };
+    struct sock_fprog prog{};
+    prog.len = sizeof(code) / sizeof(code[0]);
+    prog.filter = code;
+
+    if (setsockopt(fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog, sizeof(prog)) < 0) {
+        return std::error_code(errno, std::system_category());
+    }
+    return {};
+#else
+    (void)fd;
+    return std::make_error_code(std::errc::not_supported);
+#endif
+}
+
 void close_fd(int fd) {
     if (fd >= 0) {
 #ifdef TITAN_ENABLE_FD_TRACKING
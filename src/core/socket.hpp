@@ -31,6 +31,68 @@ namespace titan::core {
 [[nodiscard]] std::error_code set_nonblocking(int fd);
 [[nodiscard]] std::error_code set_reuseaddr(int fd);
 
+/// Opt a connected socket into MSG_ZEROCOPY sends (SO_ZEROCOPY). The
+/// caller becomes responsible for keeping each zero-copy send buffer
+/// untouched until its completion arrives on the error queue (see
+/// drain_zerocopy_completions). Linux only; returns ENOTSUP elsewhere.
+[[nodiscard]] std::error_code enable_zerocopy(int fd);
+
+/// Set TCP_NOTSENT_LOWAT: the socket only reports writable while the
+/// not-yet-sent queue is below the threshold, so the event loop stops
+/// being woken to stuff kernel buffers that are already deep.
+[[nodiscard]] std::error_code set_notsent_lowat(int fd, uint32_t bytes);
+
+/// Drain MSG_ZEROCOPY completion notifications from the socket's error
+/// queue. Adds the number of completed zero-copy sends (completions are
+/// delivered in send order) to 'completed_sends'. Returns false if a
+/// genuine socket error was dequeued alongside - the caller should treat
+/// the connection as failed.
+[[nodiscard]] bool drain_zerocopy_completions(int fd, uint32_t& completed_sends);
+
+/// Set SO_BUSY_POLL: receive paths (including epoll_wait with a zero
+/// timeout) busy-poll the NIC queue for up to 'usec' microseconds before
+/// sleeping, trading idle CPU for wakeup latency. May need CAP_NET_ADMIN
+/// on older kernels. Linux only; returns ENOTSUP elsewhere.
+[[nodiscard]] std::error_code set_busy_poll(int fd, uint32_t usec);
+
+/// Enable TCP Fast Open on a listening socket with the given pending-TFO
+/// queue length. Repeat clients holding a valid cookie deliver their
+/// request in the SYN, saving a full RTT to first byte - most visible
+/// during reconnect storms. Needs net.ipv4.tcp_fastopen to allow server
+/// mode (bit 2). Returns ENOTSUP where unavailable.
+[[nodiscard]] std::error_code set_tcp_fastopen(int fd, uint32_t queue_length);
+
+/// Set TCP_DEFER_ACCEPT: the kernel completes the handshake but only
+/// surfaces the connection to accept() once data arrives (or the timeout
+/// expires), so workers never wake for data-less connections. Linux only.
+[[nodiscard]] std::error_code set_tcp_defer_accept(int fd, uint32_t seconds);
+
+/// Opt a not-yet-connected socket into TCP_FASTOPEN_CONNECT: once a TFO
+/// cookie for the destination is cached, connect() returns immediately
+/// and the first write rides the SYN. Transparent to the caller - plain
+/// connect()/write() semantics are preserved either way. Linux 4.11+.
+[[nodiscard]] std::error_code set_tcp_fastopen_connect(int fd);
+
+/// Accept-queue occupancy of a listening socket, sampled via TCP_INFO
+/// (depth = connections waiting in accept(), limit = configured backlog)
+struct ListenQueueStats {
+    uint32_t depth = 0;
+    uint32_t limit = 0;
+};
+[[nodiscard]] bool get_listen_queue_stats(int fd, ListenQueueStats& stats);
+
+/// Read the host-wide TcpExt ListenOverflows / ListenDrops counters from
+/// /proc/net/netstat (connections lost to a full accept queue). Host-wide
+/// because the kernel does not account overflows per listener.
+[[nodiscard]] bool read_listen_overflow_counters(uint64_t& overflows, uint64_t& drops);
+
+/// Attach a cBPF program to the SO_REUSEPORT group steering each incoming
+/// connection to the listener whose index equals the receiving CPU.
+/// With workers pinned to cores (pin_thread_to_core) this keeps a
+/// connection on the CPU that handled its SYN instead of the default
+/// 4-tuple hash. Linux only; returns ENOTSUP elsewhere.
+[[nodiscard]] std::error_code attach_reuseport_cpu_steering(int fd);
+
 void close_fd(int fd);
 
 // Performance instrumentation - track fd origins for debugging
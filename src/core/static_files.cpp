@@ -0,0 +1,301 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Static File Cache - Implementation
+
+#include "static_files.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+
+namespace titan::core {
+
+namespace {
+
+/// Content types for the extensions SPAs actually ship. Anything else
+/// goes out as application/octet-stream.
+std::string_view content_type_for(std::string_view path) {
+    auto dot = path.rfind('.');
+    if (dot == std::string_view::npos) {
+        return "application/octet-stream";
+    }
+    std::string_view ext = path.substr(dot + 1);
+    if (ext == "html" || ext == "htm")
+        return "text/html; charset=utf-8";
+    if (ext == "css")
+        return "text/css; charset=utf-8";
+    if (ext == "js" || ext == "mjs")
+        return "text/javascript; charset=utf-8";
+    if (ext == "json" || ext == "map")
+        return "application/json";
+    if (ext == "svg")
+        return "image/svg+xml";
+    if (ext == "png")
+        return "image/png";
+    if (ext == "jpg" || ext == "jpeg")
+        return "image/jpeg";
+    if (ext == "gif")
+        return "image/gif";
+    if (ext == "webp")
+        return "image/webp";
+    if (ext == "ico")
+        return "image/x-icon";
+    if (ext == "woff2")
+        return "font/woff2";
+    if (ext == "woff")
+        return "font/woff";
+    if (ext == "wasm")
+        return "application/wasm";
+    if (ext == "txt")
+        return "text/plain; charset=utf-8";
+    if (ext == "xml")
+        return "application/xml";
+    if (ext == "pdf")
+        return "application/pdf";
+    return "application/octet-stream";
+}
+
+/// Reject anything that could escape the root: parent segments, embedded
+/// NULs, absolute paths smuggled through the wildcard
+bool path_is_safe(std::string_view rel) {
+    if (rel.find('\0') != std::string_view::npos) {
+        return false;
+    }
+    if (!rel.empty() && rel.front() == '/') {
+        return false;
+    }
+    size_t pos = 0;
+    while (pos <= rel.size()) {
+        size_t next = rel.find('/', pos);
+        std::string_view segment =
+            rel.substr(pos, next == std::string_view::npos ? rel.size() - pos : next - pos);
+        if (segment == "..") {
+            return false;
+        }
+        if (next == std::string_view::npos) {
+            break;
+        }
+        pos = next + 1;
+    }
+    return true;
+}
+
+struct MappedFile {
+    int fd = -1;
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    struct stat st {};
+};
+
+/// Open + fstat + mmap a regular file; fd stays open for sendfile
+bool map_file(const std::string& path, MappedFile& out) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return false;
+    }
+    const uint8_t* data = nullptr;
+    if (st.st_size > 0) {
+        void* map = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+        data = static_cast<const uint8_t*>(map);
+    }
+    out.fd = fd;
+    out.data = data;
+    out.size = static_cast<size_t>(st.st_size);
+    out.st = st;
+    return true;
+}
+
+void unmap_close(int fd, const uint8_t* data, size_t size) {
+    if (data != nullptr && size > 0) {
+        munmap(const_cast<uint8_t*>(data), size);
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+}  // namespace
+
+StaticFileCache::Entry::~Entry() {
+    unmap_close(fd, data, size);
+    for (const auto& v : variants) {
+        unmap_close(v.fd, v.data, v.size);
+    }
+}
+
+StaticFileCache::StaticFileCache() {
+#ifdef __linux__
+    inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+}
+
+StaticFileCache::~StaticFileCache() {
+    if (inotify_fd_ >= 0) {
+        close(inotify_fd_);
+    }
+}
+
+const StaticFileCache::Entry* StaticFileCache::lookup(std::string_view root,
+                                                      std::string_view rel_path) {
+    if (!path_is_safe(rel_path)) {
+        return nullptr;
+    }
+
+    std::string abs;
+    abs.reserve(root.size() + rel_path.size() + 12);
+    abs.append(root);
+    if (abs.empty() || abs.back() != '/') {
+        abs.push_back('/');
+    }
+    abs.append(rel_path);
+    if (rel_path.empty() || abs.back() == '/') {
+        abs.append("index.html");
+    }
+
+    auto it = entries_.find(abs);
+    if (it != entries_.end()) {
+        return it->second.get();
+    }
+
+    auto entry = load(abs);
+    if (!entry) {
+        return nullptr;  // Misses are not cached; 404s re-stat each time
+    }
+    watch_parent(abs);
+    auto [inserted, ok] = entries_.emplace(std::move(abs), std::move(entry));
+    (void)ok;
+    return inserted->second.get();
+}
+
+std::unique_ptr<StaticFileCache::Entry> StaticFileCache::load(const std::string& abs_path) {
+    MappedFile file;
+    if (!map_file(abs_path, file)) {
+        return nullptr;
+    }
+
+    auto entry = std::make_unique<Entry>();
+    entry->fd = file.fd;
+    entry->data = file.data;
+    entry->size = file.size;
+    entry->content_type = content_type_for(abs_path);
+
+    // Strong ETag from size + mtime (nginx-style): changes whenever the
+    // file does, stable across workers serving the same deploy
+    char etag[64];
+    snprintf(etag, sizeof(etag), "\"%zx-%lx\"", entry->size,
+             static_cast<unsigned long>(file.st.st_mtime));
+    entry->etag = etag;
+
+    // Precompressed siblings, in the order we prefer serving them
+    static constexpr struct {
+        const char* ext;
+        std::string_view encoding;
+    } kVariants[] = {{".br", "br"}, {".zst", "zstd"}, {".gz", "gzip"}};
+    for (const auto& [ext, encoding] : kVariants) {
+        MappedFile vf;
+        if (map_file(abs_path + ext, vf)) {
+            Variant v;
+            v.encoding = encoding;
+            v.fd = vf.fd;
+            v.data = vf.data;
+            v.size = vf.size;
+            entry->variants.push_back(v);
+        }
+    }
+
+    return entry;
+}
+
+void StaticFileCache::watch_parent(const std::string& abs_path) {
+#ifdef __linux__
+    if (inotify_fd_ < 0) {
+        return;
+    }
+    auto slash = abs_path.rfind('/');
+    std::string dir = slash == std::string::npos ? "." : abs_path.substr(0, slash);
+
+    // inotify_add_watch on an already-watched dir returns the same wd
+    int wd = inotify_add_watch(inotify_fd_, dir.c_str(),
+                               IN_CLOSE_WRITE | IN_DELETE | IN_MOVED_TO | IN_MOVED_FROM);
+    if (wd >= 0) {
+        watches_[wd] = std::move(dir);
+    }
+#else
+    (void)abs_path;
+#endif
+}
+
+void StaticFileCache::poll() {
+#ifdef __linux__
+    if (inotify_fd_ < 0 || entries_.empty()) {
+        return;
+    }
+
+    alignas(inotify_event) char buf[4096];
+    bool changed = false;
+    std::vector<std::string> dirty_dirs;
+    for (;;) {
+        ssize_t n = read(inotify_fd_, buf, sizeof(buf));
+        if (n <= 0) {
+            break;  // EAGAIN: no events pending
+        }
+        for (ssize_t off = 0; off < n;) {
+            auto* event = reinterpret_cast<const inotify_event*>(buf + off);
+            auto it = watches_.find(event->wd);
+            if (it != watches_.end()) {
+                dirty_dirs.push_back(it->second);
+                changed = true;
+            }
+            off += static_cast<ssize_t>(sizeof(inotify_event)) + event->len;
+        }
+    }
+    if (!changed) {
+        return;
+    }
+
+    // Coarse invalidation: drop every entry in a changed directory. A
+    // deploy rewrites a handful of files; reloading siblings is cheap
+    // next to serving stale bytes.
+    for (const auto& dir : dirty_dirs) {
+        std::erase_if(entries_, [&dir](const auto& kv) {
+            const std::string& path = kv.first;
+            return path.size() > dir.size() + 1 && path.compare(0, dir.size(), dir) == 0 &&
+                   path[dir.size()] == '/' &&
+                   path.find('/', dir.size() + 1) == std::string::npos;
+        });
+    }
+#endif
+}
+
+}  // namespace titan::core
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Static File Cache - Header
+// mmap-backed open-file cache for static routes: files stay open and
+// mapped across requests (the fd feeds sendfile, the mapping feeds TLS
+// and HTTP/2 sends), with precomputed ETags, extension-based content
+// types, and precompressed sibling variants (.br/.zst/.gz) discovered at
+// load. Directories holding cached files are watched via inotify;
+// poll() drains events and drops stale entries, so a deploy that
+// rewrites assets invalidates without a restart.
+
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "containers.hpp"
+
+namespace titan::core {
+
+/// Per-worker open-file cache (single-threaded, like everything a
+/// Server owns)
+class StaticFileCache {
+public:
+    /// One precompressed sibling (asset.js.br next to asset.js)
+    struct Variant {
+        std::string_view encoding;  // "br" / "zstd" / "gzip" (static literal)
+        int fd = -1;
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+    };
+
+    /// Cached file: open fd + mapping + metadata, owned until invalidated
+    struct Entry {
+        int fd = -1;
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        std::string etag;               // Strong ETag from size + mtime
+        std::string_view content_type;  // From extension (static literal)
+        std::vector<Variant> variants;  // Preference order: br, zstd, gzip
+
+        Entry() = default;
+        Entry(const Entry&) = delete;
+        Entry& operator=(const Entry&) = delete;
+        ~Entry();
+    };
+
+    StaticFileCache();
+    ~StaticFileCache();
+
+    StaticFileCache(const StaticFileCache&) = delete;
+    StaticFileCache& operator=(const StaticFileCache&) = delete;
+
+    /// Resolve and cache `rel_path` under `root`. Returns nullptr for
+    /// traversal attempts, missing files, and non-regular files. An empty
+    /// or directory-like rel_path serves index.html.
+    [[nodiscard]] const Entry* lookup(std::string_view root, std::string_view rel_path);
+
+    /// Drain pending inotify events and drop entries from changed
+    /// directories. Called once per event-loop pass; non-blocking.
+    void poll();
+
+    /// Cached entry count (for metrics/debugging)
+    [[nodiscard]] size_t size() const noexcept { return entries_.size(); }
+
+private:
+    /// Load a file from disk into a new cache entry (nullptr on failure)
+    std::unique_ptr<Entry> load(const std::string& abs_path);
+
+    /// Watch the directory containing abs_path (idempotent per dir)
+    void watch_parent(const std::string& abs_path);
+
+    fast_map<std::string, std::unique_ptr<Entry>> entries_;  // abs path -> entry
+    fast_map<int, std::string> watches_;                     // inotify wd -> dir
+    int inotify_fd_ = -1;
+};
+
+}  // namespace titan::core
@@ -0,0 +1,150 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Timer Wheel - Implementation
+
+#include "timer_wheel.hpp"
+
+#include <algorithm>
+
+namespace titan::core {
+
+TimerWheel::TimerWheel() : epoch_(std::chrono::steady_clock::now()) {}
+
+TimerWheel::~TimerWheel() = default;
+
+uint64_t TimerWheel::tick_for(std::chrono::steady_clock::time_point tp) const {
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(tp - epoch_).count();
+    return static_cast<uint64_t>(elapsed < 0 ? 0 : elapsed) / kTickMs;
+}
+
+TimerWheel::TimerId TimerWheel::add(uint64_t delay_ms, Callback callback) {
+    auto timer = std::make_unique<Timer>();
+    timer->id = next_id_++;
+    // Round up so a timer never fires early; minimum one tick out
+    uint64_t delay_ticks = std::max<uint64_t>(1, (delay_ms + kTickMs - 1) / kTickMs);
+    timer->expiry_tick = current_tick_ + delay_ticks;
+    timer->callback = std::move(callback);
+
+    TimerId id = timer->id;
+    active_[id] = timer.get();
+    schedule(std::move(timer));
+    return id;
+}
+
+void TimerWheel::cancel(TimerId id) {
+    // Lazy cancellation: drop the live entry, the slot's unique_ptr is
+    // discarded when its slot expires or cascades
+    active_.erase(id);
+}
+
+void TimerWheel::schedule(std::unique_ptr<Timer> timer) {
+    uint64_t delta = timer->expiry_tick - current_tick_;
+    uint64_t expiry = timer->expiry_tick;
+
+    if (delta < kL0Slots) {
+        l0_[expiry & (kL0Slots - 1)].push_back(std::move(timer));
+        return;
+    }
+
+    size_t shift = kL0Bits;
+    for (size_t level = 0; level < 3; ++level) {
+        uint64_t span = uint64_t{1} << (shift + kLnBits);
+        if (delta < span || level == 2) {
+            // Clamp far-future timers to the top level's furthest slot
+            if (delta >= span) {
+                expiry = current_tick_ + span - 1;
+                timer->expiry_tick = expiry;
+            }
+            outer_[level][(expiry >> shift) & (kLnSlots - 1)].push_back(std::move(timer));
+            return;
+        }
+        shift += kLnBits;
+    }
+}
+
+void TimerWheel::cascade(size_t level, size_t slot_index) {
+    Slot moved;
+    moved.swap(outer_[level][slot_index]);
+    for (auto& timer : moved) {
+        if (active_.contains(timer->id)) {
+            schedule(std::move(timer));
+        }
+        // Cancelled timers are dropped here
+    }
+}
+
+void TimerWheel::expire(Slot& slot) {
+    // Detach first: callbacks may arm timers that hash into this same slot
+    Slot due;
+    due.swap(slot);
+    for (auto& timer : due) {
+        auto it = active_.find(timer->id);
+        if (it == active_.end()) {
+            continue;  // Cancelled after arming
+        }
+        active_.erase(it);
+        timer->callback();
+    }
+}
+
+int TimerWheel::advance(std::chrono::steady_clock::time_point now) {
+    uint64_t target = tick_for(now);
+
+    while (current_tick_ < target) {
+        ++current_tick_;
+
+        size_t l0_index = current_tick_ & (kL0Slots - 1);
+        if (l0_index == 0) {
+            // Inner wheel wrapped - pull the next outer slots down
+            size_t shift = kL0Bits;
+            for (size_t level = 0; level < 3; ++level) {
+                size_t index = (current_tick_ >> shift) & (kLnSlots - 1);
+                cascade(level, index);
+                if (index != 0) {
+                    break;  // Higher levels only cascade when this one wraps
+                }
+                shift += kLnBits;
+            }
+        }
+
+        expire(l0_[l0_index]);
+    }
+
+    return next_timeout_ms();
+}
+
+int TimerWheel::next_timeout_ms() const {
+    if (active_.empty()) {
+        return -1;
+    }
+
+    // Scan the inner wheel for the nearest armed slot. Slots may hold only
+    // cancelled timers, which makes the estimate conservative (an early
+    // wakeup, never a late one).
+    for (uint64_t delta = 1; delta < kL0Slots; ++delta) {
+        if (!l0_[(current_tick_ + delta) & (kL0Slots - 1)].empty()) {
+            return static_cast<int>(delta * kTickMs);
+        }
+    }
+
+    // Everything pending lives in the outer wheels; wake at the next
+    // cascade boundary and re-evaluate then
+    uint64_t to_wrap = kL0Slots - (current_tick_ & (kL0Slots - 1));
+    return static_cast<int>(to_wrap * kTickMs);
+}
+
+}  // namespace titan::core
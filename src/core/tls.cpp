@@ -19,7 +19,10 @@
 
 #include "tls.hpp"
 
+#include <openssl/core_names.h>
 #include <openssl/evp.h>
+#include <openssl/params.h>
+#include <openssl/rand.h>
 
 #include <cstring>
 #include <format>
@@ -92,13 +95,105 @@ static int alpn_select_callback(SSL* ssl, const unsigned char** out, unsigned ch
     return SSL_TLSEXT_ERR_NOACK;
 }
 
+// ============================
+// Session Ticket Keys
+// ============================
+
+TlsTicketKeyStore& TlsTicketKeyStore::instance() {
+    static TlsTicketKeyStore store;
+    return store;
+}
+
+TlsTicketKeyStore::TlsTicketKeyStore() {
+    rotate_locked();  // Constructor runs once - no lock needed yet
+}
+
+void TlsTicketKeyStore::rotate_locked() {
+    previous_ = current_;
+    has_previous_ = last_rotation_ != std::chrono::steady_clock::time_point{};
+
+    RAND_bytes(current_.name, sizeof(current_.name));
+    RAND_bytes(current_.aes_key, sizeof(current_.aes_key));
+    RAND_bytes(current_.hmac_key, sizeof(current_.hmac_key));
+
+    last_rotation_ = std::chrono::steady_clock::now();
+}
+
+TlsTicketKeyStore::Key TlsTicketKeyStore::current_key() {
+    std::lock_guard lock(mutex_);
+    if (std::chrono::steady_clock::now() - last_rotation_ >= kRotationInterval) {
+        rotate_locked();
+    }
+    return current_;
+}
+
+int TlsTicketKeyStore::find_key(const uint8_t name[16], Key& out) {
+    std::lock_guard lock(mutex_);
+    if (std::memcmp(name, current_.name, sizeof(current_.name)) == 0) {
+        out = current_;
+        return 1;
+    }
+    if (has_previous_ && std::memcmp(name, previous_.name, sizeof(previous_.name)) == 0) {
+        out = previous_;
+        return 2;
+    }
+    return 0;
+}
+
+/// Session ticket callback (OpenSSL 3.x EVP_MAC variant).
+/// enc=1: issue a ticket under the current shared key.
+/// enc=0: decrypt with whichever shared key the ticket names; returning 2
+/// resumes but reissues the ticket under the current key (rotation grace).
+static int ticket_key_callback(SSL* /*ssl*/, unsigned char key_name[16],
+                               unsigned char iv[EVP_MAX_IV_LENGTH], EVP_CIPHER_CTX* cipher_ctx,
+                               EVP_MAC_CTX* hmac_ctx, int enc) {
+    auto& store = TlsTicketKeyStore::instance();
+
+    TlsTicketKeyStore::Key key;
+    int result = 1;
+    if (enc) {
+        key = store.current_key();
+        std::memcpy(key_name, key.name, sizeof(key.name));
+        if (RAND_bytes(iv, EVP_MAX_IV_LENGTH) != 1) {
+            return -1;
+        }
+    } else {
+        result = store.find_key(key_name, key);
+        if (result == 0) {
+            return 0;  // Unknown key (rotated out) - full handshake
+        }
+    }
+
+    OSSL_PARAM params[3];
+    params[0] = OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, key.hmac_key,
+                                                  sizeof(key.hmac_key));
+    params[1] = OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+                                                 const_cast<char*>("SHA256"), 0);
+    params[2] = OSSL_PARAM_construct_end();
+    if (EVP_MAC_CTX_set_params(hmac_ctx, params) != 1) {
+        return -1;
+    }
+
+    if (enc) {
+        if (EVP_EncryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr, key.aes_key, iv) != 1) {
+            return -1;
+        }
+    } else {
+        if (EVP_DecryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr, key.aes_key, iv) != 1) {
+            return -1;
+        }
+    }
+
+    return result;
+}
+
 // ============================
 // TLS Context
 // ============================
 
 std::optional<TlsContext> TlsContext::create(std::string_view cert_path, std::string_view key_path,
                                              std::span<const std::string> alpn_protocols,
-                                             std::error_code& error_out) {
+                                             std::error_code& error_out, bool enable_ktls) {
     // Create SSL context (TLS 1.2+)
     SslCtxPtr ctx(SSL_CTX_new(TLS_server_method()));
     if (!ctx) {
@@ -109,6 +204,18 @@ std::optional<TlsContext> TlsContext::create(std::string_view cert_path, std::st
     // Set minimum TLS version (TLS 1.2)
     SSL_CTX_set_min_proto_version(ctx.get(), TLS1_2_VERSION);
 
+#ifdef SSL_OP_ENABLE_KTLS
+    // Kernel TLS: after the handshake OpenSSL hands the record keys to the
+    // socket via setsockopt(TLS_TX/TLS_RX) when the cipher and kernel allow
+    // it, and transparently keeps userspace crypto otherwise. Whether the
+    // kernel actually took the keys is per-connection (BIO_get_ktls_send).
+    if (enable_ktls) {
+        SSL_CTX_set_options(ctx.get(), SSL_OP_ENABLE_KTLS);
+    }
+#else
+    (void)enable_ktls;
+#endif
+
     // Load certificate
     if (SSL_CTX_use_certificate_file(ctx.get(), cert_path.data(), SSL_FILETYPE_PEM) <= 0) {
         error_out = make_tls_error();
@@ -140,6 +247,10 @@ std::optional<TlsContext> TlsContext::create(std::string_view cert_path, std::st
     // Enable session resumption for better performance
     SSL_CTX_set_session_cache_mode(ctx.get(), SSL_SESS_CACHE_SERVER);
 
+    // Session tickets encrypted with process-wide rotating keys, so a client
+    // resumes no matter which SO_REUSEPORT worker its reconnect lands on
+    SSL_CTX_set_tlsext_ticket_key_evp_cb(ctx.get(), ticket_key_callback);
+
     return TlsContext(std::move(ctx), std::move(alpn_storage));
 }
 
@@ -22,7 +22,9 @@
 #include <openssl/err.h>
 #include <openssl/ssl.h>
 
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <span>
 #include <string>
@@ -68,6 +70,49 @@ struct SslDeleter {
 using SslCtxPtr = std::unique_ptr<SSL_CTX, SslCtxDeleter>;
 using SslPtr = std::unique_ptr<SSL, SslDeleter>;
 
+/// Process-wide session ticket keys (TLS 1.3 PSK resumption, RFC 8446 §2.2)
+///
+/// Every worker's TlsContext encrypts tickets with the same keys: SO_REUSEPORT
+/// spreads reconnecting clients across workers, so per-context random keys
+/// would make cross-worker resumption impossible and force a full handshake
+/// (~1ms CPU) on almost every reconnect. Keys rotate on a fixed interval; the
+/// previous key stays accepted for one more interval, so tickets issued just
+/// before a rotation still resume (and are reissued under the current key).
+class TlsTicketKeyStore {
+public:
+    struct Key {
+        uint8_t name[16];      // Identifies the key in the ticket
+        uint8_t aes_key[32];   // AES-256-CBC ticket encryption
+        uint8_t hmac_key[32];  // HMAC-SHA256 ticket integrity
+    };
+
+    static constexpr std::chrono::hours kRotationInterval{1};
+
+    [[nodiscard]] static TlsTicketKeyStore& instance();
+
+    /// Copy of the issuing key, rotating first when the interval has elapsed
+    [[nodiscard]] Key current_key();
+
+    /// Look up a ticket's key by name.
+    /// Returns 1 for the current key, 2 for the previous key (resume and
+    /// reissue under the current key), 0 if unknown (full handshake).
+    [[nodiscard]] int find_key(const uint8_t name[16], Key& out);
+
+    // Shared across workers - not copyable
+    TlsTicketKeyStore(const TlsTicketKeyStore&) = delete;
+    TlsTicketKeyStore& operator=(const TlsTicketKeyStore&) = delete;
+
+private:
+    TlsTicketKeyStore();
+    void rotate_locked();
+
+    std::mutex mutex_;  // Handshake-rate path only, never per request
+    Key current_{};
+    Key previous_{};
+    bool has_previous_ = false;
+    std::chrono::steady_clock::time_point last_rotation_{};
+};
+
 /// TLS configuration and context management
 class TlsContext {
 public:
@@ -76,10 +121,14 @@ public:
     /// @param key_path Path to private key file (PEM format)
     /// @param alpn_protocols List of ALPN protocol names (e.g., "h2", "http/1.1")
     /// @param error_out Output parameter for error code
+    /// @param enable_ktls Offer record crypto to the kernel (TLS_TX/TLS_RX)
+    ///        after each handshake; OpenSSL keeps encrypting in userspace
+    ///        whenever the kernel refuses, so this is safe to enable broadly
     /// @return TlsContext or nullopt on error
     [[nodiscard]] static std::optional<TlsContext> create(
         std::string_view cert_path, std::string_view key_path,
-        std::span<const std::string> alpn_protocols, std::error_code& error_out);
+        std::span<const std::string> alpn_protocols, std::error_code& error_out,
+        bool enable_ktls = false);
 
     /// Create server-side SSL connection object
     [[nodiscard]] SslPtr create_ssl(int sockfd) const;
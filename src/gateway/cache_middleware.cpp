@@ -0,0 +1,393 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Cache Middleware - Implementation
+
+#include "cache_middleware.hpp"
+
+#include <charconv>
+
+namespace titan::gateway {
+
+namespace {
+
+/// FNV-1a 64-bit over multiple request components
+uint64_t fnv1a_append(uint64_t hash, std::string_view data) {
+    for (char c : data) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    // Separator so ("a","bc") and ("ab","c") hash differently
+    hash ^= 0x1f;
+    hash *= 1099511628211ull;
+    return hash;
+}
+
+constexpr uint64_t kFnvOffset = 14695981039346656037ull;
+
+/// Headers that must not be replayed from cache (connection-specific or
+/// recomputed by send_response)
+bool is_uncacheable_header(std::string_view name) {
+    constexpr std::string_view skip[] = {"connection", "keep-alive", "transfer-encoding",
+                                         "content-length", "set-cookie"};
+    for (std::string_view s : skip) {
+        if (name.size() == s.size()) {
+            bool equal = true;
+            for (size_t i = 0; i < s.size(); ++i) {
+                char c = name[i];
+                if (c >= 'A' && c <= 'Z') {
+                    c = static_cast<char>(c - 'A' + 'a');
+                }
+                if (c != s[i]) {
+                    equal = false;
+                    break;
+                }
+            }
+            if (equal) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/// Split a comma-separated header value and trim whitespace per token
+template <typename Fn>
+void for_each_token(std::string_view value, Fn&& fn) {
+    size_t pos = 0;
+    while (pos < value.size()) {
+        size_t end = value.find(',', pos);
+        if (end == std::string_view::npos) {
+            end = value.size();
+        }
+        std::string_view token = value.substr(pos, end - pos);
+        while (!token.empty() && (token.front() == ' ' || token.front() == '\t')) {
+            token.remove_prefix(1);
+        }
+        while (!token.empty() && (token.back() == ' ' || token.back() == '\t')) {
+            token.remove_suffix(1);
+        }
+        if (!token.empty()) {
+            fn(token);
+        }
+        pos = end + 1;
+    }
+}
+
+}  // namespace
+
+// ResponseCache
+
+const ResponseCache::Entry* ResponseCache::find(uint64_t key) const {
+    const Shard& shard = shard_for(key);
+    auto it = shard.entries.find(key);
+    return it != shard.entries.end() ? &it->second : nullptr;
+}
+
+void ResponseCache::insert(uint64_t key, Entry entry) {
+    Shard& shard = shard_for(key);
+
+    if (shard.entries.size() >= max_entries_per_shard_ && !shard.entries.contains(key)) {
+        // Sweep entries past their servable-stale window first
+        auto now = std::chrono::steady_clock::now();
+        for (auto it = shard.entries.begin(); it != shard.entries.end();) {
+            if (it->second.stale_until < now) {
+                it = shard.entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        // Still full: drop an arbitrary victim (hash order ~ random) rather
+        // than paying for LRU bookkeeping on every hit
+        if (shard.entries.size() >= max_entries_per_shard_) {
+            shard.entries.erase(shard.entries.begin());
+        }
+    }
+
+    shard.entries[key] = std::move(entry);
+}
+
+void ResponseCache::erase(uint64_t key) {
+    shard_for(key).entries.erase(key);
+}
+
+bool ResponseCache::mark_inflight(uint64_t key) {
+    auto now = std::chrono::steady_clock::now();
+    auto [it, inserted] = shard_for(key).inflight.try_emplace(key, now + kInflightTtl);
+    if (inserted) {
+        return true;
+    }
+    if (it->second < now) {
+        // The previous revalidator never cleared its marker (error paths
+        // skip process_response entirely) - take over the election
+        it->second = now + kInflightTtl;
+        return true;
+    }
+    return false;
+}
+
+void ResponseCache::clear_inflight(uint64_t key) {
+    shard_for(key).inflight.erase(key);
+}
+
+size_t ResponseCache::size() const {
+    size_t total = 0;
+    for (const auto& shard : shards_) {
+        total += shard.entries.size();
+    }
+    return total;
+}
+
+// CacheMiddleware
+
+CacheMiddleware::CacheMiddleware(control::CacheConfig config)
+    : config_(std::move(config)), store_(config_.max_entries) {}
+
+CacheMiddleware::CacheControl CacheMiddleware::parse_cache_control(std::string_view value) {
+    CacheControl cc;
+    for_each_token(value, [&cc](std::string_view token) {
+        if (token == "no-store") {
+            cc.no_store = true;
+        } else if (token == "no-cache") {
+            cc.no_cache = true;
+        } else if (token == "private") {
+            cc.is_private = true;
+        } else if (token.starts_with("s-maxage=") || token.starts_with("max-age=")) {
+            std::string_view digits = token.substr(token.find('=') + 1);
+            uint32_t seconds = 0;
+            if (std::from_chars(digits.data(), digits.data() + digits.size(), seconds).ec ==
+                std::errc{}) {
+                // s-maxage takes precedence for shared caches
+                if (token[0] == 's' || !cc.has_max_age) {
+                    cc.max_age = seconds;
+                    cc.has_max_age = true;
+                }
+            }
+        } else if (token.starts_with("stale-while-revalidate=")) {
+            std::string_view digits = token.substr(token.find('=') + 1);
+            uint32_t seconds = 0;
+            if (std::from_chars(digits.data(), digits.data() + digits.size(), seconds).ec ==
+                std::errc{}) {
+                cc.stale_while_revalidate = seconds;
+                cc.has_swr = true;
+            }
+        }
+    });
+    return cc;
+}
+
+uint64_t CacheMiddleware::cache_key(const http::Request& request) {
+    uint64_t hash = kFnvOffset;
+    hash = fnv1a_append(hash, http::to_string(request.method));
+    hash = fnv1a_append(hash, request.get_header(http::WellKnownHeader::Host));
+    hash = fnv1a_append(hash, request.path);
+    hash = fnv1a_append(hash, request.query);
+    return hash;
+}
+
+bool CacheMiddleware::is_cacheable_request(const http::Request& request) {
+    if (request.method != http::Method::GET) {
+        return false;
+    }
+    // Authenticated responses are per-user; never share them
+    if (request.has_header(http::WellKnownHeader::Authorization)) {
+        return false;
+    }
+    // Client opted out
+    auto cc = parse_cache_control(request.get_header(http::WellKnownHeader::CacheControl));
+    return !cc.no_store;
+}
+
+void CacheMiddleware::serve_entry(RequestContext& ctx, const ResponseCache::Entry& entry,
+                                  std::string_view cache_status) {
+    http::Response& response = *ctx.response;
+    response.status = entry.status;
+    response.reason_phrase = entry.reason_phrase;
+
+    response.headers.clear();
+    response.well_known.fill(0);
+    response.backend_headers.clear();
+    response.middleware_headers.clear();
+    for (const auto& [name, value] : entry.headers) {
+        response.add_middleware_header(name, value);
+    }
+    response.add_middleware_header("X-Cache", cache_status);
+
+    // Copy the body into response-owned storage: the entry can be evicted
+    // by a later request while this response is still being written
+    response.body_storage.assign(entry.body.begin(), entry.body.end());
+    response.body = response.body_storage;
+}
+
+MiddlewareResult CacheMiddleware::process_request(RequestContext& ctx) {
+    if (!config_.enabled || !ctx.request || !ctx.response) {
+        return MiddlewareResult::Continue;
+    }
+    if (!is_cacheable_request(*ctx.request)) {
+        return MiddlewareResult::Continue;
+    }
+
+    uint64_t key = cache_key(*ctx.request);
+    const ResponseCache::Entry* entry = store_.find(key);
+    if (!entry) {
+        // Miss. Concurrent misses for the same key can't be parked in an
+        // event-driven worker, so they all proceed; collapse only applies
+        // once a (stale) entry exists
+        return MiddlewareResult::Continue;
+    }
+
+    // Vary check: stored variant must match this request's values
+    for (const auto& [header_name, stored_value] : entry->vary) {
+        if (ctx.request->get_header(header_name) != stored_value) {
+            return MiddlewareResult::Continue;
+        }
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (now < entry->expires) {
+        serve_entry(ctx, *entry, "HIT");
+        return MiddlewareResult::Stop;
+    }
+
+    if (now < entry->stale_until) {
+        if (!store_.mark_inflight(key)) {
+            // Someone is already revalidating - serve stale immediately
+            serve_entry(ctx, *entry, "STALE");
+            return MiddlewareResult::Stop;
+        }
+        // This request is the elected revalidator: go to the backend with
+        // a conditional request when we hold an ETag
+        if (!entry->etag.empty()) {
+            if (!ctx.header_transforms) {
+                ctx.header_transforms.emplace();
+            }
+            ctx.header_transforms->add.emplace_back("If-None-Match", entry->etag);
+        }
+        ctx.set_metadata("cache_revalidating", "1");
+        return MiddlewareResult::Continue;
+    }
+
+    // Past the stale window - plain miss
+    return MiddlewareResult::Continue;
+}
+
+MiddlewareResult CacheMiddleware::process_response(ResponseContext& ctx) {
+    if (!config_.enabled || !ctx.request || !ctx.response) {
+        return MiddlewareResult::Continue;
+    }
+    if (!is_cacheable_request(*ctx.request)) {
+        return MiddlewareResult::Continue;
+    }
+
+    uint64_t key = cache_key(*ctx.request);
+    bool revalidating = ctx.get_metadata("cache_revalidating") == "1";
+    if (revalidating) {
+        store_.clear_inflight(key);
+    }
+
+    http::Response& response = *ctx.response;
+    auto now = std::chrono::steady_clock::now();
+
+    // 304 on revalidation: refresh the stored entry's lifetime and answer
+    // the client from it (the backend sent no body)
+    if (revalidating && response.status == http::StatusCode::NotModified) {
+        const ResponseCache::Entry* entry = store_.find(key);
+        if (entry) {
+            auto cc = parse_cache_control(response.get_header(http::WellKnownHeader::CacheControl));
+            uint32_t ttl = cc.has_max_age ? cc.max_age : config_.default_ttl;
+            uint32_t swr = cc.has_swr ? cc.stale_while_revalidate : config_.stale_while_revalidate;
+
+            ResponseCache::Entry refreshed = *entry;
+            refreshed.expires = now + std::chrono::seconds(ttl);
+            refreshed.stale_until = refreshed.expires + std::chrono::seconds(swr);
+            store_.insert(key, std::move(refreshed));
+
+            // Serve from the (re-)stored entry: its strings are stable in
+            // the map, so the response's views stay valid through send
+            const ResponseCache::Entry* stored = store_.find(key);
+            response.status = stored->status;
+            response.reason_phrase = stored->reason_phrase;
+            response.headers.clear();
+            response.well_known.fill(0);
+            response.backend_headers.clear();
+            response.middleware_headers.clear();
+            for (const auto& [name, value] : stored->headers) {
+                response.add_middleware_header(name, value);
+            }
+            response.add_middleware_header("X-Cache", "REVALIDATED");
+            response.body_storage.assign(stored->body.begin(), stored->body.end());
+            response.body = response.body_storage;
+        }
+        return MiddlewareResult::Continue;
+    }
+
+    if (response.status != http::StatusCode::OK) {
+        return MiddlewareResult::Continue;
+    }
+
+    auto cc = parse_cache_control(response.get_header(http::WellKnownHeader::CacheControl));
+    if (cc.no_store || cc.no_cache || cc.is_private) {
+        // Entry may have been cacheable before the backend changed its
+        // mind - don't keep serving it stale
+        store_.erase(key);
+        return MiddlewareResult::Continue;
+    }
+
+    uint32_t ttl = cc.has_max_age ? cc.max_age : config_.default_ttl;
+    if (ttl == 0) {
+        return MiddlewareResult::Continue;
+    }
+    if (response.body.size() > config_.max_body_size) {
+        return MiddlewareResult::Continue;
+    }
+
+    ResponseCache::Entry entry;
+    entry.status = response.status;
+    entry.reason_phrase = std::string(response.reason_phrase);
+    entry.body.assign(response.body.begin(), response.body.end());
+    entry.etag = std::string(response.get_header(http::WellKnownHeader::ETag));
+
+    for (auto it = response.all_headers_begin(); it != response.all_headers_end(); ++it) {
+        auto [name, value] = *it;
+        if (!is_uncacheable_header(name)) {
+            entry.headers.emplace_back(std::string(name), std::string(value));
+        }
+    }
+
+    // Record the Vary dimension values this variant was stored under;
+    // Vary: * means the response is effectively uncacheable
+    bool vary_star = false;
+    for_each_token(response.get_header(http::WellKnownHeader::Vary), [&](std::string_view header_name) {
+        if (header_name == "*") {
+            vary_star = true;
+            return;
+        }
+        entry.vary.emplace_back(std::string(header_name),
+                                std::string(ctx.request->get_header(header_name)));
+    });
+    if (vary_star) {
+        return MiddlewareResult::Continue;
+    }
+
+    uint32_t swr = cc.has_swr ? cc.stale_while_revalidate : config_.stale_while_revalidate;
+    entry.expires = now + std::chrono::seconds(ttl);
+    entry.stale_until = entry.expires + std::chrono::seconds(swr);
+
+    store_.insert(key, std::move(entry));
+    return MiddlewareResult::Continue;
+}
+
+}  // namespace titan::gateway
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Cache Middleware - In-memory HTTP response cache
+// Honors Cache-Control/ETag with stale-while-revalidate and singleflight
+// collapse of concurrent revalidations
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../control/config.hpp"
+#include "../core/containers.hpp"
+#include "pipeline.hpp"
+
+namespace titan::gateway {
+
+/// Sharded in-memory response store (per-worker, no locking)
+///
+/// Keyed by a hash of method + host + path + query; each entry remembers
+/// the Vary headers and the request values they were stored under, so a
+/// variant mismatch reads as a miss (one variant per key - enough for the
+/// Accept-Encoding-style Vary we see in practice).
+class ResponseCache {
+public:
+    static constexpr size_t kShardCount = 8;
+
+    struct Entry {
+        http::StatusCode status = http::StatusCode::OK;
+        std::string reason_phrase;
+        std::vector<std::pair<std::string, std::string>> headers;
+        std::vector<uint8_t> body;
+        std::string etag;
+
+        // Vary handling: header names and the request values at store time
+        std::vector<std::pair<std::string, std::string>> vary;
+
+        std::chrono::steady_clock::time_point expires;      // Fresh until
+        std::chrono::steady_clock::time_point stale_until;  // Servable-stale until
+    };
+
+    explicit ResponseCache(size_t max_entries) : max_entries_per_shard_(max_entries / kShardCount) {}
+
+    /// Lookup; returns nullptr on miss. The pointer stays valid until the
+    /// next insert/evict on this worker - callers must copy before yielding
+    [[nodiscard]] const Entry* find(uint64_t key) const;
+
+    void insert(uint64_t key, Entry entry);
+    void erase(uint64_t key);
+
+    /// Singleflight markers: at most one request revalidates a stale key.
+    /// Markers expire after kInflightTtl - error paths (backend 502s,
+    /// timeouts, client disconnects) never traverse response middleware,
+    /// so an unexpired-forever marker would permanently disable
+    /// revalidation for its key. An expired marker's key is up for
+    /// re-election on the next mark_inflight.
+    [[nodiscard]] bool mark_inflight(uint64_t key);  // false if already marked
+    void clear_inflight(uint64_t key);
+
+    [[nodiscard]] size_t size() const;
+
+private:
+    // A revalidation should finish well inside this; past it the marker is
+    // treated as leaked (its owner died on an error path) and re-electable
+    static constexpr std::chrono::seconds kInflightTtl{10};
+
+    struct Shard {
+        titan::core::fast_map<uint64_t, Entry> entries;
+        titan::core::fast_map<uint64_t, std::chrono::steady_clock::time_point> inflight;
+    };
+
+    [[nodiscard]] Shard& shard_for(uint64_t key) { return shards_[key % kShardCount]; }
+    [[nodiscard]] const Shard& shard_for(uint64_t key) const { return shards_[key % kShardCount]; }
+
+    std::array<Shard, kShardCount> shards_;
+    size_t max_entries_per_shard_;
+};
+
+/// Cache Middleware - serve cacheable GET responses from the gateway
+///
+/// Request phase: fresh hit is served directly (pipeline stops before the
+/// proxy). A stale-but-servable hit is served too, except for the single
+/// request elected to revalidate (singleflight) - that one continues to
+/// the backend carrying If-None-Match when an ETag is stored.
+/// Response phase: 200s with a freshness lifetime are stored; a 304 on
+/// revalidation refreshes the stored entry and is answered from it.
+class CacheMiddleware : public Middleware {
+public:
+    explicit CacheMiddleware(control::CacheConfig config);
+
+    [[nodiscard]] MiddlewareResult process_request(RequestContext& ctx) override;
+    [[nodiscard]] MiddlewareResult process_response(ResponseContext& ctx) override;
+
+    [[nodiscard]] std::string_view name() const override { return "cache"; }
+    [[nodiscard]] std::string_view type() const override { return "cache"; }
+
+private:
+    /// Parsed Cache-Control response directives
+    struct CacheControl {
+        bool no_store = false;
+        bool no_cache = false;
+        bool is_private = false;
+        uint32_t max_age = 0;  // 0 = absent
+        uint32_t stale_while_revalidate = 0;
+        bool has_max_age = false;
+        bool has_swr = false;
+    };
+
+    [[nodiscard]] static CacheControl parse_cache_control(std::string_view value);
+    [[nodiscard]] static uint64_t cache_key(const http::Request& request);
+    [[nodiscard]] static bool is_cacheable_request(const http::Request& request);
+
+    /// Copy a stored entry into ctx.response (owned storage, safe to send)
+    static void serve_entry(RequestContext& ctx, const ResponseCache::Entry& entry,
+                            std::string_view cache_status);
+
+    control::CacheConfig config_;
+    ResponseCache store_;
+};
+
+}  // namespace titan::gateway
@@ -22,8 +22,21 @@
 
 #include <algorithm>
 
+#include "../control/metrics.hpp"
+
 namespace titan::gateway {
 
+namespace {
+
+/// Steady-clock seconds (bucket granularity of the sliding window)
+[[nodiscard]] uint64_t now_seconds() noexcept {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+}  // namespace
+
 // Initialize global catastrophic failure flags
 std::atomic<bool> CircuitBreaker::global_backend_down_[CircuitBreaker::MAX_BACKENDS];
 
@@ -38,20 +51,35 @@ CircuitBreaker::CircuitBreaker(CircuitBreakerConfig config)
 CircuitBreaker::CircuitBreaker(CircuitBreaker&& other) noexcept
     : config_(other.config_),
       state_(other.state_.load(std::memory_order_acquire)),
-      failure_timestamps_(std::move(other.failure_timestamps_)),
       consecutive_successes_(other.consecutive_successes_),
       state_transition_time_(other.state_transition_time_),
       total_failures_(other.total_failures_.load(std::memory_order_relaxed)),
       total_successes_(other.total_successes_.load(std::memory_order_relaxed)),
       rejected_requests_(other.rejected_requests_.load(std::memory_order_relaxed)),
       state_transitions_(other.state_transitions_.load(std::memory_order_relaxed)),
-      backend_id_(other.backend_id_) {}
+      backend_id_(other.backend_id_) {
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        buckets_[i].second.store(other.buckets_[i].second.load(std::memory_order_relaxed),
+                                 std::memory_order_relaxed);
+        buckets_[i].requests.store(other.buckets_[i].requests.load(std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+        buckets_[i].failures.store(other.buckets_[i].failures.load(std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+    }
+}
 
 CircuitBreaker& CircuitBreaker::operator=(CircuitBreaker&& other) noexcept {
     if (this != &other) {
         config_ = other.config_;
         state_.store(other.state_.load(std::memory_order_acquire), std::memory_order_release);
-        failure_timestamps_ = std::move(other.failure_timestamps_);
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            buckets_[i].second.store(other.buckets_[i].second.load(std::memory_order_relaxed),
+                                     std::memory_order_relaxed);
+            buckets_[i].requests.store(other.buckets_[i].requests.load(std::memory_order_relaxed),
+                                       std::memory_order_relaxed);
+            buckets_[i].failures.store(other.buckets_[i].failures.load(std::memory_order_relaxed),
+                                       std::memory_order_relaxed);
+        }
         consecutive_successes_ = other.consecutive_successes_;
         state_transition_time_ = other.state_transition_time_;
         total_failures_.store(other.total_failures_.load(std::memory_order_relaxed),
@@ -95,6 +123,7 @@ bool CircuitBreaker::should_allow_request() {
 
 void CircuitBreaker::record_success() {
     total_successes_.fetch_add(1, std::memory_order_relaxed);
+    record_outcome(false);
 
     auto state = state_.load(std::memory_order_acquire);
 
@@ -113,7 +142,7 @@ void CircuitBreaker::record_success() {
             }
 
             // Clear failure history
-            failure_timestamps_.clear();
+            clear_window();
 
             fmt::print("[INFO] Circuit breaker HALF_OPEN → CLOSED (recovery successful)\n");
         }
@@ -122,40 +151,89 @@ void CircuitBreaker::record_success() {
 
 void CircuitBreaker::record_failure() {
     total_failures_.fetch_add(1, std::memory_order_relaxed);
+    record_outcome(true);
 
-    auto now = std::chrono::steady_clock::now();
-    failure_timestamps_.push_back(now);
-
-    // Cleanup old failures outside sliding window
-    cleanup_old_failures();
-
-    auto state = state_.load(std::memory_order_acquire);
-
-    if (state == CircuitState::HALF_OPEN) {
-        // Recovery test failed, reopen circuit
+    // CLOSED → OPEN tripping happens in evaluate(); only the HALF_OPEN
+    // reaction stays inline, because a failed recovery probe must slam the
+    // circuit shut before the next request is let through
+    if (state_.load(std::memory_order_acquire) == CircuitState::HALF_OPEN) {
         transition_to(CircuitState::OPEN);
         consecutive_successes_ = 0;
         fmt::print("[WARN] Circuit breaker HALF_OPEN → OPEN (recovery test failed)\n");
+    }
+}
+
+void CircuitBreaker::evaluate() {
+    if (state_.load(std::memory_order_acquire) != CircuitState::CLOSED) {
         return;
     }
 
-    if (state == CircuitState::CLOSED) {
-        // Check if we've hit failure threshold
-        if (failure_timestamps_.size() >= config_.failure_threshold) {
-            transition_to(CircuitState::OPEN);
-            fmt::print("[INFO] Circuit breaker CLOSED → OPEN ({} failures in {}ms window)\n",
-                       failure_timestamps_.size(), config_.window_ms);
+    auto stats = window_stats(now_seconds());
+
+    bool count_trip = stats.failures >= config_.failure_threshold;
+    bool rate_trip = stats.requests >= config_.min_requests &&
+                     static_cast<double>(stats.failures) >=
+                         config_.failure_rate_threshold * static_cast<double>(stats.requests);
+
+    if (count_trip || rate_trip) {
+        transition_to(CircuitState::OPEN);
+        fmt::print("[INFO] Circuit breaker CLOSED → OPEN ({}/{} failures in {}ms window)\n",
+                   stats.failures, stats.requests, config_.window_ms);
+    }
+
+    // Check for catastrophic failure rate (help other workers)
+    if (config_.enable_global_hints && stats.failures >= config_.catastrophic_threshold) {
+        set_global_catastrophic_failure();
+        fmt::print(
+            "[WARN] Circuit breaker detected catastrophic failure rate ({} failures), "
+            "setting global hint\n",
+            stats.failures);
+    }
+}
+
+void CircuitBreaker::record_outcome(bool failure) noexcept {
+    uint64_t sec = now_seconds();
+    SecondBucket& bucket = buckets_[sec % kBucketCount];
+
+    uint64_t tag = bucket.second.load(std::memory_order_relaxed);
+    if (tag != sec) {
+        // Bucket still holds a lap-old second: claim it and restart the
+        // counters. Losing the CAS means another recorder already did.
+        if (bucket.second.compare_exchange_strong(tag, sec, std::memory_order_relaxed)) {
+            bucket.requests.store(0, std::memory_order_relaxed);
+            bucket.failures.store(0, std::memory_order_relaxed);
         }
+    }
 
-        // Check for catastrophic failure rate (help other workers)
-        if (config_.enable_global_hints &&
-            failure_timestamps_.size() >= config_.catastrophic_threshold) {
-            set_global_catastrophic_failure();
-            fmt::print(
-                "[WARN] Circuit breaker detected catastrophic failure rate ({} failures), "
-                "setting global hint\n",
-                failure_timestamps_.size());
+    bucket.requests.fetch_add(1, std::memory_order_relaxed);
+    if (failure) {
+        bucket.failures.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+CircuitBreaker::WindowStats CircuitBreaker::window_stats(uint64_t now_sec) const noexcept {
+    // Window seconds capped below the ring size so a bucket about to be
+    // reused for the current second never reads as history
+    uint64_t window_secs =
+        std::min<uint64_t>(std::max(1u, config_.window_ms / 1000), kBucketCount - 1);
+
+    WindowStats stats;
+    for (uint64_t s = now_sec - std::min(now_sec, window_secs); s <= now_sec; ++s) {
+        const SecondBucket& bucket = buckets_[s % kBucketCount];
+        if (bucket.second.load(std::memory_order_relaxed) != s) {
+            continue;  // Bucket holds a different lap (or was never written)
         }
+        stats.requests += bucket.requests.load(std::memory_order_relaxed);
+        stats.failures += bucket.failures.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+void CircuitBreaker::clear_window() noexcept {
+    for (auto& bucket : buckets_) {
+        bucket.second.store(0, std::memory_order_relaxed);
+        bucket.requests.store(0, std::memory_order_relaxed);
+        bucket.failures.store(0, std::memory_order_relaxed);
     }
 }
 
@@ -173,21 +251,10 @@ void CircuitBreaker::transition_to(CircuitState new_state) {
     if (old_state != new_state) {
         state_transition_time_ = std::chrono::steady_clock::now();
         state_transitions_.fetch_add(1, std::memory_order_relaxed);
-    }
-}
-
-void CircuitBreaker::cleanup_old_failures() {
-    if (failure_timestamps_.empty()) {
-        return;
-    }
-
-    auto now = std::chrono::steady_clock::now();
-    auto window = std::chrono::milliseconds(config_.window_ms);
-    auto cutoff = now - window;
-
-    // Remove failures older than window
-    while (!failure_timestamps_.empty() && failure_timestamps_.front() < cutoff) {
-        failure_timestamps_.pop_front();
+        if (control::t_thread_metrics) {
+            control::t_thread_metrics->record_circuit_transition(
+                new_state == CircuitState::OPEN, new_state == CircuitState::HALF_OPEN);
+        }
     }
 }
 
@@ -204,6 +271,9 @@ bool CircuitBreaker::try_half_open() {
                                            std::memory_order_acq_rel)) {
             state_transition_time_ = now;
             state_transitions_.fetch_add(1, std::memory_order_relaxed);
+            if (control::t_thread_metrics) {
+                control::t_thread_metrics->record_circuit_transition(false, true);
+            }
             consecutive_successes_ = 0;
             fmt::print(
                 "[INFO] Circuit breaker OPEN → HALF_OPEN (timeout expired, testing recovery)\n");
@@ -19,10 +19,10 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
-#include <deque>
 #include <string_view>
 
 namespace titan::gateway {
@@ -48,6 +48,15 @@ struct CircuitBreakerConfig {
     /// Sliding window in milliseconds for counting failures
     uint32_t window_ms = 10000;  // 10 seconds
 
+    /// Failure rate (0.0-1.0) over the window to open circuit.
+    /// Rate tripping only engages once the window holds min_requests, so
+    /// one failed request out of two at low traffic doesn't open the
+    /// circuit; the absolute failure_threshold still applies regardless.
+    double failure_rate_threshold = 0.5;
+
+    /// Minimum requests in window before failure_rate_threshold applies
+    uint32_t min_requests = 20;
+
     /// Enable catastrophic failure detection (sets global flag to help other workers)
     bool enable_global_hints = true;
 
@@ -58,11 +67,18 @@ struct CircuitBreakerConfig {
 /// Circuit breaker for preventing cascading failures
 ///
 /// State machine:
-///   CLOSED → OPEN (failure_threshold failures in window_ms)
+///   CLOSED → OPEN (failure_threshold failures or failure_rate_threshold
+///                  exceeded in window_ms, decided by evaluate())
 ///   OPEN → HALF_OPEN (after timeout_ms)
 ///   HALF_OPEN → CLOSED (success_threshold consecutive successes)
 ///   HALF_OPEN → OPEN (any failure)
 ///
+/// The window is a fixed ring of per-second buckets: recording an outcome
+/// is two relaxed atomic increments (plus one CAS when a bucket rolls to a
+/// new second), never an allocation or a scan. Scanning the ring and
+/// deciding CLOSED → OPEN happens in evaluate(), which the worker loop
+/// runs on its timer cadence - off the request path.
+///
 /// Thread-safety: Designed for single-worker access (thread-per-core).
 /// Metrics are atomic for cross-thread observability.
 class CircuitBreaker {
@@ -86,6 +102,12 @@ public:
     /// Record failed request (5xx error or timeout)
     void record_failure();
 
+    /// Evaluate the sliding window and trip CLOSED → OPEN if the failure
+    /// count or failure rate crosses its threshold. Called periodically by
+    /// the worker loop (once a second is plenty - the window has
+    /// one-second resolution).
+    void evaluate();
+
     /// Force circuit to OPEN state (used by health checker)
     void force_open();
 
@@ -118,11 +140,39 @@ public:
     [[nodiscard]] const CircuitBreakerConfig& config() const noexcept { return config_; }
 
 private:
+    /// One second of request/failure counts plus the epoch-second tag
+    /// saying which second the counts belong to. A recorder seeing a stale
+    /// tag claims the bucket with one CAS and the counters restart; the
+    /// handful of increments racing a claim land in either second's
+    /// tally - fine for tripping decisions with one-second resolution.
+    struct alignas(64) SecondBucket {
+        std::atomic<uint64_t> second{0};
+        std::atomic<uint32_t> requests{0};
+        std::atomic<uint32_t> failures{0};
+    };
+
+    /// Window totals as of a scan (see window_stats())
+    struct WindowStats {
+        uint32_t requests = 0;
+        uint32_t failures = 0;
+    };
+
+    // Power of two, and one more second than the largest supported window
+    // so the bucket being overwritten for "now" never counts as history
+    static constexpr size_t kBucketCount = 32;
+
     /// Transition to new state and update metrics
     void transition_to(CircuitState new_state);
 
-    /// Remove failures older than window_ms
-    void cleanup_old_failures();
+    /// Bump the current second's bucket (wait-free apart from the
+    /// once-per-second bucket claim)
+    void record_outcome(bool failure) noexcept;
+
+    /// Sum buckets inside the window ending at now_sec
+    [[nodiscard]] WindowStats window_stats(uint64_t now_sec) const noexcept;
+
+    /// Forget all recorded outcomes (on recovery to CLOSED)
+    void clear_window() noexcept;
 
     /// Try transitioning from OPEN to HALF_OPEN if timeout expired
     /// Returns true if request should be allowed
@@ -143,8 +193,8 @@ private:
     // State (atomic for observability from other threads)
     std::atomic<CircuitState> state_{CircuitState::CLOSED};
 
-    // Sliding window of failure timestamps (not thread-safe, single-worker access)
-    std::deque<std::chrono::steady_clock::time_point> failure_timestamps_;
+    // Sliding window: ring of per-second outcome buckets (wait-free recording)
+    std::array<SecondBucket, kBucketCount> buckets_;
 
     // HALF_OPEN state tracking
     uint32_t consecutive_successes_ = 0;
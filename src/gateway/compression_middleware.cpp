@@ -25,6 +25,9 @@
 #include <fstream>
 #include <iostream>
 
+#include "../control/metrics.hpp"
+#include "../core/compression_offload.hpp"
+
 namespace titan::gateway {
 
 // Thread-local compression contexts (lazy initialization)
@@ -35,8 +38,163 @@ thread_local std::unique_ptr<core::BrotliContext> CompressionMiddleware::brotli_
 // Thread-local compression metrics
 thread_local CompressionMetrics compression_metrics;
 
+namespace {
+
+/// Configured level for the negotiated algorithm
+[[nodiscard]] int configured_level(const control::CompressionConfig& config,
+                                   core::CompressionEncoding encoding) noexcept {
+    switch (encoding) {
+        case core::CompressionEncoding::GZIP:
+            return config.levels.gzip;
+        case core::CompressionEncoding::ZSTD:
+            return config.levels.zstd;
+        case core::CompressionEncoding::BROTLI:
+            return config.levels.brotli;
+        default:
+            return 0;
+    }
+}
+
+/// Fast fallback level per algorithm: the point of diminishing returns is
+/// far above these, but under pressure throughput beats ratio
+[[nodiscard]] int fast_level(core::CompressionEncoding encoding) noexcept {
+    switch (encoding) {
+        case core::CompressionEncoding::GZIP:
+            return 1;
+        case core::CompressionEncoding::ZSTD:
+            return 1;
+        case core::CompressionEncoding::BROTLI:
+            return 2;
+        default:
+            return 0;
+    }
+}
+
+/// Custom Accept-Encoding / Content-Encoding token for dictionary frames.
+/// Dictionary-compressed bodies are not decodable as plain "zstd", so they
+/// get their own token that clients opt into explicitly.
+constexpr std::string_view kZstdDictToken = "zstd-dict";
+
+/// Whether the Accept-Encoding header lists the given token
+[[nodiscard]] bool accepts_token(std::string_view accept_encoding, std::string_view token) {
+    size_t pos = 0;
+    while (pos < accept_encoding.size()) {
+        size_t comma_pos = accept_encoding.find(',', pos);
+        if (comma_pos == std::string_view::npos) {
+            comma_pos = accept_encoding.size();
+        }
+
+        std::string_view candidate = accept_encoding.substr(pos, comma_pos - pos);
+        size_t semicolon_pos = candidate.find(';');
+        candidate = candidate.substr(0, semicolon_pos);
+
+        while (!candidate.empty() && std::isspace(candidate.front())) {
+            candidate.remove_prefix(1);
+        }
+        while (!candidate.empty() && std::isspace(candidate.back())) {
+            candidate.remove_suffix(1);
+        }
+
+        if (core::encoding_equals(candidate, token)) {
+            return true;
+        }
+        pos = comma_pos + 1;
+    }
+    return false;
+}
+
+/// Read a whole file into memory (empty vector when missing/unreadable)
+[[nodiscard]] std::vector<uint8_t> read_file_bytes(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return {};
+    }
+
+    std::streamsize size = file.tellg();
+    file.seekg(0, std::ios::beg);
+
+    std::vector<uint8_t> bytes(static_cast<size_t>(size));
+    if (!file.read(reinterpret_cast<char*>(bytes.data()), size)) {
+        return {};
+    }
+    return bytes;
+}
+
+}  // namespace
+
+// ============================================================================
+// DictionarySampleStore
+// ============================================================================
+
+DictionarySampleStore& DictionarySampleStore::instance() {
+    static DictionarySampleStore store;
+    return store;
+}
+
+void DictionarySampleStore::offer(const std::string& id, std::span<const uint8_t> body,
+                                  size_t max_total_bytes) {
+    std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return;  // Never block a worker for a training sample
+    }
+
+    Pool& pool = pools_[id];
+    if (pool.bytes.size() + body.size() > max_total_bytes) {
+        return;  // Pool is full; training has enough material
+    }
+
+    pool.bytes.insert(pool.bytes.end(), body.begin(), body.end());
+    pool.sizes.push_back(body.size());
+}
+
+DictionarySampleStore::TrainResult DictionarySampleStore::train(const std::string& id,
+                                                                size_t max_dict_size) {
+    Pool pool;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = pools_.find(id);
+        if (it == pools_.end()) {
+            return {};
+        }
+        pool = std::move(it->second);
+        pools_.erase(it);
+    }
+
+    TrainResult result;
+    result.sample_count = pool.sizes.size();
+    result.sample_bytes = pool.bytes.size();
+    result.dictionary = core::ZstdDictionary::train(pool.bytes, pool.sizes, max_dict_size);
+    return result;
+}
+
 CompressionMiddleware::CompressionMiddleware(control::CompressionConfig config)
-    : config_(std::move(config)) {}
+    : config_(std::move(config)) {
+    // Digest configured dictionaries once; entries whose file is missing
+    // stay registered (dict == nullptr) so response sampling and admin
+    // training can bootstrap them before the first dictionary exists
+    for (const auto& entry : config_.dictionaries.entries) {
+        if (entry.id.empty() || entry.path_prefix.empty()) {
+            continue;
+        }
+
+        LoadedDictionary loaded{entry.id, entry.path_prefix, nullptr};
+        auto bytes = read_file_bytes(entry.file);
+        if (!bytes.empty()) {
+            auto dict = std::make_shared<core::ZstdDictionary>(bytes.data(), bytes.size(),
+                                                               config_.levels.zstd);
+            if (dict->valid()) {
+                loaded.dict = std::move(dict);
+            }
+        }
+        dictionaries_.push_back(std::move(loaded));
+    }
+
+    // Longest prefix first so find_dictionary can return the first match
+    std::sort(dictionaries_.begin(), dictionaries_.end(),
+              [](const LoadedDictionary& a, const LoadedDictionary& b) {
+                  return a.path_prefix.size() > b.path_prefix.size();
+              });
+}
 
 MiddlewareResult CompressionMiddleware::process_response(ResponseContext& ctx) {
     const control::CompressionConfig& effective_config =
@@ -65,20 +223,38 @@ MiddlewareResult CompressionMiddleware::process_response(ResponseContext& ctx) {
         return MiddlewareResult::Continue;
     }
 
-    auto content_type = ctx.response->get_header("Content-Type");
+    auto content_type = ctx.response->get_header(http::WellKnownHeader::ContentType);
     if (!is_compressible(content_type, effective_config)) {
         compression_metrics.skipped_wrong_type++;
         ctx.set_metadata("compression_skip_reason", "uncompressible_type");
         return MiddlewareResult::Continue;
     }
 
-    auto content_encoding = ctx.response->get_header("Content-Encoding");
+    auto content_encoding = ctx.response->get_header(http::WellKnownHeader::ContentEncoding);
     if (!content_encoding.empty() && content_encoding != "identity") {
         compression_metrics.skipped_wrong_type++;
         ctx.set_metadata("compression_skip_reason", "already_compressed");
         return MiddlewareResult::Continue;
     }
 
+    // Zstd dictionary path: sample bodies for training, then serve
+    // dictionary frames to clients that opted in via "zstd-dict". Small
+    // JSON bodies gain the shared history plain zstd lacks at this size.
+    if (effective_config.dictionaries.sample_responses && !dictionaries_.empty()) {
+        static thread_local uint64_t sample_tick = 0;
+        size_t every = std::max<size_t>(1, effective_config.dictionaries.sample_every);
+        if (++sample_tick % every == 0) {
+            if (const LoadedDictionary* entry = find_dictionary(ctx.request->path)) {
+                DictionarySampleStore::instance().offer(
+                    entry->id, ctx.response->body, effective_config.dictionaries.max_sample_bytes);
+            }
+        }
+    }
+
+    if (try_dictionary_compression(ctx, effective_config)) {
+        return MiddlewareResult::Continue;
+    }
+
     auto encoding = negotiate_encoding(*ctx.request, effective_config);
     if (encoding == core::CompressionEncoding::NONE) {
         compression_metrics.skipped_client_unsupported++;
@@ -97,19 +273,61 @@ MiddlewareResult CompressionMiddleware::process_response(ResponseContext& ctx) {
         }
     }
 
+    // Adaptive level selection: under CPU pressure shipping slightly
+    // larger bytes beats queueing requests behind the compressor
+    int level = configured_level(effective_config, encoding);
+    const auto& adaptive = effective_config.adaptive;
+    if (adaptive.enabled) {
+        double cpu = control::t_worker_cpu_utilization;
+        if (cpu >= adaptive.cpu_skip_threshold) {
+            compression_metrics.skipped_cpu_pressure++;
+            ctx.set_metadata("compression_skip_reason", "cpu_pressure");
+            ctx.response->add_middleware_header("Vary", "Accept-Encoding");
+            return MiddlewareResult::Continue;
+        }
+        if (cpu >= adaptive.cpu_fast_threshold ||
+            ctx.response->body.size() >= adaptive.large_body_size) {
+            int fast = fast_level(encoding);
+            if (fast < level) {
+                level = fast;
+                compression_metrics.level_degraded++;
+            }
+        }
+    }
+
     auto start_time = std::chrono::steady_clock::now();
     size_t original_size = ctx.response->body.size();
+
+    // Offload: large bodies go to the dedicated compressor pool instead
+    // of stalling this event-loop thread. The middleware only marks the
+    // response; the server moves the body into a job after the pipeline
+    // finishes and sends once the compressed body is delivered back.
+    const auto& offload = effective_config.offload;
+    if (offload.enabled && original_size >= offload.min_body_size &&
+        ctx.get_metadata("compression_offload_capable") == "1") {
+        auto& pool = core::CompressionOffloadPool::instance();
+        pool.ensure_started(offload.threads, offload.max_inflight_jobs);
+        if (pool.has_capacity()) {
+            ctx.set_metadata("compression_offload", core::encoding_to_string(encoding));
+            ctx.set_metadata("compression_offload_level", std::to_string(level));
+            compression_metrics.offloaded++;
+            return MiddlewareResult::Continue;
+        }
+        // Pool saturated: fall through and compress inline (bounded by
+        // max_inflight_jobs this stays the exception, not the rule)
+    }
+
     bool use_streaming = (original_size > effective_config.streaming_threshold);
 
     bool success = false;
     if (use_streaming) {
         // Phase 3: Streaming compression (for large responses)
-        success = compress_streaming(ctx, encoding);
+        success = compress_streaming(ctx, encoding, level);
     } else {
         // Phase 1: Buffered compression (for typical responses)
         std::span<const uint8_t> body_span = ctx.response->body;
 
-        auto compressed = compress_buffered(body_span, encoding);
+        auto compressed = compress_buffered(body_span, encoding, level);
         if (!compressed.empty()) {
             ctx.response->body_storage = std::move(compressed);
             ctx.response->body = ctx.response->body_storage;  // Update span to point to storage
@@ -167,7 +385,7 @@ MiddlewareResult CompressionMiddleware::process_response(ResponseContext& ctx) {
 
 core::CompressionEncoding CompressionMiddleware::negotiate_encoding(
     const http::Request& req, const control::CompressionConfig& config) const {
-    auto accept_encoding = req.get_header("Accept-Encoding");
+    auto accept_encoding = req.get_header(http::WellKnownHeader::AcceptEncoding);
     if (accept_encoding.empty()) {
         return core::CompressionEncoding::NONE;
     }
@@ -311,25 +529,26 @@ bool CompressionMiddleware::is_breach_sensitive_path(
 bool CompressionMiddleware::is_setting_cookies(const http::Response& response) const {
     // Check if response has Set-Cookie header
     // Set-Cookie indicates session management - likely contains sensitive tokens
-    return response.has_header("Set-Cookie");
+    return response.has_header(http::WellKnownHeader::SetCookie);
 }
 
 std::vector<uint8_t> CompressionMiddleware::compress_buffered(std::span<const uint8_t> body,
-                                                              core::CompressionEncoding encoding) {
+                                                              core::CompressionEncoding encoding,
+                                                              int level) {
     switch (encoding) {
         case core::CompressionEncoding::GZIP:
-            return get_gzip_context().compress(body.data(), body.size());
+            return get_gzip_context(level).compress(body.data(), body.size());
         case core::CompressionEncoding::ZSTD:
-            return get_zstd_context().compress(body.data(), body.size());
+            return get_zstd_context(level).compress(body.data(), body.size());
         case core::CompressionEncoding::BROTLI:
-            return get_brotli_context().compress(body.data(), body.size());
+            return get_brotli_context(level).compress(body.data(), body.size());
         default:
             return {};
     }
 }
 
 bool CompressionMiddleware::compress_streaming(ResponseContext& ctx,
-                                               core::CompressionEncoding encoding) {
+                                               core::CompressionEncoding encoding, int level) {
     std::vector<uint8_t> output;
     output.reserve(ctx.response->body.size() / 4);
 
@@ -340,15 +559,15 @@ bool CompressionMiddleware::compress_streaming(ResponseContext& ctx,
     bool success = false;
     switch (encoding) {
         case core::CompressionEncoding::GZIP:
-            success = get_gzip_context().compress_stream(ctx.response->body.data(),
-                                                         ctx.response->body.size(), callback, true);
+            success = get_gzip_context(level).compress_stream(
+                ctx.response->body.data(), ctx.response->body.size(), callback, true);
             break;
         case core::CompressionEncoding::ZSTD:
-            success = get_zstd_context().compress_stream(ctx.response->body.data(),
-                                                         ctx.response->body.size(), callback, true);
+            success = get_zstd_context(level).compress_stream(
+                ctx.response->body.data(), ctx.response->body.size(), callback, true);
             break;
         case core::CompressionEncoding::BROTLI:
-            success = get_brotli_context().compress_stream(
+            success = get_brotli_context(level).compress_stream(
                 ctx.response->body.data(), ctx.response->body.size(), callback, true);
             break;
         default:
@@ -457,13 +676,83 @@ bool CompressionMiddleware::try_serve_precompressed(ResponseContext& ctx,
     return true;
 }
 
+const CompressionMiddleware::LoadedDictionary* CompressionMiddleware::find_dictionary(
+    std::string_view path) const {
+    // dictionaries_ is sorted by prefix length descending, so the first
+    // prefix match is the longest. Entries may have a null dict (file not
+    // trained yet); callers decide whether that matters.
+    for (const auto& entry : dictionaries_) {
+        if (path.starts_with(entry.path_prefix)) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+bool CompressionMiddleware::try_dictionary_compression(ResponseContext& ctx,
+                                                       const control::CompressionConfig& config) {
+    if (!config.dictionaries.enabled || dictionaries_.empty()) {
+        return false;
+    }
+
+    auto accept_encoding = ctx.request->get_header(http::WellKnownHeader::AcceptEncoding);
+    if (accept_encoding.empty() || !accepts_token(accept_encoding, kZstdDictToken)) {
+        return false;
+    }
+
+    const LoadedDictionary* entry = find_dictionary(ctx.request->path);
+    if (!entry || !entry->dict) {
+        return false;
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+    size_t original_size = ctx.response->body.size();
+
+    // The dictionary's baked-in level makes this cheaper than a plain
+    // frame at the same level, so no adaptive interplay here
+    auto compressed = get_zstd_context(config.levels.zstd)
+                          .compress_with_dictionary(ctx.response->body.data(),
+                                                    ctx.response->body.size(), *entry->dict);
+    if (compressed.empty()) {
+        return false;  // Fall through to plain negotiation
+    }
+
+    auto compression_time = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time);
+
+    ctx.response->body_storage = std::move(compressed);
+    ctx.response->body = ctx.response->body_storage;
+
+    update_headers(*ctx.response, kZstdDictToken);
+    ctx.response->add_middleware_header("X-Zstd-Dictionary-Id", entry->id);
+
+    compression_metrics.requests_compressed++;
+    compression_metrics.bytes_in += original_size;
+    compression_metrics.bytes_out += ctx.response->body.size();
+    compression_metrics.compression_time_us += compression_time.count();
+    compression_metrics.zstd_count++;
+    compression_metrics.dictionary_hits++;
+
+    ctx.set_metadata("compression_encoding", kZstdDictToken);
+    ctx.set_metadata("compression_dictionary_id", entry->id);
+    ctx.set_metadata("compression_original_size", std::to_string(original_size));
+    ctx.set_metadata("compression_compressed_size", std::to_string(ctx.response->body.size()));
+
+    return true;
+}
+
 void CompressionMiddleware::update_headers(http::Response& response,
                                            core::CompressionEncoding encoding) {
+    update_headers(response, std::string_view(core::encoding_to_string(encoding)));
+}
+
+void CompressionMiddleware::update_headers(http::Response& response,
+                                           std::string_view content_encoding_token) {
     // Add Content-Encoding header using hybrid storage
-    response.add_middleware_header("Content-Encoding", core::encoding_to_string(encoding));
+    response.add_middleware_header("Content-Encoding", content_encoding_token);
 
     // Add Vary header for proper caching
-    auto existing_vary = response.get_header("Vary");
+    auto existing_vary = response.get_header(http::WellKnownHeader::Vary);
     if (existing_vary.empty()) {
         response.add_middleware_header("Vary", "Accept-Encoding");
     } else if (existing_vary.find("Accept-Encoding") == std::string_view::npos) {
@@ -474,7 +763,7 @@ void CompressionMiddleware::update_headers(http::Response& response,
     }
 
     // Convert strong ETag to weak ETag (compression changes byte representation)
-    auto etag = response.get_header("ETag");
+    auto etag = response.get_header(http::WellKnownHeader::ETag);
     if (!etag.empty() && etag[0] != 'W') {
         response.remove_header("ETag");
         std::string weak_etag = "W/" + std::string(etag);
@@ -485,23 +774,29 @@ void CompressionMiddleware::update_headers(http::Response& response,
     // Note: Content-Length will be automatically updated by Response serialization
 }
 
-core::GzipContext& CompressionMiddleware::get_gzip_context() {
+core::GzipContext& CompressionMiddleware::get_gzip_context(int level) {
     if (!gzip_ctx_) {
-        gzip_ctx_ = std::make_unique<core::GzipContext>(config_.levels.gzip);
+        gzip_ctx_ = std::make_unique<core::GzipContext>(level);
+    } else if (gzip_ctx_->level() != level) {
+        gzip_ctx_->set_level(level);
     }
     return *gzip_ctx_;
 }
 
-core::ZstdContext& CompressionMiddleware::get_zstd_context() {
+core::ZstdContext& CompressionMiddleware::get_zstd_context(int level) {
     if (!zstd_ctx_) {
-        zstd_ctx_ = std::make_unique<core::ZstdContext>(config_.levels.zstd);
+        zstd_ctx_ = std::make_unique<core::ZstdContext>(level);
+    } else if (zstd_ctx_->level() != level) {
+        zstd_ctx_->set_level(level);
     }
     return *zstd_ctx_;
 }
 
-core::BrotliContext& CompressionMiddleware::get_brotli_context() {
+core::BrotliContext& CompressionMiddleware::get_brotli_context(int level) {
     if (!brotli_ctx_) {
-        brotli_ctx_ = std::make_unique<core::BrotliContext>(config_.levels.brotli);
+        brotli_ctx_ = std::make_unique<core::BrotliContext>(level);
+    } else if (brotli_ctx_->quality() != level) {
+        brotli_ctx_->set_quality(level);
     }
     return *brotli_ctx_;
 }
@@ -21,9 +21,11 @@
 
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <span>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "../control/config.hpp"
@@ -32,6 +34,38 @@
 
 namespace titan::gateway {
 
+/// Process-wide pool of sampled response bodies for zstd dictionary
+/// training. Workers offer 1-in-N compressible bodies (try_lock only -
+/// a contended mutex never blocks the hot path); the admin endpoint
+/// drains a pool through ZDICT when training is requested.
+class DictionarySampleStore {
+public:
+    [[nodiscard]] static DictionarySampleStore& instance();
+
+    /// Retain a copy of `body` for dictionary entry `id`. Drops the sample
+    /// silently when the per-entry byte cap is reached or the lock is held.
+    void offer(const std::string& id, std::span<const uint8_t> body, size_t max_total_bytes);
+
+    struct TrainResult {
+        std::vector<uint8_t> dictionary;  // Empty on failure
+        size_t sample_count = 0;
+        size_t sample_bytes = 0;
+    };
+
+    /// Train a dictionary from the samples collected for `id` and clear
+    /// the pool. Blocking; called from the admin thread only.
+    [[nodiscard]] TrainResult train(const std::string& id, size_t max_dict_size);
+
+private:
+    struct Pool {
+        std::vector<uint8_t> bytes;  // Concatenated samples (ZDICT layout)
+        std::vector<size_t> sizes;
+    };
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, Pool> pools_;
+};
+
 /// Compression middleware (Response Phase)
 /// Compresses response bodies using Gzip, Zstd, or Brotli based on client Accept-Encoding
 class CompressionMiddleware : public Middleware {
@@ -48,10 +82,21 @@ public:
     /// Get middleware name
     [[nodiscard]] std::string_view name() const override { return "CompressionMiddleware"; }
     [[nodiscard]] std::string_view type() const override { return "compression"; }
+    [[nodiscard]] bool handles_request() const override { return false; }
 
 private:
     control::CompressionConfig config_;
 
+    // Per-route zstd dictionaries, digested once at construction and
+    // shared read-only across workers (ZSTD_CDict is immutable). Sorted
+    // by prefix length descending so the first match is the longest.
+    struct LoadedDictionary {
+        std::string id;
+        std::string path_prefix;
+        std::shared_ptr<core::ZstdDictionary> dict;
+    };
+    std::vector<LoadedDictionary> dictionaries_;
+
     // Thread-local compression contexts (initialized on first use)
     static thread_local std::unique_ptr<core::GzipContext> gzip_ctx_;
     static thread_local std::unique_ptr<core::ZstdContext> zstd_ctx_;
@@ -71,22 +116,34 @@ private:
 
     /// Compress response body (buffered mode)
     [[nodiscard]] std::vector<uint8_t> compress_buffered(std::span<const uint8_t> body,
-                                                         core::CompressionEncoding encoding);
+                                                         core::CompressionEncoding encoding,
+                                                         int level);
 
     /// Compress response body (streaming mode) - Phase 3
-    [[nodiscard]] bool compress_streaming(ResponseContext& ctx, core::CompressionEncoding encoding);
+    [[nodiscard]] bool compress_streaming(ResponseContext& ctx, core::CompressionEncoding encoding,
+                                          int level);
 
     /// Try to serve pre-compressed file - Phase 4
     [[nodiscard]] bool try_serve_precompressed(ResponseContext& ctx,
                                                core::CompressionEncoding encoding);
 
+    /// Dictionary compression for opted-in clients ("zstd-dict" token).
+    /// Returns true when the response was compressed against a dictionary.
+    [[nodiscard]] bool try_dictionary_compression(ResponseContext& ctx,
+                                                  const control::CompressionConfig& config);
+
+    /// Longest-prefix dictionary match for a request path (nullptr if none)
+    [[nodiscard]] const LoadedDictionary* find_dictionary(std::string_view path) const;
+
     /// Update response headers after compression
     void update_headers(http::Response& response, core::CompressionEncoding encoding);
+    void update_headers(http::Response& response, std::string_view content_encoding_token);
 
-    /// Get or create thread-local compression context
-    [[nodiscard]] core::GzipContext& get_gzip_context();
-    [[nodiscard]] core::ZstdContext& get_zstd_context();
-    [[nodiscard]] core::BrotliContext& get_brotli_context();
+    /// Get or create the thread-local compression context at the given
+    /// level; an existing context is retuned in place (no re-init)
+    [[nodiscard]] core::GzipContext& get_gzip_context(int level);
+    [[nodiscard]] core::ZstdContext& get_zstd_context(int level);
+    [[nodiscard]] core::BrotliContext& get_brotli_context(int level);
 };
 
 /// Compression metrics (tracked per worker thread)
@@ -104,6 +161,7 @@ struct CompressionMetrics {
 
     // Skip reasons
     uint64_t skipped_too_small = 0;
+    uint64_t skipped_cpu_pressure = 0;  // Adaptive: worker too busy to compress
     uint64_t skipped_wrong_type = 0;
     uint64_t skipped_client_unsupported = 0;
     uint64_t skipped_disabled = 0;
@@ -112,6 +170,15 @@ struct CompressionMetrics {
     // Precompressed file serving
     uint64_t precompressed_hits = 0;  // Successfully served precompressed files
 
+    // Dictionary compression ("zstd-dict" responses)
+    uint64_t dictionary_hits = 0;
+
+    // Bodies handed to the offload compressor pool
+    uint64_t offloaded = 0;
+
+    // Adaptive level selection dropped to the fast level (CPU or body size)
+    uint64_t level_degraded = 0;
+
     /// Calculate compression ratio (average)
     [[nodiscard]] double compression_ratio() const noexcept {
         if (bytes_in == 0)
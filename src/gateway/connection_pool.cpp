@@ -23,6 +23,7 @@
 
 #include <algorithm>
 
+#include "../core/containers.hpp"
 #include "../core/logging.hpp"
 #include "../core/socket.hpp"
 
@@ -127,17 +128,33 @@ void BackendConnectionPool::release(int fd, const std::string& host, uint16_t po
     pool_.push_back(std::move(conn));
 }
 
-void BackendConnectionPool::cleanup_stale() {
-    auto now = std::chrono::steady_clock::now();
+size_t BackendConnectionPool::count(const std::string& host, uint16_t port) const noexcept {
+    return static_cast<size_t>(
+        std::count_if(pool_.begin(), pool_.end(), [&](const PooledConnection& conn) {
+            return conn.host == host && conn.port == port;
+        }));
+}
 
-    // Remove stale connections
+void BackendConnectionPool::cleanup_stale(size_t keep_warm_per_backend) {
+    // Remove stale connections, sparing up to keep_warm_per_backend
+    // healthy ones per backend (front-to-back, so the LIFO top - the most
+    // recently used - is evicted last)
+    titan::core::fast_map<std::string, size_t> kept;
     pool_.erase(std::remove_if(pool_.begin(), pool_.end(),
-                               [this, now](const PooledConnection& conn) {
-                                   if (conn.is_stale(max_idle_)) {
-                                       close_fd(conn.fd);
-                                       return true;  // Remove from pool
+                               [&](const PooledConnection& conn) {
+                                   if (!conn.is_stale(max_idle_)) {
+                                       return false;
+                                   }
+                                   if (keep_warm_per_backend > 0 && conn.is_healthy()) {
+                                       size_t& count = kept[conn.host + ":" +
+                                                           std::to_string(conn.port)];
+                                       if (count < keep_warm_per_backend) {
+                                           ++count;
+                                           return false;  // Spared as warm stock
+                                       }
                                    }
-                                   return false;
+                                   close_fd(conn.fd);
+                                   return true;  // Remove from pool
                                }),
                 pool_.end());
 }
@@ -69,9 +69,17 @@ public:
     /// If pool is full or connection is unhealthy, closes the connection
     void release(int fd, const std::string& host, uint16_t port);
 
+    /// Count pooled connections for one backend
+    [[nodiscard]] size_t count(const std::string& host, uint16_t port) const noexcept;
+
     /// Remove stale connections (idle > max_idle_time)
     /// Should be called periodically (e.g., every 10 seconds)
-    void cleanup_stale();
+    ///
+    /// keep_warm_per_backend > 0 exempts up to that many healthy
+    /// connections per backend from staleness eviction, so a warmed pool
+    /// isn't torn down and rebuilt every idle period - exactly the churn
+    /// prewarming exists to avoid
+    void cleanup_stale(size_t keep_warm_per_backend = 0);
 
     /// Clear all connections in pool
     void clear();
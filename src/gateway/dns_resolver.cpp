@@ -0,0 +1,139 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan DNS Resolver - Implementation
+
+#include "dns_resolver.hpp"
+
+#include <arpa/inet.h>
+#include <netdb.h>
+
+#include <cstring>
+#include <vector>
+
+namespace titan::gateway {
+
+DnsResolver::DnsResolver(std::chrono::seconds refresh_interval)
+    : refresh_interval_(refresh_interval) {}
+
+DnsResolver::~DnsResolver() {
+    stop();
+}
+
+void DnsResolver::track(const std::string& host) {
+    // Literal IPs never need resolution
+    sockaddr_in probe{};
+    if (inet_pton(AF_INET, host.c_str(), &probe.sin_addr) == 1) {
+        return;
+    }
+
+    std::lock_guard lock(mutex_);
+    cache_.try_emplace(host);  // Invalid until the refresh thread resolves it
+}
+
+void DnsResolver::start() {
+    if (running_.exchange(true)) {
+        return;  // Already running
+    }
+    refresh_thread_ = std::thread([this] { refresh_loop(); });
+}
+
+void DnsResolver::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    cv_.notify_all();
+    if (refresh_thread_.joinable()) {
+        refresh_thread_.join();
+    }
+}
+
+std::optional<sockaddr_in> DnsResolver::lookup(const std::string& host) {
+    std::lock_guard lock(mutex_);
+    auto it = cache_.find(host);
+    if (it == cache_.end()) {
+        // Unknown host - track it so the refresh thread picks it up
+        cache_.try_emplace(host);
+        return std::nullopt;
+    }
+    if (!it->second.valid) {
+        return std::nullopt;  // Tracked but not yet resolved
+    }
+    return it->second.addr;
+}
+
+std::optional<sockaddr_in> DnsResolver::resolve_now(const std::string& host) {
+    auto addr = resolve(host);
+    if (addr) {
+        std::lock_guard lock(mutex_);
+        auto& entry = cache_[host];
+        entry.addr = *addr;
+        entry.valid = true;
+    }
+    return addr;
+}
+
+void DnsResolver::refresh_loop() {
+    while (running_.load(std::memory_order_relaxed)) {
+        // Snapshot hostnames under the lock, resolve without it
+        // (getaddrinfo can take tens of milliseconds)
+        std::vector<std::string> hosts;
+        {
+            std::lock_guard lock(mutex_);
+            hosts.reserve(cache_.size());
+            for (const auto& [host, entry] : cache_) {
+                hosts.push_back(host);
+            }
+        }
+
+        for (const auto& host : hosts) {
+            if (!running_.load(std::memory_order_relaxed)) {
+                return;
+            }
+
+            auto addr = resolve(host);
+            if (addr) {
+                std::lock_guard lock(mutex_);
+                auto& entry = cache_[host];
+                entry.addr = *addr;
+                entry.valid = true;
+            }
+            // On failure keep the previous address (stale-while-revalidate):
+            // a transient resolver outage must not take down healthy backends
+        }
+
+        // Sleep until next refresh (interruptible for fast shutdown)
+        std::unique_lock cv_lock(cv_mutex_);
+        cv_.wait_for(cv_lock, refresh_interval_,
+                     [this] { return !running_.load(std::memory_order_relaxed); });
+    }
+}
+
+std::optional<sockaddr_in> DnsResolver::resolve(const std::string& host) {
+    struct addrinfo hints{}, *result = nullptr;
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    if (getaddrinfo(host.c_str(), nullptr, &hints, &result) != 0 || !result) {
+        return std::nullopt;
+    }
+
+    sockaddr_in addr = *reinterpret_cast<struct sockaddr_in*>(result->ai_addr);
+    freeaddrinfo(result);
+    return addr;
+}
+
+}  // namespace titan::gateway
@@ -22,6 +22,7 @@
 
 #include "../core/jwks_fetcher.hpp"
 #include "../core/jwt.hpp"
+#include "cache_middleware.hpp"
 #include "circuit_breaker.hpp"
 #include "compression_middleware.hpp"
 #include "jwt_authz_middleware.hpp"
@@ -80,63 +81,134 @@ std::unique_ptr<Router> build_router(const control::Config& config) {
         route.transform_config = route_config.transform;      // Per-route transform config
         route.compression_config = route_config.compression;  // Per-route compression config
         route.middleware = route_config.middleware;           // Per-route middleware
+        route.static_root = route_config.static_root;         // Static file root (if any)
+        route.mirror_upstream = route_config.mirror_upstream;  // Shadow mirroring (if any)
+        route.mirror_sample_percent = route_config.mirror_sample_percent;
+        if (route_config.websocket) {
+            route.ws_broadcast_channel = route_config.websocket->broadcast_channel;
+        }
 
         router->add_route(std::move(route));
     }
 
+    // Flatten the radix tree into the contiguous matcher (hot-path lookups
+    // walk index-linked records instead of per-node heap pointers)
+    router->compile();
+
     return router;
 }
 
+/// Build one Upstream from its config section
+static std::unique_ptr<Upstream> build_upstream(const control::UpstreamConfig& upstream_config) {
+    // Calculate pool size as max of all backend max_connections
+    size_t pool_size = 64;  // Default
+    for (const auto& backend_config : upstream_config.backends) {
+        pool_size = std::max(pool_size, static_cast<size_t>(backend_config.max_connections));
+    }
+
+    auto upstream = std::make_unique<Upstream>(upstream_config.name, pool_size);
+
+    for (const auto& backend_config : upstream_config.backends) {
+        Backend backend;
+        backend.host = backend_config.host;
+        backend.port = backend_config.port;
+        backend.weight = backend_config.weight;
+        backend.max_connections = backend_config.max_connections;
+
+        // Initialize circuit breaker if enabled
+        if (upstream_config.circuit_breaker.enabled) {
+            CircuitBreakerConfig cb_config;
+            cb_config.failure_threshold = upstream_config.circuit_breaker.failure_threshold;
+            cb_config.success_threshold = upstream_config.circuit_breaker.success_threshold;
+            cb_config.timeout_ms = upstream_config.circuit_breaker.timeout_ms;
+            cb_config.window_ms = upstream_config.circuit_breaker.window_ms;
+            cb_config.failure_rate_threshold =
+                upstream_config.circuit_breaker.failure_rate_threshold;
+            cb_config.min_requests = upstream_config.circuit_breaker.min_requests;
+            cb_config.enable_global_hints = upstream_config.circuit_breaker.enable_global_hints;
+            cb_config.catastrophic_threshold =
+                upstream_config.circuit_breaker.catastrophic_threshold;
+
+            upstream->add_backend_with_circuit_breaker(std::move(backend), cb_config);
+        } else {
+            upstream->add_backend(std::move(backend));
+        }
+    }
+
+    // Set load balancing strategy from config
+    if (upstream_config.load_balancing == "least_connections") {
+        upstream->set_load_balancer(std::make_unique<LeastConnectionsBalancer>());
+    } else if (upstream_config.load_balancing == "random") {
+        upstream->set_load_balancer(std::make_unique<RandomBalancer>());
+    } else if (upstream_config.load_balancing == "weighted_round_robin") {
+        upstream->set_load_balancer(std::make_unique<WeightedRoundRobinBalancer>());
+    } else if (upstream_config.load_balancing == "p2c") {
+        upstream->set_load_balancer(std::make_unique<PowerOfTwoChoicesBalancer>());
+    } else if (upstream_config.load_balancing == "consistent_hash") {
+        upstream->set_load_balancer(std::make_unique<ConsistentHashBalancer>());
+        upstream->set_hash_key(upstream_config.hash_key);
+    }
+    // else: defaults to RoundRobinBalancer (set in Upstream constructor)
+
+    upstream->set_http2(upstream_config.http2);
+
+    OutlierDetectionConfig outlier_config;
+    outlier_config.enabled = upstream_config.outlier_detection.enabled;
+    outlier_config.consecutive_errors = upstream_config.outlier_detection.consecutive_errors;
+    outlier_config.latency_factor = upstream_config.outlier_detection.latency_factor;
+    outlier_config.min_latency_us = upstream_config.outlier_detection.min_latency_us;
+    outlier_config.base_ejection_ms = upstream_config.outlier_detection.base_ejection_ms;
+    outlier_config.max_ejection_ms = upstream_config.outlier_detection.max_ejection_ms;
+    outlier_config.max_ejected_fraction =
+        upstream_config.outlier_detection.max_ejected_fraction;
+    upstream->set_outlier_detection(outlier_config);
+    upstream->set_min_warm_connections(upstream_config.min_pool_size);
+
+    HedgingConfig hedging_config;
+    hedging_config.enabled = upstream_config.hedging.enabled;
+    hedging_config.delay_percentile = upstream_config.hedging.delay_percentile;
+    hedging_config.min_delay_ms = upstream_config.hedging.min_delay_ms;
+    hedging_config.max_delay_ms = upstream_config.hedging.max_delay_ms;
+    hedging_config.budget_percent = upstream_config.hedging.budget_percent;
+    upstream->set_hedging(hedging_config);
+
+    return upstream;
+}
+
 std::unique_ptr<UpstreamManager> build_upstream_manager(const control::Config& config) {
+    return build_upstream_manager(config, nullptr, nullptr);
+}
+
+std::unique_ptr<UpstreamManager> build_upstream_manager(const control::Config& config,
+                                                        const control::ConfigDelta* delta,
+                                                        UpstreamManager* previous) {
     auto upstream_manager = std::make_unique<UpstreamManager>();
 
-    // Build upstreams from config
     for (const auto& upstream_config : config.upstreams) {
-        // Calculate pool size as max of all backend max_connections
-        size_t pool_size = 64;  // Default
-        for (const auto& backend_config : upstream_config.backends) {
-            pool_size = std::max(pool_size, static_cast<size_t>(backend_config.max_connections));
+        // Incremental reload: an upstream whose config section did not
+        // change moves across from the retiring manager, keeping its
+        // warmed balancer state, breaker windows, latency EWMAs and
+        // pooled backend connections. In-flight requests holding Backend
+        // pointers into it stay valid - the objects never move.
+        std::unique_ptr<Upstream> upstream;
+        if (delta && previous && delta->upstream_unchanged(upstream_config.name)) {
+            upstream = previous->release_upstream(upstream_config.name);
         }
-
-        auto upstream = std::make_unique<Upstream>(upstream_config.name, pool_size);
-
-        for (const auto& backend_config : upstream_config.backends) {
-            Backend backend;
-            backend.host = backend_config.host;
-            backend.port = backend_config.port;
-            backend.weight = backend_config.weight;
-            backend.max_connections = backend_config.max_connections;
-
-            // Initialize circuit breaker if enabled
-            if (upstream_config.circuit_breaker.enabled) {
-                CircuitBreakerConfig cb_config;
-                cb_config.failure_threshold = upstream_config.circuit_breaker.failure_threshold;
-                cb_config.success_threshold = upstream_config.circuit_breaker.success_threshold;
-                cb_config.timeout_ms = upstream_config.circuit_breaker.timeout_ms;
-                cb_config.window_ms = upstream_config.circuit_breaker.window_ms;
-                cb_config.enable_global_hints = upstream_config.circuit_breaker.enable_global_hints;
-                cb_config.catastrophic_threshold =
-                    upstream_config.circuit_breaker.catastrophic_threshold;
-
-                upstream->add_backend_with_circuit_breaker(std::move(backend), cb_config);
-            } else {
-                upstream->add_backend(std::move(backend));
-            }
+        if (!upstream) {
+            upstream = build_upstream(upstream_config);
         }
+        upstream_manager->register_upstream(std::move(upstream));
 
-        // Set load balancing strategy from config
-        if (upstream_config.load_balancing == "least_connections") {
-            upstream->set_load_balancer(std::make_unique<LeastConnectionsBalancer>());
-        } else if (upstream_config.load_balancing == "random") {
-            upstream->set_load_balancer(std::make_unique<RandomBalancer>());
-        } else if (upstream_config.load_balancing == "weighted_round_robin") {
-            upstream->set_load_balancer(std::make_unique<WeightedRoundRobinBalancer>());
+        // Track backend hostnames for background DNS resolution
+        // (literal IPs are ignored by the resolver)
+        for (const auto& backend_config : upstream_config.backends) {
+            upstream_manager->dns_resolver().track(backend_config.host);
         }
-        // else: defaults to RoundRobinBalancer (set in Upstream constructor)
-
-        upstream_manager->register_upstream(std::move(upstream));
     }
 
+    // Prewarm and refresh backend addresses off the hot path
+    upstream_manager->dns_resolver().start();
+
     return upstream_manager;
 }
 
@@ -266,26 +338,40 @@ std::unique_ptr<Pipeline> build_pipeline(const control::Config& config,
         pipeline->use(std::make_unique<JwtAuthzMiddleware>(authz_config));
     }
 
+    // Rate limiter config compilation. Local mode divides the configured
+    // total by worker_count (each worker enforces its slice - effective
+    // limit drifts with how a client's connections land on workers).
+    // Cluster mode enforces the full per-node share against one table all
+    // workers update, dividing only by cluster_node_count.
+    auto compile_rate_limit = [worker_count](std::string_view limiter_name,
+                                             const control::RateLimitConfig& rl) {
+        RateLimitMiddleware::Config rl_config;
+        if (rl.cluster_enabled) {
+            uint32_t nodes = std::max(1u, rl.cluster_node_count);
+            rl_config.requests_per_second = std::max(1u, rl.requests_per_second / nodes);
+            rl_config.burst_size = std::max(1u, rl.burst_size / nodes);
+            rl_config.shared_table = acquire_shared_gcra_table(
+                limiter_name, GcraParams::compile(rl_config.requests_per_second,
+                                                  rl_config.burst_size));
+        } else {
+            rl_config.requests_per_second = std::max(1u, rl.requests_per_second / worker_count);
+            rl_config.burst_size = std::max(1u, rl.burst_size / worker_count);
+        }
+        return rl_config;
+    };
+
     // Global rate limiting (backward compatibility - only if enabled in config)
-    // Divide by worker_count to match user expectations (config specifies total limit)
     if (config.rate_limit.enabled && config.rate_limit.requests_per_second > 0) {
-        RateLimitMiddleware::Config rl_config;
-        rl_config.requests_per_second =
-            std::max(1u, config.rate_limit.requests_per_second / worker_count);
-        rl_config.burst_size = std::max(1u, config.rate_limit.burst_size / worker_count);
-        pipeline->use(std::make_unique<RateLimitMiddleware>(rl_config));
+        pipeline->use(std::make_unique<RateLimitMiddleware>(
+            compile_rate_limit("__global", config.rate_limit)));
     }
 
     // Named rate limiters (for per-route rate limiting)
-    // Divide by worker_count to match user expectations (config specifies total limit)
     for (const auto& [name, rate_limit_config] : config.rate_limits) {
         if (rate_limit_config.enabled && rate_limit_config.requests_per_second > 0) {
-            RateLimitMiddleware::Config rl_config;
-            rl_config.requests_per_second =
-                std::max(1u, rate_limit_config.requests_per_second / worker_count);
-            rl_config.burst_size = std::max(1u, rate_limit_config.burst_size / worker_count);
-            pipeline->register_named_middleware(name,
-                                                std::make_unique<RateLimitMiddleware>(rl_config));
+            pipeline->register_named_middleware(
+                name, std::make_unique<RateLimitMiddleware>(
+                          compile_rate_limit(name, rate_limit_config)));
         }
     }
 
@@ -323,6 +409,13 @@ std::unique_ptr<Pipeline> build_pipeline(const control::Config& config,
         pipeline->use(std::make_unique<TransformMiddleware>(config.transform));
     }
 
+    // Response cache (serve cacheable GETs from the gateway)
+    // Runs after Auth/Transform so cached entries reflect final request
+    // shape, before Compression so bodies are cached uncompressed
+    if (config.cache.enabled) {
+        pipeline->use(std::make_unique<CacheMiddleware>(config.cache));
+    }
+
     // Compression middleware (response compression with Gzip/Zstd/Brotli)
     // Runs in response phase (after proxy response is received)
     // IMPORTANT: Compression runs in Response Phase, not Request Phase
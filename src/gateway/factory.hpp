@@ -38,6 +38,13 @@ namespace titan::gateway {
 [[nodiscard]] std::unique_ptr<UpstreamManager> build_upstream_manager(
     const control::Config& config);
 
+/// Incremental rebuild for config hot reload: upstreams listed unchanged
+/// in the delta are detached from the previous manager and reused as-is
+/// (warmed balancer/breaker/pool state intact); only changed ones are
+/// built fresh. Pass nullptrs for a full build.
+[[nodiscard]] std::unique_ptr<UpstreamManager> build_upstream_manager(
+    const control::Config& config, const control::ConfigDelta* delta, UpstreamManager* previous);
+
 /// Build static JWT key manager from configuration (shared across workers)
 [[nodiscard]] std::shared_ptr<core::KeyManager> build_static_key_manager(
     const control::Config& config);
@@ -53,6 +53,7 @@ public:
     /// Get middleware name
     [[nodiscard]] std::string_view name() const override { return "JwtAuthzMiddleware"; }
     [[nodiscard]] std::string_view type() const override { return "jwt_authz"; }
+    [[nodiscard]] bool handles_response() const override { return false; }
 
 private:
     /// Send 403 Forbidden response
@@ -20,10 +20,21 @@
 
 #include <cassert>
 
+#include "../control/metrics.hpp"
 #include "../core/logging.hpp"
 
 namespace titan::gateway {
 
+bool JwtAuthMiddleware::check_revoked(std::string_view jti) {
+    auto probe = revocation_list_.check(jti);
+    if (auto* metrics = control::t_thread_metrics) {
+        metrics->record_revocation_probe(
+            probe == core::RevocationList::ProbeResult::BloomNegative,
+            probe == core::RevocationList::ProbeResult::FalsePositive);
+    }
+    return probe == core::RevocationList::ProbeResult::Revoked;
+}
+
 JwtAuthMiddleware::JwtAuthMiddleware(Config config, std::shared_ptr<core::JwtValidator> validator,
                                      core::RevocationQueue* revocation_queue)
     : config_(std::move(config)),
@@ -83,7 +94,7 @@ MiddlewareResult JwtAuthMiddleware::process_request(RequestContext& ctx) {
         revocation_list_.sync_from_queue(*revocation_queue_);
 
         // Check if this token's jti is in the blacklist
-        if (!result.claims.jti.empty() && revocation_list_.is_revoked(result.claims.jti)) {
+        if (!result.claims.jti.empty() && check_revoked(result.claims.jti)) {
             auto* logger = logging::get_current_logger();
             assert(logger && "Logger must be initialized");
             LOG_WARNING(logger, "JWT revoked: jti={}, client_ip={}, correlation_id={}",
@@ -225,7 +236,7 @@ MiddlewareResult JwtAuthMiddleware::process_websocket_upgrade(RequestContext& ct
     if (config_.revocation_enabled && revocation_queue_) {
         revocation_list_.sync_from_queue(*revocation_queue_);
 
-        if (!result.claims.jti.empty() && revocation_list_.is_revoked(result.claims.jti)) {
+        if (!result.claims.jti.empty() && check_revoked(result.claims.jti)) {
             auto* logger = logging::get_current_logger();
             assert(logger && "Logger must be initialized");
             LOG_WARNING(logger,
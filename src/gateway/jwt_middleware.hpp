@@ -48,12 +48,18 @@ public:
     /// Get middleware name
     [[nodiscard]] std::string_view name() const override { return "JwtAuthMiddleware"; }
     [[nodiscard]] std::string_view type() const override { return "jwt_auth"; }
+    [[nodiscard]] bool handles_response() const override { return false; }
 
     // WebSocket support (validate JWT before upgrade)
     [[nodiscard]] bool applies_to_websocket() const override { return config_.enabled; }
     [[nodiscard]] MiddlewareResult process_websocket_upgrade(RequestContext& ctx) override;
 
 private:
+    /// Revocation probe with filter stats: records the Bloom outcome to the
+    /// worker's ThreadMetrics and returns whether the token is revoked
+    [[nodiscard]] bool check_revoked(std::string_view jti);
+
+
     /// Send 401 Unauthorized response
     [[nodiscard]] MiddlewareResult send_401(RequestContext& ctx, std::string_view error) const;
 
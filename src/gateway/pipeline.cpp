@@ -19,12 +19,33 @@
 #include "pipeline.hpp"
 
 #include <cassert>
+#include <chrono>
 #include <iostream>
 
+#include "../core/access_log.hpp"
 #include "../core/logging.hpp"
 
 namespace titan::gateway {
 
+namespace {
+
+/// Stable 32-bit backend identifier for access-log records (FNV-1a over
+/// host bytes + port, no string allocation)
+uint32_t backend_log_id(const Backend& backend) noexcept {
+    uint32_t hash = 2166136261u;
+    for (char c : backend.host) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    hash ^= static_cast<uint8_t>(backend.port & 0xFF);
+    hash *= 16777619u;
+    hash ^= static_cast<uint8_t>((backend.port >> 8) & 0xFF);
+    hash *= 16777619u;
+    return hash != 0 ? hash : 1;  // 0 is reserved for "no backend"
+}
+
+}  // namespace
+
 // LoggingMiddleware implementation (Response phase - logs with timing)
 
 MiddlewareResult LoggingMiddleware::process_response(ResponseContext& ctx) {
@@ -32,62 +53,134 @@ MiddlewareResult LoggingMiddleware::process_response(ResponseContext& ctx) {
         return MiddlewareResult::Error;
     }
 
-    // Logging disabled for performance in MVP
-    // TODO: Implement lock-free async logging with background thread for production
-    // Calculate duration if needed for metrics:
-    // auto now = std::chrono::steady_clock::now();
-    // auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
-    //     now - ctx.start_time);
+    // Binary access log: fill one fixed-layout record and push it into the
+    // worker's SPSC ring; the background writer handles serialization.
+    // Null ring means binary access logging is disabled - no work at all.
+    if (core::t_access_log_ring) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - ctx.start_time);
+
+        core::AccessLogRecord record{};
+        record.timestamp_ns =
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                      std::chrono::system_clock::now().time_since_epoch())
+                                      .count());
+        record.bytes_in = ctx.request->body.size();
+        record.bytes_out = ctx.response->body.size();
+        record.duration_us = static_cast<uint32_t>(elapsed.count());
+        record.route_id = ctx.route_match.metrics_id;
+        record.backend_id = ctx.backend ? backend_log_id(*ctx.backend) : 0;
+        record.status = static_cast<uint16_t>(ctx.response->status);
+        if (ctx.backend_error) {
+            record.flags |= core::kAccessLogFlagBackendError;
+        }
+        core::t_access_log_ring->push(record);
+    }
 
     return MiddlewareResult::Continue;
 }
 
 // CorsMiddleware implementation (Request phase - adds CORS headers)
 
-MiddlewareResult CorsMiddleware::process_request(RequestContext& ctx) {
-    if (!ctx.request || !ctx.response) {
-        return MiddlewareResult::Error;
+CorsMiddleware::CorsMiddleware(Config config) : config_(std::move(config)) {
+    for (const auto& origin : config_.allowed_origins) {
+        if (origin == "*") {
+            allow_any_origin_ = true;
+        }
+        origin_set_.insert(origin);
     }
 
-    // Add CORS headers using hybrid storage (add_middleware_header copies strings - safe!)
+    auto join = [](const std::vector<std::string>& parts) {
+        std::string joined;
+        for (size_t i = 0; i < parts.size(); ++i) {
+            if (i > 0) {
+                joined += ", ";
+            }
+            joined += parts[i];
+        }
+        return joined;
+    };
+    methods_joined_ = join(config_.allowed_methods);
+    headers_joined_ = join(config_.allowed_headers);
+    max_age_str_ = std::to_string(config_.max_age);
+
+    // Serialize the full preflight response once - byte-for-byte what
+    // send_response() would emit for the 204 the per-request path used to
+    // build. Both Connection variants are canned so the server can pick
+    // without editing bytes.
+    auto serialize_preflight = [this](std::string_view connection) {
+        std::string r = "HTTP/1.1 204 No Content\r\n";
+        if (!config_.allowed_origins.empty()) {
+            r += "Access-Control-Allow-Origin: ";
+            r += config_.allowed_origins[0];
+            r += "\r\n";
+        }
+        if (!methods_joined_.empty()) {
+            r += "Access-Control-Allow-Methods: ";
+            r += methods_joined_;
+            r += "\r\n";
+        }
+        if (!headers_joined_.empty()) {
+            r += "Access-Control-Allow-Headers: ";
+            r += headers_joined_;
+            r += "\r\n";
+        }
+        if (config_.allow_credentials) {
+            r += "Access-Control-Allow-Credentials: true\r\n";
+        }
+        r += "Access-Control-Max-Age: ";
+        r += max_age_str_;
+        r += "\r\n";
+        r += "Content-Length: 0\r\n";
+        r += "Connection: ";
+        r += connection;
+        r += "\r\n\r\n";
+        return r;
+    };
+    preflight_keepalive_ = serialize_preflight("keep-alive");
+    preflight_close_ = serialize_preflight("close");
+}
+
+void CorsMiddleware::add_cors_headers(RequestContext& ctx) const {
+    // Hybrid storage (add_middleware_header copies strings - safe!); the
+    // joined value lists were built once at construction
     if (!config_.allowed_origins.empty()) {
         ctx.response->add_middleware_header("Access-Control-Allow-Origin",
                                             config_.allowed_origins[0]);
     }
-
-    if (!config_.allowed_methods.empty()) {
-        std::string methods;
-        for (size_t i = 0; i < config_.allowed_methods.size(); ++i) {
-            if (i > 0)
-                methods += ", ";
-            methods += config_.allowed_methods[i];
-        }
-        ctx.response->add_middleware_header("Access-Control-Allow-Methods", methods);
+    if (!methods_joined_.empty()) {
+        ctx.response->add_middleware_header("Access-Control-Allow-Methods", methods_joined_);
     }
-
-    if (!config_.allowed_headers.empty()) {
-        std::string headers;
-        for (size_t i = 0; i < config_.allowed_headers.size(); ++i) {
-            if (i > 0)
-                headers += ", ";
-            headers += config_.allowed_headers[i];
-        }
-        ctx.response->add_middleware_header("Access-Control-Allow-Headers", headers);
+    if (!headers_joined_.empty()) {
+        ctx.response->add_middleware_header("Access-Control-Allow-Headers", headers_joined_);
     }
-
     if (config_.allow_credentials) {
         ctx.response->add_middleware_header("Access-Control-Allow-Credentials", "true");
     }
+    ctx.response->add_middleware_header("Access-Control-Max-Age", max_age_str_);
+}
 
-    std::string max_age = std::to_string(config_.max_age);
-    ctx.response->add_middleware_header("Access-Control-Max-Age", max_age);
+MiddlewareResult CorsMiddleware::process_request(RequestContext& ctx) {
+    if (!ctx.request || !ctx.response) {
+        return MiddlewareResult::Error;
+    }
 
-    // Handle OPTIONS preflight
+    // OPTIONS preflight: hand the server the canned bytes and stop - the
+    // rest of the pipeline never runs and nothing is built per request.
+    // The regular response fields are still filled in for paths that
+    // can't take canned HTTP/1.1 bytes (HTTP/2 streams frame their own).
     if (ctx.request->method == http::Method::OPTIONS) {
+        ctx.canned_response = std::span<const uint8_t>(
+            reinterpret_cast<const uint8_t*>(preflight_keepalive_.data()),
+            preflight_keepalive_.size());
+        ctx.canned_response_close = std::span<const uint8_t>(
+            reinterpret_cast<const uint8_t*>(preflight_close_.data()), preflight_close_.size());
+        add_cors_headers(ctx);
         ctx.response->status = http::StatusCode::NoContent;
         return MiddlewareResult::Stop;
     }
 
+    add_cors_headers(ctx);
     return MiddlewareResult::Continue;
 }
 
@@ -113,22 +206,11 @@ MiddlewareResult CorsMiddleware::process_websocket_upgrade(RequestContext& ctx)
         }
     }
 
-    // Validate Origin against allowed_origins
-    bool origin_allowed = false;
-
-    for (const auto& allowed_origin : config_.allowed_origins) {
-        // Check for wildcard (DANGEROUS for WebSocket - should only allow in dev)
-        if (allowed_origin == "*") {
-            origin_allowed = true;
-            break;
-        }
-
-        // Exact match (case-sensitive per RFC 6454)
-        if (origin == allowed_origin) {
-            origin_allowed = true;
-            break;
-        }
-    }
+    // Validate Origin against the precomputed hash set. Wildcard is
+    // DANGEROUS for WebSocket - should only allow in dev. Exact matches
+    // are case-sensitive per RFC 6454.
+    bool origin_allowed =
+        allow_any_origin_ || (!origin.empty() && origin_set_.contains(std::string(origin)));
 
     if (!origin_allowed) {
         // Origin not in allowed list - REJECT upgrade (CSWSH prevention)
@@ -154,15 +236,8 @@ MiddlewareResult CorsMiddleware::process_websocket_upgrade(RequestContext& ctx)
 
 // RateLimitMiddleware implementation (Request phase - checks rate limits)
 
-RateLimitMiddleware::RateLimitMiddleware()
-    : config_(),
-      limiter_(std::make_unique<ThreadLocalRateLimiter>(config_.burst_size,
-                                                        config_.requests_per_second)) {}
-
 RateLimitMiddleware::RateLimitMiddleware(Config config)
-    : config_(std::move(config)),
-      limiter_(std::make_unique<ThreadLocalRateLimiter>(config_.burst_size,
-                                                        config_.requests_per_second)) {}
+    : config_(std::move(config)), limiter_(config_.requests_per_second, config_.burst_size) {}
 
 MiddlewareResult RateLimitMiddleware::process_request(RequestContext& ctx) {
     // Use client IP as the rate limit key
@@ -172,8 +247,11 @@ MiddlewareResult RateLimitMiddleware::process_request(RequestContext& ctx) {
         return MiddlewareResult::Continue;
     }
 
-    // Check rate limit
-    if (!limiter_->allow(key)) {
+    // Check rate limit (shared node-global table in cluster mode,
+    // per-worker limiter otherwise)
+    bool allowed =
+        config_.shared_table ? config_.shared_table->allow(key) : limiter_.allow(key);
+    if (!allowed) {
         // Rate limit exceeded
         if (ctx.response) {
             ctx.response->status = http::StatusCode::TooManyRequests;
@@ -203,7 +281,9 @@ MiddlewareResult RateLimitMiddleware::process_websocket_upgrade(RequestContext&
     }
 
     // Check rate limit using same limiter as HTTP requests
-    if (!limiter_->allow(key)) {
+    bool allowed =
+        config_.shared_table ? config_.shared_table->allow(key) : limiter_.allow(key);
+    if (!allowed) {
         // Rate limit exceeded - block WebSocket upgrade
         if (ctx.response) {
             ctx.response->status = http::StatusCode::TooManyRequests;
@@ -279,21 +359,23 @@ MiddlewareResult ProxyMiddleware::process_request(RequestContext& ctx) {
 }
 
 MiddlewareResult ProxyMiddleware::process_response(ResponseContext& ctx) {
-    // Record circuit breaker feedback
-    if (ctx.backend && ctx.backend->circuit_breaker) {
-        if (ctx.backend_error) {
-            // Backend timeout or connection error
-            ctx.backend->circuit_breaker->record_failure();
-        } else if (ctx.response) {
-            // Got response from backend
-            if (ctx.response->status >= http::StatusCode::InternalServerError) {
-                // 5xx error - backend failure
-                ctx.backend->circuit_breaker->record_failure();
-            } else if (ctx.response->status < http::StatusCode::BadRequest) {
-                // 2xx or 3xx - success
-                ctx.backend->circuit_breaker->record_success();
+    // Record circuit breaker + outlier detection feedback
+    if (ctx.backend) {
+        // 4xx errors are client errors, counted as neither
+        bool failure = ctx.backend_error ||
+                       (ctx.response && ctx.response->status >= http::StatusCode::InternalServerError);
+        bool success =
+            !failure && ctx.response && ctx.response->status < http::StatusCode::BadRequest;
+
+        if (failure || success) {
+            ctx.backend->record_result(failure);
+            if (ctx.backend->circuit_breaker) {
+                if (failure) {
+                    ctx.backend->circuit_breaker->record_failure();
+                } else {
+                    ctx.backend->circuit_breaker->record_success();
+                }
             }
-            // 4xx errors are client errors, don't count as backend failure
         }
     }
 
@@ -319,14 +401,17 @@ MiddlewareResult ProxyMiddleware::process_response(ResponseContext& ctx) {
 
 void Pipeline::use(std::unique_ptr<Middleware> middleware) {
     middleware_.push_back(std::move(middleware));
+    invalidate_chains();
 }
 
 void Pipeline::use(MiddlewareFunc func, std::string_view name) {
     middleware_.push_back(std::make_unique<FunctionMiddleware>(std::move(func), std::string(name)));
+    invalidate_chains();
 }
 
 void Pipeline::register_named_middleware(std::string name, std::unique_ptr<Middleware> middleware) {
     named_middleware_[std::move(name)] = std::move(middleware);
+    invalidate_chains();
 }
 
 Middleware* Pipeline::get_named_middleware(const std::string& name) const {
@@ -334,12 +419,18 @@ Middleware* Pipeline::get_named_middleware(const std::string& name) const {
     return (it != named_middleware_.end()) ? it->second.get() : nullptr;
 }
 
-MiddlewareResult Pipeline::execute_request(RequestContext& ctx) {
-    // Collect types of per-route middleware for override detection (REPLACEMENT model)
+Pipeline::CompiledChain Pipeline::compile_chain(
+    const std::vector<std::string>& route_middleware) const {
+    CompiledChain chain;
+
+    // Collect per-route instances and their types for override detection
+    // (REPLACEMENT model) - resolved here once instead of per request
     titan::core::fast_set<std::string_view> route_middleware_types;
-    for (const auto& middleware_name : ctx.route_match.middleware) {
+    std::vector<Middleware*> route_instances;
+    for (const auto& middleware_name : route_middleware) {
         Middleware* middleware = get_named_middleware(middleware_name);
         if (middleware) {
+            route_instances.push_back(middleware);
             auto type = middleware->type();
             if (!type.empty()) {
                 route_middleware_types.insert(type);
@@ -347,14 +438,59 @@ MiddlewareResult Pipeline::execute_request(RequestContext& ctx) {
         }
     }
 
-    // Execute global middleware (skip if route provides same type - REPLACEMENT)
-    for (auto& middleware : middleware_) {
+    // Global middleware first (skip if route provides same type), then
+    // per-route instances - same order the interpreted loops used. Each
+    // phase keeps only middleware that actually implements it.
+    for (const auto& middleware : middleware_) {
         auto type = middleware->type();
         if (!type.empty() && route_middleware_types.contains(type)) {
-            // Skip: route middleware will override this global middleware
-            continue;
+            continue;  // Route middleware overrides this global middleware
         }
+        if (middleware->handles_request()) {
+            chain.request.push_back(middleware.get());
+        }
+        if (middleware->handles_response()) {
+            chain.response.push_back(middleware.get());
+        }
+    }
+    for (Middleware* middleware : route_instances) {
+        if (middleware->handles_request()) {
+            chain.request.push_back(middleware);
+        }
+        if (middleware->handles_response()) {
+            chain.response.push_back(middleware);
+        }
+    }
 
+    return chain;
+}
+
+const Pipeline::CompiledChain& Pipeline::get_chain(const RouteMatch& route_match) {
+    // Routes without per-route middleware share one global chain
+    if (route_match.middleware.empty()) {
+        if (!global_chain_valid_) {
+            global_chain_ = compile_chain({});
+            global_chain_valid_ = true;
+        }
+        return global_chain_;
+    }
+
+    // Keyed by the route's dense metrics ID: first request on a route
+    // pays the compile, every later one is a map hit
+    uint32_t route_id = route_match.metrics_id;
+    auto it = route_chains_.find(route_id);
+    if (it != route_chains_.end()) {
+        return it->second;
+    }
+
+    auto [iter, inserted] = route_chains_.emplace(route_id, compile_chain(route_match.middleware));
+    return iter->second;
+}
+
+MiddlewareResult Pipeline::execute_request(RequestContext& ctx) {
+    const CompiledChain& chain = get_chain(ctx.route_match);
+
+    for (Middleware* middleware : chain.request) {
         MiddlewareResult result = middleware->process_request(ctx);
 
         if (result == MiddlewareResult::Stop) {
@@ -366,46 +502,13 @@ MiddlewareResult Pipeline::execute_request(RequestContext& ctx) {
         }
     }
 
-    // Execute per-route middleware
-    for (const auto& middleware_name : ctx.route_match.middleware) {
-        Middleware* middleware = get_named_middleware(middleware_name);
-        if (middleware) {
-            MiddlewareResult result = middleware->process_request(ctx);
-
-            if (result == MiddlewareResult::Stop) {
-                return MiddlewareResult::Stop;
-            }
-
-            if (result == MiddlewareResult::Error || ctx.has_error) {
-                return MiddlewareResult::Error;
-            }
-        }
-    }
-
     return MiddlewareResult::Continue;
 }
 
 MiddlewareResult Pipeline::execute_response(ResponseContext& ctx) {
-    // Collect types of per-route middleware for override detection (REPLACEMENT model)
-    titan::core::fast_set<std::string_view> route_middleware_types;
-    for (const auto& middleware_name : ctx.route_match.middleware) {
-        Middleware* middleware = get_named_middleware(middleware_name);
-        if (middleware) {
-            auto type = middleware->type();
-            if (!type.empty()) {
-                route_middleware_types.insert(type);
-            }
-        }
-    }
-
-    // Execute global middleware (skip if route provides same type - REPLACEMENT)
-    for (auto& middleware : middleware_) {
-        auto type = middleware->type();
-        if (!type.empty() && route_middleware_types.contains(type)) {
-            // Skip: route middleware will override this global middleware
-            continue;
-        }
+    const CompiledChain& chain = get_chain(ctx.route_match);
 
+    for (Middleware* middleware : chain.response) {
         MiddlewareResult result = middleware->process_response(ctx);
 
         if (result == MiddlewareResult::Stop) {
@@ -417,22 +520,6 @@ MiddlewareResult Pipeline::execute_response(ResponseContext& ctx) {
         }
     }
 
-    // Execute per-route middleware
-    for (const auto& middleware_name : ctx.route_match.middleware) {
-        Middleware* middleware = get_named_middleware(middleware_name);
-        if (middleware) {
-            MiddlewareResult result = middleware->process_response(ctx);
-
-            if (result == MiddlewareResult::Stop) {
-                return MiddlewareResult::Stop;
-            }
-
-            if (result == MiddlewareResult::Error) {
-                return MiddlewareResult::Error;
-            }
-        }
-    }
-
     return MiddlewareResult::Continue;
 }
 
@@ -21,11 +21,13 @@
 
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
 #include "../http/http.hpp"
 #include "core/containers.hpp"
+#include "core/memory.hpp"
 #include "rate_limit.hpp"
 #include "router.hpp"
 #include "upstream.hpp"
@@ -67,6 +69,25 @@ struct RequestContext {
     // Header transformations (zero-copy optimization for header modifications)
     std::optional<HeaderTransformations> header_transforms;
 
+    // Per-request arena (owned by the Connection, reset at request
+    // boundaries). Middlewares should place transient strings here instead
+    // of heap-allocating; anything that must survive the request phase
+    // (async proxy state) still needs an owned copy.
+    core::Arena* arena = nullptr;
+
+    // Arena-backed rewrites set by TransformMiddleware and consumed while
+    // building the backend request, within the same request phase
+    std::string_view transformed_path;
+    std::string_view transformed_query;
+
+    // Canned response fast path: a middleware that fully handles a
+    // request (e.g. CORS preflight) points these at pre-serialized
+    // HTTP/1.1 bytes it owns; the server writes the matching Connection
+    // variant straight to the socket and skips response serialization.
+    // HTTP/2 paths ignore these and frame `response` as usual.
+    std::span<const uint8_t> canned_response;        // Connection: keep-alive
+    std::span<const uint8_t> canned_response_close;  // Connection: close
+
     // Timing
     std::chrono::steady_clock::time_point start_time;
 
@@ -90,6 +111,13 @@ struct RequestContext {
     void set_metadata(std::string key, std::string value) {
         metadata[std::move(key)] = std::move(value);
     }
+
+    /// Helper: Copy a transient string into the per-request arena.
+    /// The returned view is valid until the arena resets (next request on
+    /// this connection); falls back to an empty view without an arena.
+    [[nodiscard]] std::string_view arena_copy(std::string_view str) const {
+        return arena ? arena->copy_string(str) : std::string_view{};
+    }
 };
 
 /// Response context (passed through response middleware chain)
@@ -166,6 +194,14 @@ public:
     /// Returns empty string for middleware that doesn't support overrides
     [[nodiscard]] virtual std::string_view type() const { return ""; }
 
+    /// Phase participation - lets the pipeline drop this middleware from
+    /// compiled per-route chains for phases it doesn't implement, so a
+    /// no-op virtual call is never made. Defaults are conservative
+    /// (participate in both); overrides must match which process_*
+    /// methods are actually implemented.
+    [[nodiscard]] virtual bool handles_request() const { return true; }
+    [[nodiscard]] virtual bool handles_response() const { return true; }
+
     /// Whether this middleware applies to WebSocket upgrade requests
     /// Override to return true if middleware should process WebSocket upgrades
     /// Default implementation: do not apply to WebSocket
@@ -185,9 +221,14 @@ class LoggingMiddleware : public Middleware {
 public:
     MiddlewareResult process_response(ResponseContext& ctx) override;
     std::string_view name() const override { return "LoggingMiddleware"; }
+    bool handles_request() const override { return false; }
 };
 
 /// CORS middleware
+/// Preflights are deterministic per config, so the full 204 response is
+/// serialized once at construction - an OPTIONS hit hands the server
+/// canned bytes (RequestContext::canned_response) and stops the
+/// pipeline. Origin checks go through a precomputed hash set.
 class CorsMiddleware : public Middleware {
 public:
     struct Config {
@@ -207,37 +248,58 @@ public:
               max_age(86400) {}
     };
 
-    CorsMiddleware() : config_() {}
-    explicit CorsMiddleware(Config config) : config_(std::move(config)) {}
+    CorsMiddleware() : CorsMiddleware(Config{}) {}
+    explicit CorsMiddleware(Config config);
 
     MiddlewareResult process_request(RequestContext& ctx) override;
     std::string_view name() const override { return "CorsMiddleware"; }
     std::string_view type() const override { return "cors"; }
+    bool handles_response() const override { return false; }
 
     // WebSocket support (CRITICAL for CSWSH prevention)
     bool applies_to_websocket() const override { return true; }
     MiddlewareResult process_websocket_upgrade(RequestContext& ctx) override;
 
 private:
+    /// Add CORS headers to the regular response (non-preflight requests,
+    /// and the fallback fields behind the canned preflight)
+    void add_cors_headers(RequestContext& ctx) const;
+
     Config config_;
+
+    // Precomputed at construction - config is immutable per instance
+    // (reloads build a fresh pipeline), so nothing here is rebuilt or
+    // allocated per request
+    titan::core::fast_set<std::string> origin_set_;  // Exact-match origins
+    bool allow_any_origin_ = false;                  // "*" present
+    std::string methods_joined_;                     // "GET, POST, ..."
+    std::string headers_joined_;
+    std::string max_age_str_;
+    std::string preflight_keepalive_;  // Serialized 204, Connection: keep-alive
+    std::string preflight_close_;      // Same bytes, Connection: close
 };
 
-/// Rate limiting middleware (thread-local token bucket)
+/// Rate limiting middleware (thread-local GCRA, keyed by client IP)
 class RateLimitMiddleware : public Middleware {
 public:
     struct Config {
         size_t requests_per_second;
         size_t burst_size;
 
+        // Cluster mode: enforce against the process-wide shared table
+        // instead of this worker's local limiter (see SharedGcraTable)
+        SharedGcraTable* shared_table = nullptr;
+
         Config() : requests_per_second(100), burst_size(200) {}
     };
 
-    RateLimitMiddleware();
+    RateLimitMiddleware() : RateLimitMiddleware(Config{}) {}
     explicit RateLimitMiddleware(Config config);
 
     MiddlewareResult process_request(RequestContext& ctx) override;
     std::string_view name() const override { return "RateLimitMiddleware"; }
     std::string_view type() const override { return "rate_limit"; }
+    bool handles_response() const override { return false; }
 
     // WebSocket support (limit WebSocket connection attempts)
     bool applies_to_websocket() const override { return true; }
@@ -245,7 +307,7 @@ public:
 
 private:
     Config config_;
-    std::unique_ptr<ThreadLocalRateLimiter> limiter_;
+    GcraLimiter limiter_;
 };
 
 /// Proxy middleware (validates and routes to upstream)
@@ -266,6 +328,12 @@ private:
 };
 
 /// Middleware pipeline
+/// Per-route chains are compiled on first hit: override resolution
+/// (REPLACEMENT model) and no-op filtering happen once, leaving dense
+/// arrays of middleware that actually implement each phase. A bare proxy
+/// route executes zero no-op virtual calls and allocates nothing per
+/// request. Pipelines are per-worker (single-threaded), so the lazy
+/// cache fills need no locking; a config reload builds a fresh pipeline.
 class Pipeline {
 public:
     Pipeline() = default;
@@ -302,6 +370,7 @@ public:
     void clear() {
         middleware_.clear();
         named_middleware_.clear();
+        invalidate_chains();
     }
 
     /// Register named middleware (for per-route execution)
@@ -311,8 +380,34 @@ public:
     [[nodiscard]] Middleware* get_named_middleware(const std::string& name) const;
 
 private:
+    /// A route's resolved middleware chains: globals (minus overridden
+    /// types) followed by per-route instances, filtered per phase
+    struct CompiledChain {
+        std::vector<Middleware*> request;
+        std::vector<Middleware*> response;
+    };
+
+    /// Chain for this request's route, compiling on first hit. Routes
+    /// without per-route middleware share the global chain.
+    [[nodiscard]] const CompiledChain& get_chain(const RouteMatch& route_match);
+
+    /// Resolve overrides and drop phase no-ops for one middleware list
+    [[nodiscard]] CompiledChain compile_chain(
+        const std::vector<std::string>& route_middleware) const;
+
+    /// Drop all compiled chains (middleware set changed)
+    void invalidate_chains() {
+        global_chain_ = CompiledChain{};
+        global_chain_valid_ = false;
+        route_chains_.clear();
+    }
+
     std::vector<std::unique_ptr<Middleware>> middleware_;
     titan::core::fast_map<std::string, std::unique_ptr<Middleware>> named_middleware_;
+
+    CompiledChain global_chain_;
+    bool global_chain_valid_ = false;
+    titan::core::fast_map<uint32_t, CompiledChain> route_chains_;  // Keyed by metrics_id
 };
 
 /// Pipeline builder (fluent API)
@@ -345,6 +440,7 @@ public:
     MiddlewareResult process_request(RequestContext& ctx) override { return func_(ctx); }
 
     std::string_view name() const override { return name_; }
+    bool handles_response() const override { return false; }
 
 private:
     MiddlewareFunc func_;
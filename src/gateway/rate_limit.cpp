@@ -19,113 +19,90 @@
 #include "rate_limit.hpp"
 
 #include <algorithm>
+#include <bit>
+#include <chrono>
+#include <mutex>
 
 namespace titan::gateway {
 
-// TokenBucket implementation
-
-TokenBucket::TokenBucket(uint64_t capacity, uint64_t refill_rate)
-    : capacity_(capacity),
-      refill_rate_(refill_rate),
-      tokens_(capacity),
-      last_refill_(std::chrono::steady_clock::now()) {}
-
-TokenBucket::TokenBucket(TokenBucket&& other) noexcept
-    : capacity_(other.capacity_),
-      refill_rate_(other.refill_rate_),
-      tokens_(other.tokens_),
-      last_refill_(other.last_refill_) {}
-
-TokenBucket& TokenBucket::operator=(TokenBucket&& other) noexcept {
-    if (this != &other) {
-        // capacity_ and refill_rate_ are const, can't reassign
-        // This is intentional - buckets with different configs shouldn't be moved
-        tokens_ = other.tokens_;
-        last_refill_ = other.last_refill_;
-    }
-    return *this;
-}
-
-bool TokenBucket::consume(uint64_t tokens) {
-    refill();
-
-    if (tokens_ >= tokens) {
-        tokens_ -= tokens;
-        return true;  // Successfully consumed
-    }
+namespace {
 
-    return false;  // Not enough tokens
+/// Steady-clock nanoseconds (monotonic; GCRA only needs differences)
+[[nodiscard]] uint64_t now_ns() noexcept {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
 }
 
-void TokenBucket::reset() noexcept {
-    tokens_ = capacity_;
-    last_refill_ = std::chrono::steady_clock::now();
-}
-
-void TokenBucket::refill() {
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - last_refill_);
-
-    if (elapsed.count() <= 0) {
-        return;  // No time has passed
+/// FNV-1a with a murmur3 finalizer: slot indexing needs well-mixed high
+/// and low bits, which raw FNV doesn't give for short keys like IPs
+[[nodiscard]] uint64_t hash_key(std::string_view key) noexcept {
+    uint64_t hash = 1469598103934665603ULL;
+    for (char c : key) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ULL;
     }
-
-    // Calculate tokens to add
-    // tokens = (elapsed_ms * refill_rate) / 1000
-    uint64_t tokens_to_add = (static_cast<uint64_t>(elapsed.count()) * refill_rate_) / 1000;
-
-    if (tokens_to_add == 0) {
-        return;  // Not enough time elapsed to add a token
-    }
-
-    // Update timestamp
-    last_refill_ = now;
-
-    // Add tokens (capped at capacity)
-    tokens_ = std::min(tokens_ + tokens_to_add, capacity_);
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
 }
 
-// ThreadLocalRateLimiter implementation
-
-ThreadLocalRateLimiter::ThreadLocalRateLimiter(uint64_t capacity, uint64_t refill_rate)
-    : capacity_(capacity), refill_rate_(refill_rate) {}
-
-bool ThreadLocalRateLimiter::allow(std::string_view key, uint64_t tokens) {
-    std::string key_str{key};
+}  // namespace
 
-    // Find or create bucket for this key (thread-local map)
-    auto it = buckets_.find(key_str);
-    if (it == buckets_.end()) {
-        // Create new bucket
-        TokenBucket bucket(capacity_, refill_rate_);
-        bool allowed = bucket.consume(tokens);
-        buckets_.emplace(std::move(key_str), std::move(bucket));
-        return allowed;
-    }
+bool GcraLimiter::allow(std::string_view key) {
+    // try_emplace: a new key starts cold (tat = 0, full burst available)
+    auto [it, inserted] = tat_.try_emplace(std::string(key), 0);
+    return gcra_allow(it->second, now_ns(), params_);
+}
 
-    // Use existing bucket
-    return it->second.consume(tokens);
+void GcraLimiter::reset(std::string_view key) {
+    tat_.erase(std::string(key));
 }
 
-void ThreadLocalRateLimiter::reset(std::string_view key) {
-    std::string key_str{key};
-    auto it = buckets_.find(key_str);
-    if (it != buckets_.end()) {
-        it->second.reset();
+// SharedGcraTable implementation
+
+SharedGcraTable::SharedGcraTable(GcraParams params, size_t slots)
+    : params_(params),
+      slots_(std::make_unique<std::atomic<uint64_t>[]>(std::bit_ceil(std::max(slots, size_t{1})))),
+      slot_mask_(std::bit_ceil(std::max(slots, size_t{1})) - 1) {}
+
+bool SharedGcraTable::allow(std::string_view key) noexcept {
+    auto& slot = slots_[hash_key(key) & slot_mask_];
+    uint64_t now = now_ns();
+
+    uint64_t tat = slot.load(std::memory_order_relaxed);
+    for (;;) {
+        if (tat > now + params_.burst_tolerance_ns) {
+            return false;
+        }
+        uint64_t next = (tat > now ? tat : now) + params_.emission_interval_ns;
+        if (slot.compare_exchange_weak(tat, next, std::memory_order_relaxed,
+                                       std::memory_order_relaxed)) {
+            return true;
+        }
+        // CAS failure reloads tat: another worker admitted a request for
+        // this slot first - re-run conformance against the new TAT
     }
 }
 
-void ThreadLocalRateLimiter::clear() {
-    buckets_.clear();
-}
+SharedGcraTable* acquire_shared_gcra_table(std::string_view name, GcraParams params) {
+    static std::mutex registry_mutex;
+    static titan::core::fast_map<std::string, std::unique_ptr<SharedGcraTable>> registry;
+
+    // Params are part of the key so a reload that changes a limiter's
+    // numbers gets a fresh table instead of mutating one in use
+    std::string key = std::string(name) + "|" + std::to_string(params.emission_interval_ns) + "|" +
+                      std::to_string(params.burst_tolerance_ns);
 
-uint64_t ThreadLocalRateLimiter::available(std::string_view key) const {
-    std::string key_str{key};
-    auto it = buckets_.find(key_str);
-    if (it == buckets_.end()) {
-        return capacity_;  // New key would have full capacity
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    auto it = registry.find(key);
+    if (it == registry.end()) {
+        it = registry.emplace(std::move(key), std::make_unique<SharedGcraTable>(params)).first;
     }
-    return it->second.available();
+    return it->second.get();
 }
 
 }  // namespace titan::gateway
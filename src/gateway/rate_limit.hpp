@@ -15,12 +15,16 @@
  */
 
 // Titan Rate Limiting - Header
-// Thread-local token bucket algorithm (lock-free, approximate limits)
+// GCRA (virtual scheduling): the entire per-key state is one 64-bit
+// theoretical-arrival-time, updated with a compare and an add - no bucket
+// struct, no refill math. Limiters are per-worker (shared-nothing), so the
+// word needs no atomics, matching the rest of the thread-local hot path.
 
 #pragma once
 
-#include <chrono>
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <string_view>
 
@@ -28,86 +32,121 @@
 
 namespace titan::gateway {
 
-/// Token bucket for rate limiting (thread-local, no synchronization)
-class TokenBucket {
+/// GCRA limit parameters, precompiled from requests-per-second + burst at
+/// config-compile time so the per-request path does no division
+struct GcraParams {
+    uint64_t emission_interval_ns = 0;  // T = 1s / rate (0 = unlimited)
+    uint64_t burst_tolerance_ns = 0;    // tau = T * (burst - 1)
+
+    /// Compile config numbers into nanosecond parameters. A rate of 0
+    /// yields unlimited parameters (every request conforms).
+    [[nodiscard]] static GcraParams compile(uint64_t requests_per_second,
+                                            uint64_t burst_size) noexcept {
+        GcraParams params;
+        if (requests_per_second == 0) {
+            return params;
+        }
+        params.emission_interval_ns = 1'000'000'000ULL / requests_per_second;
+        if (params.emission_interval_ns == 0) {
+            params.emission_interval_ns = 1;  // >1e9 rps: limit at clock resolution
+        }
+        if (burst_size > 1) {
+            params.burst_tolerance_ns = params.emission_interval_ns * (burst_size - 1);
+        }
+        return params;
+    }
+};
+
+/// GCRA conformance test on a single theoretical-arrival-time word.
+/// Allows when TAT has not run further than the burst tolerance ahead of
+/// now; on allow, TAT advances by one emission interval. A cold key
+/// (tat = 0) admits a full burst instantly, then settles at the rate.
+[[nodiscard]] inline bool gcra_allow(uint64_t& tat, uint64_t now_ns,
+                                     const GcraParams& params) noexcept {
+    if (tat > now_ns + params.burst_tolerance_ns) {
+        return false;
+    }
+    tat = (tat > now_ns ? tat : now_ns) + params.emission_interval_ns;
+    return true;
+}
+
+/// Per-key GCRA limiter (thread-local, one per worker - no synchronization)
+/// Keys are request identities (client IPs); each key costs one map slot
+/// holding a single uint64_t.
+class GcraLimiter {
 public:
-    /// Create a token bucket
-    /// @param capacity Maximum number of tokens (burst size)
-    /// @param refill_rate Tokens added per second
-    TokenBucket(uint64_t capacity, uint64_t refill_rate);
+    /// @param requests_per_second Sustained rate
+    /// @param burst_size Requests a cold key may issue instantly
+    GcraLimiter(uint64_t requests_per_second, uint64_t burst_size)
+        : params_(GcraParams::compile(requests_per_second, burst_size)) {}
 
-    ~TokenBucket() = default;
+    ~GcraLimiter() = default;
 
-    // Non-copyable, movable
-    TokenBucket(const TokenBucket&) = delete;
-    TokenBucket& operator=(const TokenBucket&) = delete;
-    TokenBucket(TokenBucket&& other) noexcept;
-    TokenBucket& operator=(TokenBucket&& other) noexcept;
+    // Non-copyable, non-movable
+    GcraLimiter(const GcraLimiter&) = delete;
+    GcraLimiter& operator=(const GcraLimiter&) = delete;
 
-    /// Try to consume N tokens
-    /// @param tokens Number of tokens to consume (default 1)
-    /// @return true if tokens were consumed, false if rate limit exceeded
-    [[nodiscard]] bool consume(uint64_t tokens = 1);
+    /// Check if a request should be allowed for a key (no locks)
+    /// @return true if request conforms, false if rate limited
+    [[nodiscard]] bool allow(std::string_view key);
 
-    /// Get current number of available tokens
-    [[nodiscard]] uint64_t available() const noexcept { return tokens_; }
+    /// Forget rate limit state for a specific key
+    void reset(std::string_view key);
 
-    /// Get bucket capacity
-    [[nodiscard]] uint64_t capacity() const noexcept { return capacity_; }
+    /// Clear all keys
+    void clear() { tat_.clear(); }
 
-    /// Get refill rate (tokens per second)
-    [[nodiscard]] uint64_t refill_rate() const noexcept { return refill_rate_; }
+    /// Get number of tracked keys
+    [[nodiscard]] size_t key_count() const noexcept { return tat_.size(); }
 
-    /// Reset the bucket to full capacity
-    void reset() noexcept;
+    /// Precompiled limit parameters
+    [[nodiscard]] const GcraParams& params() const noexcept { return params_; }
 
 private:
-    /// Refill tokens based on elapsed time (no atomics needed - thread-local)
-    void refill();
-
-    const uint64_t capacity_;     // Maximum tokens (burst size)
-    const uint64_t refill_rate_;  // Tokens per second
-    uint64_t tokens_;             // Current available tokens (no atomic - thread-local)
-    std::chrono::steady_clock::time_point last_refill_;
+    const GcraParams params_;
+    titan::core::fast_map<std::string, uint64_t> tat_;  // key -> TAT (ns, steady clock)
 };
 
-/// Thread-local rate limiter with per-key buckets
-/// Each worker thread has its own instance - no synchronization needed
-class ThreadLocalRateLimiter {
+/// Process-wide GCRA table shared by every worker: a fixed power-of-two
+/// array of atomic TAT words indexed by key hash. Enforcement is exact
+/// across workers within a node - no per-worker rate splitting, so a
+/// client hammering one worker and a client spread over all of them see
+/// the same limit. Distinct keys colliding into a slot share a limit; at
+/// the default 64K slots that error is far below the accuracy the limits
+/// are configured with.
+///
+/// The hot path is one hash plus one CAS on the key's slot. The cache
+/// line only bounces when the same client is concurrently hitting
+/// several workers, which is exactly when coordination has to happen.
+class SharedGcraTable {
 public:
-    /// Create a rate limiter
-    /// @param capacity Token bucket capacity (burst size)
-    /// @param refill_rate Tokens per second
-    ThreadLocalRateLimiter(uint64_t capacity, uint64_t refill_rate);
+    static constexpr size_t kDefaultSlots = 1 << 16;  // 512KB of TAT words
 
-    ~ThreadLocalRateLimiter() = default;
+    explicit SharedGcraTable(GcraParams params, size_t slots = kDefaultSlots);
 
-    // Non-copyable, non-movable
-    ThreadLocalRateLimiter(const ThreadLocalRateLimiter&) = delete;
-    ThreadLocalRateLimiter& operator=(const ThreadLocalRateLimiter&) = delete;
+    // Non-copyable, non-movable (workers hold raw pointers)
+    SharedGcraTable(const SharedGcraTable&) = delete;
+    SharedGcraTable& operator=(const SharedGcraTable&) = delete;
 
-    /// Check if a request should be allowed for a key (no locks)
-    /// @param key Identifier (e.g., IP address, API key)
-    /// @param tokens Number of tokens to consume (default 1)
-    /// @return true if request is allowed, false if rate limited
-    [[nodiscard]] bool allow(std::string_view key, uint64_t tokens = 1);
-
-    /// Reset rate limit for a specific key
-    void reset(std::string_view key);
+    /// Check if a request should be allowed for a key (lock-free)
+    [[nodiscard]] bool allow(std::string_view key) noexcept;
 
-    /// Clear all buckets
-    void clear();
-
-    /// Get number of tracked keys
-    [[nodiscard]] size_t key_count() const noexcept { return buckets_.size(); }
-
-    /// Get available tokens for a key (capacity if key not found)
-    [[nodiscard]] uint64_t available(std::string_view key) const;
+    /// Precompiled limit parameters
+    [[nodiscard]] const GcraParams& params() const noexcept { return params_; }
 
 private:
-    const uint64_t capacity_;
-    const uint64_t refill_rate_;
-    titan::core::fast_map<std::string, TokenBucket> buckets_;  // Thread-local, no mutex
+    const GcraParams params_;
+    std::unique_ptr<std::atomic<uint64_t>[]> slots_;
+    size_t slot_mask_;
 };
 
+/// Acquire the process-wide shared table for a named limiter, creating it
+/// on first use. Pipeline-build time only (mutex-guarded, never on the
+/// request path); every worker passes identical params for a given name,
+/// so all of them receive the same table. A config reload that changes a
+/// limiter's parameters yields a fresh table (keyed by name + params);
+/// superseded tables are retained for the process lifetime, same as
+/// displaced route-metrics tables.
+[[nodiscard]] SharedGcraTable* acquire_shared_gcra_table(std::string_view name, GcraParams params);
+
 }  // namespace titan::gateway
@@ -46,18 +46,94 @@ Router::Router(Router&&) noexcept = default;
 Router& Router::operator=(Router&&) noexcept = default;
 
 void Router::add_route(Route route) {
+    // Dense metrics ID = position in routes_; stable until the next
+    // config compile builds a fresh Router
+    route.metrics_id = static_cast<uint32_t>(routes_.size());
     insert_route(route);
     routes_.push_back(std::move(route));
+    compiled_ = false;  // Compiled table is stale until the next compile()
 }
 
 RouteMatch Router::match(http::Method method, std::string_view path) const {
     std::vector<RouteParam> params;
+    if (compiled_) {
+        return search_compiled(0, path, method, params);
+    }
     return search(root_.get(), path, method, params);
 }
 
 void Router::clear() {
     root_ = std::make_unique<RadixNode>();
     routes_.clear();
+    compiled_nodes_.clear();
+    compiled_first_byte_.clear();
+    compiled_handlers_.clear();
+    compiled_blob_.clear();
+    compiled_ = false;
+}
+
+void Router::compile() {
+    compiled_nodes_.clear();
+    compiled_first_byte_.clear();
+    compiled_handlers_.clear();
+    compiled_blob_.clear();
+
+    // Map handler_id -> routes_ index so compiled handlers reference the
+    // canonical Route (node handlers are per-node copies)
+    titan::core::fast_map<std::string_view, uint32_t> route_index;
+    route_index.reserve(routes_.size());
+    for (uint32_t i = 0; i < routes_.size(); ++i) {
+        route_index[routes_[i].handler_id] = i;
+    }
+
+    // BFS order makes each node's children contiguous in the array
+    std::vector<const RadixNode*> order;
+    order.push_back(root_.get());
+    for (size_t i = 0; i < order.size(); ++i) {
+        for (const auto& child : order[i]->children) {
+            order.push_back(child.get());
+        }
+    }
+
+    compiled_nodes_.resize(order.size());
+    compiled_first_byte_.resize(order.size(), 0);
+
+    uint32_t next_child = 1;  // Index 0 is the root
+    for (size_t i = 0; i < order.size(); ++i) {
+        const RadixNode* node = order[i];
+        CompiledNode& record = compiled_nodes_[i];
+
+        record.prefix_offset = static_cast<uint32_t>(compiled_blob_.size());
+        record.prefix_len = static_cast<uint16_t>(node->prefix.size());
+        compiled_blob_.append(node->prefix);
+
+        record.param_name_offset = static_cast<uint32_t>(compiled_blob_.size());
+        record.param_name_len = static_cast<uint16_t>(node->param_name.size());
+        compiled_blob_.append(node->param_name);
+
+        record.is_param = node->is_param;
+        record.is_wildcard = node->is_wildcard;
+
+        record.children_begin = next_child;
+        record.children_count = static_cast<uint16_t>(node->children.size());
+        next_child += static_cast<uint32_t>(node->children.size());
+
+        record.handlers_begin = static_cast<uint32_t>(compiled_handlers_.size());
+        for (const auto& [method, route] : node->handlers) {
+            auto it = route_index.find(std::string_view(route.handler_id));
+            if (it != route_index.end()) {
+                compiled_handlers_.push_back({method, it->second});
+            }
+        }
+        record.handlers_count =
+            static_cast<uint16_t>(compiled_handlers_.size() - record.handlers_begin);
+
+        compiled_first_byte_[i] = node->prefix.empty()
+                                      ? 0
+                                      : static_cast<uint8_t>(node->prefix.front());
+    }
+
+    compiled_ = true;
 }
 
 Router::Stats Router::get_stats() const {
@@ -200,6 +276,7 @@ RouteMatch Router::search(RadixNode* node, std::string_view path, http::Method m
         if (it != node->handlers.end()) {
             RouteMatch match;
             match.handler_id = it->second.handler_id;
+            match.metrics_id = it->second.metrics_id;
             match.upstream_name = it->second.upstream_name;
             match.auth_required = it->second.auth_required;
             match.required_scopes = it->second.required_scopes;
@@ -216,6 +293,7 @@ RouteMatch Router::search(RadixNode* node, std::string_view path, http::Method m
         if (any_it != node->handlers.end()) {
             RouteMatch match;
             match.handler_id = any_it->second.handler_id;
+            match.metrics_id = any_it->second.metrics_id;
             match.upstream_name = any_it->second.upstream_name;
             match.auth_required = any_it->second.auth_required;
             match.required_scopes = any_it->second.required_scopes;
@@ -262,6 +340,7 @@ RouteMatch Router::search(RadixNode* node, std::string_view path, http::Method m
             if (it != child->handlers.end()) {
                 RouteMatch match;
                 match.handler_id = it->second.handler_id;
+                match.metrics_id = it->second.metrics_id;
                 match.upstream_name = it->second.upstream_name;
                 match.auth_required = it->second.auth_required;
                 match.required_scopes = it->second.required_scopes;
@@ -295,6 +374,116 @@ RouteMatch Router::search(RadixNode* node, std::string_view path, http::Method m
     return {};
 }
 
+RouteMatch Router::make_match(const Route& route, const std::vector<RouteParam>& params,
+                              std::string_view wildcard) const {
+    RouteMatch match;
+    match.handler_id = route.handler_id;
+    match.metrics_id = route.metrics_id;
+    match.upstream_name = route.upstream_name;
+    match.auth_required = route.auth_required;
+    match.required_scopes = route.required_scopes;
+    match.required_roles = route.required_roles;
+    match.transform_config = route.transform_config;
+    match.compression_config = route.compression_config;
+    match.middleware = route.middleware;
+    match.static_root = route.static_root;
+    match.mirror_upstream = route.mirror_upstream;
+    match.ws_broadcast_channel = route.ws_broadcast_channel;
+    match.mirror_sample_percent = route.mirror_sample_percent;
+    match.params = params;
+    match.wildcard = wildcard;
+    return match;
+}
+
+RouteMatch Router::search_compiled(uint32_t node_index, std::string_view path, http::Method method,
+                                   std::vector<RouteParam>& params) const {
+    const CompiledNode& node = compiled_nodes_[node_index];
+
+    auto blob = [this](uint32_t offset, uint16_t len) {
+        return std::string_view(compiled_blob_).substr(offset, len);
+    };
+
+    // Exact method first, UNKNOWN (any-method) as fallback - same
+    // precedence as the tree walk
+    auto find_handler = [this](const CompiledNode& n, http::Method m) -> const Route* {
+        const Route* any_method = nullptr;
+        for (uint32_t h = n.handlers_begin; h < n.handlers_begin + n.handlers_count; ++h) {
+            if (compiled_handlers_[h].method == m) {
+                return &routes_[compiled_handlers_[h].route_index];
+            }
+            if (compiled_handlers_[h].method == http::Method::UNKNOWN) {
+                any_method = &routes_[compiled_handlers_[h].route_index];
+            }
+        }
+        return any_method;
+    };
+
+    // Terminal: check handlers on this node
+    if (path.empty() || path == "/") {
+        if (const Route* route = find_handler(node, method)) {
+            return make_match(*route, params);
+        }
+        return {};
+    }
+
+    // Strip leading slash
+    if (path[0] == '/') {
+        path.remove_prefix(1);
+    }
+
+    // Extract next segment (use SIMD for long paths)
+    size_t slash_pos = std::string_view::npos;
+    if (path.size() >= 16) {
+        const char* slash_ptr = http::simd::find_char(path.data(), path.size(), '/');
+        if (slash_ptr) {
+            slash_pos = slash_ptr - path.data();
+        }
+    } else {
+        slash_pos = path.find('/');
+    }
+    std::string_view segment = path.substr(0, slash_pos);
+    std::string_view remaining =
+        (slash_pos != std::string_view::npos) ? path.substr(slash_pos) : std::string_view{};
+
+    // Children are one contiguous record range; the parallel first-byte
+    // table rejects static children without reading their prefix bytes
+    for (uint32_t c = 0; c < node.children_count; ++c) {
+        uint32_t child_index = node.children_begin + c;
+        const CompiledNode& child = compiled_nodes_[child_index];
+
+        if (child.is_wildcard) {
+            if (const Route* route = find_handler(child, method)) {
+                return make_match(*route, params, path);
+            }
+        } else if (child.is_param) {
+            params.push_back({blob(child.param_name_offset, child.param_name_len), segment});
+            auto result = search_compiled(child_index, remaining, method, params);
+            if (result.matched()) {
+                return result;
+            }
+            params.pop_back();  // Backtrack
+        } else {
+            // First-byte dispatch
+            if (child.prefix_len > 0 &&
+                (segment.empty() ||
+                 compiled_first_byte_[child_index] != static_cast<uint8_t>(segment.front()))) {
+                continue;
+            }
+            std::string_view prefix = blob(child.prefix_offset, child.prefix_len);
+            if (segment.starts_with(prefix)) {
+                std::string_view next_path = path;
+                next_path.remove_prefix(prefix.size());
+                auto result = search_compiled(child_index, next_path, method, params);
+                if (result.matched()) {
+                    return result;
+                }
+            }
+        }
+    }
+
+    return {};
+}
+
 size_t Router::common_prefix_length(std::string_view a, std::string_view b) {
     size_t min_len = std::min(a.size(), b.size());
     return http::simd::common_prefix_length(a.data(), b.data(), min_len);
@@ -38,9 +38,13 @@ struct RouteParam {
     std::string_view value;  // Actual value from request path
 };
 
+/// Sentinel for "no metrics slot" (static responses, unmatched paths)
+inline constexpr uint32_t kInvalidRouteMetricsId = UINT32_MAX;
+
 /// Match result from router
 struct RouteMatch {
     std::string_view handler_id;               // Unique identifier for matched route
+    uint32_t metrics_id = kInvalidRouteMetricsId;  // Dense per-route metrics index
     std::vector<RouteParam> params;            // Extracted path parameters
     std::string_view wildcard;                 // Wildcard match (if any)
     std::string_view upstream_name;            // Upstream name for this route
@@ -57,6 +61,17 @@ struct RouteMatch {
     // Per-route middleware
     std::vector<std::string> middleware;
 
+    // Static file root (non-empty for static file routes)
+    std::string_view static_root;
+
+    // Shadow mirroring (non-empty upstream name enables it)
+    std::string_view mirror_upstream;
+    uint32_t mirror_sample_percent = 100;
+
+    // WebSocket broadcast channel (non-empty = terminate locally and
+    // subscribe instead of proxying - see http/ws_broadcast.hpp)
+    std::string_view ws_broadcast_channel;
+
     [[nodiscard]] bool matched() const noexcept { return !handler_id.empty(); }
 
     // Helper: Get parameter value by name
@@ -70,6 +85,11 @@ struct Route {
     std::string handler_id;  // Unique handler identifier
     uint32_t priority = 0;   // Higher priority = checked first
 
+    // Dense ID assigned by Router::add_route (position in routes()); indexes
+    // the flat per-route arrays in ThreadMetrics so hot-path stat recording
+    // is an array store, never a string-keyed lookup
+    uint32_t metrics_id = kInvalidRouteMetricsId;
+
     // Backend configuration (for proxy routes)
     std::string upstream_name;  // Name of upstream group
     std::string rewrite_path;   // Optional path rewriting
@@ -87,6 +107,19 @@ struct Route {
 
     // Per-route middleware
     std::vector<std::string> middleware;
+
+    // Static file root: serve files from this directory instead of
+    // proxying (wildcard remainder selects the file)
+    std::string static_root;
+
+    // Shadow mirroring: duplicate a sample of this route's requests to
+    // this upstream, fire-and-forget
+    std::string mirror_upstream;
+    uint32_t mirror_sample_percent = 100;
+
+    // WebSocket broadcast channel: upgrades on this route subscribe to
+    // the channel instead of opening a backend leg
+    std::string ws_broadcast_channel;
 };
 
 /// Radix tree node (internal)
@@ -122,9 +155,16 @@ public:
     Router(Router&&) noexcept;
     Router& operator=(Router&&) noexcept;
 
-    /// Add a route to the router
+    /// Add a route to the router (invalidates any compiled table)
     void add_route(Route route);
 
+    /// Compile the radix tree into a contiguous flat-array matcher.
+    /// Call once after all routes are added (config load); match() then
+    /// walks index-linked records in one allocation instead of chasing
+    /// per-node heap pointers, with a first-byte table to reject
+    /// non-matching children without touching their records.
+    void compile();
+
     /// Find matching route for given method and path (with caching)
     [[nodiscard]] RouteMatch match(http::Method method, std::string_view path) const;
 
@@ -159,8 +199,46 @@ private:
     // Calculate tree statistics
     void calculate_stats(const RadixNode* node, Stats& stats, size_t depth) const;
 
+    // Compiled flat-array matcher (built by compile())
+    //
+    // Nodes live in BFS order so every node's children occupy one
+    // contiguous range; prefixes and parameter names are packed into a
+    // single string blob. A hot lookup therefore touches a handful of
+    // sequential cache lines instead of a pointer walk.
+    struct CompiledHandler {
+        http::Method method;
+        uint32_t route_index;  // Into routes_
+    };
+
+    struct CompiledNode {
+        uint32_t prefix_offset = 0;  // Into compiled_blob_
+        uint32_t param_name_offset = 0;
+        uint16_t prefix_len = 0;
+        uint16_t param_name_len = 0;
+        uint32_t children_begin = 0;  // Contiguous range in compiled_nodes_
+        uint16_t children_count = 0;
+        uint16_t handlers_count = 0;
+        uint32_t handlers_begin = 0;  // Range in compiled_handlers_
+        bool is_param = false;
+        bool is_wildcard = false;
+    };
+
+    // Search compiled table (mirrors search() semantics exactly)
+    RouteMatch search_compiled(uint32_t node_index, std::string_view path, http::Method method,
+                               std::vector<RouteParam>& params) const;
+
+    // Build a RouteMatch from a stored route
+    RouteMatch make_match(const Route& route, const std::vector<RouteParam>& params,
+                          std::string_view wildcard = {}) const;
+
     std::unique_ptr<RadixNode> root_;
     std::vector<Route> routes_;  // Keep track of all routes for inspection
+
+    std::vector<CompiledNode> compiled_nodes_;
+    std::vector<uint8_t> compiled_first_byte_;  // Parallel to compiled_nodes_
+    std::vector<CompiledHandler> compiled_handlers_;
+    std::string compiled_blob_;  // Prefix + param-name storage
+    bool compiled_ = false;
 };
 
 /// Route builder (fluent API)
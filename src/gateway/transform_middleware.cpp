@@ -15,6 +15,8 @@
  */
 
 // Transform Middleware - Implementation
+// Rules are lowered into flat TransformPrograms at config time; the
+// per-request path is a tight interpreter over primitive ops
 
 #include "transform_middleware.hpp"
 
@@ -24,199 +26,246 @@
 namespace titan::gateway {
 
 TransformMiddleware::TransformMiddleware(control::TransformConfig global_config)
-    : global_config_(std::move(global_config)) {}
+    : global_config_(std::move(global_config)), global_program_(compile_program(global_config_)) {}
 
-MiddlewareResult TransformMiddleware::process_request(RequestContext& ctx) {
-    // Merge global and per-route configs (per-route overrides global)
-    // Make a deep copy to ensure proper string lifetime
-    // This is NOT a hot path (only happens once per request during middleware setup)
-    // Safety > Performance for config handling
-    control::TransformConfig active_config;
-    if (ctx.route_match.transform_config.has_value()) {
-        // Per-route config exists - make a full deep copy (all strings are now owned)
-        active_config = *ctx.route_match.transform_config;
-    } else {
-        // Use global config - make a copy
-        active_config = global_config_;
+const TransformProgram& TransformMiddleware::get_program(const RouteMatch& route_match) const {
+    if (!route_match.transform_config.has_value()) {
+        return global_program_;
     }
 
-    if (!active_config.enabled) {
-        return MiddlewareResult::Continue;  // Transformations disabled
+    // Programs are bound to the route's dense metrics ID: first request
+    // on a route pays the compile, every later one is a map hit
+    uint32_t route_id = route_match.metrics_id;
+    auto it = route_programs_.find(route_id);
+    if (it != route_programs_.end()) {
+        return it->second;
     }
 
-    // 1. Apply path transformations
-    if (!active_config.path_rewrites.empty()) {
-        auto transformed_path = apply_path_rewrites(ctx.request->path, active_config.path_rewrites);
-        if (transformed_path.has_value()) {
-            // Store transformed path in metadata for proxy to use
-            ctx.set_metadata("transformed_path", std::move(*transformed_path));
-        }
-    }
+    auto [iter, inserted] =
+        route_programs_.emplace(route_id, compile_program(*route_match.transform_config));
+    return iter->second;
+}
 
-    // 2. Apply query parameter transformations
-    if (!active_config.query_params.empty() && !ctx.request->query.empty()) {
-        auto params = parse_query(ctx.request->query);
-        apply_query_transformations(params, active_config.query_params);
-        auto transformed_query = build_query(params);
+TransformProgram TransformMiddleware::compile_program(const control::TransformConfig& config) {
+    TransformProgram program;
+    program.enabled = config.enabled;
+    if (!config.enabled) {
+        return program;
+    }
 
-        // Store transformed query in metadata
-        ctx.set_metadata("transformed_query", std::move(transformed_query));
+    for (const auto& rule : config.path_rewrites) {
+        if (rule.type == "prefix_strip") {
+            TransformOp op{TransformOp::Kind::PathPrefixStrip};
+            op.arg1 = rule.pattern;
+            program.ops.push_back(std::move(op));
+            program.has_path_ops = true;
+        } else if (rule.type == "regex") {
+            // PCRE2 stays only for rules that genuinely need it
+            auto regex = titan::http::Regex::compile(rule.pattern);
+            if (!regex.has_value()) {
+                continue;  // Compilation failed (caught in config validation)
+            }
+            TransformOp op{TransformOp::Kind::PathRegex};
+            op.regex_index = static_cast<int32_t>(program.regexes.size());
+            op.arg2 = rule.replacement;
+            program.regexes.push_back(std::move(*regex));
+            program.ops.push_back(std::move(op));
+            program.has_path_ops = true;
+        }
     }
 
-    // 3. Apply request header transformations
-    // Select config source (per-route overrides global completely)
-    const control::TransformConfig* source_config = nullptr;
-    if (ctx.route_match.transform_config.has_value()) {
-        source_config = &(*ctx.route_match.transform_config);
-    } else {
-        source_config = &global_config_;
+    for (const auto& rule : config.query_params) {
+        TransformOp op{TransformOp::Kind::QueryRemove};
+        if (rule.action == "remove") {
+            op.kind = TransformOp::Kind::QueryRemove;
+        } else if (rule.action == "modify") {
+            op.kind = TransformOp::Kind::QueryModify;
+        } else if (rule.action == "add") {
+            op.kind = TransformOp::Kind::QueryAdd;
+        } else {
+            continue;
+        }
+        op.arg1 = rule.name;
+        op.arg2 = rule.value;
+        program.ops.push_back(std::move(op));
+        program.has_query_ops = true;
     }
 
-    if (!source_config->request_headers.empty()) {
-        apply_request_header_transformations(ctx, source_config->request_headers);
+    for (const auto& rule : config.request_headers) {
+        TransformOp op{TransformOp::Kind::RequestHeaderAdd};
+        if (rule.action == "add") {
+            op.kind = TransformOp::Kind::RequestHeaderAdd;
+        } else if (rule.action == "remove") {
+            op.kind = TransformOp::Kind::RequestHeaderRemove;
+        } else if (rule.action == "modify") {
+            op.kind = TransformOp::Kind::RequestHeaderModify;
+        } else {
+            continue;
+        }
+        op.arg1 = rule.name;
+        op.arg2 = rule.value;
+        program.ops.push_back(std::move(op));
+        program.has_request_header_ops = true;
     }
 
-    // 4. Store response header transformations in metadata for response phase
-    // NOTE: active_config is stack-local and destroyed after this function returns!
-    // Must explicitly copy string values to metadata, not just reference them.
-    if (!active_config.response_headers.empty()) {
-        for (const auto& rule : active_config.response_headers) {
-            std::string key = "response_header_" + rule.action + ":" + rule.name;
-            // CRITICAL: Explicitly create owned copy - active_config is destroyed when function
-            // returns
-            ctx.set_metadata(std::move(key), std::string(rule.value));
+    for (const auto& rule : config.response_headers) {
+        TransformOp op{TransformOp::Kind::ResponseHeaderAdd};
+        if (rule.action == "add") {
+            op.kind = TransformOp::Kind::ResponseHeaderAdd;
+        } else if (rule.action == "remove") {
+            op.kind = TransformOp::Kind::ResponseHeaderRemove;
+        } else if (rule.action == "modify") {
+            op.kind = TransformOp::Kind::ResponseHeaderModify;
+        } else {
+            continue;
         }
+        op.arg1 = rule.name;
+        op.arg2 = rule.value;
+        program.ops.push_back(std::move(op));
+        program.has_response_header_ops = true;
     }
 
-    return MiddlewareResult::Continue;
+    return program;
 }
 
-MiddlewareResult TransformMiddleware::process_response(ResponseContext& ctx) {
-    // Check if response header transformations were stored in metadata from request phase
-    bool has_metadata_rules = false;
-    for (const auto& [key, value] : ctx.metadata) {
-        if (key.starts_with("response_header_")) {
-            has_metadata_rules = true;
-            break;
-        }
+MiddlewareResult TransformMiddleware::process_request(RequestContext& ctx) {
+    const TransformProgram& program = get_program(ctx.route_match);
+    if (!program.enabled || program.ops.empty()) {
+        return MiddlewareResult::Continue;
     }
 
-    if (has_metadata_rules) {
-        // Apply response header transformations from metadata (normal two-phase flow)
-        // Metadata keys: "response_header_add:X-Custom", "response_header_remove:Server", etc.
-
-        // IMPORTANT: Collect all header operations first to avoid iterator invalidation
-        // (ctx.set_metadata() modifies the map we're iterating over)
-        std::vector<std::pair<std::string, std::string>> headers_to_add;
-        std::vector<std::string> headers_to_remove;
-        std::vector<std::pair<std::string, std::string>> headers_to_modify;
-
-        for (const auto& [key, value] : ctx.metadata) {
-            if (key.starts_with("response_header_add:")) {
-                std::string header_name = key.substr(20);  // Skip "response_header_add:"
-                headers_to_add.emplace_back(std::move(header_name), std::string(value));
-            } else if (key.starts_with("response_header_remove:")) {
-                std::string header_name = key.substr(23);  // Skip "response_header_remove:"
-                headers_to_remove.emplace_back(std::move(header_name));
-            } else if (key.starts_with("response_header_modify:")) {
-                std::string header_name = key.substr(23);  // Skip "response_header_modify:"
-                headers_to_modify.emplace_back(std::move(header_name), std::string(value));
+    // 1. Path ops
+    if (program.has_path_ops) {
+        std::string current_path(ctx.request->path);
+
+        for (const auto& op : program.ops) {
+            switch (op.kind) {
+                case TransformOp::Kind::PathPrefixStrip:
+                    if (current_path.starts_with(op.arg1)) {
+                        current_path = current_path.substr(op.arg1.size());
+                        if (current_path.empty() || current_path[0] != '/') {
+                            current_path = "/" + current_path;
+                        }
+                    }
+                    break;
+                case TransformOp::Kind::PathRegex: {
+                    const auto& regex = program.regexes[static_cast<size_t>(op.regex_index)];
+                    auto substituted = regex.substitute(current_path, op.arg2);
+                    if (substituted != current_path) {
+                        current_path = std::move(substituted);
+                    }
+                    break;
+                }
+                default:
+                    break;
             }
         }
 
-        // Now apply collected operations (safe - not iterating anymore)
-        for (auto& [name, value] : headers_to_add) {
-            // Hybrid storage: add_middleware_header() copies to owned strings
-            // Completely safe - no need for metadata storage anymore!
-            ctx.response->add_middleware_header(name, value);
-        }
-
-        for (const auto& name : headers_to_remove) {
-            ctx.response->remove_header(name);
-        }
-
-        for (auto& [name, value] : headers_to_modify) {
-            if (!ctx.response->modify_header(name, value)) {
-                // Header doesn't exist, add it using hybrid storage
-                ctx.response->add_middleware_header(name, value);
+        if (current_path != ctx.request->path) {
+            if (ctx.arena) {
+                // Arena-backed: consumed while building the backend request,
+                // no per-request heap allocation or metadata map insert
+                ctx.transformed_path = ctx.arena_copy(current_path);
+            } else {
+                // No arena (e.g. standalone pipeline use) - metadata fallback
+                ctx.set_metadata("transformed_path", std::move(current_path));
             }
         }
-    } else {
-        // No metadata rules - apply global config directly (for tests or legacy usage)
-        apply_response_header_transformations(ctx, global_config_.response_headers);
     }
 
-    return MiddlewareResult::Continue;
-}
+    // 2. Query parameter ops
+    if (program.has_query_ops && !ctx.request->query.empty()) {
+        auto params = parse_query(ctx.request->query);
 
-// Helper: Get compiled regex with caching
-const titan::http::Regex* TransformMiddleware::get_compiled_regex(
-    const std::string& pattern) const {
-    // Check cache first
-    auto it = regex_cache_.find(pattern);
-    if (it != regex_cache_.end()) {
-        return &it->second;
-    }
+        for (const auto& op : program.ops) {
+            switch (op.kind) {
+                case TransformOp::Kind::QueryRemove:
+                    params.params.erase(
+                        std::remove_if(params.params.begin(), params.params.end(),
+                                       [&op](const auto& p) { return p.first == op.arg1; }),
+                        params.params.end());
+                    break;
+                case TransformOp::Kind::QueryModify:
+                    for (auto& [key, value] : params.params) {
+                        if (key == op.arg1) {
+                            value = op.arg2;
+                            break;  // Only modify first occurrence
+                        }
+                    }
+                    break;
+                case TransformOp::Kind::QueryAdd:
+                    params.params.emplace_back(op.arg1, op.arg2);
+                    break;
+                default:
+                    break;
+            }
+        }
 
-    // Compile and cache
-    auto regex = titan::http::Regex::compile(pattern);
-    if (!regex.has_value()) {
-        return nullptr;  // Compilation failed (should have been caught in validation)
+        auto transformed_query = build_query(params);
+        if (ctx.arena) {
+            ctx.transformed_query = ctx.arena_copy(transformed_query);
+        } else {
+            ctx.set_metadata("transformed_query", std::move(transformed_query));
+        }
     }
 
-    auto [iter, inserted] = regex_cache_.emplace(pattern, std::move(*regex));
-    return &iter->second;
-}
-
-// Helper: Merge global and per-route configs
-control::TransformConfig TransformMiddleware::merge_configs(
-    const std::optional<control::TransformConfig>& route_config) const {
-    if (!route_config.has_value()) {
-        return global_config_;  // No per-route config, use global
-    }
+    // 3. Request header ops (owned copies for async safety, especially
+    // HTTP/2 where RequestContext may be destroyed before the backend
+    // response completes)
+    if (program.has_request_header_ops) {
+        if (!ctx.header_transforms.has_value()) {
+            ctx.header_transforms.emplace();
+        }
 
-    if (!route_config->enabled) {
-        return *route_config;  // Per-route explicitly disabled
+        for (const auto& op : program.ops) {
+            switch (op.kind) {
+                case TransformOp::Kind::RequestHeaderAdd:
+                    ctx.header_transforms->add.emplace_back(op.arg1, op.arg2);
+                    break;
+                case TransformOp::Kind::RequestHeaderRemove:
+                    ctx.header_transforms->remove.emplace_back(op.arg1);
+                    break;
+                case TransformOp::Kind::RequestHeaderModify:
+                    ctx.header_transforms->modify.emplace_back(op.arg1, op.arg2);
+                    break;
+                default:
+                    break;
+            }
+        }
     }
 
-    // Per-route config enabled - use it (overrides global)
-    return *route_config;
+    // Response header ops run in process_response from the same program
+    // (both phases resolve it via route_match - no metadata round-trip)
+    return MiddlewareResult::Continue;
 }
 
-// Path transformation
-std::optional<std::string> TransformMiddleware::apply_path_rewrites(
-    std::string_view path, const std::vector<control::PathRewriteRule>& rules) const {
-    std::string current_path(path);
-
-    for (const auto& rule : rules) {
-        if (rule.type == "prefix_strip") {
-            // Strip prefix if path starts with pattern
-            if (current_path.starts_with(rule.pattern)) {
-                current_path = current_path.substr(rule.pattern.size());
+MiddlewareResult TransformMiddleware::process_response(ResponseContext& ctx) {
+    const TransformProgram& program = get_program(ctx.route_match);
+    if (!program.enabled || !program.has_response_header_ops) {
+        return MiddlewareResult::Continue;
+    }
 
-                // Ensure path starts with /
-                if (current_path.empty() || current_path[0] != '/') {
-                    current_path = "/" + current_path;
+    for (const auto& op : program.ops) {
+        switch (op.kind) {
+            case TransformOp::Kind::ResponseHeaderAdd:
+                // Hybrid storage: add_middleware_header() copies to owned strings
+                ctx.response->add_middleware_header(op.arg1, op.arg2);
+                break;
+            case TransformOp::Kind::ResponseHeaderRemove:
+                ctx.response->remove_header(op.arg1);
+                break;
+            case TransformOp::Kind::ResponseHeaderModify:
+                if (!ctx.response->modify_header(op.arg1, op.arg2)) {
+                    // Header doesn't exist, add it using hybrid storage
+                    ctx.response->add_middleware_header(op.arg1, op.arg2);
                 }
-            }
-        } else if (rule.type == "regex") {
-            // Apply regex substitution
-            const auto* regex = get_compiled_regex(rule.pattern);
-            if (regex) {
-                auto substituted = regex->substitute(current_path, rule.replacement);
-                if (substituted != current_path) {
-                    current_path = std::move(substituted);
-                }
-            }
+                break;
+            default:
+                break;
         }
     }
 
-    // Return transformed path if it changed
-    if (current_path != path) {
-        return current_path;
-    }
-
-    return std::nullopt;  // No transformation applied
+    return MiddlewareResult::Continue;
 }
 
 // Query parameter parsing
@@ -290,75 +339,4 @@ std::string TransformMiddleware::build_query(const QueryParams& params) const {
     return oss.str();
 }
 
-// Query parameter transformations
-void TransformMiddleware::apply_query_transformations(
-    QueryParams& params, const std::vector<control::QueryRule>& rules) const {
-    for (const auto& rule : rules) {
-        if (rule.action == "remove") {
-            // Remove all parameters with matching name
-            params.params.erase(
-                std::remove_if(params.params.begin(), params.params.end(),
-                               [&rule](const auto& p) { return p.first == rule.name; }),
-                params.params.end());
-        } else if (rule.action == "modify") {
-            // Modify first matching parameter
-            for (auto& [key, value] : params.params) {
-                if (key == rule.name) {
-                    value = rule.value;
-                    break;  // Only modify first occurrence
-                }
-            }
-        } else if (rule.action == "add") {
-            // Add new parameter (at the end)
-            params.params.emplace_back(rule.name, rule.value);
-        }
-    }
-}
-
-// Request header transformations (async-safe with owned strings)
-void TransformMiddleware::apply_request_header_transformations(
-    RequestContext& ctx, const std::vector<control::HeaderRule>& rules) {
-    // Copy strings for async safety (especially HTTP/2 where RequestContext
-    // may be destroyed before backend response completes).
-    // Benefits over metadata approach:
-    //   - No string key encoding ("header_add:X-Custom" -> just "X-Custom")
-    //   - Direct vector iteration instead of map iteration + string parsing
-    //   - Better cache locality
-
-    // Initialize HeaderTransformations if not already present
-    if (!ctx.header_transforms.has_value()) {
-        ctx.header_transforms.emplace();
-    }
-
-    // Populate with owned string copies
-    for (const auto& rule : rules) {
-        if (rule.action == "add") {
-            ctx.header_transforms->add.emplace_back(rule.name, rule.value);
-        } else if (rule.action == "remove") {
-            ctx.header_transforms->remove.emplace_back(rule.name);
-        } else if (rule.action == "modify") {
-            ctx.header_transforms->modify.emplace_back(rule.name, rule.value);
-        }
-    }
-}
-
-// Response header transformations
-void TransformMiddleware::apply_response_header_transformations(
-    ResponseContext& ctx, const std::vector<control::HeaderRule>& rules) {
-    for (const auto& rule : rules) {
-        if (rule.action == "remove") {
-            ctx.response->remove_header(rule.name);
-        } else if (rule.action == "modify") {
-            // Modify existing header (or add if doesn't exist)
-            if (!ctx.response->modify_header(rule.name, rule.value)) {
-                // Header doesn't exist, add it using hybrid storage
-                ctx.response->add_middleware_header(rule.name, rule.value);
-            }
-        } else if (rule.action == "add") {
-            // Hybrid storage: add_middleware_header() copies to owned strings
-            ctx.response->add_middleware_header(rule.name, rule.value);
-        }
-    }
-}
-
 }  // namespace titan::gateway
@@ -31,6 +31,45 @@
 
 namespace titan::gateway {
 
+/// One primitive op of a precompiled transform program
+struct TransformOp {
+    enum class Kind : uint8_t {
+        PathPrefixStrip,      // arg1 = literal prefix to strip
+        PathRegex,            // regex_index into the program's regexes, arg2 = replacement
+        QueryRemove,          // arg1 = parameter name
+        QueryModify,          // arg1 = name, arg2 = value
+        QueryAdd,             // arg1 = name, arg2 = value
+        RequestHeaderAdd,     // arg1 = name, arg2 = value
+        RequestHeaderRemove,  // arg1 = name
+        RequestHeaderModify,  // arg1 = name, arg2 = value
+        ResponseHeaderAdd,    // arg1 = name, arg2 = value
+        ResponseHeaderRemove,   // arg1 = name
+        ResponseHeaderModify,   // arg1 = name, arg2 = value
+    };
+
+    Kind kind;
+    int32_t regex_index = -1;  // Only PathRegex ops reference a regex
+    std::string arg1;
+    std::string arg2;
+};
+
+/// A route's transformation rules lowered to a flat op list at config
+/// time. The per-request interpreter is a switch over primitive ops -
+/// no rule-list walking, no string dispatch on action/type names, and
+/// PCRE2 only where a rule genuinely needs it.
+struct TransformProgram {
+    bool enabled = false;
+
+    // Phase pre-checks so a phase with no ops costs one branch
+    bool has_path_ops = false;
+    bool has_query_ops = false;
+    bool has_request_header_ops = false;
+    bool has_response_header_ops = false;
+
+    std::vector<TransformOp> ops;
+    std::vector<titan::http::Regex> regexes;  // Compiled once, indexed by ops
+};
+
 /// Transform Middleware - Apply request/response transformations
 /// Execution order: After Auth, Before Proxy (Phase 1 for request, Phase 2 for response)
 class TransformMiddleware : public Middleware {
@@ -48,20 +87,21 @@ private:
     // Configuration (global, can be overridden per-route)
     control::TransformConfig global_config_;
 
-    // Compiled regex cache (thread-local, lazy compilation)
-    // Maps pattern → compiled regex
-    mutable titan::core::fast_map<std::string, titan::http::Regex> regex_cache_;
-
-    // Helper: Get compiled regex (with caching)
-    [[nodiscard]] const titan::http::Regex* get_compiled_regex(const std::string& pattern) const;
+    // Precompiled programs: the global config compiles once at
+    // construction; per-route configs compile on first hit, keyed by the
+    // route's dense metrics ID. The middleware lives in a per-worker
+    // pipeline (single-threaded), so lazy fills need no locking, and a
+    // config reload replaces the whole middleware along with its cache.
+    TransformProgram global_program_;
+    mutable titan::core::fast_map<uint32_t, TransformProgram> route_programs_;
 
-    // Helper: Merge global and per-route configs (per-route overrides global)
-    [[nodiscard]] control::TransformConfig merge_configs(
-        const std::optional<control::TransformConfig>& route_config) const;
+    /// Program for this request's route (compiling per-route config on
+    /// first hit)
+    [[nodiscard]] const TransformProgram& get_program(const RouteMatch& route_match) const;
 
-    // Path transformation
-    [[nodiscard]] std::optional<std::string> apply_path_rewrites(
-        std::string_view path, const std::vector<control::PathRewriteRule>& rules) const;
+    /// Lower a transform config into a flat op program. Regex rules keep
+    /// PCRE2; everything else becomes a literal primitive op.
+    [[nodiscard]] static TransformProgram compile_program(const control::TransformConfig& config);
 
     // Query parameter transformation
     struct QueryParams {
@@ -70,16 +110,6 @@ private:
 
     [[nodiscard]] QueryParams parse_query(std::string_view query) const;
     [[nodiscard]] std::string build_query(const QueryParams& params) const;
-    void apply_query_transformations(QueryParams& params,
-                                     const std::vector<control::QueryRule>& rules) const;
-
-    // Header transformation (for request)
-    void apply_request_header_transformations(RequestContext& ctx,
-                                              const std::vector<control::HeaderRule>& rules);
-
-    // Header transformation (for response)
-    void apply_response_header_transformations(ResponseContext& ctx,
-                                               const std::vector<control::HeaderRule>& rules);
 };
 
 }  // namespace titan::gateway
@@ -21,10 +21,25 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <cstdio>
 #include <random>
 
 namespace titan::gateway {
 
+namespace {
+
+/// FNV-1a 64-bit - cheap, stateless, good enough spread for ring placement
+uint64_t fnv1a_hash(std::string_view data, uint64_t seed = 14695981039346656037ull) {
+    uint64_t hash = seed;
+    for (char c : data) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+}  // namespace
+
 // Load balancer implementations
 
 Backend* RoundRobinBalancer::select(const std::vector<Backend>& backends,
@@ -131,6 +146,149 @@ Backend* WeightedRoundRobinBalancer::select(const std::vector<Backend>& backends
     return weighted_pool[index];
 }
 
+Backend* PowerOfTwoChoicesBalancer::select(const std::vector<Backend>& backends,
+                                           std::string_view client_ip) {
+    (void)client_ip;  // Unused
+
+    if (backends.empty()) {
+        return nullptr;
+    }
+
+    // Filter available backends
+    std::vector<Backend*> available;
+    for (auto& backend : backends) {
+        if (backend.can_accept_connection()) {
+            available.push_back(const_cast<Backend*>(&backend));
+        }
+    }
+
+    if (available.empty()) {
+        return nullptr;
+    }
+    if (available.size() == 1) {
+        return available[0];
+    }
+
+    // Sample two distinct backends
+    static thread_local std::mt19937 rng{std::random_device{}()};
+    std::uniform_int_distribution<size_t> dist(0, available.size() - 1);
+    size_t first = dist(rng);
+    size_t second = dist(rng);
+    if (second == first) {
+        second = (second + 1) % available.size();
+    }
+
+    // Score = (in-flight + 1) * (latency EWMA + 1): an idle backend with a
+    // degraded EWMA scores worse than a moderately busy fast one
+    auto score = [](const Backend& b) {
+        return (static_cast<uint64_t>(b.active_connections) + 1) *
+               (b.ewma_latency_us.load(std::memory_order_relaxed) + 1);
+    };
+
+    return score(*available[first]) <= score(*available[second]) ? available[first]
+                                                                 : available[second];
+}
+
+void ConsistentHashBalancer::maybe_rebuild(const std::vector<Backend>& backends) {
+    bool dirty = backends.size() != ring_members_.size();
+    if (!dirty) {
+        for (size_t i = 0; i < backends.size(); ++i) {
+            if (ring_members_[i].first != backends[i].address() ||
+                ring_members_[i].second != backends[i].weight) {
+                dirty = true;
+                break;
+            }
+        }
+    }
+    if (!dirty) {
+        return;
+    }
+
+    ring_.clear();
+    ring_members_.clear();
+    ring_members_.reserve(backends.size());
+
+    for (size_t i = 0; i < backends.size(); ++i) {
+        std::string address = backends[i].address();
+        uint32_t weight = backends[i].weight > 0 ? backends[i].weight : 1;
+        uint32_t replicas = virtual_nodes_ * weight;
+
+        // Hash "<address>#<replica>" for each virtual node; weightier
+        // backends own proportionally more of the ring
+        uint64_t node_seed = fnv1a_hash(address);
+        for (uint32_t replica = 0; replica < replicas; ++replica) {
+            char suffix[16];
+            int len = std::snprintf(suffix, sizeof(suffix), "#%u", replica);
+            ring_.push_back({fnv1a_hash({suffix, static_cast<size_t>(len)}, node_seed), i});
+        }
+
+        ring_members_.emplace_back(std::move(address), backends[i].weight);
+    }
+
+    std::sort(ring_.begin(), ring_.end(),
+              [](const VirtualNode& a, const VirtualNode& b) { return a.hash < b.hash; });
+}
+
+Backend* ConsistentHashBalancer::select(const std::vector<Backend>& backends,
+                                        std::string_view key) {
+    if (backends.empty()) {
+        return nullptr;
+    }
+
+    maybe_rebuild(backends);
+    if (ring_.empty()) {
+        return nullptr;
+    }
+
+    // Bounded load: cap any backend at load_factor * average active
+    // connections (minimum headroom of 1 so an idle upstream still routes)
+    uint64_t total_active = 0;
+    uint32_t available = 0;
+    for (const auto& backend : backends) {
+        if (backend.can_accept_connection()) {
+            total_active += backend.active_connections;
+            ++available;
+        }
+    }
+    if (available == 0) {
+        return nullptr;
+    }
+    auto max_load = static_cast<uint64_t>(
+        load_factor_ * (static_cast<double>(total_active + 1) / available) + 1.0);
+
+    // Keyless requests (no client IP, attribute missing) can't be sticky -
+    // spread them round-robin over the ring instead of pinning one node
+    uint64_t point = key.empty()
+                         ? fnv1a_hash({}, fallback_counter_.fetch_add(1, std::memory_order_relaxed))
+                         : fnv1a_hash(key);
+
+    // First virtual node clockwise of the hash point, then walk until a
+    // backend passes health/circuit/load gates. Overloaded-but-healthy
+    // backends are kept as fallback in case every node is above the bound.
+    auto it = std::lower_bound(
+        ring_.begin(), ring_.end(), point,
+        [](const VirtualNode& node, uint64_t value) { return node.hash < value; });
+    size_t start = (it == ring_.end()) ? 0 : static_cast<size_t>(it - ring_.begin());
+
+    Backend* overloaded_fallback = nullptr;
+    for (size_t step = 0; step < ring_.size(); ++step) {
+        const VirtualNode& node = ring_[(start + step) % ring_.size()];
+        auto& backend = const_cast<Backend&>(backends[node.backend_index]);
+
+        if (!backend.can_accept_connection()) {
+            continue;
+        }
+        if (backend.active_connections < max_load) {
+            return &backend;
+        }
+        if (!overloaded_fallback) {
+            overloaded_fallback = &backend;
+        }
+    }
+
+    return overloaded_fallback;
+}
+
 // Upstream implementation
 
 Upstream::Upstream(std::string name, size_t backend_pool_size)
@@ -163,6 +321,119 @@ void Upstream::set_load_balancer(std::unique_ptr<LoadBalancer> balancer) {
     balancer_ = std::move(balancer);
 }
 
+Backend* Upstream::select_backend(std::string_view key) {
+    if (!balancer_) {
+        return nullptr;
+    }
+    return balancer_->select(backends_, key);
+}
+
+void Upstream::evaluate_outliers() {
+    if (!outlier_config_.enabled || backends_.size() < 2) {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+
+    // Reinstatement pass, plus the latency baseline: mean EWMA over
+    // backends currently in rotation (ejected ones would drag the mean
+    // toward the very outliers being measured against it)
+    uint64_t ewma_sum = 0;
+    uint32_t ewma_count = 0;
+    size_t ejected = 0;
+    for (auto& backend : backends_) {
+        if (backend.outlier_ejected) {
+            if (now >= backend.outlier_until) {
+                backend.outlier_ejected = false;
+                backend.consecutive_errors.store(0, std::memory_order_relaxed);
+                std::printf("[INFO] Outlier detection: backend %s reinstated\n",
+                            backend.address().c_str());
+            } else {
+                ++ejected;
+                continue;
+            }
+        }
+        uint64_t ewma = backend.ewma_latency_us.load(std::memory_order_relaxed);
+        if (backend.is_available() && ewma > 0) {
+            ewma_sum += ewma;
+            ++ewma_count;
+        }
+    }
+
+    // Ejection pass, capped so a fleet-wide slowdown (shared database,
+    // network) can't eject everything and melt the survivors
+    auto max_ejected = static_cast<size_t>(outlier_config_.max_ejected_fraction *
+                                           static_cast<double>(backends_.size()));
+    for (auto& backend : backends_) {
+        if (ejected >= max_ejected) {
+            break;
+        }
+        if (backend.outlier_ejected || !backend.is_available()) {
+            continue;
+        }
+
+        uint32_t errors = backend.consecutive_errors.load(std::memory_order_relaxed);
+        uint64_t ewma = backend.ewma_latency_us.load(std::memory_order_relaxed);
+        bool error_outlier = errors >= outlier_config_.consecutive_errors;
+
+        // Deviation is measured against the candidate's peers, not a mean
+        // that includes the candidate - one 50x outlier among three
+        // backends would otherwise drag the baseline up past its own bar
+        uint64_t peer_mean = 0;
+        if (ewma > 0 && ewma_count >= 2) {
+            peer_mean = (ewma_sum - ewma) / (ewma_count - 1);
+        }
+        bool latency_outlier =
+            peer_mean > 0 && ewma >= outlier_config_.min_latency_us &&
+            static_cast<double>(ewma) >
+                outlier_config_.latency_factor * static_cast<double>(peer_mean);
+
+        if (!error_outlier && !latency_outlier) {
+            continue;
+        }
+
+        // Exponential backoff per repeat offense, capped
+        uint64_t duration_ms = std::min<uint64_t>(
+            static_cast<uint64_t>(outlier_config_.base_ejection_ms)
+                << std::min<uint32_t>(backend.outlier_ejections, 10),
+            outlier_config_.max_ejection_ms);
+
+        backend.outlier_ejected = true;
+        backend.outlier_until = now + std::chrono::milliseconds(duration_ms);
+        backend.outlier_ejections++;
+        ++ejected;
+        std::printf(
+            "[WARN] Outlier detection: backend %s ejected for %llums "
+            "(%s: %u consecutive errors, ewma %lluus vs mean %lluus)\n",
+            backend.address().c_str(), static_cast<unsigned long long>(duration_ms),
+            error_outlier ? "errors" : "latency", errors, static_cast<unsigned long long>(ewma),
+            static_cast<unsigned long long>(peer_mean));
+    }
+}
+
+void Upstream::note_proxied_request() noexcept {
+    auto now = std::chrono::steady_clock::now();
+    if (now - budget_window_start_ > std::chrono::seconds(10)) {
+        budget_window_start_ = now;
+        budget_requests_ = 0;
+        budget_hedges_ = 0;
+    }
+    ++budget_requests_;
+}
+
+bool Upstream::try_spend_hedge() noexcept {
+    // +1 grants a small floor so hedging works at trickle traffic, where
+    // a strict percentage of a near-empty window would round to zero
+    auto allowed = static_cast<uint64_t>(hedging_config_.budget_percent / 100.0 *
+                                         static_cast<double>(budget_requests_)) +
+                   1;
+    if (budget_hedges_ >= allowed) {
+        return false;
+    }
+    ++budget_hedges_;
+    return true;
+}
+
 size_t Upstream::healthy_count() const noexcept {
     return std::count_if(backends_.begin(), backends_.end(),
                          [](const Backend& b) { return b.is_available(); });
@@ -177,6 +448,11 @@ Upstream::Stats Upstream::get_stats() const {
     for (const auto& backend : backends_) {
         stats.total_requests += backend.total_requests.load(std::memory_order_relaxed);
         stats.total_failures += backend.total_failures.load(std::memory_order_relaxed);
+        stats.peak_ewma_latency_us = std::max(
+            stats.peak_ewma_latency_us, backend.ewma_latency_us.load(std::memory_order_relaxed));
+        if (backend.outlier_ejected) {
+            ++stats.ejected_backends;
+        }
     }
 
     return stats;
@@ -204,6 +480,17 @@ void UpstreamManager::remove_upstream(std::string_view name) {
         upstreams_.end());
 }
 
+std::unique_ptr<Upstream> UpstreamManager::release_upstream(std::string_view name) {
+    for (auto it = upstreams_.begin(); it != upstreams_.end(); ++it) {
+        if ((*it)->name() == name) {
+            std::unique_ptr<Upstream> upstream = std::move(*it);
+            upstreams_.erase(it);
+            return upstream;
+        }
+    }
+    return nullptr;
+}
+
 void UpstreamManager::clear() {
     upstreams_.clear();
 }
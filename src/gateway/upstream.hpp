@@ -29,6 +29,7 @@
 
 #include "circuit_breaker.hpp"
 #include "connection_pool.hpp"
+#include "dns_resolver.hpp"
 
 namespace titan::gateway {
 
@@ -40,6 +41,53 @@ enum class BackendStatus : uint8_t {
     Draining  // Graceful shutdown
 };
 
+/// Passive outlier detection tuning (see Upstream::evaluate_outliers)
+struct OutlierDetectionConfig {
+    bool enabled = true;
+
+    /// Consecutive proxy failures that eject a backend
+    uint32_t consecutive_errors = 5;
+
+    /// Eject when a backend's latency EWMA exceeds this multiple of the
+    /// mean EWMA across the upstream's in-rotation backends
+    double latency_factor = 3.0;
+
+    /// Latency ejection only engages above this EWMA (microseconds), so a
+    /// 300us backend next to 80us peers isn't ejected over noise
+    uint64_t min_latency_us = 10000;
+
+    /// First ejection duration; doubles per repeat offense
+    uint32_t base_ejection_ms = 30000;
+
+    /// Ejection duration cap
+    uint32_t max_ejection_ms = 300000;
+
+    /// Never eject past this fraction of the upstream's backends - losing
+    /// capacity to ejection must not cascade into overloading the rest
+    double max_ejected_fraction = 0.5;
+};
+
+/// Request hedging tuning (see Server's backend path). A hedge is a
+/// second copy of a slow idempotent request raced against a different
+/// backend; whichever answers first wins and the loser is cancelled.
+struct HedgingConfig {
+    bool enabled = false;
+
+    /// Hedge after the request has been in flight longer than this
+    /// percentile of the worker's observed request latency
+    double delay_percentile = 0.95;
+
+    /// Clamp on the percentile-derived delay: the floor keeps warm-cache
+    /// fast paths from hedging everything, the ceiling keeps a polluted
+    /// histogram from disabling hedging entirely
+    uint32_t min_delay_ms = 5;
+    uint32_t max_delay_ms = 1000;
+
+    /// Hedges may not exceed this percentage of proxied requests
+    /// (sliding 10s window, per worker) - the retry budget
+    double budget_percent = 10.0;
+};
+
 /// Backend server definition
 struct Backend {
     std::string host;
@@ -55,6 +103,12 @@ struct Backend {
     std::chrono::steady_clock::time_point last_health_check;
     uint32_t consecutive_failures = 0;
 
+    // Passive outlier detection (driven by Upstream::evaluate_outliers)
+    std::atomic<uint32_t> consecutive_errors{0};  // Proxy failures since last success
+    bool outlier_ejected = false;
+    std::chrono::steady_clock::time_point outlier_until{};
+    uint32_t outlier_ejections = 0;  // Lifetime count, drives backoff exponent
+
     // Circuit breaker
     std::unique_ptr<CircuitBreaker> circuit_breaker;
 
@@ -64,6 +118,33 @@ struct Backend {
     std::atomic<uint64_t> total_bytes_sent{0};
     std::atomic<uint64_t> total_bytes_received{0};
 
+    // EWMA of observed response latency (microseconds); 0 = no sample yet.
+    // Fed by the Server when a proxied response completes, consumed by
+    // latency-aware balancing (PowerOfTwoChoicesBalancer)
+    std::atomic<uint64_t> ewma_latency_us{0};
+
+    /// Track the proxy outcome stream for passive outlier detection:
+    /// failures accumulate, any success resets the streak
+    void record_result(bool failure) noexcept {
+        if (failure) {
+            consecutive_errors.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            consecutive_errors.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /// Fold a response latency sample into the EWMA (alpha = 1/8, same
+    /// smoothing as TCP SRTT - reacts in a few requests without jitter)
+    void record_latency(uint64_t latency_us) noexcept {
+        uint64_t current = ewma_latency_us.load(std::memory_order_relaxed);
+        uint64_t updated;
+        do {
+            updated = current == 0 ? latency_us : current - (current >> 3) + (latency_us >> 3);
+        } while (!ewma_latency_us.compare_exchange_weak(current, updated,
+                                                        std::memory_order_relaxed,
+                                                        std::memory_order_relaxed));
+    }
+
     // Make Backend movable by handling atomics
     Backend() = default;
     Backend(Backend&& other) noexcept
@@ -75,11 +156,16 @@ struct Backend {
           active_connections(other.active_connections),
           last_health_check(other.last_health_check),
           consecutive_failures(other.consecutive_failures),
+          consecutive_errors(other.consecutive_errors.load()),
+          outlier_ejected(other.outlier_ejected),
+          outlier_until(other.outlier_until),
+          outlier_ejections(other.outlier_ejections),
           circuit_breaker(std::move(other.circuit_breaker)),
           total_requests(other.total_requests.load()),
           total_failures(other.total_failures.load()),
           total_bytes_sent(other.total_bytes_sent.load()),
-          total_bytes_received(other.total_bytes_received.load()) {}
+          total_bytes_received(other.total_bytes_received.load()),
+          ewma_latency_us(other.ewma_latency_us.load()) {}
 
     Backend& operator=(Backend&& other) noexcept {
         if (this != &other) {
@@ -91,11 +177,16 @@ struct Backend {
             active_connections = other.active_connections;
             last_health_check = other.last_health_check;
             consecutive_failures = other.consecutive_failures;
+            consecutive_errors.store(other.consecutive_errors.load());
+            outlier_ejected = other.outlier_ejected;
+            outlier_until = other.outlier_until;
+            outlier_ejections = other.outlier_ejections;
             circuit_breaker = std::move(other.circuit_breaker);
             total_requests.store(other.total_requests.load());
             total_failures.store(other.total_failures.load());
             total_bytes_sent.store(other.total_bytes_sent.load());
             total_bytes_received.store(other.total_bytes_received.load());
+            ewma_latency_us.store(other.ewma_latency_us.load());
         }
         return *this;
     }
@@ -114,7 +205,13 @@ struct Backend {
             return false;  // HealthChecker marked backend as down
         }
 
-        // Gate 2: Circuit breaker state (real-time failure tracking)
+        // Gate 2: Passive outlier ejection (slow or erroring backend is
+        // cooling off; Upstream::evaluate_outliers reinstates it)
+        if (outlier_ejected) {
+            return false;
+        }
+
+        // Gate 3: Circuit breaker state (real-time failure tracking)
         // Note: const_cast is safe here since should_allow_request() only reads state
         // for CLOSED/OPEN decision (mutations happen in record_failure/success)
         if (circuit_breaker &&
@@ -122,7 +219,7 @@ struct Backend {
             return false;  // Too many recent failures, circuit is OPEN
         }
 
-        // Gate 3: Connection limit
+        // Gate 4: Connection limit
         if (active_connections >= max_connections) {
             return false;
         }
@@ -139,7 +236,9 @@ enum class LoadBalancingStrategy : uint8_t {
     LeastConnections,    // Pick backend with fewest connections
     Random,              // Random selection
     WeightedRoundRobin,  // Round-robin with weights
-    IPHash               // Hash based on client IP (sticky sessions)
+    IPHash,              // Hash based on client IP (sticky sessions)
+    ConsistentHash,      // Ring hash with bounded load (cache affinity)
+    PowerOfTwoChoices    // Sample two, pick by connections x EWMA latency
 };
 
 /// Load balancer interface
@@ -190,6 +289,55 @@ private:
     std::atomic<uint64_t> counter_{0};
 };
 
+/// Power-of-two-choices balancer weighted by EWMA response latency
+///
+/// Samples two distinct available backends and keeps the one with the
+/// lower (active_connections + 1) * (ewma_latency + 1) score, so a
+/// slow-but-idle backend stops attracting traffic the moment its latency
+/// EWMA degrades. O(1) per pick (no full scan like least-connections),
+/// and two random choices are enough to keep load within a constant
+/// factor of optimal.
+class PowerOfTwoChoicesBalancer : public LoadBalancer {
+public:
+    Backend* select(const std::vector<Backend>& backends, std::string_view client_ip) override;
+};
+
+/// Consistent-hash (ring) load balancer with bounded load
+///
+/// Hashes the request key (client IP, path, header or cookie - the Server
+/// extracts it per the upstream's hash_key config) onto a ring of virtual
+/// nodes (weight * virtual_nodes per backend), so a membership change only
+/// remaps the keys that hashed to the departed node - backend caches keep
+/// their hit rates across scale events. Bounded load ("consistent hashing
+/// with bounded loads"): a backend already carrying more than load_factor
+/// times the average connection count is skipped and the walk continues
+/// clockwise, so one hot key cannot melt a single backend.
+///
+/// The ring is rebuilt lazily when backend membership or weights change;
+/// like the connection pool, a balancer instance belongs to one worker.
+class ConsistentHashBalancer : public LoadBalancer {
+public:
+    explicit ConsistentHashBalancer(uint32_t virtual_nodes = 160, double load_factor = 1.25)
+        : virtual_nodes_(virtual_nodes), load_factor_(load_factor) {}
+
+    Backend* select(const std::vector<Backend>& backends, std::string_view key) override;
+
+private:
+    struct VirtualNode {
+        uint64_t hash;
+        size_t backend_index;
+    };
+
+    /// Rebuild the ring if backend membership/weights changed
+    void maybe_rebuild(const std::vector<Backend>& backends);
+
+    std::vector<VirtualNode> ring_;
+    std::vector<std::pair<std::string, uint32_t>> ring_members_;  // address+weight fingerprint
+    uint32_t virtual_nodes_;
+    double load_factor_;
+    std::atomic<uint64_t> fallback_counter_{0};  // Keyless requests round-robin
+};
+
 /// Upstream group (multiple backends with load balancing)
 class Upstream {
 public:
@@ -214,11 +362,79 @@ public:
     /// Set load balancing strategy
     void set_load_balancer(std::unique_ptr<LoadBalancer> balancer);
 
+    /// Configure request hedging for this upstream
+    void set_hedging(HedgingConfig config) noexcept { hedging_config_ = config; }
+    [[nodiscard]] const HedgingConfig& hedging() const noexcept { return hedging_config_; }
+
+    /// Hedge delay derived from the latency percentile, refreshed by the
+    /// worker's timer sweep (milliseconds; 0 until the first refresh)
+    void set_hedge_delay_ms(uint32_t delay) noexcept { hedge_delay_ms_ = delay; }
+    [[nodiscard]] uint32_t hedge_delay_ms() const noexcept { return hedge_delay_ms_; }
+
+    /// Count a proxied request against the hedge budget window
+    void note_proxied_request() noexcept;
+
+    /// Spend one hedge from the budget. Returns false when hedging this
+    /// request would push hedges past budget_percent of the window's
+    /// traffic - the hedge is simply not sent and the primary rides alone.
+    [[nodiscard]] bool try_spend_hedge() noexcept;
+
+    /// Minimum pooled connections the warmer maintains per backend (per
+    /// worker - each worker warms its own pool). 0 disables warming.
+    void set_min_warm_connections(size_t count) noexcept { min_warm_connections_ = count; }
+
+    /// Pre-scale hook: hold the warm target at `per_backend` connections
+    /// for `hold`, ahead of a known traffic event (product launch, cron
+    /// fan-out). The boost decays back to min_warm_connections on expiry.
+    void prewarm(size_t per_backend, std::chrono::seconds hold) {
+        prewarm_target_ = per_backend;
+        prewarm_until_ = std::chrono::steady_clock::now() + hold;
+    }
+
+    /// Current per-backend warm target (configured minimum, or the
+    /// pre-scale boost while one is active)
+    [[nodiscard]] size_t warm_target() const noexcept {
+        if (prewarm_target_ > min_warm_connections_ &&
+            std::chrono::steady_clock::now() < prewarm_until_) {
+            return prewarm_target_;
+        }
+        return min_warm_connections_;
+    }
+
+    /// Configure passive outlier detection
+    void set_outlier_detection(OutlierDetectionConfig config) noexcept {
+        outlier_config_ = config;
+    }
+
+    /// Sweep backends for passive outliers: eject any whose consecutive
+    /// proxy failures or latency EWMA deviation crossed its threshold, and
+    /// reinstate ejected backends whose backoff expired. Runs on the
+    /// worker's timer cadence, never on the request path (selection just
+    /// reads the outlier_ejected flag).
+    void evaluate_outliers();
+
+    /// Select a backend via the configured balancer (health + circuit
+    /// breaker checks happen inside the balancer). key is the balancing
+    /// key - client IP for the default strategies, the configured request
+    /// attribute for consistent hashing
+    [[nodiscard]] Backend* select_backend(std::string_view key = {});
+
+    /// Request attribute to hash on for consistent hashing:
+    /// "ip", "path", "header:<name>" or "cookie:<name>"
+    void set_hash_key(std::string hash_key) { hash_key_ = std::move(hash_key); }
+    [[nodiscard]] std::string_view hash_key() const noexcept { return hash_key_; }
+
+    /// HTTP/2 to backends (h2c prior knowledge): one multiplexed
+    /// connection per backend instead of one pooled socket per request
+    void set_http2(bool enabled) noexcept { http2_ = enabled; }
+    [[nodiscard]] bool http2() const noexcept { return http2_; }
+
     /// Get upstream name
     [[nodiscard]] std::string_view name() const noexcept { return name_; }
 
     /// Get all backends
     [[nodiscard]] const std::vector<Backend>& backends() const noexcept { return backends_; }
+    [[nodiscard]] std::vector<Backend>& backends() noexcept { return backends_; }
 
     /// Get healthy backend count
     [[nodiscard]] size_t healthy_count() const noexcept;
@@ -230,6 +446,8 @@ public:
         size_t healthy_backends = 0;
         uint64_t total_requests = 0;
         uint64_t total_failures = 0;
+        uint64_t peak_ewma_latency_us = 0;  // Slowest backend's latency EWMA
+        size_t ejected_backends = 0;        // Currently ejected as passive outliers
     };
     [[nodiscard]] Stats get_stats() const;
 
@@ -243,6 +461,20 @@ private:
     std::string name_;
     std::vector<Backend> backends_;
     std::unique_ptr<LoadBalancer> balancer_;
+    std::string hash_key_ = "ip";
+    bool http2_ = false;
+    OutlierDetectionConfig outlier_config_;
+    HedgingConfig hedging_config_;
+    uint32_t hedge_delay_ms_ = 0;
+
+    // Hedge budget window (per worker - no synchronization)
+    std::chrono::steady_clock::time_point budget_window_start_{};
+    uint64_t budget_requests_ = 0;
+    uint64_t budget_hedges_ = 0;
+
+    size_t min_warm_connections_ = 0;
+    size_t prewarm_target_ = 0;
+    std::chrono::steady_clock::time_point prewarm_until_{};
     BackendConnectionPool backend_pool_;  // Simple FD-based pool for async backend
 };
 
@@ -270,11 +502,21 @@ public:
     /// Remove upstream by name
     void remove_upstream(std::string_view name);
 
+    /// Detach an upstream, transferring ownership to the caller (nullptr
+    /// if absent). Used by incremental config reload to carry unchanged
+    /// upstreams - warmed balancer, breaker and pool state included -
+    /// from the retiring manager into its replacement.
+    [[nodiscard]] std::unique_ptr<Upstream> release_upstream(std::string_view name);
+
     /// Clear all upstreams
     void clear();
 
+    /// Get per-worker DNS resolver (backend hostnames, background refresh)
+    [[nodiscard]] DnsResolver& dns_resolver() noexcept { return dns_resolver_; }
+
 private:
     std::vector<std::unique_ptr<Upstream>> upstreams_;
+    DnsResolver dns_resolver_;
 };
 
 }  // namespace titan::gateway
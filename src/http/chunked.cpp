@@ -0,0 +1,204 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Chunked Transfer-Encoding Decoder - Implementation
+
+#include "chunked.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "simd.hpp"
+
+namespace titan::http {
+
+bool ChunkedDecoder::parse_size_line(const char* line, size_t len) noexcept {
+    size_t value = 0;
+    size_t i = 0;
+    for (; i < len; ++i) {
+        const char c = line[i];
+        int digit;
+        if (c >= '0' && c <= '9') {
+            digit = c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            digit = c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            digit = c - 'A' + 10;
+        } else {
+            break;
+        }
+        if (value > (std::numeric_limits<size_t>::max() >> 4)) {
+            return false;  // Size would overflow
+        }
+        value = (value << 4) | static_cast<size_t>(digit);
+    }
+    if (i == 0) {
+        return false;  // No hex digits
+    }
+    // Anything after the size must be an extension (";token[=value]").
+    // Tolerate the BWS some servers emit before the semicolon; the
+    // extension itself is skipped unexamined.
+    while (i < len && (line[i] == ' ' || line[i] == '\t')) {
+        ++i;
+    }
+    if (i < len && line[i] != ';') {
+        return false;
+    }
+    remaining_ = value;
+    return true;
+}
+
+std::pair<ChunkedResult, size_t> ChunkedDecoder::feed(
+    std::span<const uint8_t> data, std::vector<std::span<const uint8_t>>& slices) {
+    const char* base = reinterpret_cast<const char*>(data.data());
+    const size_t len = data.size();
+    size_t pos = 0;
+
+    auto fail = [&]() -> std::pair<ChunkedResult, size_t> {
+        state_ = State::Failed;
+        return {ChunkedResult::Error, pos};
+    };
+
+    // Dispatch a complete size/trailer line (CRLF already stripped)
+    auto consume_line = [&](const char* line, size_t line_len) -> bool {
+        if (state_ == State::ChunkSize) {
+            if (!parse_size_line(line, line_len)) {
+                return false;
+            }
+            state_ = (remaining_ == 0) ? State::Trailers : State::ChunkData;
+        } else {  // Trailers: blank line ends the message, fields are dropped
+            if (line_len == 0) {
+                state_ = State::Done;
+            }
+        }
+        return true;
+    };
+
+    while (pos < len) {
+        switch (state_) {
+            case State::ChunkSize:
+            case State::Trailers: {
+                const char* scan = base + pos;
+                const size_t avail = len - pos;
+
+                if (!line_carry_.empty()) {
+                    // The line started in a previous feed; the terminating
+                    // CRLF may straddle the boundary, so extend the carry
+                    // through the first LF and validate there
+                    const char* lf = simd::find_char(scan, avail, '\n');
+                    if (!lf) {
+                        if (line_carry_.size() + avail > kMaxLineLength) {
+                            return fail();
+                        }
+                        line_carry_.append(scan, avail);
+                        pos = len;
+                        break;
+                    }
+                    const size_t take = static_cast<size_t>(lf - scan) + 1;
+                    if (line_carry_.size() + take > kMaxLineLength) {
+                        return fail();
+                    }
+                    line_carry_.append(scan, take);
+                    pos += take;
+                    if (line_carry_.size() < 2 ||
+                        line_carry_[line_carry_.size() - 2] != '\r') {
+                        return fail();  // Bare LF
+                    }
+                    const bool ok =
+                        consume_line(line_carry_.data(), line_carry_.size() - 2);
+                    line_carry_.clear();
+                    if (!ok) {
+                        return fail();
+                    }
+                    break;
+                }
+
+                // Common case: the whole line is in this feed - locate the
+                // CRLF with a wide scan and parse in place, no copy
+                const char* crlf = simd::find_crlf(scan, avail);
+                if (!crlf) {
+                    if (avail > kMaxLineLength) {
+                        return fail();
+                    }
+                    line_carry_.assign(scan, avail);
+                    pos = len;
+                    break;
+                }
+                const size_t line_len = static_cast<size_t>(crlf - scan);
+                if (line_len > kMaxLineLength) {
+                    return fail();
+                }
+                pos += line_len + 2;
+                if (!consume_line(scan, line_len)) {
+                    return fail();
+                }
+                break;
+            }
+
+            case State::ChunkData: {
+                // Payload passes through untouched: emit a span over the
+                // caller's buffer and advance
+                const size_t take = std::min(remaining_, len - pos);
+                slices.push_back(data.subspan(pos, take));
+                decoded_bytes_ += take;
+                remaining_ -= take;
+                pos += take;
+                if (remaining_ == 0) {
+                    state_ = State::DataCr;
+                }
+                break;
+            }
+
+            case State::DataCr:
+                if (base[pos] != '\r') {
+                    return fail();
+                }
+                ++pos;
+                state_ = State::DataLf;
+                break;
+
+            case State::DataLf:
+                if (base[pos] != '\n') {
+                    return fail();
+                }
+                ++pos;
+                state_ = State::ChunkSize;
+                break;
+
+            case State::Done:
+                // Bytes past the final CRLF belong to the next message
+                return {ChunkedResult::Complete, pos};
+
+            case State::Failed:
+                return {ChunkedResult::Error, pos};
+        }
+
+        if (state_ == State::Done) {
+            return {ChunkedResult::Complete, pos};
+        }
+    }
+
+    return {state_ == State::Done ? ChunkedResult::Complete : ChunkedResult::Incomplete, pos};
+}
+
+void ChunkedDecoder::reset() noexcept {
+    state_ = State::ChunkSize;
+    remaining_ = 0;
+    decoded_bytes_ = 0;
+    line_carry_.clear();
+}
+
+}  // namespace titan::http
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Chunked Transfer-Encoding Decoder - Header
+// Incremental, zero-copy: yields slices over the caller's recv buffer
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace titan::http {
+
+/// Decode result (mirrors ParseResult, kept separate so callers can
+/// distinguish framing errors from header-parse errors)
+enum class ChunkedResult : uint8_t {
+    Complete,    // Final chunk and trailers consumed
+    Incomplete,  // Need more data
+    Error        // Malformed chunk framing
+};
+
+/// Incremental decoder for HTTP/1.1 chunked transfer encoding.
+///
+/// Built for streaming backends (LLM-style APIs) that deliver a response
+/// as thousands of small chunks: each feed() call scans only the newly
+/// arrived bytes - chunk-size lines are located with the simd.hpp wide
+/// scans - and emits the chunk payloads as zero-copy spans over the fed
+/// buffer instead of compacting them into a contiguous allocation. Total
+/// decode cost is linear in bytes received, independent of how the bytes
+/// were split across reads.
+///
+/// The decoder keeps no pointers into fed data between calls (partial
+/// size/trailer lines are carried in a small owned buffer), so the
+/// caller may grow or reallocate its recv buffer freely between feeds.
+/// Emitted spans are only valid until the underlying buffer moves;
+/// callers whose buffer reallocates should convert them to offsets
+/// immediately (the spans point into the span passed to feed()).
+///
+/// Chunk extensions are skipped and trailer fields are consumed but not
+/// surfaced - the proxy path forwards neither.
+class ChunkedDecoder {
+public:
+    /// Decode newly arrived bytes. Appends one span per contiguous run of
+    /// chunk payload in 'data' to 'slices' (a chunk split across feeds
+    /// produces one span per feed). Returns the result and the number of
+    /// bytes consumed: all of 'data' on Incomplete, the bytes up to the
+    /// end of the final trailer CRLF on Complete, and the offset of the
+    /// offending byte on Error.
+    [[nodiscard]] std::pair<ChunkedResult, size_t> feed(
+        std::span<const uint8_t> data, std::vector<std::span<const uint8_t>>& slices);
+
+    /// Total payload bytes emitted so far (final body length on Complete)
+    [[nodiscard]] size_t decoded_bytes() const noexcept { return decoded_bytes_; }
+
+    /// Prepare for the next message (connection reuse)
+    void reset() noexcept;
+
+private:
+    enum class State : uint8_t {
+        ChunkSize,  // Scanning the "<hex>[;ext]\r\n" size line
+        ChunkData,  // Emitting payload bytes of the current chunk
+        DataCr,     // Expect '\r' terminating the chunk payload
+        DataLf,     // Expect '\n' terminating the chunk payload
+        Trailers,   // Consuming trailer lines until the blank line
+        Done,
+        Failed
+    };
+
+    // Size and trailer lines longer than this fail the message; bounds
+    // both the carry buffer and hostile chunk-extension growth
+    static constexpr size_t kMaxLineLength = 1024;
+
+    /// Parse a complete "<hex>[;ext]" size line (CRLF stripped).
+    /// Returns false on malformed input; on success sets remaining_.
+    [[nodiscard]] bool parse_size_line(const char* line, size_t len) noexcept;
+
+    State state_ = State::ChunkSize;
+    size_t remaining_ = 0;       // Payload bytes left in the current chunk
+    size_t decoded_bytes_ = 0;   // Payload bytes emitted across all chunks
+    std::string line_carry_;     // Partial size/trailer line spanning feeds
+};
+
+}  // namespace titan::http
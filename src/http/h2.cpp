@@ -41,7 +41,18 @@ bool is_http2_connection(std::span<const uint8_t> data) noexcept {
 // H2Session Implementation
 // ============================
 
-H2Session::H2Session(bool is_server) : is_server_(is_server) {
+namespace {
+
+// Opaque payload marking our BDP probe PINGs (peers echo it back in the ACK)
+constexpr uint8_t kBdpPingData[8] = {'t', 'i', 't', 'a', 'n', 'b', 'd', 'p'};
+
+// Retired H2Stream objects kept per session for reuse
+constexpr size_t kStreamPoolLimit = 64;
+
+}  // namespace
+
+H2Session::H2Session(bool is_server, uint32_t max_window)
+    : is_server_(is_server), max_window_(max_window < 65535 ? 65535 : max_window) {
     nghttp2_session_callbacks* callbacks;
     nghttp2_session_callbacks_new(&callbacks);
 
@@ -112,6 +123,89 @@ void H2Session::consume_send_buffer(size_t bytes) {
     }
 }
 
+void H2Session::record_bdp_bytes(size_t len) {
+    if (max_window_ <= current_window_) {
+        return;  // Already at the cap (or tuning disabled)
+    }
+
+    bdp_bytes_since_probe_ += len;
+
+    if (!bdp_ping_inflight_) {
+        // Launch a probe: DATA delivered until the ACK returns approximates
+        // one bandwidth-delay product
+        if (nghttp2_submit_ping(session_, NGHTTP2_FLAG_NONE, kBdpPingData) == 0) {
+            bdp_ping_inflight_ = true;
+            bdp_bytes_since_probe_ = len;
+        }
+    }
+}
+
+void H2Session::on_bdp_ping_ack() {
+    if (!bdp_ping_inflight_) {
+        return;
+    }
+    bdp_ping_inflight_ = false;
+
+    // Sample filled most of the window within one RTT - the peer is window
+    // limited, not bandwidth limited. Double until the sample fits or the
+    // configured cap is reached.
+    if (bdp_bytes_since_probe_ * 3 < static_cast<uint64_t>(current_window_) * 2) {
+        return;
+    }
+
+    uint64_t grown = static_cast<uint64_t>(current_window_) * 2;
+    uint32_t new_window = static_cast<uint32_t>(std::min<uint64_t>(grown, max_window_));
+    if (new_window == current_window_) {
+        return;
+    }
+
+    // Connection-level window: nghttp2 emits the WINDOW_UPDATE delta itself
+    if (nghttp2_session_set_local_window_size(session_, NGHTTP2_FLAG_NONE, 0,
+                                              static_cast<int32_t>(new_window)) != 0) {
+        return;
+    }
+
+    // Stream-level windows: a SETTINGS update rebases every stream's window
+    // (existing and future) by the delta
+    nghttp2_settings_entry entry = {NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE, new_window};
+    if (nghttp2_submit_settings(session_, NGHTTP2_FLAG_NONE, &entry, 1) != 0) {
+        return;
+    }
+
+    current_window_ = new_window;
+}
+
+// Static data read callback for request bodies (client mode)
+// Resolves the stream by ID through session user_data - stream pointers from
+// source->ptr would be stale if the streams map rehashes between submit and send.
+static ssize_t request_data_read_callback(nghttp2_session* /*session*/, int32_t stream_id,
+                                          uint8_t* buf, size_t length, uint32_t* data_flags,
+                                          nghttp2_data_source* /*source*/, void* user_data) {
+    auto* self = static_cast<H2Session*>(user_data);
+    auto* stream = self->get_stream(stream_id);
+
+    if (!stream || stream->request_body.empty()) {
+        *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+        return 0;
+    }
+
+    size_t remaining = stream->request_body.size() - stream->request_body_offset;
+    if (remaining == 0) {
+        *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+        return 0;
+    }
+
+    size_t to_copy = std::min(length, remaining);
+    std::memcpy(buf, stream->request_body.data() + stream->request_body_offset, to_copy);
+    stream->request_body_offset += to_copy;
+
+    if (stream->request_body_offset >= stream->request_body.size()) {
+        *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+    }
+
+    return static_cast<ssize_t>(to_copy);
+}
+
 std::error_code H2Session::submit_request(const Request& request, int32_t& stream_id) {
     if (is_server_) {
         return std::make_error_code(std::errc::operation_not_supported);
@@ -123,7 +217,13 @@ std::error_code H2Session::submit_request(const Request& request, int32_t& strea
     // Pseudo-headers (required for HTTP/2)
     std::string method_str = std::string(to_string(request.method));
     std::string path = std::string(request.path);
-    std::string scheme = "https";  // Use HTTPS for TLS connections (all HTTP/2 in production)
+    if (path.empty()) {
+        path = "/";
+    }
+    std::string scheme = "http";  // Backend connections are cleartext h2c (prior knowledge)
+
+    // :authority carries what Host would in HTTP/1.1 (RFC 9113 §8.3.1)
+    std::string authority = std::string(request.get_header(WellKnownHeader::Host, "backend"));
 
     headers.push_back({const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(":method")),
                        const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(method_str.c_str())),
@@ -137,21 +237,52 @@ std::error_code H2Session::submit_request(const Request& request, int32_t& strea
                        const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(scheme.c_str())), 7,
                        scheme.size(), NGHTTP2_NV_FLAG_NONE});
 
-    // Regular headers
+    headers.push_back({const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(":authority")),
+                       const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(authority.c_str())),
+                       10, authority.size(), NGHTTP2_NV_FLAG_NONE});
+
+    // Regular headers - connection-specific HTTP/1.1 headers are forbidden in
+    // HTTP/2 (RFC 9113 §8.2.2) and Host is carried by :authority above
     for (const auto& header : request.headers) {
+        if (header_name_equals(header.name, "Host") ||
+            header_name_equals(header.name, "Connection") ||
+            header_name_equals(header.name, "Keep-Alive") ||
+            header_name_equals(header.name, "Proxy-Connection") ||
+            header_name_equals(header.name, "Transfer-Encoding") ||
+            header_name_equals(header.name, "Upgrade")) {
+            continue;
+        }
         headers.push_back(
             {const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(header.name.data())),
              const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(header.value.data())),
              header.name.size(), header.value.size(), NGHTTP2_NV_FLAG_NONE});
     }
 
+    // Attach a data provider when the request carries a body
+    nghttp2_data_provider provider{};
+    nghttp2_data_provider* provider_ptr = nullptr;
+    if (!request.body.empty()) {
+        provider.source.ptr = nullptr;
+        provider.read_callback = request_data_read_callback;
+        provider_ptr = &provider;
+    }
+
     // Submit request
-    int32_t sid =
-        nghttp2_submit_request(session_, nullptr, headers.data(), headers.size(), nullptr, nullptr);
+    int32_t sid = nghttp2_submit_request(session_, nullptr, headers.data(), headers.size(),
+                                         provider_ptr, nullptr);
     if (sid < 0) {
         return std::make_error_code(std::errc::protocol_error);
     }
 
+    // Copy the body into owned stream storage before nghttp2 serializes frames -
+    // the caller's view may not outlive the send
+    auto& stream = get_or_create_stream(sid);
+    stream.state = H2StreamState::Open;
+    if (!request.body.empty()) {
+        stream.request_body.assign(request.body.begin(), request.body.end());
+        stream.request_body_offset = 0;
+    }
+
     stream_id = sid;
     return {};
 }
@@ -279,16 +410,18 @@ std::error_code H2Session::submit_response(int32_t stream_id, const Response& re
 }
 
 H2Stream* H2Session::get_stream(int32_t stream_id) {
-    auto it = streams_.find(stream_id);
-    if (it == streams_.end()) {
-        return nullptr;
+    for (auto& stream : streams_) {
+        if (stream->stream_id == stream_id) {
+            return stream.get();
+        }
     }
-    return it->second.get();
+    return nullptr;
 }
 
 std::vector<H2Stream*> H2Session::get_active_streams() {
     std::vector<H2Stream*> active;
-    for (auto& [sid, stream] : streams_) {
+    active.reserve(streams_.size());
+    for (auto& stream : streams_) {
         if (stream->state != H2StreamState::Closed) {
             active.push_back(stream.get());
         }
@@ -309,27 +442,90 @@ void H2Session::set_stream_close_callback(StreamCloseCallback callback) {
 }
 
 H2Stream& H2Session::get_or_create_stream(int32_t stream_id) {
-    auto it = streams_.find(stream_id);
-    if (it != streams_.end()) {
-        return *it->second;
+    if (auto* existing = get_stream(stream_id); existing) {
+        return *existing;
+    }
+
+    std::unique_ptr<H2Stream> stream;
+    if (!stream_pool_.empty()) {
+        // Reuse a retired stream - its header/body buffers keep their
+        // capacity, so the steady-state path allocates nothing
+        stream = std::move(stream_pool_.back());
+        stream_pool_.pop_back();
+    } else {
+        stream = std::make_unique<H2Stream>();
+
+        // Reserve capacity to prevent reallocation (which would invalidate string_views)
+        // Using 64 as a reasonable upper bound for typical requests (power of 2, ~4KB overhead)
+        stream->request_header_storage.reserve(64);
+        stream->response_header_storage.reserve(64);
     }
 
-    auto stream = std::make_unique<H2Stream>();
     stream->stream_id = stream_id;
     stream->state = H2StreamState::Open;
 
-    // Reserve capacity to prevent reallocation (which would invalidate string_views)
-    // Using 64 as a reasonable upper bound for typical requests (power of 2, ~4KB overhead)
-    stream->request_header_storage.reserve(64);
-    stream->response_header_storage.reserve(64);
-
     auto* ptr = stream.get();
-    streams_[stream_id] = std::move(stream);
+    streams_.push_back(std::move(stream));
     return *ptr;
 }
 
 void H2Session::remove_stream(int32_t stream_id) {
-    streams_.erase(stream_id);
+    for (auto it = streams_.begin(); it != streams_.end(); ++it) {
+        if ((*it)->stream_id == stream_id) {
+            auto stream = std::move(*it);
+            // Swap-erase: active-stream order carries no meaning
+            *it = std::move(streams_.back());
+            streams_.pop_back();
+
+            if (stream_pool_.size() < kStreamPoolLimit) {
+                stream->reset();
+                stream_pool_.push_back(std::move(stream));
+            }
+            return;
+        }
+    }
+}
+
+void H2Stream::reset() noexcept {
+    stream_id = -1;
+    state = H2StreamState::Idle;
+
+    // Clear without deallocating - vector/string capacity survives clear()
+    request.method = Method::UNKNOWN;
+    request.version = Version::HTTP_1_1;
+    request.uri = {};
+    request.path = {};
+    request.query = {};
+    request.headers.clear();
+    request.well_known.fill(0);
+    request.body = {};
+
+    response.version = Version::HTTP_2_0;
+    response.status = StatusCode::OK;
+    response.reason_phrase = {};
+    response.headers.clear();
+    response.well_known.fill(0);
+    response.backend_headers.clear();
+    response.middleware_headers.clear();
+    response.header_storage.clear();
+    response.body_storage.clear();
+    response.body = {};
+
+    request_body.clear();
+    response_body.clear();
+    request_body_offset = 0;
+    response_body_offset = 0;
+
+    path_storage.clear();
+    uri_storage.clear();
+    request_header_storage.clear();
+    response_header_storage.clear();
+    status_storage.clear();
+
+    data_provider = {};
+    request_complete = false;
+    response_complete = false;
+    response_submitted = false;
 }
 
 // ============================
@@ -380,6 +576,14 @@ int H2Session::on_frame_recv_callback(nghttp2_session* /*session*/, const nghttp
             }
             break;
 
+        case NGHTTP2_PING:
+            // BDP probe came back - one full RTT of DATA has been accounted
+            if ((frame->hd.flags & NGHTTP2_FLAG_ACK) &&
+                std::memcmp(frame->ping.opaque_data, kBdpPingData, sizeof(kBdpPingData)) == 0) {
+                self->on_bdp_ping_ack();
+            }
+            break;
+
         case NGHTTP2_GOAWAY:
             self->should_close_ = true;
             break;
@@ -440,7 +644,16 @@ int H2Session::on_header_callback(nghttp2_session* /*session*/, const nghttp2_fr
             // Regular header - store in owned storage first, then create views
             stream.request_header_storage.emplace_back(std::string(name_sv), std::string(value_sv));
             const auto& [owned_name, owned_value] = stream.request_header_storage.back();
-            stream.request.headers.push_back(Header{owned_name, owned_value});
+
+            // Tag well-known headers for the O(1) accessors (HTTP/2 names
+            // arrive lowercase; the ID lookup is case-insensitive)
+            auto id = well_known_header_id(owned_name);
+            stream.request.headers.push_back(Header{owned_name, owned_value, id});
+            if (id != WellKnownHeader::Unknown && stream.request.headers.size() <= 255 &&
+                stream.request.well_known[static_cast<size_t>(id)] == 0) {
+                stream.request.well_known[static_cast<size_t>(id)] =
+                    static_cast<uint8_t>(stream.request.headers.size());
+            }
         }
     } else {
         // Parsing response headers
@@ -452,7 +665,8 @@ int H2Session::on_header_callback(nghttp2_session* /*session*/, const nghttp2_fr
             stream.response_header_storage.emplace_back(std::string(name_sv),
                                                         std::string(value_sv));
             const auto& [owned_name, owned_value] = stream.response_header_storage.back();
-            stream.response.headers.push_back(Header{owned_name, owned_value});
+            stream.response.headers.push_back(
+                Header{owned_name, owned_value, well_known_header_id(owned_name)});
         }
     }
 
@@ -464,6 +678,9 @@ int H2Session::on_data_chunk_recv_callback(nghttp2_session* /*session*/, uint8_t
                                            void* user_data) {
     auto* self = static_cast<H2Session*>(user_data);
 
+    // Feed the flow-control auto-tuner regardless of stream bookkeeping
+    self->record_bdp_bytes(len);
+
     auto* stream = self->get_stream(stream_id);
     if (!stream) {
         return 0;
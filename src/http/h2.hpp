@@ -29,7 +29,6 @@
 #include <system_error>
 #include <vector>
 
-#include "../core/containers.hpp"
 #include "http.hpp"
 
 namespace titan::http {
@@ -61,6 +60,7 @@ struct H2Stream {
 
     std::vector<uint8_t> request_body;   // Accumulated request body data
     std::vector<uint8_t> response_body;  // Accumulated response body data
+    size_t request_body_offset = 0;      // Offset for chunked request body sending (client mode)
     size_t response_body_offset = 0;     // Offset for chunked response body sending
 
     // Storage for HTTP/2 pseudo-headers (request.path/uri are views into these)
@@ -82,6 +82,10 @@ struct H2Stream {
     bool request_complete = false;
     bool response_complete = false;
     bool response_submitted = false;  // Prevent duplicate nghttp2_submit_response calls
+
+    /// Clear per-stream state while keeping buffer capacity, so a pooled
+    /// stream's next use allocates nothing on the steady-state path
+    void reset() noexcept;
 };
 
 /// HTTP/2 session managing multiple streams over a single connection
@@ -92,7 +96,10 @@ public:
 
     /// Create HTTP/2 session
     /// is_server: true for server mode, false for client mode
-    explicit H2Session(bool is_server);
+    /// max_window: flow-control window cap for BDP auto-tuning - receive
+    /// windows start at the 64KB protocol default and grow toward the
+    /// observed bandwidth-delay product up to this cap (65535 disables it)
+    explicit H2Session(bool is_server, uint32_t max_window = 65535);
     ~H2Session();
 
     H2Session(const H2Session&) = delete;
@@ -134,11 +141,31 @@ private:
     bool is_server_;
     nghttp2_session* session_ = nullptr;
 
-    titan::core::fast_map<int32_t, std::unique_ptr<H2Stream>> streams_;
+    // Active streams in a small flat table: a connection carries a handful of
+    // concurrent streams, so a linear scan beats hashing. Retired streams
+    // park in stream_pool_ with their buffers intact, making stream
+    // setup/teardown allocation-free once the pool is warm.
+    std::vector<std::unique_ptr<H2Stream>> streams_;
+    std::vector<std::unique_ptr<H2Stream>> stream_pool_;
     std::vector<uint8_t> send_buffer_;
 
     bool should_close_ = false;
 
+    // BDP-based flow-control auto-tuning: a PING probe rides alongside DATA
+    // receipt; bytes delivered between probe and ACK approximate one
+    // bandwidth-delay product. While a probe fills most of the current
+    // window, the window is doubled (connection + stream) up to max_window_,
+    // so high-RTT peers stop stalling on WINDOW_UPDATE round trips.
+    uint32_t max_window_;                // Cap from control::Config
+    uint32_t current_window_ = 65535;    // Advertised receive window
+    bool bdp_ping_inflight_ = false;      // Probe sent, awaiting ACK
+    uint64_t bdp_bytes_since_probe_ = 0;  // DATA bytes since the probe left
+
+    /// Account received DATA bytes and launch a probe if none is in flight
+    void record_bdp_bytes(size_t len);
+    /// Probe ACK arrived: grow windows if the sample shows window exhaustion
+    void on_bdp_ping_ack();
+
     // Callback invoked when streams are closed
     StreamCloseCallback stream_close_callback_;
 
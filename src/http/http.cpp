@@ -28,6 +28,15 @@ namespace titan::http {
 // Request helper methods
 
 const Header* Request::find_header(std::string_view name) const noexcept {
+    // Fast path: parser-tagged well-known headers resolve by array index
+    auto id = well_known_header_id(name);
+    if (id != WellKnownHeader::Unknown) {
+        uint8_t slot = well_known[static_cast<size_t>(id)];
+        if (slot != 0 && slot <= headers.size()) {
+            return &headers[slot - 1];
+        }
+    }
+
     for (const auto& header : headers) {
         if (header_name_equals(header.name, name)) {
             return &header;
@@ -47,14 +56,14 @@ bool Request::has_header(std::string_view name) const noexcept {
 }
 
 size_t Request::content_length() const noexcept {
-    auto value = get_header("Content-Length", "0");
+    auto value = get_header(WellKnownHeader::ContentLength, "0");
     size_t length = 0;
     std::from_chars(value.data(), value.data() + value.size(), length);
     return length;
 }
 
 bool Request::keep_alive() const noexcept {
-    auto connection = get_header("Connection");
+    auto connection = get_header(WellKnownHeader::Connection);
 
     // HTTP/1.1 defaults to keep-alive
     if (version == Version::HTTP_1_1) {
@@ -155,7 +164,7 @@ void Response::add_header(std::string_view name, std::string_view value) {
     std::string_view name_view{header_storage.data() + name_offset, name.size()};
     std::string_view value_view{header_storage.data() + value_offset, value.size()};
 
-    headers.push_back({name_view, value_view});
+    headers.push_back({name_view, value_view, well_known_header_id(name_view)});
 }
 
 bool Response::remove_header(std::string_view name) {
@@ -241,14 +250,14 @@ void Response::set_content_type(std::string_view content_type) {
 }
 
 size_t Response::content_length() const noexcept {
-    auto value = get_header("Content-Length", "0");
+    auto value = get_header(WellKnownHeader::ContentLength, "0");
     size_t length = 0;
     std::from_chars(value.data(), value.data() + value.size(), length);
     return length;
 }
 
 bool Response::keep_alive() const noexcept {
-    auto connection = get_header("Connection");
+    auto connection = get_header(WellKnownHeader::Connection);
 
     // HTTP/1.1 defaults to keep-alive
     if (version == Version::HTTP_1_1) {
@@ -266,7 +275,7 @@ void Response::add_backend_header(std::string_view name, std::string_view value)
     // Zero-copy: Store string_views pointing to external storage (recv_buffer or
     // response_header_storage) CRITICAL: Caller must ensure lifetime (typically points to
     // recv_buffer)
-    backend_headers.push_back({name, value});
+    backend_headers.push_back({name, value, well_known_header_id(name)});
 }
 
 void Response::add_middleware_header(std::string_view name, std::string_view value) {
@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <deque>
 #include <span>
@@ -26,6 +28,8 @@
 #include <string_view>
 #include <vector>
 
+#include "well_known_headers.hpp"
+
 namespace titan::http {
 
 /// HTTP methods
@@ -89,6 +93,145 @@ enum class StatusCode : uint16_t {
 struct Header {
     std::string_view name;
     std::string_view value;
+
+    // Well-known name ID tagged at creation (parser, h2 decoder, header
+    // helpers). Lets serialization and hop-by-hop filters test one byte
+    // instead of a case-insensitive name compare.
+    WellKnownHeader known_id = WellKnownHeader::Unknown;
+};
+
+/// Small-buffer-optimized header array. The inline capacity covers
+/// typical header counts, so the common request never heap-allocates for
+/// header storage (our most frequent small allocation); larger sets
+/// spill to a single heap block. clear() keeps the spill block, matching
+/// the vector capacity-reuse the parser reset paths rely on.
+class HeaderVec {
+public:
+    static constexpr size_t kInlineCapacity = 16;
+
+    using value_type = Header;
+    using iterator = Header*;
+    using const_iterator = const Header*;
+
+    HeaderVec() = default;
+    HeaderVec(const HeaderVec& other) { assign_from(other); }
+    HeaderVec& operator=(const HeaderVec& other) {
+        if (this != &other) {
+            size_ = 0;
+            assign_from(other);
+        }
+        return *this;
+    }
+    HeaderVec(HeaderVec&& other) noexcept { move_from(std::move(other)); }
+    HeaderVec& operator=(HeaderVec&& other) noexcept {
+        if (this != &other) {
+            release();
+            move_from(std::move(other));
+        }
+        return *this;
+    }
+    ~HeaderVec() { release(); }
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] size_t capacity() const noexcept { return capacity_; }
+
+    void clear() noexcept { size_ = 0; }  // Keeps the spill block
+
+    void reserve(size_t n) {
+        if (n > capacity_) {
+            grow(n);
+        }
+    }
+
+    void push_back(const Header& h) {
+        if (size_ == capacity_) {
+            grow(capacity_ * 2);
+        }
+        data_[size_++] = h;
+    }
+
+    template <typename... Args>
+    Header& emplace_back(Args&&... args) {
+        if (size_ == capacity_) {
+            grow(capacity_ * 2);
+        }
+        data_[size_] = Header{std::forward<Args>(args)...};
+        return data_[size_++];
+    }
+
+    [[nodiscard]] Header& operator[](size_t i) noexcept { return data_[i]; }
+    [[nodiscard]] const Header& operator[](size_t i) const noexcept { return data_[i]; }
+    [[nodiscard]] Header& front() noexcept { return data_[0]; }
+    [[nodiscard]] Header& back() noexcept { return data_[size_ - 1]; }
+
+    [[nodiscard]] iterator begin() noexcept { return data_; }
+    [[nodiscard]] iterator end() noexcept { return data_ + size_; }
+    [[nodiscard]] const_iterator begin() const noexcept { return data_; }
+    [[nodiscard]] const_iterator end() const noexcept { return data_ + size_; }
+    [[nodiscard]] const Header* data() const noexcept { return data_; }
+
+    iterator erase(iterator pos) {
+        std::move(pos + 1, end(), pos);
+        --size_;
+        return pos;
+    }
+
+    iterator erase(iterator first, iterator last) {
+        std::move(last, end(), first);
+        size_ -= static_cast<size_t>(last - first);
+        return first;
+    }
+
+private:
+    void grow(size_t min_capacity) {
+        size_t new_capacity = std::max(min_capacity, capacity_ * 2);
+        Header* block = new Header[new_capacity];
+        std::copy(data_, data_ + size_, block);
+        if (data_ != inline_) {
+            delete[] data_;
+        }
+        data_ = block;
+        capacity_ = new_capacity;
+    }
+
+    void release() noexcept {
+        if (data_ != inline_) {
+            delete[] data_;
+            data_ = inline_;
+            capacity_ = kInlineCapacity;
+        }
+        size_ = 0;
+    }
+
+    void assign_from(const HeaderVec& other) {
+        if (other.size_ > capacity_) {
+            grow(other.size_);
+        }
+        std::copy(other.data_, other.data_ + other.size_, data_);
+        size_ = other.size_;
+    }
+
+    void move_from(HeaderVec&& other) noexcept {
+        if (other.data_ != other.inline_) {
+            // Steal the spill block
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            size_ = other.size_;
+            other.data_ = other.inline_;
+            other.capacity_ = kInlineCapacity;
+            other.size_ = 0;
+        } else {
+            std::copy(other.inline_, other.inline_ + other.size_, inline_);
+            size_ = other.size_;
+            other.size_ = 0;
+        }
+    }
+
+    Header* data_ = inline_;
+    size_t size_ = 0;
+    size_t capacity_ = kInlineCapacity;
+    Header inline_[kInlineCapacity];
 };
 
 /// HTTP request (zero-copy, all views into buffer)
@@ -101,12 +244,31 @@ struct Request {
     std::string_view path;   // URI without query string
     std::string_view query;  // Query string (if present)
 
-    // Headers stored in arena (small vector optimization)
-    std::vector<Header> headers;
+    // Headers: inline small-buffer storage (see HeaderVec)
+    HeaderVec headers;
 
     // Body (view into buffer)
     std::span<const uint8_t> body;
 
+    // Well-known header slots: ID -> 1-based index into headers (0 =
+    // absent), tagged by the parser as headers land. Slots are validated
+    // against headers.size() on read, so a cleared headers vector can't
+    // be indexed through a stale slot.
+    std::array<uint8_t, kWellKnownHeaderCount> well_known{};
+
+    // O(1) well-known accessor: array index instead of a scan with
+    // case-insensitive compares
+    [[nodiscard]] std::string_view get_header(WellKnownHeader id,
+                                              std::string_view default_value = {}) const noexcept {
+        uint8_t slot = well_known[static_cast<size_t>(id)];
+        return (slot != 0 && slot <= headers.size()) ? headers[slot - 1].value : default_value;
+    }
+
+    [[nodiscard]] bool has_header(WellKnownHeader id) const noexcept {
+        uint8_t slot = well_known[static_cast<size_t>(id)];
+        return slot != 0 && slot <= headers.size();
+    }
+
     // Helper: Find header by name (case-insensitive)
     [[nodiscard]] const Header* find_header(std::string_view name) const noexcept;
 
@@ -137,7 +299,7 @@ struct Response {
     // Backend headers: Zero-copy string_views into recv_buffer or response_header_storage
     // Lifetime: Valid until recv_buffer is reused (short-lived, performance-critical)
     // Usage: Populated by parser, copied from upstream responses
-    std::vector<Header> backend_headers;
+    HeaderVec backend_headers;
 
     // Middleware headers: Owned std::string pairs (safe, long-lived)
     // Lifetime: Valid until Response is destroyed (owned by Response)
@@ -147,7 +309,7 @@ struct Response {
 
     // DEPRECATED (Phase 1 compatibility):
     // Old unified storage - will be removed after full migration
-    std::vector<Header> headers;
+    HeaderVec headers;
     std::string header_storage;
 
     // Reserve capacity on first use (lazy initialization)
@@ -164,6 +326,29 @@ struct Response {
     // Body (may be owned or view)
     std::span<const uint8_t> body;
 
+    // Well-known header slots over the parser-filled `headers` vector
+    // (same contract as Request::well_known)
+    std::array<uint8_t, kWellKnownHeaderCount> well_known{};
+
+    // O(1) well-known accessor for parser-tagged headers; falls back to
+    // the scan for headers added by middleware after parsing
+    [[nodiscard]] std::string_view get_header(WellKnownHeader id,
+                                              std::string_view default_value = {}) const noexcept {
+        uint8_t slot = well_known[static_cast<size_t>(id)];
+        if (slot != 0 && slot <= headers.size()) {
+            return headers[slot - 1].value;
+        }
+        return get_header(well_known_header_name(id), default_value);
+    }
+
+    [[nodiscard]] bool has_header(WellKnownHeader id) const noexcept {
+        uint8_t slot = well_known[static_cast<size_t>(id)];
+        if (slot != 0 && slot <= headers.size()) {
+            return true;
+        }
+        return has_header(well_known_header_name(id));
+    }
+
     // Helper: Find header by name (case-insensitive)
     [[nodiscard]] const Header* find_header(std::string_view name) const noexcept;
 
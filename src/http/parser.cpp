@@ -18,10 +18,68 @@
 
 #include "parser.hpp"
 
+#include <charconv>
 #include <cstring>
 
+#include "simd.hpp"
+
 namespace titan::http {
 
+namespace {
+
+/// RFC 7230 tchar bitmap for header-name validation
+constexpr auto kTokenChar = [] {
+    std::array<bool, 256> table{};
+    constexpr std::string_view extra = "!#$%&'*+-.^_`|~";
+    for (char c = '0'; c <= '9'; ++c) table[static_cast<uint8_t>(c)] = true;
+    for (char c = 'a'; c <= 'z'; ++c) table[static_cast<uint8_t>(c)] = true;
+    for (char c = 'A'; c <= 'Z'; ++c) table[static_cast<uint8_t>(c)] = true;
+    for (char c : extra) table[static_cast<uint8_t>(c)] = true;
+    return table;
+}();
+
+[[nodiscard]] bool is_token(std::string_view s) noexcept {
+    if (s.empty()) {
+        return false;
+    }
+    for (char c : s) {
+        if (!kTokenChar[static_cast<uint8_t>(c)]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Method token -> enum; UNKNOWN defers to llhttp (extension methods)
+[[nodiscard]] Method parse_known_method(std::string_view token) noexcept {
+    switch (token.size()) {
+        case 3:
+            if (token == "GET") return Method::GET;
+            if (token == "PUT") return Method::PUT;
+            break;
+        case 4:
+            if (token == "POST") return Method::POST;
+            if (token == "HEAD") return Method::HEAD;
+            break;
+        case 5:
+            if (token == "PATCH") return Method::PATCH;
+            if (token == "TRACE") return Method::TRACE;
+            break;
+        case 6:
+            if (token == "DELETE") return Method::DELETE;
+            break;
+        case 7:
+            if (token == "OPTIONS") return Method::OPTIONS;
+            if (token == "CONNECT") return Method::CONNECT;
+            break;
+        default:
+            break;
+    }
+    return Method::UNKNOWN;
+}
+
+}  // namespace
+
 Parser::Parser() {
     // Initialize llhttp settings
     llhttp_settings_init(&settings_);
@@ -44,7 +102,10 @@ Parser::Parser() {
 Parser::~Parser() = default;
 
 Parser::Parser(Parser&& other) noexcept
-    : parser_(other.parser_), settings_(other.settings_), ctx_(other.ctx_) {
+    : parser_(other.parser_),
+      settings_(other.settings_),
+      ctx_(other.ctx_),
+      llhttp_engaged_(other.llhttp_engaged_) {
     parser_.data = &ctx_;
 }
 
@@ -53,13 +114,193 @@ Parser& Parser::operator=(Parser&& other) noexcept {
         parser_ = other.parser_;
         settings_ = other.settings_;
         ctx_ = other.ctx_;
+        llhttp_engaged_ = other.llhttp_engaged_;
         parser_.data = &ctx_;
     }
     return *this;
 }
 
+std::optional<std::pair<ParseResult, size_t>> Parser::try_fast_parse_request(
+    std::span<const uint8_t> data, Request& request) noexcept {
+    // Conservative limits; anything past them defers to llhttp
+    constexpr size_t kMaxFastHeaderBytes = 64 * 1024;
+    constexpr size_t kMaxFastHeaders = 128;
+
+    const char* base = reinterpret_cast<const char*>(data.data());
+    const char* end = base + data.size();
+
+    // Request line: one wide scan to the CRLF, two to split the tokens
+    const char* line_end = simd::find_crlf(base, data.size());
+    if (!line_end) {
+        if (data.size() > kMaxFastHeaderBytes) {
+            return std::nullopt;  // Let llhttp produce the overlong-line error
+        }
+        return std::pair{ParseResult::Incomplete, data.size()};
+    }
+
+    const char* sp1 = simd::find_char(base, static_cast<size_t>(line_end - base), ' ');
+    if (!sp1 || sp1 == base) {
+        return std::nullopt;
+    }
+    Method method = parse_known_method(std::string_view(base, static_cast<size_t>(sp1 - base)));
+    if (method == Method::UNKNOWN) {
+        return std::nullopt;  // Extension methods go through llhttp
+    }
+
+    const char* uri_start = sp1 + 1;
+    const char* sp2 =
+        simd::find_char(uri_start, static_cast<size_t>(line_end - uri_start), ' ');
+    if (!sp2 || sp2 == uri_start) {
+        return std::nullopt;
+    }
+    std::string_view uri(uri_start, static_cast<size_t>(sp2 - uri_start));
+    if (simd::find_ctl(uri.data(), uri.size()) != nullptr) {
+        return std::nullopt;
+    }
+
+    std::string_view version_token(sp2 + 1, static_cast<size_t>(line_end - (sp2 + 1)));
+    Version version;
+    if (version_token == "HTTP/1.1") {
+        version = Version::HTTP_1_1;
+    } else if (version_token == "HTTP/1.0") {
+        version = Version::HTTP_1_0;
+    } else {
+        return std::nullopt;
+    }
+
+    // Header block: CRLF-delimited lines, name:value split by one scan each
+    const char* p = line_end + 2;
+    request.headers.clear();
+    request.well_known.fill(0);
+    bool have_transfer_encoding = false;
+
+    while (true) {
+        if (end - p >= 2 && p[0] == '\r' && p[1] == '\n') {
+            p += 2;  // Empty line: end of headers
+            break;
+        }
+        const char* eol = simd::find_crlf(p, static_cast<size_t>(end - p));
+        if (!eol) {
+            if (static_cast<size_t>(end - base) > kMaxFastHeaderBytes) {
+                return std::nullopt;
+            }
+            return std::pair{ParseResult::Incomplete, data.size()};
+        }
+        if (*p == ' ' || *p == '\t') {
+            return std::nullopt;  // obs-fold: llhttp decides how to treat it
+        }
+
+        const char* colon = simd::find_char(p, static_cast<size_t>(eol - p), ':');
+        if (!colon || colon == p) {
+            return std::nullopt;
+        }
+        std::string_view name(p, static_cast<size_t>(colon - p));
+        if (!is_token(name)) {
+            return std::nullopt;
+        }
+
+        const char* value_start = colon + 1;
+        while (value_start < eol && (*value_start == ' ' || *value_start == '\t')) {
+            ++value_start;
+        }
+        const char* value_end = eol;
+        while (value_end > value_start && (value_end[-1] == ' ' || value_end[-1] == '\t')) {
+            --value_end;
+        }
+        std::string_view value(value_start, static_cast<size_t>(value_end - value_start));
+        if (simd::find_ctl(value.data(), value.size()) != nullptr) {
+            return std::nullopt;
+        }
+
+        if (request.headers.size() >= kMaxFastHeaders) {
+            return std::nullopt;
+        }
+        request.headers.push_back({name, value});
+
+        auto id = well_known_header_id(name);
+        if (id != WellKnownHeader::Unknown) {
+            auto slot_index = static_cast<size_t>(id);
+            if (id == WellKnownHeader::ContentLength && request.well_known[slot_index] != 0) {
+                return std::nullopt;  // Duplicate Content-Length: llhttp rejects it
+            }
+            if (id == WellKnownHeader::TransferEncoding) {
+                have_transfer_encoding = true;
+            }
+            if (request.well_known[slot_index] == 0) {
+                request.well_known[slot_index] =
+                    static_cast<uint8_t>(request.headers.size());
+            }
+        }
+
+        p = eol + 2;
+    }
+
+    // Body framing: chunked goes to llhttp; Content-Length is a bounds check
+    if (have_transfer_encoding) {
+        return std::nullopt;
+    }
+
+    auto header_bytes = static_cast<size_t>(p - base);
+    size_t consumed = header_bytes;
+    request.body = {};
+
+    auto content_length_value = request.get_header(WellKnownHeader::ContentLength);
+    if (!content_length_value.empty()) {
+        size_t content_length = 0;
+        auto [parse_end, ec] =
+            std::from_chars(content_length_value.data(),
+                            content_length_value.data() + content_length_value.size(),
+                            content_length);
+        if (ec != std::errc{} ||
+            parse_end != content_length_value.data() + content_length_value.size()) {
+            return std::nullopt;
+        }
+        if (data.size() - header_bytes < content_length) {
+            return std::pair{ParseResult::Incomplete, data.size()};
+        }
+        request.body = std::span<const uint8_t>(data.data() + header_bytes, content_length);
+        consumed = header_bytes + content_length;
+    }
+
+    request.method = method;
+    request.version = version;
+    request.uri = uri;
+
+    // Split path and query (same logic as on_url)
+    size_t query_pos = uri.find('?');
+    if (query_pos != std::string_view::npos) {
+        request.path = uri.substr(0, query_pos);
+        request.query = uri.substr(query_pos + 1);
+    } else {
+        request.path = uri;
+        request.query = {};
+    }
+
+    return std::pair{ParseResult::Complete, consumed};
+}
+
 std::pair<ParseResult, size_t> Parser::parse_request(std::span<const uint8_t> data,
                                                      Request& request) {
+    // SIMD fast path: handles the overwhelmingly common shape (known
+    // method, HTTP/1.x, no chunked body) with wide scans. Stateless, so
+    // it only runs while llhttp holds no partial-message state. (It frames
+    // whole messages, so headers-only mode always goes through llhttp.)
+    if (!llhttp_engaged_ && !ctx_.headers_only) {
+        if (auto fast = try_fast_parse_request(data, request)) {
+            ctx_.message_complete = (fast->first == ParseResult::Complete);
+            ctx_.error = HPE_OK;
+            return *fast;
+        }
+        // The fast path may have staged partial state before bailing;
+        // llhttp rebuilds the request from scratch
+        request.headers.clear();
+        request.well_known.fill(0);
+        request.uri = {};
+        request.path = {};
+        request.query = {};
+        request.body = {};
+    }
+
     // Initialize parser for request if needed
     if (parser_type_ != HTTP_REQUEST) {
         llhttp_init(&parser_, HTTP_REQUEST, &settings_);
@@ -81,6 +322,17 @@ std::pair<ParseResult, size_t> Parser::parse_request(std::span<const uint8_t> da
     // Calculate bytes consumed
     size_t consumed = data.size();
 
+    // Headers-only mode: the pause requested by on_headers_complete is the
+    // success case - consumed stops at the end of the header block
+    if (err == HPE_PAUSED && ctx_.headers_only) {
+        const char* pause_pos = llhttp_get_error_pos(&parser_);
+        if (pause_pos) {
+            consumed =
+                static_cast<size_t>(reinterpret_cast<const uint8_t*>(pause_pos) - data.data());
+        }
+        return {ParseResult::Complete, consumed};
+    }
+
     // On error, get actual error position
     if (err != HPE_OK && err != HPE_PAUSED_UPGRADE) {
         const char* error_pos = llhttp_get_error_pos(&parser_);
@@ -97,10 +349,29 @@ std::pair<ParseResult, size_t> Parser::parse_request(std::span<const uint8_t> da
         return {ParseResult::Complete, consumed};
     }
 
-    // Need more data (incomplete request)
+    // Need more data (incomplete request). llhttp now holds mid-message
+    // state, so the fast path stays disabled until reset().
+    llhttp_engaged_ = true;
     return {ParseResult::Incomplete, consumed};
 }
 
+std::pair<ParseResult, size_t> Parser::parse_request_headers(std::span<const uint8_t> data,
+                                                             Request& request) {
+    // Drop any mid-message llhttp state; the header block is short enough
+    // that re-parsing it from the start costs less than threading resume
+    // offsets through the caller
+    reset();
+    ctx_.headers_only = true;
+    auto result = parse_request(data, request);
+    if (result.first == ParseResult::Error) {
+        return result;  // Keep llhttp state for error_message()
+    }
+    // llhttp is paused (or mid-header); reset so the next message - after
+    // the caller has consumed the body itself - parses fresh
+    reset();
+    return result;
+}
+
 std::pair<ParseResult, size_t> Parser::parse_response(std::span<const uint8_t> data,
                                                       Response& response) {
     // Initialize parser for response if needed
@@ -124,6 +395,17 @@ std::pair<ParseResult, size_t> Parser::parse_response(std::span<const uint8_t> d
     // Calculate bytes consumed
     size_t consumed = data.size();
 
+    // Headers-only mode: the pause requested by on_headers_complete is the
+    // success case - consumed stops at the end of the header block
+    if (err == HPE_PAUSED && ctx_.headers_only) {
+        const char* pause_pos = llhttp_get_error_pos(&parser_);
+        if (pause_pos) {
+            consumed =
+                static_cast<size_t>(reinterpret_cast<const uint8_t*>(pause_pos) - data.data());
+        }
+        return {ParseResult::Complete, consumed};
+    }
+
     // On error, get actual error position
     if (err != HPE_OK && err != HPE_PAUSED_UPGRADE) {
         const char* error_pos = llhttp_get_error_pos(&parser_);
@@ -144,10 +426,31 @@ std::pair<ParseResult, size_t> Parser::parse_response(std::span<const uint8_t> d
     return {ParseResult::Incomplete, consumed};
 }
 
+std::pair<ParseResult, size_t> Parser::parse_response_headers(std::span<const uint8_t> data,
+                                                              Response& response) {
+    // Same shape as parse_request_headers: drop any mid-message state,
+    // parse from the start in headers-only mode, and leave the parser
+    // reset so the next message parses fresh
+    reset();
+    if (parser_type_ != HTTP_RESPONSE) {
+        llhttp_init(&parser_, HTTP_RESPONSE, &settings_);
+        parser_.data = &ctx_;
+        parser_type_ = HTTP_RESPONSE;
+    }
+    ctx_.headers_only = true;
+    auto result = parse_response(data, response);
+    if (result.first == ParseResult::Error) {
+        return result;  // Keep llhttp state for error_message()
+    }
+    reset();
+    return result;
+}
+
 void Parser::reset() {
     llhttp_init(&parser_, parser_type_, &settings_);
     parser_.data = &ctx_;
     ctx_ = Context{};
+    llhttp_engaged_ = false;
 }
 
 std::string_view Parser::error_message() const noexcept {
@@ -167,6 +470,14 @@ int Parser::on_message_begin(llhttp_t* parser) {
     auto* ctx = static_cast<Context*>(parser->data);
     ctx->message_complete = false;
     ctx->error = HPE_OK;
+
+    // Clear well-known header slots from any previous message
+    if (ctx->request) {
+        ctx->request->well_known.fill(0);
+    }
+    if (ctx->response) {
+        ctx->response->well_known.fill(0);
+    }
     return 0;
 }
 
@@ -226,13 +537,29 @@ int Parser::on_header_value(llhttp_t* parser, const char* at, size_t length) {
     if (!ctx->request && !ctx->response)
         return -1;
 
-    // Add header to request or response
-    Header header{ctx->current_header_field, std::string_view(at, length)};
+    // Add header to request or response, carrying the well-known-name ID
+    // inline so downstream filters skip the case-insensitive compare
+    auto id = well_known_header_id(ctx->current_header_field);
+    Header header{ctx->current_header_field, std::string_view(at, length), id};
+
+    // Tag well-known headers so get_header(WellKnownHeader) is an array
+    // index (first occurrence wins; slots are 1-based uint8, so headers
+    // past position 255 fall back to the scan)
 
     if (ctx->request) {
         ctx->request->headers.push_back(header);
+        if (id != WellKnownHeader::Unknown && ctx->request->headers.size() <= 255 &&
+            ctx->request->well_known[static_cast<size_t>(id)] == 0) {
+            ctx->request->well_known[static_cast<size_t>(id)] =
+                static_cast<uint8_t>(ctx->request->headers.size());
+        }
     } else if (ctx->response) {
         ctx->response->headers.push_back(header);
+        if (id != WellKnownHeader::Unknown && ctx->response->headers.size() <= 255 &&
+            ctx->response->well_known[static_cast<size_t>(id)] == 0) {
+            ctx->response->well_known[static_cast<size_t>(id)] =
+                static_cast<uint8_t>(ctx->response->headers.size());
+        }
     }
 
     ctx->last_was_field = false;
@@ -299,6 +626,13 @@ int Parser::on_headers_complete(llhttp_t* parser) {
         ctx->response->version = version;
     }
 
+    // Headers-only mode: pause here so llhttp_execute returns with the
+    // consumed count at the header/body boundary (HPE_PAUSED is an
+    // explicitly supported return for this callback)
+    if (ctx->headers_only) {
+        return HPE_PAUSED;
+    }
+
     return 0;
 }
 
@@ -56,12 +56,30 @@ public:
     [[nodiscard]] std::pair<ParseResult, size_t> parse_request(std::span<const uint8_t> data,
                                                                Request& request);
 
+    /// Parse only the header block of an HTTP request (streamed-body mode).
+    /// Returns Complete with consumed = header bytes once the blank line is
+    /// reached, leaving the body unread; 'request.body' stays empty and the
+    /// caller takes over body framing (Content-Length accounting). Always
+    /// re-parses from the start of 'data' and leaves the parser reset, so
+    /// it is safe to call after parse_request returned Incomplete.
+    [[nodiscard]] std::pair<ParseResult, size_t> parse_request_headers(
+        std::span<const uint8_t> data, Request& request);
+
     /// Parse HTTP response from buffer
     /// Returns ParseResult and number of bytes consumed
     /// On Complete, populates 'response' with zero-copy views into 'data'
     [[nodiscard]] std::pair<ParseResult, size_t> parse_response(std::span<const uint8_t> data,
                                                                 Response& response);
 
+    /// Parse only the header block of an HTTP response (streamed-body
+    /// mode, the response-side twin of parse_request_headers). Returns
+    /// Complete with consumed = header bytes once the blank line is
+    /// reached; 'response.body' stays empty and the caller takes over
+    /// body framing (e.g. ChunkedDecoder). Always re-parses from the
+    /// start of 'data' and leaves the parser reset.
+    [[nodiscard]] std::pair<ParseResult, size_t> parse_response_headers(
+        std::span<const uint8_t> data, Response& response);
+
     /// Reset parser state for next request/response
     void reset();
 
@@ -96,11 +114,24 @@ private:
         std::string_view current_header_field;
         bool last_was_field = false;
         bool message_complete = false;
+        bool headers_only = false;  // Pause at end of headers (parse_request_headers)
         llhttp_errno_t error = HPE_OK;
     };
 
     Context ctx_;
     llhttp_type_t parser_type_ = HTTP_REQUEST;  // Track current parser type
+
+    // True while llhttp holds partial-message state for this request.
+    // The SIMD fast path is stateless (it re-parses the whole span each
+    // call), so once llhttp has consumed bytes mid-message the fast path
+    // must stay out of the way until reset().
+    bool llhttp_engaged_ = false;
+
+    /// SIMD fast path: tokenize a complete, simply-framed HTTP/1.x request
+    /// (no chunked encoding, no obs-fold) with wide scans. Returns the
+    /// result when it can conclusively parse; nullopt defers to llhttp.
+    [[nodiscard]] static std::optional<std::pair<ParseResult, size_t>> try_fast_parse_request(
+        std::span<const uint8_t> data, Request& request) noexcept;
 };
 
 /// Helper: Parse entire HTTP request (convenience wrapper)
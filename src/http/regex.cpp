@@ -17,12 +17,117 @@ static std::string get_pcre2_error(int error_code) {
     return std::string(reinterpret_cast<const char*>(buffer));
 }
 
+namespace {
+
+/// True when the pattern fragment contains no PCRE2 metacharacters
+/// (including backslash escapes - those stay on the generic path)
+bool is_plain_literal(std::string_view fragment) {
+    for (char c : fragment) {
+        switch (c) {
+            case '\\':
+            case '^':
+            case '$':
+            case '.':
+            case '[':
+            case ']':
+            case '(':
+            case ')':
+            case '*':
+            case '+':
+            case '?':
+            case '{':
+            case '}':
+            case '|':
+                return false;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+/// Thread-local reusable match data for generic patterns. One allocation
+/// per thread instead of one per match; patterns with more captures than
+/// the pooled ovector fall back to a per-call allocation.
+class MatchDataPool {
+public:
+    static constexpr uint32_t kOvecPairs = 16;
+
+    ~MatchDataPool() {
+        if (match_data_) {
+            pcre2_match_data_free(match_data_);
+        }
+    }
+
+    [[nodiscard]] pcre2_match_data* get() {
+        if (!match_data_) {
+            match_data_ = pcre2_match_data_create(kOvecPairs, nullptr);
+        }
+        return match_data_;
+    }
+
+private:
+    pcre2_match_data* match_data_ = nullptr;
+};
+
+thread_local MatchDataPool t_match_data;
+
+}  // namespace
+
 // Regex implementation
 
 Regex::Regex(pcre2_real_code_8* code, std::string pattern)
-    : code_(code), pattern_(std::move(pattern)) {}
+    : code_(code), pattern_(std::move(pattern)) {
+    uint32_t captures = 0;
+    if (pcre2_pattern_info(code_, PCRE2_INFO_CAPTURECOUNT, &captures) == 0) {
+        capture_count_ = captures;
+    }
+    classify();
+}
+
+void Regex::classify() {
+    std::string_view p = pattern_;
+
+    bool anchored_start = !p.empty() && p.front() == '^';
+    if (anchored_start) {
+        p.remove_prefix(1);
+    }
+    bool anchored_end = !p.empty() && p.back() == '$';
+    std::string_view body = anchored_end ? p.substr(0, p.size() - 1) : p;
+
+    // ^lit.* (optionally $-terminated): the greedy wildcard consumes to
+    // the end, so this is a pure starts_with test
+    if (anchored_start && body.ends_with(".*")) {
+        std::string_view literal = body.substr(0, body.size() - 2);
+        if (!literal.empty() && is_plain_literal(literal)) {
+            kind_ = Kind::PrefixWildcard;
+            literal_ = literal;
+            return;
+        }
+    }
 
-Regex::Regex(Regex&& other) noexcept : code_(other.code_), pattern_(std::move(other.pattern_)) {
+    if (body.empty() || !is_plain_literal(body)) {
+        return;  // Generic: PCRE2 handles it
+    }
+
+    if (anchored_start && anchored_end) {
+        kind_ = Kind::AnchoredLiteral;
+    } else if (anchored_start) {
+        kind_ = Kind::PrefixLiteral;
+    } else if (anchored_end) {
+        kind_ = Kind::SuffixLiteral;
+    } else {
+        kind_ = Kind::Literal;
+    }
+    literal_ = body;
+}
+
+Regex::Regex(Regex&& other) noexcept
+    : code_(other.code_),
+      pattern_(std::move(other.pattern_)),
+      kind_(other.kind_),
+      literal_(std::move(other.literal_)),
+      capture_count_(other.capture_count_) {
     other.code_ = nullptr;
 }
 
@@ -33,6 +138,9 @@ Regex& Regex::operator=(Regex&& other) noexcept {
         }
         code_ = other.code_;
         pattern_ = std::move(other.pattern_);
+        kind_ = other.kind_;
+        literal_ = std::move(other.literal_);
+        capture_count_ = other.capture_count_;
         other.code_ = nullptr;
     }
     return *this;
@@ -63,11 +171,31 @@ std::optional<Regex> Regex::compile(std::string_view pattern, std::string& error
         return std::nullopt;
     }
 
+    // JIT-compile for the generic path; on failure pcre2_match silently
+    // uses the interpreted form, so the result is advisory
+    (void)pcre2_jit_compile(code, PCRE2_JIT_COMPLETE);
+
     return Regex(code, std::string(pattern));
 }
 
 bool Regex::matches(std::string_view subject) const {
-    auto* match_data = pcre2_match_data_create_from_pattern(code_, nullptr);
+    switch (kind_) {
+        case Kind::Literal:
+            return subject.find(literal_) != std::string_view::npos;
+        case Kind::AnchoredLiteral:
+            return subject == literal_;
+        case Kind::PrefixLiteral:
+        case Kind::PrefixWildcard:
+            return subject.starts_with(literal_);
+        case Kind::SuffixLiteral:
+            return subject.ends_with(literal_);
+        case Kind::Generic:
+            break;
+    }
+
+    bool pooled = capture_count_ + 1 <= MatchDataPool::kOvecPairs;
+    auto* match_data =
+        pooled ? t_match_data.get() : pcre2_match_data_create_from_pattern(code_, nullptr);
     if (!match_data) {
         return false;
     }
@@ -77,13 +205,50 @@ bool Regex::matches(std::string_view subject) const {
                          0,  // options
                          match_data, nullptr);
 
-    pcre2_match_data_free(match_data);
+    if (!pooled) {
+        pcre2_match_data_free(match_data);
+    }
 
     return rc >= 0;  // >= 0 means match found
 }
 
 std::optional<std::string_view> Regex::find_first(std::string_view subject) const {
-    auto* match_data = pcre2_match_data_create_from_pattern(code_, nullptr);
+    switch (kind_) {
+        case Kind::Literal: {
+            size_t pos = subject.find(literal_);
+            if (pos == std::string_view::npos) {
+                return std::nullopt;
+            }
+            return subject.substr(pos, literal_.size());
+        }
+        case Kind::AnchoredLiteral:
+            if (subject == literal_) {
+                return subject;
+            }
+            return std::nullopt;
+        case Kind::PrefixLiteral:
+            if (subject.starts_with(literal_)) {
+                return subject.substr(0, literal_.size());
+            }
+            return std::nullopt;
+        case Kind::PrefixWildcard:
+            // The greedy .* extends the match to the end of the subject
+            if (subject.starts_with(literal_)) {
+                return subject;
+            }
+            return std::nullopt;
+        case Kind::SuffixLiteral:
+            if (subject.ends_with(literal_)) {
+                return subject.substr(subject.size() - literal_.size());
+            }
+            return std::nullopt;
+        case Kind::Generic:
+            break;
+    }
+
+    bool pooled = capture_count_ + 1 <= MatchDataPool::kOvecPairs;
+    auto* match_data =
+        pooled ? t_match_data.get() : pcre2_match_data_create_from_pattern(code_, nullptr);
     if (!match_data) {
         return std::nullopt;
     }
@@ -94,7 +259,9 @@ std::optional<std::string_view> Regex::find_first(std::string_view subject) cons
                          match_data, nullptr);
 
     if (rc < 0) {
-        pcre2_match_data_free(match_data);
+        if (!pooled) {
+            pcre2_match_data_free(match_data);
+        }
         return std::nullopt;
     }
 
@@ -102,7 +269,9 @@ std::optional<std::string_view> Regex::find_first(std::string_view subject) cons
     PCRE2_SIZE start = ovector[0];
     PCRE2_SIZE end = ovector[1];
 
-    pcre2_match_data_free(match_data);
+    if (!pooled) {
+        pcre2_match_data_free(match_data);
+    }
 
     return subject.substr(start, end - start);
 }
@@ -110,7 +279,19 @@ std::optional<std::string_view> Regex::find_first(std::string_view subject) cons
 std::vector<std::string_view> Regex::extract_groups(std::string_view subject) const {
     std::vector<std::string_view> groups;
 
-    auto* match_data = pcre2_match_data_create_from_pattern(code_, nullptr);
+    // The fast-path kinds carry no capture groups: the result is just
+    // the full match (index 0), exactly as PCRE2 would report it
+    if (kind_ != Kind::Generic) {
+        auto match = find_first(subject);
+        if (match.has_value()) {
+            groups.push_back(*match);
+        }
+        return groups;
+    }
+
+    bool pooled = capture_count_ + 1 <= MatchDataPool::kOvecPairs;
+    auto* match_data =
+        pooled ? t_match_data.get() : pcre2_match_data_create_from_pattern(code_, nullptr);
     if (!match_data) {
         return groups;
     }
@@ -121,7 +302,9 @@ std::vector<std::string_view> Regex::extract_groups(std::string_view subject) co
                          match_data, nullptr);
 
     if (rc < 0) {
-        pcre2_match_data_free(match_data);
+        if (!pooled) {
+            pcre2_match_data_free(match_data);
+        }
         return groups;
     }
 
@@ -139,12 +322,67 @@ std::vector<std::string_view> Regex::extract_groups(std::string_view subject) co
         }
     }
 
-    pcre2_match_data_free(match_data);
+    if (!pooled) {
+        pcre2_match_data_free(match_data);
+    }
 
     return groups;
 }
 
 std::string Regex::substitute(std::string_view subject, std::string_view replacement) const {
+    // Fast-path kinds have no capture groups; as long as the replacement
+    // carries no $ references the substitution is pure string splicing.
+    // (A literal $ in the replacement means PCRE2 syntax - fall through.)
+    if (kind_ != Kind::Generic && replacement.find('$') == std::string_view::npos) {
+        switch (kind_) {
+            case Kind::AnchoredLiteral:
+                if (subject == literal_) {
+                    return std::string(replacement);
+                }
+                return std::string(subject);
+            case Kind::PrefixLiteral:
+                if (subject.starts_with(literal_)) {
+                    std::string out(replacement);
+                    out.append(subject.substr(literal_.size()));
+                    return out;
+                }
+                return std::string(subject);
+            case Kind::PrefixWildcard:
+                // The greedy .* consumes the rest: the whole subject is
+                // the match
+                if (subject.starts_with(literal_)) {
+                    return std::string(replacement);
+                }
+                return std::string(subject);
+            case Kind::SuffixLiteral:
+                if (subject.ends_with(literal_)) {
+                    std::string out(subject.substr(0, subject.size() - literal_.size()));
+                    out.append(replacement);
+                    return out;
+                }
+                return std::string(subject);
+            case Kind::Literal: {
+                // Global replacement, matching PCRE2_SUBSTITUTE_GLOBAL
+                std::string out;
+                out.reserve(subject.size());
+                size_t pos = 0;
+                while (pos <= subject.size()) {
+                    size_t hit = subject.find(literal_, pos);
+                    if (hit == std::string_view::npos) {
+                        break;
+                    }
+                    out.append(subject.substr(pos, hit - pos));
+                    out.append(replacement);
+                    pos = hit + literal_.size();
+                }
+                out.append(subject.substr(pos));
+                return out;
+            }
+            case Kind::Generic:
+                break;
+        }
+    }
+
     // PCRE2 substitute API performs regex substitution with backreferences
     PCRE2_SIZE out_len = subject.size() * 2 + replacement.size() * 2;  // Initial estimate
     std::string output(out_len, '\0');
@@ -15,6 +15,11 @@ namespace titan::http {
 
 // PCRE2 wrapper for regex compilation and execution
 // Thread-safe for read operations after compilation
+//
+// Compile-time pattern analysis classifies anchored literals, literal
+// prefixes/suffixes and single-wildcard patterns; those match with plain
+// memcmp-style string ops and never enter PCRE2. Everything else keeps
+// JIT-compiled PCRE2 with a thread-local match-data pool.
 class Regex {
 public:
     // Compile a regex pattern
@@ -54,11 +59,30 @@ public:
     // Get the original pattern string
     [[nodiscard]] std::string_view pattern() const { return pattern_; }
 
+    // Fast-path classification (exposed for diagnostics)
+    enum class Kind : uint8_t {
+        Generic,          // Needs PCRE2
+        Literal,          // No metacharacters: substring containment
+        AnchoredLiteral,  // ^lit$ : exact equality
+        PrefixLiteral,    // ^lit  : starts_with
+        SuffixLiteral,    // lit$  : ends_with
+        PrefixWildcard,   // ^lit.* (optionally $-terminated) : starts_with
+    };
+    [[nodiscard]] Kind kind() const noexcept { return kind_; }
+
 private:
     explicit Regex(pcre2_real_code_8* code, std::string pattern);
 
+    /// Classify the pattern and extract its literal core (sets kind_ and
+    /// literal_). Called once from compile().
+    void classify();
+
     pcre2_real_code_8* code_;  // Compiled regex (owned)
     std::string pattern_;      // Original pattern (for debugging)
+
+    Kind kind_ = Kind::Generic;
+    std::string literal_;         // Literal core for the fast-path kinds
+    uint32_t capture_count_ = 0;  // PCRE2_INFO_CAPTURECOUNT (sizing match data)
 };
 
 // Utility function for URL encoding/decoding
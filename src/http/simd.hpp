@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -70,6 +71,28 @@ public:
     bool has_avx2() const noexcept { return features_ & SIMDFeature::AVX2; }
     bool has_neon() const noexcept { return features_ & SIMDFeature::NEON; }
 
+    /// Widest kernel the hot paths will actually take at runtime.
+    /// Kernels are compile-time gated, so build flags cap the answer:
+    /// a binary built without -mavx2 reports SSE2 even on AVX2 hardware.
+    const char* active_kernel() const noexcept {
+#if defined(__AVX2__)
+        if (has_avx2()) {
+            return "AVX2 (32B/iter)";
+        }
+#endif
+#if defined(__x86_64__) || defined(_M_X64)
+        if (has_sse2()) {
+            return "SSE2 (16B/iter)";
+        }
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+        if (has_neon()) {
+            return "NEON (16B/iter)";
+        }
+#endif
+        return "scalar";
+    }
+
 private:
     CPUFeatures() : features_(detect_features()) {}
 
@@ -80,8 +103,8 @@ private:
         // x86_64 always has SSE2
         result = result | SIMDFeature::SSE2;
 
-        // Check for AVX2 using Clang built-in (no headers needed!)
-#if defined(__clang__)
+        // Check for AVX2 using compiler built-in (no headers needed!)
+#if defined(__clang__) || defined(__GNUC__)
         if (__builtin_cpu_supports("avx2")) {
             result = result | SIMDFeature::AVX2;
         }
@@ -255,6 +278,96 @@ inline const char* find_crlf(const char* data, size_t len) noexcept {
     return nullptr;
 }
 
+// Find first byte that is not a legal header-value octet: control chars
+// below 0x20 (except HT) and DEL. obs-text (0x80-0xFF) is allowed, so the
+// comparisons are unsigned. Returns pointer to the offending byte or
+// nullptr if the whole range is clean.
+inline const char* find_ctl(const char* data, size_t len) noexcept {
+    const char* ptr = data;
+    const char* end = data + len;
+
+#if defined(__AVX2__)
+    if (CPUFeatures::instance().has_avx2() && len >= 32) {
+        const __m256i sp = _mm256_set1_epi8(0x20);
+        const __m256i del = _mm256_set1_epi8(0x7F);
+        const __m256i ht = _mm256_set1_epi8(0x09);
+        const __m256i ones = _mm256_set1_epi8(-1);
+
+        while (ptr + 32 <= end) {
+            __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+            // below_sp = chunk < 0x20 (unsigned): max(chunk, 0x20) != chunk
+            __m256i ge_sp = _mm256_cmpeq_epi8(_mm256_max_epu8(chunk, sp), chunk);
+            __m256i is_del = _mm256_cmpeq_epi8(chunk, del);
+            __m256i is_ht = _mm256_cmpeq_epi8(chunk, ht);
+            __m256i bad = _mm256_andnot_si256(
+                is_ht, _mm256_or_si256(_mm256_andnot_si256(ge_sp, ones), is_del));
+            int mask = _mm256_movemask_epi8(bad);
+            if (mask != 0) {
+                return ptr + __builtin_ctz(mask);
+            }
+            ptr += 32;
+        }
+    }
+#elif defined(__SSE2__)
+    if (CPUFeatures::instance().has_sse2() && len >= 16) {
+        const __m128i sp = _mm_set1_epi8(0x20);
+        const __m128i del = _mm_set1_epi8(0x7F);
+        const __m128i ht = _mm_set1_epi8(0x09);
+        const __m128i ones = _mm_set1_epi8(-1);
+
+        while (ptr + 16 <= end) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+            __m128i ge_sp = _mm_cmpeq_epi8(_mm_max_epu8(chunk, sp), chunk);
+            __m128i is_del = _mm_cmpeq_epi8(chunk, del);
+            __m128i is_ht = _mm_cmpeq_epi8(chunk, ht);
+            __m128i bad =
+                _mm_andnot_si128(is_ht, _mm_or_si128(_mm_andnot_si128(ge_sp, ones), is_del));
+            int mask = _mm_movemask_epi8(bad);
+            if (mask != 0) {
+                return ptr + __builtin_ctz(mask);
+            }
+            ptr += 16;
+        }
+    }
+#elif defined(__aarch64__)
+    if (CPUFeatures::instance().has_neon() && len >= 16) {
+        const uint8x16_t sp = vdupq_n_u8(0x20);
+        const uint8x16_t del = vdupq_n_u8(0x7F);
+        const uint8x16_t ht = vdupq_n_u8(0x09);
+
+        while (ptr + 16 <= end) {
+            uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(ptr));
+            uint8x16_t below_sp = vcltq_u8(chunk, sp);
+            uint8x16_t is_del = vceqq_u8(chunk, del);
+            uint8x16_t is_ht = vceqq_u8(chunk, ht);
+            uint8x16_t bad = vbicq_u8(vorrq_u8(below_sp, is_del), is_ht);
+
+            uint64x2_t bad64 = vreinterpretq_u64_u8(bad);
+            if (vgetq_lane_u64(bad64, 0) != 0 || vgetq_lane_u64(bad64, 1) != 0) {
+                for (int i = 0; i < 16; i++) {
+                    auto c = static_cast<uint8_t>(ptr[i]);
+                    if ((c < 0x20 && c != 0x09) || c == 0x7F) {
+                        return ptr + i;
+                    }
+                }
+            }
+            ptr += 16;
+        }
+    }
+#endif
+
+    // Scalar fallback for remaining bytes
+    while (ptr < end) {
+        auto c = static_cast<uint8_t>(*ptr);
+        if ((c < 0x20 && c != 0x09) || c == 0x7F) {
+            return ptr;
+        }
+        ptr++;
+    }
+
+    return nullptr;
+}
+
 // Convert ASCII character to lowercase
 inline char to_lower(char c) noexcept {
     // Branchless: set bit 5 if c is uppercase (A-Z)
@@ -495,8 +608,13 @@ inline void unmask_payload(uint8_t* payload, size_t length, uint32_t masking_key
             ptr += 32;
         }
     }
-#elif defined(__SSE2__)
-    if (CPUFeatures::instance().has_sse2() && length >= 16) {
+#endif
+#if defined(__x86_64__) || defined(_M_X64)
+    // Independent of the AVX2 block above (not #elif): on an AVX2 build
+    // running on SSE2-only hardware this is the vector path, and on AVX2
+    // hardware it mops up the 16..31 byte tail left by the 32-byte loop.
+    // Vector widths are multiples of 4, so the mask phase stays aligned.
+    if (CPUFeatures::instance().has_sse2() && static_cast<size_t>(end - ptr) >= 16) {
         // Create 128-bit mask: repeat 4-byte pattern 4 times
         __m128i mask_vec =
             _mm_set_epi8(key_bytes[3], key_bytes[2], key_bytes[1], key_bytes[0],  // Bytes 12-15
@@ -539,4 +657,156 @@ inline void unmask_payload(uint8_t* payload, size_t length, uint32_t masking_key
     }
 }
 
+// ============================================================================
+// Base64url Decoding (RFC 4648 §5)
+// ============================================================================
+
+namespace detail {
+
+// Maps base64 characters to their 6-bit values, 0xFF for invalid bytes.
+// Accepts both the url-safe ('-', '_') and standard ('+', '/') alphabets so
+// callers that historically tolerated either keep working. '=' is treated
+// as invalid here; callers strip padding before decoding.
+inline constexpr auto kBase64DecodeTable = [] {
+    std::array<uint8_t, 256> table{};
+    for (auto& entry : table) {
+        entry = 0xFF;
+    }
+    for (int i = 0; i < 26; ++i) {
+        table[static_cast<size_t>('A') + i] = static_cast<uint8_t>(i);
+        table[static_cast<size_t>('a') + i] = static_cast<uint8_t>(26 + i);
+    }
+    for (int i = 0; i < 10; ++i) {
+        table[static_cast<size_t>('0') + i] = static_cast<uint8_t>(52 + i);
+    }
+    table[static_cast<size_t>('-')] = 62;
+    table[static_cast<size_t>('+')] = 62;
+    table[static_cast<size_t>('_')] = 63;
+    table[static_cast<size_t>('/')] = 63;
+    return table;
+}();
+
+}  // namespace detail
+
+// Decode unpadded base64url into dst. Returns the decoded length, or
+// SIZE_MAX if the input contains an invalid character or has an impossible
+// length (len % 4 == 1). dst must hold the decoded length: (len / 4) * 3
+// plus 1-2 bytes for a trailing partial quantum.
+inline size_t base64url_decode(const char* src, size_t len, uint8_t* dst) noexcept {
+    if (len % 4 == 1) {
+        return SIZE_MAX;
+    }
+
+    const auto* in = reinterpret_cast<const uint8_t*>(src);
+    size_t pos = 0;
+    uint8_t* out = dst;
+
+#if defined(__AVX2__)
+    // Vector path: classify + pack 32 chars into 24 bytes per iteration
+    // (maddubs/madd 6-bit merge). Strict url-safe alphabet only - a chunk
+    // containing '+', '/', or garbage drops to the scalar loop below, which
+    // is also where SSE2/NEON builds go (the packing needs byte shuffles
+    // those baselines lack). Each store writes 32 bytes of which 24 are
+    // meaningful; keeping >= 32 chars for the scalar tail guarantees the
+    // stray 8 bytes land inside output the tail overwrites.
+    if (CPUFeatures::instance().has_avx2() && len >= 64) {
+        const __m256i ch_upper_lo = _mm256_set1_epi8('A');
+        const __m256i ch_upper_hi = _mm256_set1_epi8('Z');
+        const __m256i ch_lower_lo = _mm256_set1_epi8('a');
+        const __m256i ch_lower_hi = _mm256_set1_epi8('z');
+        const __m256i ch_digit_lo = _mm256_set1_epi8('0');
+        const __m256i ch_digit_hi = _mm256_set1_epi8('9');
+        const __m256i ch_dash = _mm256_set1_epi8('-');
+        const __m256i ch_under = _mm256_set1_epi8('_');
+        const __m256i pack_shuf = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1,
+                                                   -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                                                   -1, -1, -1, -1);
+        const __m256i pack_perm = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 0, 0);
+
+        while (len - pos >= 64) {
+            __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + pos));
+
+            // Unsigned range tests: max(c, lo) == c means c >= lo,
+            // min(c, hi) == c means c <= hi.
+            __m256i upper =
+                _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_max_epu8(chunk, ch_upper_lo), chunk),
+                                 _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, ch_upper_hi), chunk));
+            __m256i lower =
+                _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_max_epu8(chunk, ch_lower_lo), chunk),
+                                 _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, ch_lower_hi), chunk));
+            __m256i digit =
+                _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_max_epu8(chunk, ch_digit_lo), chunk),
+                                 _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, ch_digit_hi), chunk));
+            __m256i dash = _mm256_cmpeq_epi8(chunk, ch_dash);
+            __m256i under = _mm256_cmpeq_epi8(chunk, ch_under);
+
+            __m256i valid = _mm256_or_si256(
+                _mm256_or_si256(upper, lower),
+                _mm256_or_si256(digit, _mm256_or_si256(dash, under)));
+            if (_mm256_movemask_epi8(valid) != -1) {
+                break;  // Non-url-safe byte: let the scalar loop decide
+            }
+
+            // Map each class onto its 6-bit value
+            __m256i val = _mm256_and_si256(upper, _mm256_sub_epi8(chunk, _mm256_set1_epi8(65)));
+            val = _mm256_or_si256(
+                val, _mm256_and_si256(lower, _mm256_sub_epi8(chunk, _mm256_set1_epi8(71))));
+            val = _mm256_or_si256(
+                val, _mm256_and_si256(digit, _mm256_add_epi8(chunk, _mm256_set1_epi8(4))));
+            val = _mm256_or_si256(val, _mm256_and_si256(dash, _mm256_set1_epi8(62)));
+            val = _mm256_or_si256(val, _mm256_and_si256(under, _mm256_set1_epi8(63)));
+
+            // Merge four 6-bit values into three bytes per group
+            __m256i merge_ab_bc = _mm256_maddubs_epi16(val, _mm256_set1_epi32(0x01400140));
+            __m256i packed = _mm256_madd_epi16(merge_ab_bc, _mm256_set1_epi32(0x00011000));
+            __m256i shuffled = _mm256_shuffle_epi8(packed, pack_shuf);
+            __m256i result = _mm256_permutevar8x32_epi32(shuffled, pack_perm);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), result);
+            out += 24;
+            pos += 32;
+        }
+    }
+#endif
+
+    // Scalar path: full quantums (4 chars -> 3 bytes)
+    const auto& table = detail::kBase64DecodeTable;
+    while (len - pos >= 4) {
+        uint8_t a = table[in[pos]];
+        uint8_t b = table[in[pos + 1]];
+        uint8_t c = table[in[pos + 2]];
+        uint8_t d = table[in[pos + 3]];
+        // Valid values fit in 6 bits; 0xFF trips the mask
+        if (((a | b | c | d) & 0xC0) != 0) {
+            return SIZE_MAX;
+        }
+        uint32_t v = (static_cast<uint32_t>(a) << 18) | (static_cast<uint32_t>(b) << 12) |
+                     (static_cast<uint32_t>(c) << 6) | d;
+        *out++ = static_cast<uint8_t>(v >> 16);
+        *out++ = static_cast<uint8_t>(v >> 8);
+        *out++ = static_cast<uint8_t>(v);
+        pos += 4;
+    }
+
+    // Trailing partial quantum (2 chars -> 1 byte, 3 chars -> 2 bytes)
+    size_t remainder = len - pos;
+    if (remainder >= 2) {
+        uint8_t a = table[in[pos]];
+        uint8_t b = table[in[pos + 1]];
+        if (((a | b) & 0xC0) != 0) {
+            return SIZE_MAX;
+        }
+        *out++ = static_cast<uint8_t>((a << 2) | (b >> 4));
+        if (remainder == 3) {
+            uint8_t c = table[in[pos + 2]];
+            if ((c & 0xC0) != 0) {
+                return SIZE_MAX;
+            }
+            *out++ = static_cast<uint8_t>((b << 4) | (c >> 2));
+        }
+    }
+
+    return static_cast<size_t>(out - dst);
+}
+
 }  // namespace titan::http::simd
@@ -23,6 +23,7 @@
 #include <openssl/buffer.h>
 #include <openssl/evp.h>
 #include <openssl/sha.h>
+#include <zlib.h>
 
 #include <algorithm>
 #include <cstring>
@@ -68,8 +69,260 @@ bool contains_ci(std::string_view haystack, std::string_view needle) {
     return it != haystack.end();
 }
 
+// ========================================
+// permessage-deflate stream pools (RFC 7692)
+// ========================================
+
+/// RFC 7692 §7.2.1: each DEFLATE block ends with an empty stored block
+/// (the Z_SYNC_FLUSH tail); it is stripped on the wire and re-appended
+/// before inflating.
+constexpr uint8_t kDeflateTail[4] = {0x00, 0x00, 0xFF, 0xFF};
+
+/// Cap on pooled streams per worker; beyond this, streams are destroyed
+/// on connection close instead of pooled (~300KB deflate / ~40KB inflate
+/// state each, so the cap bounds idle pool memory)
+constexpr size_t kMaxPooledStreams = 32;
+
+// Worker-local free lists: WebSocket connections are pinned to their
+// accepting worker, so no locking is needed
+thread_local std::vector<z_stream*> t_deflate_pool;
+thread_local std::vector<z_stream*> t_inflate_pool;
+
+z_stream* acquire_deflate_stream() {
+    if (!t_deflate_pool.empty()) {
+        z_stream* stream = t_deflate_pool.back();
+        t_deflate_pool.pop_back();
+        deflateReset(stream);
+        return stream;
+    }
+    auto* stream = new z_stream{};
+    // Negative windowBits = raw deflate (no zlib header), per RFC 7692
+    if (deflateInit2(stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) !=
+        Z_OK) {
+        delete stream;
+        return nullptr;
+    }
+    return stream;
+}
+
+void release_deflate_stream(z_stream* stream) {
+    if (!stream) {
+        return;
+    }
+    if (t_deflate_pool.size() >= kMaxPooledStreams) {
+        deflateEnd(stream);
+        delete stream;
+        return;
+    }
+    t_deflate_pool.push_back(stream);
+}
+
+z_stream* acquire_inflate_stream() {
+    if (!t_inflate_pool.empty()) {
+        z_stream* stream = t_inflate_pool.back();
+        t_inflate_pool.pop_back();
+        inflateReset(stream);
+        return stream;
+    }
+    auto* stream = new z_stream{};
+    if (inflateInit2(stream, -15) != Z_OK) {
+        delete stream;
+        return nullptr;
+    }
+    return stream;
+}
+
+void release_inflate_stream(z_stream* stream) {
+    if (!stream) {
+        return;
+    }
+    if (t_inflate_pool.size() >= kMaxPooledStreams) {
+        inflateEnd(stream);
+        delete stream;
+        return;
+    }
+    t_inflate_pool.push_back(stream);
+}
+
+/// Iterate ','-separated extension offers / ';'-separated params, trimming
+/// optional whitespace, calling fn(token) for each
+template <typename Fn>
+void for_each_token(std::string_view list, char sep, Fn&& fn) {
+    size_t pos = 0;
+    while (pos <= list.size()) {
+        size_t end = list.find(sep, pos);
+        if (end == std::string_view::npos) {
+            end = list.size();
+        }
+        std::string_view token = list.substr(pos, end - pos);
+        while (!token.empty() && (token.front() == ' ' || token.front() == '\t')) {
+            token.remove_prefix(1);
+        }
+        while (!token.empty() && (token.back() == ' ' || token.back() == '\t')) {
+            token.remove_suffix(1);
+        }
+        if (!token.empty()) {
+            fn(token);
+        }
+        if (end == list.size()) {
+            break;
+        }
+        pos = end + 1;
+    }
+}
+
 }  // namespace
 
+// ========================================
+// PerMessageDeflate Implementation
+// ========================================
+
+std::optional<PerMessageDeflate::Params> PerMessageDeflate::negotiate(
+    std::string_view extensions_offer) {
+    std::optional<Params> accepted;
+
+    // The client may list several offers in preference order; take the
+    // first permessage-deflate offer whose parameters we can honor
+    for_each_token(extensions_offer, ',', [&](std::string_view offer) {
+        if (accepted) {
+            return;
+        }
+
+        Params params;
+        bool is_pmd = false;
+        bool acceptable = true;
+        bool first = true;
+        for_each_token(offer, ';', [&](std::string_view param) {
+            if (first) {
+                first = false;
+                is_pmd = (param == "permessage-deflate");
+                return;
+            }
+            if (param == "server_no_context_takeover") {
+                params.server_no_context_takeover = true;
+            } else if (param == "client_no_context_takeover") {
+                params.client_no_context_takeover = true;
+            } else if (param == "client_max_window_bits" ||
+                       param.starts_with("client_max_window_bits=")) {
+                // We never send client_max_window_bits back, so the client
+                // uses its offered window; raw inflate at -15 accepts any
+                // window <= 32KB, so nothing to do
+            } else if (param.starts_with("server_max_window_bits")) {
+                // We always deflate with a 32KB window; honoring a reduced
+                // window would require renegotiating zlib state, so skip
+                // this offer (the client usually repeats without it)
+                acceptable = false;
+            } else {
+                acceptable = false;  // Unknown parameter - must decline (RFC 7692 §7)
+            }
+        });
+
+        if (is_pmd && acceptable) {
+            accepted = params;
+        }
+    });
+
+    return accepted;
+}
+
+std::string PerMessageDeflate::response_value(const Params& params) {
+    std::string value = "permessage-deflate";
+    if (params.server_no_context_takeover) {
+        value += "; server_no_context_takeover";
+    }
+    if (params.client_no_context_takeover) {
+        value += "; client_no_context_takeover";
+    }
+    return value;
+}
+
+PerMessageDeflate::PerMessageDeflate(const Params& params)
+    : params_(params), deflate_(acquire_deflate_stream()), inflate_(acquire_inflate_stream()) {}
+
+PerMessageDeflate::~PerMessageDeflate() {
+    release_deflate_stream(deflate_);
+    release_inflate_stream(inflate_);
+}
+
+std::optional<std::vector<uint8_t>> PerMessageDeflate::compress(std::span<const uint8_t> payload) {
+    if (!deflate_) {
+        return std::nullopt;
+    }
+
+    std::vector<uint8_t> out;
+    out.reserve(payload.size() / 4 + 32);
+
+    deflate_->next_in = const_cast<uint8_t*>(payload.data());
+    deflate_->avail_in = static_cast<uInt>(payload.size());
+
+    uint8_t chunk[16384];
+    do {
+        deflate_->next_out = chunk;
+        deflate_->avail_out = sizeof(chunk);
+        // Z_SYNC_FLUSH emits the 00 00 FF FF empty stored block and keeps
+        // the stream usable for the next message (context takeover)
+        if (::deflate(deflate_, Z_SYNC_FLUSH) != Z_OK) {
+            return std::nullopt;
+        }
+        out.insert(out.end(), chunk, chunk + (sizeof(chunk) - deflate_->avail_out));
+    } while (deflate_->avail_out == 0);
+
+    // Strip the flush tail (RFC 7692 §7.2.1)
+    if (out.size() < sizeof(kDeflateTail) ||
+        memcmp(out.data() + out.size() - sizeof(kDeflateTail), kDeflateTail,
+               sizeof(kDeflateTail)) != 0) {
+        return std::nullopt;
+    }
+    out.resize(out.size() - sizeof(kDeflateTail));
+
+    if (params_.server_no_context_takeover) {
+        deflateReset(deflate_);
+    }
+    return out;
+}
+
+std::optional<std::vector<uint8_t>> PerMessageDeflate::decompress(std::span<const uint8_t> payload,
+                                                                  size_t max_size) {
+    if (!inflate_) {
+        return std::nullopt;
+    }
+
+    // Re-append the flush tail the sender stripped
+    std::vector<uint8_t> input;
+    input.reserve(payload.size() + sizeof(kDeflateTail));
+    input.insert(input.end(), payload.begin(), payload.end());
+    input.insert(input.end(), kDeflateTail, kDeflateTail + sizeof(kDeflateTail));
+
+    std::vector<uint8_t> out;
+    inflate_->next_in = input.data();
+    inflate_->avail_in = static_cast<uInt>(input.size());
+
+    uint8_t chunk[16384];
+    do {
+        inflate_->next_out = chunk;
+        inflate_->avail_out = sizeof(chunk);
+        int rc = ::inflate(inflate_, Z_SYNC_FLUSH);
+        if (rc != Z_OK && rc != Z_BUF_ERROR) {
+            inflateReset(inflate_);
+            return std::nullopt;
+        }
+        out.insert(out.end(), chunk, chunk + (sizeof(chunk) - inflate_->avail_out));
+        if (out.size() > max_size) {
+            // Decompression bomb guard - treat as protocol error
+            inflateReset(inflate_);
+            return std::nullopt;
+        }
+        if (rc == Z_BUF_ERROR && inflate_->avail_out != 0) {
+            break;  // All input consumed
+        }
+    } while (inflate_->avail_out == 0 || inflate_->avail_in > 0);
+
+    if (params_.client_no_context_takeover) {
+        inflateReset(inflate_);
+    }
+    return out;
+}
+
 // ========================================
 // WebSocketUtils Implementation
 // ========================================
@@ -101,7 +354,7 @@ bool WebSocketUtils::is_valid_upgrade_request(const http::Request& request) {
     }
 
     // 2. Must have Upgrade: websocket
-    std::string upgrade = std::string(request.get_header("Upgrade"));
+    std::string upgrade = std::string(request.get_header(WellKnownHeader::Upgrade));
     if (upgrade.empty()) {
         return false;
     }
@@ -112,19 +365,19 @@ bool WebSocketUtils::is_valid_upgrade_request(const http::Request& request) {
     }
 
     // 3. Must have Connection: Upgrade (case-insensitive, may have other values)
-    std::string connection = std::string(request.get_header("Connection"));
+    std::string connection = std::string(request.get_header(WellKnownHeader::Connection));
     if (!contains_ci(connection, "upgrade")) {
         return false;
     }
 
     // 4. Must have Sec-WebSocket-Key (base64-encoded 16-byte nonce)
-    std::string key = std::string(request.get_header("Sec-WebSocket-Key"));
+    std::string key = std::string(request.get_header(WellKnownHeader::SecWebSocketKey));
     if (key.empty()) {
         return false;
     }
 
     // 5. Must have Sec-WebSocket-Version: 13
-    std::string version = std::string(request.get_header("Sec-WebSocket-Version"));
+    std::string version = std::string(request.get_header(WellKnownHeader::SecWebSocketVersion));
     if (version != "13") {
         return false;  // Only version 13 is supported (RFC 6455)
     }
@@ -133,7 +386,8 @@ bool WebSocketUtils::is_valid_upgrade_request(const http::Request& request) {
 }
 
 std::string WebSocketUtils::create_upgrade_response(std::string_view accept_key,
-                                                    std::string_view protocol) {
+                                                    std::string_view protocol,
+                                                    std::string_view extensions) {
     // RFC 6455 §4.2.2: Server handshake response
     std::string response;
     response.reserve(256);
@@ -152,6 +406,13 @@ std::string WebSocketUtils::create_upgrade_response(std::string_view accept_key,
         response += "\r\n";
     }
 
+    // Optional: Sec-WebSocket-Extensions (e.g. permessage-deflate, RFC 7692)
+    if (!extensions.empty()) {
+        response += "Sec-WebSocket-Extensions: ";
+        response += extensions;
+        response += "\r\n";
+    }
+
     response += "\r\n";  // End of headers
 
     return response;
@@ -210,11 +471,12 @@ std::vector<uint8_t> WebSocketUtils::create_ping_frame() {
 }
 
 void WebSocketUtils::encode_frame_header(std::vector<uint8_t>& buffer, bool fin, uint8_t opcode,
-                                         bool mask, uint64_t payload_length, uint32_t masking_key) {
+                                         bool mask, uint64_t payload_length, uint32_t masking_key,
+                                         bool rsv1) {
     // RFC 6455 §5.2: Frame header format
 
     // Byte 0: FIN (1 bit) + RSV1-3 (3 bits) + Opcode (4 bits)
-    uint8_t byte0 = (fin ? 0x80 : 0x00) | (opcode & 0x0F);
+    uint8_t byte0 = (fin ? 0x80 : 0x00) | (rsv1 ? 0x40 : 0x00) | (opcode & 0x0F);
     buffer.push_back(byte0);
 
     // Byte 1: MASK (1 bit) + Payload length (7 bits)
@@ -280,10 +542,22 @@ WebSocketFrameParser::ParseResult WebSocketFrameParser::parse(std::span<const ui
                 uint8_t byte1 = buffer_[1];
 
                 fin_ = (byte0 & 0x80) != 0;
+                rsv1_ = (byte0 & 0x40) != 0;
                 opcode_ = byte0 & 0x0F;
                 masked_ = (byte1 & 0x80) != 0;
                 uint8_t payload_len = byte1 & 0x7F;
 
+                // RSV2/RSV3 have no negotiated meaning (RFC 6455 §5.2);
+                // RSV1 is surfaced for permessage-deflate (RFC 7692)
+                if ((byte0 & 0x30) != 0) {
+                    return ParseResult::Error;
+                }
+
+                // RSV1 is only valid on the first frame of a data message
+                if (rsv1_ && opcode_ >= 0x8) {
+                    return ParseResult::Error;  // Compressed control frame
+                }
+
                 // Validate opcode
                 if (opcode_ > 0x2 && opcode_ < 0x8) {
                     return ParseResult::Error;  // Reserved data opcode
@@ -426,6 +700,7 @@ WebSocketFrameParser::ParseResult WebSocketFrameParser::parse(std::span<const ui
 
                 // Frame complete! Build output frame
                 out_frame.fin = fin_;
+                out_frame.rsv1 = rsv1_;
                 out_frame.opcode = opcode_;
                 out_frame.masked = masked_;
                 out_frame.masking_key = masking_key_;
@@ -462,6 +737,7 @@ void WebSocketFrameParser::reset() {
     state_ = State::ReadHeader;
     buffer_.clear();
     fin_ = false;
+    rsv1_ = false;
     opcode_ = 0;
     masked_ = false;
     payload_length_ = 0;
@@ -21,15 +21,22 @@
 
 #include <chrono>
 #include <cstdint>
+#include <memory>
+#include <optional>
 #include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 
+// Forward declaration for zlib stream (see core/compression.hpp)
+struct z_stream_s;
+typedef struct z_stream_s z_stream;
+
 namespace titan::http {
 
 // Forward declarations
 struct Request;
+struct BroadcastFrame;  // See ws_broadcast.hpp
 
 /// WebSocket connection state (RFC 6455 §4)
 enum class WebSocketState : uint8_t {
@@ -68,6 +75,7 @@ constexpr uint16_t TLS_HANDSHAKE_FAILED = 1015;   // TLS handshake failed (reser
 /// WebSocket frame structure (RFC 6455 §5.2)
 struct WebSocketFrame {
     bool fin = false;                  // Final fragment flag
+    bool rsv1 = false;                 // Per-message compressed bit (RFC 7692)
     uint8_t opcode = 0;                // Frame opcode (see WebSocketOpcode)
     bool masked = false;               // Is payload masked?
     uint32_t masking_key = 0;          // XOR masking key (client→server only)
@@ -85,6 +93,53 @@ struct WebSocketFrame {
     }
 };
 
+/// permessage-deflate extension state (RFC 7692)
+///
+/// The gateway terminates the extension at the edge: it is negotiated with
+/// the client (WAN side) and stripped from the upgrade forwarded to the
+/// backend, so backend traffic stays uncompressed on the LAN. Each
+/// negotiated connection holds one deflate and one inflate stream, drawn
+/// from worker-local pools so idle churn does not pay zlib setup costs.
+class PerMessageDeflate {
+public:
+    /// Negotiated parameters (RFC 7692 §7.1)
+    struct Params {
+        bool server_no_context_takeover = false;  // Reset deflate after each message
+        bool client_no_context_takeover = false;  // Reset inflate after each message
+    };
+
+    /// Parse a client's Sec-WebSocket-Extensions offer. Returns the accepted
+    /// parameters, or nullopt if no acceptable permessage-deflate offer is
+    /// present (e.g. it demands a reduced server_max_window_bits).
+    [[nodiscard]] static std::optional<Params> negotiate(std::string_view extensions_offer);
+
+    /// Build the Sec-WebSocket-Extensions response value for accepted params
+    [[nodiscard]] static std::string response_value(const Params& params);
+
+    explicit PerMessageDeflate(const Params& params);
+    ~PerMessageDeflate();
+
+    // Non-copyable, non-movable (owns pooled zlib streams)
+    PerMessageDeflate(const PerMessageDeflate&) = delete;
+    PerMessageDeflate& operator=(const PerMessageDeflate&) = delete;
+    PerMessageDeflate(PerMessageDeflate&&) = delete;
+    PerMessageDeflate& operator=(PerMessageDeflate&&) = delete;
+
+    /// Compress a complete message payload; the 0x00 0x00 0xFF 0xFF flush
+    /// tail is stripped per RFC 7692 §7.2.1. Returns nullopt on zlib error.
+    [[nodiscard]] std::optional<std::vector<uint8_t>> compress(std::span<const uint8_t> payload);
+
+    /// Decompress a complete message payload (tail re-appended internally).
+    /// Output is capped at max_size; returns nullopt on error or overflow.
+    [[nodiscard]] std::optional<std::vector<uint8_t>> decompress(std::span<const uint8_t> payload,
+                                                                 size_t max_size);
+
+private:
+    Params params_;
+    z_stream* deflate_ = nullptr;  // Worker-pooled, raw deflate (windowBits -15)
+    z_stream* inflate_ = nullptr;  // Worker-pooled, raw inflate (windowBits -15)
+};
+
 /// WebSocket connection tracking
 struct WebSocketConnection {
     int client_fd = -1;                                 // Client socket FD
@@ -98,6 +153,16 @@ struct WebSocketConnection {
     bool fin_received = false;                  // Fragmentation state
     uint64_t accumulated_message_size = 0;      // Total size of fragmented message
 
+    // permessage-deflate state (nullptr when not negotiated). Compressed
+    // messages can only be inflated whole, so negotiated connections
+    // reassemble fragments into these message buffers before transcoding.
+    std::unique_ptr<PerMessageDeflate> pmd;
+    std::vector<uint8_t> client_message;         // Client fragments (decompress side)
+    std::vector<uint8_t> backend_message;        // Backend fragments (compress side)
+    uint8_t client_message_opcode = 0;           // Opcode of first client fragment
+    uint8_t backend_message_opcode = 0;          // Opcode of first backend fragment
+    bool client_message_compressed = false;      // RSV1 seen on first client fragment
+
     // Ping/Pong keep-alive state
     std::chrono::steady_clock::time_point last_activity;
     std::chrono::steady_clock::time_point last_ping_sent;
@@ -113,6 +178,17 @@ struct WebSocketConnection {
     // Route configuration (for per-route limits and settings)
     std::string route_path;
     std::string upstream_name;
+
+    // Broadcast fan-out state (see ws_broadcast.hpp). A non-empty channel
+    // marks a locally terminated subscriber connection (backend_fd stays
+    // -1). Queued frames are refcounted buffers shared with every other
+    // subscriber; send_offset tracks partial progress into the front
+    // frame after a short write, and backlog_bytes feeds the
+    // slow-consumer eviction check.
+    std::string broadcast_channel;
+    std::vector<std::shared_ptr<const BroadcastFrame>> broadcast_queue;
+    size_t broadcast_send_offset = 0;
+    size_t broadcast_backlog_bytes = 0;
 };
 
 /// WebSocket handshake validation and utilities
@@ -127,7 +203,8 @@ public:
 
     /// Create 101 Switching Protocols response
     [[nodiscard]] static std::string create_upgrade_response(std::string_view accept_key,
-                                                             std::string_view protocol = "");
+                                                             std::string_view protocol = "",
+                                                             std::string_view extensions = "");
 
     /// Unmask WebSocket payload (client→server frames)
     static void unmask_payload(std::span<uint8_t> payload, uint32_t masking_key);
@@ -145,7 +222,8 @@ public:
 
     /// Encode WebSocket frame header
     static void encode_frame_header(std::vector<uint8_t>& buffer, bool fin, uint8_t opcode,
-                                    bool mask, uint64_t payload_length, uint32_t masking_key = 0);
+                                    bool mask, uint64_t payload_length, uint32_t masking_key = 0,
+                                    bool rsv1 = false);
 };
 
 /// WebSocket frame parser
@@ -191,6 +269,7 @@ private:
 
     // Current frame being parsed
     bool fin_ = false;
+    bool rsv1_ = false;
     uint8_t opcode_ = 0;
     bool masked_ = false;
     uint64_t payload_length_ = 0;
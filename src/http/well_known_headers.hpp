@@ -0,0 +1,173 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan HTTP Well-Known Headers - Header
+// Compile-time perfect hash for the header names the hot middlewares
+// probe (compression, transform, JWT, CORS, cache, websocket). The parser
+// tags each header as it lands, so get_header(WellKnownHeader) on
+// Request/Response is a single array index - no scan, no case-insensitive
+// compares per probe.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace titan::http {
+
+/// Headers with a reserved slot in Request/Response. Adding a name here
+/// requires the perfect hash below to stay collision-free - the
+/// static_assert catches violations at compile time.
+enum class WellKnownHeader : uint8_t {
+    Host = 0,
+    Connection,
+    ContentLength,
+    ContentType,
+    ContentEncoding,
+    AcceptEncoding,
+    Authorization,
+    Origin,
+    Cookie,
+    SetCookie,
+    CacheControl,
+    ETag,
+    Vary,
+    IfNoneMatch,
+    Upgrade,
+    TransferEncoding,
+    UserAgent,
+    SecWebSocketKey,
+    SecWebSocketVersion,
+    SecWebSocketExtensions,
+
+    Count,
+    Unknown = 255,
+};
+
+inline constexpr size_t kWellKnownHeaderCount = static_cast<size_t>(WellKnownHeader::Count);
+
+namespace detail {
+
+inline constexpr std::array<std::string_view, kWellKnownHeaderCount> kWellKnownHeaderNames = {
+    "Host",
+    "Connection",
+    "Content-Length",
+    "Content-Type",
+    "Content-Encoding",
+    "Accept-Encoding",
+    "Authorization",
+    "Origin",
+    "Cookie",
+    "Set-Cookie",
+    "Cache-Control",
+    "ETag",
+    "Vary",
+    "If-None-Match",
+    "Upgrade",
+    "Transfer-Encoding",
+    "User-Agent",
+    "Sec-WebSocket-Key",
+    "Sec-WebSocket-Version",
+    "Sec-WebSocket-Extensions",
+};
+
+[[nodiscard]] constexpr char header_ascii_lower(char c) noexcept {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+}
+
+// Hash over (length, first char, last char) - cheap enough to beat any
+// scan, and the constants below make it collision-free for the name set
+// above within a 64-slot table
+inline constexpr size_t kWellKnownTableSize = 64;
+
+[[nodiscard]] constexpr size_t well_known_hash(std::string_view name) noexcept {
+    auto first = static_cast<size_t>(
+        static_cast<unsigned char>(header_ascii_lower(name.front())));
+    auto last = static_cast<size_t>(
+        static_cast<unsigned char>(header_ascii_lower(name.back())));
+    return (name.size() + 25 * first + last) & (kWellKnownTableSize - 1);
+}
+
+/// Slot table: hash -> candidate ID (Unknown for empty slots)
+inline constexpr auto kWellKnownTable = [] {
+    std::array<WellKnownHeader, kWellKnownTableSize> table{};
+    table.fill(WellKnownHeader::Unknown);
+    for (size_t i = 0; i < kWellKnownHeaderCount; ++i) {
+        size_t slot = well_known_hash(kWellKnownHeaderNames[i]);
+        if (table[slot] != WellKnownHeader::Unknown) {
+            // Collision: forces a compile error via the static_assert below
+            // (returning an empty table makes every lookup fail)
+            table.fill(WellKnownHeader::Unknown);
+            return table;
+        }
+        table[slot] = static_cast<WellKnownHeader>(i);
+    }
+    return table;
+}();
+
+[[nodiscard]] constexpr bool header_name_equals_ci(std::string_view a,
+                                                   std::string_view b) noexcept {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (header_ascii_lower(a[i]) != header_ascii_lower(b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace detail
+
+/// Map a header name (any case) to its well-known ID, or Unknown.
+/// One cheap hash plus one case-insensitive compare against the single
+/// candidate - never a scan over the name set.
+[[nodiscard]] constexpr WellKnownHeader well_known_header_id(std::string_view name) noexcept {
+    if (name.empty()) {
+        return WellKnownHeader::Unknown;
+    }
+    WellKnownHeader candidate = detail::kWellKnownTable[detail::well_known_hash(name)];
+    if (candidate == WellKnownHeader::Unknown) {
+        return WellKnownHeader::Unknown;
+    }
+    if (!detail::header_name_equals_ci(
+            name, detail::kWellKnownHeaderNames[static_cast<size_t>(candidate)])) {
+        return WellKnownHeader::Unknown;
+    }
+    return candidate;
+}
+
+/// Canonical name for a well-known ID
+[[nodiscard]] constexpr std::string_view well_known_header_name(WellKnownHeader id) noexcept {
+    return detail::kWellKnownHeaderNames[static_cast<size_t>(id)];
+}
+
+// The perfect hash must resolve every well-known name to itself
+static_assert(
+    [] {
+        for (size_t i = 0; i < kWellKnownHeaderCount; ++i) {
+            if (well_known_header_id(detail::kWellKnownHeaderNames[i]) !=
+                static_cast<WellKnownHeader>(i)) {
+                return false;
+            }
+        }
+        return true;
+    }(),
+    "well-known header perfect hash has collisions - adjust the hash constants");
+
+}  // namespace titan::http
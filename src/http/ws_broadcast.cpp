@@ -0,0 +1,65 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan WebSocket Broadcast - Implementation
+
+#include "ws_broadcast.hpp"
+
+#include "websocket.hpp"
+
+namespace titan::http {
+
+std::shared_ptr<const BroadcastFrame> make_broadcast_frame(uint8_t opcode,
+                                                           std::span<const uint8_t> payload) {
+    auto frame = std::make_shared<BroadcastFrame>();
+    frame->bytes.reserve(payload.size() + 10);  // Worst-case header: 2 + 8 length bytes
+    WebSocketUtils::encode_frame_header(frame->bytes, /*fin=*/true, opcode, /*mask=*/false,
+                                        payload.size());
+    frame->bytes.insert(frame->bytes.end(), payload.begin(), payload.end());
+    return frame;
+}
+
+void WsBroadcastMailbox::drain(std::vector<WsBroadcastPublication>& out) {
+    out.clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    out.swap(queue_);
+    pending_.store(0, std::memory_order_release);
+}
+
+WsBroadcastBus& WsBroadcastBus::instance() {
+    static WsBroadcastBus bus;
+    return bus;
+}
+
+WsBroadcastMailbox* WsBroadcastBus::register_worker() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    mailboxes_.push_back(std::make_unique<WsBroadcastMailbox>());
+    return mailboxes_.back().get();
+}
+
+void WsBroadcastBus::publish(std::string_view channel,
+                             std::shared_ptr<const BroadcastFrame> frame) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& mailbox : mailboxes_) {
+        {
+            std::lock_guard<std::mutex> mailbox_lock(mailbox->mutex_);
+            mailbox->queue_.push_back({std::string(channel), frame});
+        }
+        mailbox->pending_.fetch_add(1, std::memory_order_release);
+    }
+}
+
+}  // namespace titan::http
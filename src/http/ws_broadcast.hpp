@@ -0,0 +1,102 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan WebSocket Broadcast - Header
+// One-to-many fan-out for locally terminated WebSocket routes
+//
+// A message published to a channel is serialized into ONE pre-framed,
+// refcounted buffer and handed to every worker by reference; each worker
+// queues the shared buffer to its local subscribers and writes it out with
+// writev(2). Framing and buffering cost is paid once per message, not once
+// per connection - at tens of thousands of subscribers that is the
+// difference between one memcpy and forty thousand.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace titan::http {
+
+/// A server-to-client WebSocket frame serialized exactly once: header and
+/// payload in one contiguous, unmasked buffer (RFC 6455 server frames are
+/// never masked, so the bytes are identical for every subscriber). Held by
+/// shared_ptr in each subscriber's queue - zero copies after framing.
+struct BroadcastFrame {
+    std::vector<uint8_t> bytes;
+};
+
+/// Frame a payload for broadcast (fin=1, no compression - the buffer is
+/// shared across connections, so per-connection deflate contexts can't apply)
+[[nodiscard]] std::shared_ptr<const BroadcastFrame> make_broadcast_frame(
+    uint8_t opcode, std::span<const uint8_t> payload);
+
+/// One published message on its way to a worker
+struct WsBroadcastPublication {
+    std::string channel;
+    std::shared_ptr<const BroadcastFrame> frame;
+};
+
+/// Per-worker inbox on the broadcast bus. Publishers append under the
+/// mutex; the owning worker polls has_pending() every loop pass (one
+/// relaxed atomic load - no lock on the idle path) and drains with a swap.
+class WsBroadcastMailbox {
+public:
+    /// Anything queued? Lock-free check for the event loop's hot path
+    [[nodiscard]] bool has_pending() const noexcept {
+        return pending_.load(std::memory_order_acquire) != 0;
+    }
+
+    /// Move all queued publications into `out` (existing contents replaced)
+    void drain(std::vector<WsBroadcastPublication>& out);
+
+private:
+    friend class WsBroadcastBus;
+
+    std::mutex mutex_;
+    std::vector<WsBroadcastPublication> queue_;
+    std::atomic<size_t> pending_{0};
+};
+
+/// Process-wide distribution bus. Workers register a mailbox once (lazily,
+/// on first subscription) and never unregister - workers live for the
+/// process lifetime, like the other cross-thread registries in main.cpp.
+/// Publishers can run on any thread (the admin server, typically).
+class WsBroadcastBus {
+public:
+    [[nodiscard]] static WsBroadcastBus& instance();
+
+    /// Create and return the calling worker's mailbox (bus keeps ownership)
+    [[nodiscard]] WsBroadcastMailbox* register_worker();
+
+    /// Enqueue one shared frame to every registered worker's mailbox.
+    /// Workers with no subscribers on the channel drop it on drain.
+    void publish(std::string_view channel, std::shared_ptr<const BroadcastFrame> frame);
+
+private:
+    WsBroadcastBus() = default;
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<WsBroadcastMailbox>> mailboxes_;
+};
+
+}  // namespace titan::http
@@ -23,8 +23,12 @@
 #include <string>
 
 #include "control/config.hpp"
+#include "control/health_prober.hpp"
+#include "control/metrics.hpp"
+#include "core/access_log.hpp"
 #include "core/logging.hpp"
 #include "core/tls.hpp"
+#include "http/simd.hpp"
 #include "runtime/orchestrator.hpp"
 
 namespace titan::core {
@@ -34,6 +38,13 @@ std::atomic<bool> g_graceful_shutdown{false};
 std::atomic<const gateway::UpstreamManager*> g_upstream_manager_for_metrics{nullptr};
 // Global compression metrics pointer for export (set by worker 0)
 std::atomic<const gateway::CompressionMetrics*> g_compression_metrics_for_export{nullptr};
+// Global worker metrics pointer for export (set by worker 0)
+std::atomic<const control::ThreadMetrics*> g_worker_metrics_for_export{nullptr};
+// Global config manager pointer so workers can poll for hot-reload swaps
+std::atomic<const control::ConfigManager*> g_config_manager_for_workers{nullptr};
+// Global active health prober; workers fold its probe results into their
+// own backends from the timer path (set by the orchestrator)
+std::atomic<const control::HealthProber*> g_health_prober_for_workers{nullptr};
 }  // namespace titan::core
 
 namespace {
@@ -93,8 +104,19 @@ int main(int argc, char* argv[]) {
     // Initialize logging system
     titan::logging::init_logging_system();
 
+    // Offline converter for binary access logs (prints and exits)
+    if (argc >= 3 && std::string(argv[1]) == "--dump-access-log") {
+        bool as_json = argc >= 4 && std::string(argv[3]) == "--json";
+        bool ok = titan::core::convert_access_log(argv[2], stdout, as_json);
+        titan::core::cleanup_openssl();
+        return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
     if (argc < 3 || std::string(argv[1]) != "--config") {
-        fprintf(stderr, "Usage: %s --config <config.json> [--single-threaded]\n", argv[0]);
+        fprintf(stderr,
+                "Usage: %s --config <config.json> [--single-threaded]\n"
+                "       %s --dump-access-log <file.bin> [--json]\n",
+                argv[0], argv[0]);
         titan::core::cleanup_openssl();
         return EXIT_FAILURE;
     }
@@ -150,7 +172,13 @@ int main(int argc, char* argv[]) {
 
     const titan::control::Config& config = *config_ptr;
 
+    // Workers poll this for RCU-style component swaps on SIGHUP reload
+    titan::core::g_config_manager_for_workers.store(g_config_manager.get(),
+                                                    std::memory_order_release);
+
     printf("Listening on %s:%u\n", config.server.listen_address.c_str(), config.server.listen_port);
+    printf("SIMD kernels: %s (parsing, WebSocket unmasking)\n",
+           titan::http::simd::CPUFeatures::instance().active_kernel());
 
     // Install signal handlers for graceful shutdown and config reload
     std::signal(SIGINT, signal_handler);   // Ctrl+C
@@ -0,0 +1,206 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Listener Handover - Implementation
+
+#include "handover.hpp"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#include "../core/socket.hpp"
+
+namespace titan::core {
+extern std::atomic<bool> g_server_running;
+extern std::atomic<bool> g_graceful_shutdown;
+}  // namespace titan::core
+
+namespace titan::runtime {
+
+namespace {
+// One fd per worker; bounded so the cmsg buffer has a fixed size
+constexpr size_t kMaxHandoverFds = 256;
+
+std::mutex g_listener_mutex;
+std::vector<int> g_listener_fds;
+
+/// Fill a sockaddr_un; returns false if the path doesn't fit
+bool make_unix_addr(const std::string& path, sockaddr_un& addr) {
+    if (path.size() >= sizeof(addr.sun_path)) {
+        return false;
+    }
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
+
+/// Send every registered listener over a connected socket in one message:
+/// payload is the fd count, ancillary data carries the fds themselves
+bool send_listeners(int conn_fd) {
+    std::vector<int> fds;
+    {
+        std::lock_guard lock(g_listener_mutex);
+        fds = g_listener_fds;
+    }
+    if (fds.empty() || fds.size() > kMaxHandoverFds) {
+        return false;
+    }
+
+    uint32_t count = static_cast<uint32_t>(fds.size());
+    iovec iov{};
+    iov.iov_base = &count;
+    iov.iov_len = sizeof(count);
+
+    std::vector<char> cmsg_buf(CMSG_SPACE(fds.size() * sizeof(int)));
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = cmsg_buf.data();
+    msg.msg_controllen = cmsg_buf.size();
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(fds.size() * sizeof(int));
+    std::memcpy(CMSG_DATA(cmsg), fds.data(), fds.size() * sizeof(int));
+
+    return sendmsg(conn_fd, &msg, 0) == static_cast<ssize_t>(sizeof(count));
+}
+}  // namespace
+
+std::vector<int> request_listener_handover(const std::string& socket_path) {
+    sockaddr_un addr{};
+    if (!make_unix_addr(socket_path, addr)) {
+        return {};
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return {};
+    }
+
+    if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        core::close_fd(fd);  // Nobody serving - cold start
+        return {};
+    }
+
+    // Bound the wait: a wedged predecessor must not stall startup
+    timeval timeout{.tv_sec = 5, .tv_usec = 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    uint32_t count = 0;
+    iovec iov{};
+    iov.iov_base = &count;
+    iov.iov_len = sizeof(count);
+
+    std::vector<char> cmsg_buf(CMSG_SPACE(kMaxHandoverFds * sizeof(int)));
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = cmsg_buf.data();
+    msg.msg_controllen = cmsg_buf.size();
+
+    ssize_t n = recvmsg(fd, &msg, MSG_CMSG_CLOEXEC);
+    core::close_fd(fd);
+    if (n != static_cast<ssize_t>(sizeof(count)) || count == 0 || count > kMaxHandoverFds) {
+        return {};
+    }
+
+    std::vector<int> fds;
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+            continue;
+        }
+        size_t fd_bytes = cmsg->cmsg_len - CMSG_LEN(0);
+        size_t fd_count = fd_bytes / sizeof(int);
+        size_t offset = fds.size();
+        fds.resize(offset + fd_count);
+        std::memcpy(fds.data() + offset, CMSG_DATA(cmsg), fd_count * sizeof(int));
+    }
+
+    if (fds.size() != count) {
+        // Truncated control data - close what arrived and bind fresh
+        for (int received : fds) {
+            core::close_fd(received);
+        }
+        return {};
+    }
+    return fds;
+}
+
+void register_handover_listener(int listen_fd) {
+    std::lock_guard lock(g_listener_mutex);
+    g_listener_fds.push_back(listen_fd);
+}
+
+void start_handover_server(const std::string& socket_path) {
+    std::thread([socket_path]() {
+        sockaddr_un addr{};
+        if (!make_unix_addr(socket_path, addr)) {
+            std::fprintf(stderr, "Upgrade socket path too long: %s\n", socket_path.c_str());
+            return;
+        }
+
+        int listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (listen_fd < 0) {
+            return;
+        }
+
+        // A stale path from a crashed predecessor would block bind; the
+        // live predecessor unlinks its socket before we ever get here
+        unlink(socket_path.c_str());
+
+        if (bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            listen(listen_fd, 1) != 0) {
+            std::fprintf(stderr, "Failed to bind upgrade socket %s: %s\n", socket_path.c_str(),
+                         std::strerror(errno));
+            core::close_fd(listen_fd);
+            return;
+        }
+
+        while (core::g_server_running) {
+            int conn_fd = accept(listen_fd, nullptr, nullptr);
+            if (conn_fd < 0) {
+                continue;
+            }
+
+            if (send_listeners(conn_fd)) {
+                std::printf("Handover: listeners passed to successor, draining...\n");
+
+                // Release the path so the successor can serve the next
+                // upgrade, then drain exactly like SIGTERM
+                unlink(socket_path.c_str());
+                core::close_fd(conn_fd);
+                core::g_graceful_shutdown = true;
+                core::g_server_running = false;
+                break;
+            }
+            core::close_fd(conn_fd);
+        }
+
+        core::close_fd(listen_fd);
+    }).detach();
+}
+
+}  // namespace titan::runtime
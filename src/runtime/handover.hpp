@@ -0,0 +1,50 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Listener Handover - Header
+// Zero-downtime binary upgrade via SCM_RIGHTS fd passing
+//
+// A newly exec'd Titan connects to the predecessor's upgrade Unix socket
+// and receives duplicates of every worker's listening socket before the
+// old process starts draining. The accept queues are never closed, so an
+// upgrade loses no connections: pending SYNs land in the inherited
+// listeners and established connections finish on the old process.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace titan::runtime {
+
+/// Request the predecessor's listening sockets over its upgrade socket.
+/// Returns the received fds (SCM_RIGHTS duplicates, already owned by this
+/// process), or an empty vector when nobody is serving - a normal cold
+/// start. The predecessor begins graceful drain as soon as it has sent.
+[[nodiscard]] std::vector<int> request_listener_handover(const std::string& socket_path);
+
+/// Register a worker's listening socket as part of the handover set.
+/// Called by each worker after bind/adopt; safe from any thread.
+void register_handover_listener(int listen_fd);
+
+/// Start the background thread that serves handover requests on
+/// socket_path. On a request it sends every registered listener via
+/// SCM_RIGHTS and flips the graceful-shutdown flag so this process drains
+/// and exits while the successor accepts. The thread is detached and
+/// exits with the process.
+void start_handover_server(const std::string& socket_path);
+
+}  // namespace titan::runtime
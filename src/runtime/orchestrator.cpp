@@ -22,21 +22,36 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include "../control/health_prober.hpp"
+#include "../control/metrics.hpp"
+#include "../control/profiler.hpp"
+#include "../core/access_log.hpp"
 #include "../core/admin_server.hpp"
 #include "../core/jwt_revocation.hpp"
 #include "../core/logging.hpp"
+#include "../core/memory.hpp"
 #include "../core/socket.hpp"
 #include "../gateway/factory.hpp"
+#include "handover.hpp"
+#include "uring_loop.hpp"
 
 using titan::core::close_fd;
 
 #ifdef __linux__
+#include <poll.h>
 #include <sys/epoll.h>
+// poll(2) mask used by io_uring POLL_ADD; only exposed by glibc with _GNU_SOURCE
+#ifndef POLLRDHUP
+#define POLLRDHUP 0x2000
+#endif
 #elif defined(__APPLE__) || defined(__FreeBSD__)
 #include <sys/event.h>
 #endif
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <mutex>
 #include <thread>
 #include <unordered_set>
 #include <vector>
@@ -46,6 +61,9 @@ extern std::atomic<bool> g_server_running;
 extern std::atomic<bool> g_graceful_shutdown;
 extern std::atomic<const gateway::UpstreamManager*> g_upstream_manager_for_metrics;
 extern std::atomic<const gateway::CompressionMetrics*> g_compression_metrics_for_export;
+extern std::atomic<const control::ThreadMetrics*> g_worker_metrics_for_export;
+extern std::atomic<const control::ConfigManager*> g_config_manager_for_workers;
+extern std::atomic<const control::HealthProber*> g_health_prober_for_workers;
 }  // namespace titan::core
 
 namespace titan::runtime {
@@ -53,14 +71,227 @@ namespace titan::runtime {
 // Global revocation queue for JWT token revocation (shared across all workers)
 core::RevocationQueue* g_revocation_queue = nullptr;
 
+// Loop watchdog registry: worker id -> its ThreadMetrics, scanned by the
+// watchdog thread for stale loop heartbeats. Workers deregister before
+// their stack-local metrics leave scope.
+static std::mutex g_loop_watchdog_mutex;
+static std::vector<std::pair<int, control::ThreadMetrics*>> g_loop_watchdog_workers;
+
+namespace {
+
+/// RAII registration of a worker's metrics with the loop watchdog
+struct LoopWatchdogRegistration {
+    LoopWatchdogRegistration(int worker_id, control::ThreadMetrics* metrics)
+        : worker_id_(worker_id) {
+        std::lock_guard lock(g_loop_watchdog_mutex);
+        g_loop_watchdog_workers.emplace_back(worker_id, metrics);
+    }
+    ~LoopWatchdogRegistration() {
+        std::lock_guard lock(g_loop_watchdog_mutex);
+        std::erase_if(g_loop_watchdog_workers,
+                      [this](const auto& entry) { return entry.first == worker_id_; });
+    }
+
+private:
+    int worker_id_;
+};
+
+}  // namespace
+
+#ifdef __linux__
+// Adaptive spin controller for latency mode (server.busy_poll_enabled):
+// the loop polls with zero timeouts until the window expires, widening
+// the window while spinning keeps finding events and halving it when a
+// spin comes up empty, so sustained idle decays back to blocking waits.
+class AdaptiveSpinner {
+public:
+    explicit AdaptiveSpinner(uint32_t max_us) : max_us_(max_us), window_us_(max_us) {}
+
+    [[nodiscard]] uint32_t window_us() const { return window_us_; }
+
+    void record(bool found_events) {
+        if (found_events) {
+            window_us_ = std::min(max_us_, window_us_ * 2 + 1);
+        } else {
+            window_us_ /= 2;
+        }
+    }
+
+private:
+    uint32_t max_us_;
+    uint32_t window_us_;
+};
+
+// io_uring worker loop - readiness polling with batched submission
+//
+// All poll requests accumulated during one iteration (accept re-arm, client
+// re-arms, backend epoll fd) are flushed by a SINGLE io_uring_enter call in
+// UringEventLoop::wait(), replacing one epoll_ctl syscall per fd per cycle.
+// The backend epoll instance owned by Server is itself registered in the
+// ring, so backend completions piggyback on the same wakeup.
+//
+// Returns false if io_uring is unavailable (caller falls back to epoll).
+static bool run_uring_worker_loop(core::Server& server, int listen_fd, int worker_id) {
+    UringEventLoop ring;
+    if (!ring.init()) {
+        return false;
+    }
+
+    int backend_epoll_fd = server.backend_epoll_fd();
+
+    // Arm initial polls: listen socket + backend epoll instance
+    if (!ring.add_poll(listen_fd, POLLIN) || !ring.add_poll(backend_epoll_fd, POLLIN)) {
+        return false;
+    }
+
+    // Client fds with an outstanding poll request (prevents double-arming a
+    // reused fd number, which would cause spurious wakeups)
+    std::unordered_set<int> armed_fds;
+    std::unordered_set<int> active_client_fds;
+    std::vector<UringCompletion> completions;
+    completions.reserve(256);
+
+    constexpr int MAX_EVENTS = 4096;
+    epoll_event backend_events[MAX_EVENTS];
+
+    while (core::g_server_running) {
+        completions.clear();
+        if (ring.wait(completions, 1) < 0) {
+            break;  // Fatal ring error
+        }
+
+        for (const auto& c : completions) {
+            if (c.fd == listen_fd) {
+                // Accept all pending connections, then re-arm
+                while (true) {
+                    sockaddr_in client_addr{};
+                    socklen_t addr_len = sizeof(client_addr);
+                    int client_fd =
+                        accept(listen_fd, reinterpret_cast<sockaddr*>(&client_addr), &addr_len);
+
+                    if (client_fd < 0) {
+                        if (errno == EAGAIN || errno == EWOULDBLOCK)
+                            break;
+                        continue;
+                    }
+
+                    if (auto ec = core::set_nonblocking(client_fd); ec) {
+                        close_fd(client_fd);
+                        continue;
+                    }
+
+                    char ip_str[INET_ADDRSTRLEN];
+                    inet_ntop(AF_INET, &client_addr.sin_addr, ip_str, sizeof(ip_str));
+                    uint16_t port = ntohs(client_addr.sin_port);
+
+                    server.handle_accept(client_fd, ip_str, port);
+                    active_client_fds.insert(client_fd);
+
+                    if (armed_fds.insert(client_fd).second) {
+                        if (!ring.add_poll(client_fd, POLLIN | POLLRDHUP)) {
+                            armed_fds.erase(client_fd);
+                            active_client_fds.erase(client_fd);
+                            server.handle_close(client_fd);
+                        }
+                    }
+                }
+                (void)ring.add_poll(listen_fd, POLLIN);
+            } else if (c.fd == backend_epoll_fd) {
+                // Drain backend epoll (non-blocking) and re-arm
+                int n_backend = epoll_wait(backend_epoll_fd, backend_events, MAX_EVENTS, 0);
+                for (int i = 0; i < n_backend; ++i) {
+                    int backend_fd = backend_events[i].data.fd;
+                    bool readable = backend_events[i].events & EPOLLIN;
+                    bool writable = backend_events[i].events & EPOLLOUT;
+                    bool error = backend_events[i].events & (EPOLLERR | EPOLLHUP);
+                    server.handle_backend_event(backend_fd, readable, writable, error);
+                }
+                (void)ring.add_poll(backend_epoll_fd, POLLIN);
+            } else {
+                // Client completion - poll is one-shot, so it is disarmed now
+                armed_fds.erase(c.fd);
+
+                if (c.result < 0 || !active_client_fds.count(c.fd)) {
+                    // Stale completion for an already-closed fd
+                    continue;
+                }
+
+                if (c.result & (POLLHUP | POLLRDHUP)) {
+                    active_client_fds.erase(c.fd);
+                    server.handle_close(c.fd);
+                } else if (c.result & POLLERR) {
+                    // MSG_ZEROCOPY completions surface as POLLERR via the
+                    // error queue; only a genuine socket error closes
+                    if (!server.handle_client_error(c.fd)) {
+                        active_client_fds.erase(c.fd);
+                    } else if (armed_fds.insert(c.fd).second) {
+                        // Re-arm; a pending POLLIN fires again immediately
+                        if (!ring.add_poll(c.fd, POLLIN | POLLRDHUP)) {
+                            armed_fds.erase(c.fd);
+                        }
+                    }
+                } else if (c.result & POLLIN) {
+                    server.handle_read(c.fd);
+                    // Re-arm unless handle_read closed the connection; a
+                    // close is detected on the next completion via the
+                    // active set, so over-arming a closed fd is harmless
+                    if (armed_fds.insert(c.fd).second) {
+                        if (!ring.add_poll(c.fd, POLLIN | POLLRDHUP)) {
+                            armed_fds.erase(c.fd);
+                        }
+                    }
+                }
+            }
+        }
+
+        server.process_backend_operations();
+
+        // Tick the timer wheel (client idle + backend timeouts)
+        server.process_timers();
+
+        // Pick up a pending config hot swap (no-op when generation unchanged)
+        server.poll_config_update();
+    }
+
+    // Cleanup: Close remaining connections
+    for (int fd : active_client_fds) {
+        server.handle_close(fd);
+    }
+
+    printf("Worker %d: io_uring loop exited.\n", worker_id);
+    return true;
+}
+#endif  // __linux__
+
 // Worker thread function - runs dual epoll event loop for one worker
 // Each worker has its own Server instance and TWO epoll/kqueue instances:
 // - client_epoll: for client connections
 // - backend_epoll: for backend connections (non-blocking proxy)
 #ifdef __linux__
-static void run_worker_thread(const control::Config& config, int worker_id) {
-    // Pin thread to CPU core for better cache locality
-    core::pin_thread_to_core(worker_id);
+static void run_worker_thread(const control::Config& config, int worker_id,
+                              int inherited_listen_fd = -1,
+                              core::AccessLogWriter* access_log = nullptr) {
+    // NUMA-aware placement: spread workers round-robin across nodes and
+    // prefer the local node for everything allocated on this thread (the
+    // arena, object pools and buffer pool are all built below, so their
+    // pages first-touch locally). cBPF CPU steering needs listeners in
+    // identity cpu order, so it keeps the worker_id pin and takes only
+    // the memory binding.
+    uint32_t pin_cpu = worker_id;
+    int numa_node = -1;
+    if (config.server.numa_aware) {
+        if (config.server.reuseport_cpu_steering) {
+            numa_node = core::get_numa_node_of_cpu(worker_id);
+        } else {
+            auto placement = core::numa_worker_placement(worker_id);
+            pin_cpu = placement.cpu;
+            numa_node = placement.node;
+        }
+    }
+    core::pin_thread_to_core(pin_cpu);
+    if (numa_node >= 0) {
+        (void)core::bind_memory_to_node(numa_node);
+    }
 
     // Initialize per-worker logger
     auto* logger = logging::init_worker_logger(worker_id, config.logging);
@@ -68,6 +299,13 @@ static void run_worker_thread(const control::Config& config, int worker_id) {
     // Build gateway components using factory
     auto router = gateway::build_router(config);
     auto upstream_manager = gateway::build_upstream_manager(config);
+
+    // Route names snapshot for per-route metrics (router is moved into Server)
+    std::vector<std::string> route_names;
+    route_names.reserve(router->routes().size());
+    for (const auto& route : router->routes()) {
+        route_names.push_back(route.handler_id);
+    }
     auto upstream_manager_ptr = upstream_manager.get();
 
     // Build JWT components (per-worker)
@@ -89,16 +327,82 @@ static void run_worker_thread(const control::Config& config, int worker_id) {
     core::Server server(config, std::move(router), std::move(upstream_manager),
                         std::move(pipeline));
     server.set_logger(logger);
+
+    // Per-worker metrics (TLS handshake/resumption counters)
+    control::ThreadMetrics worker_metrics;
+    server.set_metrics(&worker_metrics);
+    control::t_thread_metrics = &worker_metrics;
+
+    // Make this worker sampleable by the admin /_admin/profile endpoint
+    control::CpuProfiler::instance().register_thread(static_cast<uint32_t>(worker_id));
+
+    // Expose the loop heartbeat to the stall watchdog for this scope
+    LoopWatchdogRegistration watchdog_registration(worker_id, &worker_metrics);
+
+    // Binary access log: this worker's SPSC ring (owned by the writer)
+    if (access_log) {
+        core::t_access_log_ring = access_log->create_ring();
+    }
+
+    // Flat per-route stats table indexed by the router's dense metrics IDs
+    worker_metrics.configure_routes(std::move(route_names));
+
+    // Binary handover: adopt the predecessor's listener for this worker
+    server.set_inherited_listen_fd(inherited_listen_fd);
+
+    // RCU config hot swap: on SIGHUP the manager bumps its generation and
+    // each worker rebuilds router/upstreams/pipeline from the new snapshot
+    // at a loop-iteration boundary (see Server::poll_config_update). The
+    // JWT validator object is reused (its JWKS fetcher thread outlives
+    // individual snapshots), but a changed jwt section drops the verified-
+    // token caches so rotated keys take effect immediately.
+    if (const auto* config_manager =
+            core::g_config_manager_for_workers.load(std::memory_order_acquire)) {
+        server.set_config_source(
+            config_manager,
+            [jwt_validator](std::shared_ptr<const control::Config> cfg,
+                            const control::ConfigDelta& delta,
+                            core::Server::ConfigSnapshot& previous) {
+                core::Server::ConfigSnapshot snap;
+                // Unchanged sections ride over from the displaced bundle;
+                // the pipeline is always rebuilt (it points at the manager)
+                snap.router = !delta.routes_changed && previous.router
+                                  ? std::move(previous.router)
+                                  : gateway::build_router(*cfg);
+                snap.upstream_manager =
+                    gateway::build_upstream_manager(*cfg, &delta, previous.upstream_manager.get());
+                snap.pipeline = gateway::build_pipeline(*cfg, snap.upstream_manager.get(),
+                                                        g_revocation_queue, jwt_validator);
+                // Key rotation: verified-token caches hold results produced
+                // with the old keys - drop this worker's L1 and the
+                // process-wide L2 (the clear is idempotent across workers)
+                if (delta.jwt_changed) {
+                    if (jwt_validator) {
+                        jwt_validator->clear_cache();
+                    }
+                    core::SharedTokenCache::instance().clear();
+                }
+                snap.config = std::move(cfg);
+                return snap;
+            });
+    }
+
     if (auto ec = server.start(); ec) {
         return;
     }
 
+    // Expose this listener to a future successor process
+    if (!config.server.upgrade_socket_path.empty()) {
+        register_handover_listener(server.listen_fd());
+    }
+
     // Worker 0 shares its upstream_manager for admin server metrics
     if (worker_id == 0) {
         core::g_upstream_manager_for_metrics.store(server.upstream_manager(),
                                                    std::memory_order_release);
         core::g_compression_metrics_for_export.store(&gateway::compression_metrics,
                                                      std::memory_order_release);
+        core::g_worker_metrics_for_export.store(&worker_metrics, std::memory_order_release);
     }
 
     int listen_fd = server.listen_fd();
@@ -106,6 +410,33 @@ static void run_worker_thread(const control::Config& config, int worker_id) {
         return;
     }
 
+    // Optional cBPF steering for the SO_REUSEPORT group: pin connections to
+    // the listener on the receiving CPU instead of the 4-tuple hash. The
+    // program is group-wide, so re-attaching from every worker is harmless.
+    if (config.server.reuseport_cpu_steering) {
+        if (auto ec = core::attach_reuseport_cpu_steering(listen_fd); ec) {
+            LOG_WARNING(logger, "reuseport CPU steering unavailable: {}", ec.message());
+        }
+    }
+
+    // Latency mode: let the listener's receive path busy-poll the NIC
+    // queue (accepted sockets opt in from handle_accept)
+    if (config.server.busy_poll_enabled && config.server.busy_poll_budget_us > 0) {
+        if (auto ec = core::set_busy_poll(listen_fd, config.server.busy_poll_budget_us); ec) {
+            LOG_WARNING(logger, "SO_BUSY_POLL unavailable: {}", ec.message());
+        }
+    }
+
+    // io_uring backend (opt-in): batched poll submission, one syscall per
+    // loop iteration. Falls back to the epoll loop below if unavailable.
+    if (config.server.event_backend == "io_uring") {
+        if (run_uring_worker_loop(server, listen_fd, worker_id)) {
+            server.stop();
+            return;
+        }
+        LOG_WARNING(logger, "io_uring unavailable on this kernel, falling back to epoll");
+    }
+
     // Create TWO epoll instances (dual epoll pattern)
     int client_epoll_fd = epoll_create1(0);
     if (client_epoll_fd < 0)
@@ -131,9 +462,59 @@ static void run_worker_thread(const control::Config& config, int worker_id) {
     epoll_event client_events[MAX_EVENTS];
     epoll_event backend_events[MAX_EVENTS];
 
+    const bool busy_poll = config.server.busy_poll_enabled;
+    AdaptiveSpinner spinner(config.server.busy_poll_spin_us);
+
+    // Loop lag instrumentation: dispatch time per iteration (epoll waits
+    // excluded), attributed per subsystem. An iteration over the stall
+    // threshold logs its breakdown; the orchestrator watchdog handles
+    // mid-stall stack capture via the heartbeat set below.
+    const uint64_t stall_threshold_ns =
+        static_cast<uint64_t>(config.server.loop_stall_threshold_ms) * 1'000'000;
+    auto monotonic_ns = [] {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    };
+
     while (core::g_server_running) {
-        // Process client events (with timeout to balance with backend processing)
-        int n_client = epoll_wait(client_epoll_fd, client_events, MAX_EVENTS, 1);
+        // Event acquisition. Default path: blocking 1ms waits (client here,
+        // backend below). Latency mode instead spins zero-timeout polls
+        // over both epolls for the adaptive window before falling back to
+        // a blocking wait.
+        int n_client = 0;
+        int n_backend = 0;
+        if (!busy_poll) {
+            n_client = epoll_wait(client_epoll_fd, client_events, MAX_EVENTS, 1);
+        } else {
+            n_client = epoll_wait(client_epoll_fd, client_events, MAX_EVENTS, 0);
+            n_backend = epoll_wait(backend_epoll_fd, backend_events, MAX_EVENTS, 0);
+            if (n_client > 0 || n_backend > 0) {
+                spinner.record(true);
+            } else {
+                bool found = false;
+                auto deadline = std::chrono::steady_clock::now() +
+                                std::chrono::microseconds(spinner.window_us());
+                while (std::chrono::steady_clock::now() < deadline) {
+                    n_client = epoll_wait(client_epoll_fd, client_events, MAX_EVENTS, 0);
+                    n_backend = epoll_wait(backend_epoll_fd, backend_events, MAX_EVENTS, 0);
+                    if (n_client > 0 || n_backend > 0) {
+                        found = true;
+                        break;
+                    }
+                }
+                spinner.record(found);
+                if (!found) {
+                    // Spin came up empty - block like the default loop so
+                    // sustained idle doesn't peg the core solid
+                    n_client = epoll_wait(client_epoll_fd, client_events, MAX_EVENTS, 1);
+                    n_backend = epoll_wait(backend_epoll_fd, backend_events, MAX_EVENTS, 0);
+                }
+            }
+        }
+
+        const uint64_t t_dispatch = monotonic_ns();
+        worker_metrics.loop_enter(t_dispatch);
 
         for (int i = 0; i < n_client; ++i) {
             int fd = client_events[i].data.fd;
@@ -174,18 +555,34 @@ static void run_worker_thread(const control::Config& config, int worker_id) {
                 }
             } else {
                 // Handle client I/O
-                if (client_events[i].events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP)) {
+                if (client_events[i].events & (EPOLLHUP | EPOLLRDHUP)) {
                     epoll_ctl(client_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
                     active_client_fds.erase(fd);
                     server.handle_close(fd);
+                } else if (client_events[i].events & EPOLLERR) {
+                    // MSG_ZEROCOPY completions surface as EPOLLERR via the
+                    // error queue; only a genuine socket error closes
+                    if (!server.handle_client_error(fd)) {
+                        epoll_ctl(client_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+                        active_client_fds.erase(fd);
+                    } else if (client_events[i].events & EPOLLIN) {
+                        server.handle_read(fd);
+                    }
                 } else if (client_events[i].events & EPOLLIN) {
                     server.handle_read(fd);
                 }
             }
         }
 
-        // Process backend events (with 1ms timeout)
-        int n_backend = epoll_wait(backend_epoll_fd, backend_events, MAX_EVENTS, 1);
+        const uint64_t t_client_done = monotonic_ns();
+
+        // Process backend events (with 1ms timeout; latency mode already
+        // polled them during acquisition above). The blocking wait is
+        // acquisition, not dispatch, so it stays out of the busy time.
+        if (!busy_poll) {
+            n_backend = epoll_wait(backend_epoll_fd, backend_events, MAX_EVENTS, 1);
+        }
+        const uint64_t t_backend_start = monotonic_ns();
 
         for (int i = 0; i < n_backend; ++i) {
             int backend_fd = backend_events[i].data.fd;
@@ -196,8 +593,38 @@ static void run_worker_thread(const control::Config& config, int worker_id) {
             server.handle_backend_event(backend_fd, readable, writable, error);
         }
 
+        const uint64_t t_backend_done = monotonic_ns();
+
         // Process any pending backend operations
         server.process_backend_operations();
+        const uint64_t t_ops_done = monotonic_ns();
+
+        // Tick the timer wheel (client idle + backend timeouts)
+        server.process_timers();
+        const uint64_t t_timers_done = monotonic_ns();
+
+        // Pick up a pending config hot swap (no-op when generation unchanged)
+        server.poll_config_update();
+        const uint64_t t_end = monotonic_ns();
+
+        control::ThreadMetrics::LoopIterationSample sample;
+        sample.client_io_ns = t_client_done - t_dispatch;
+        sample.backend_io_ns = t_backend_done - t_backend_start;
+        sample.maintenance_ns = (t_ops_done - t_backend_done) + (t_end - t_timers_done);
+        sample.timer_ns = t_timers_done - t_ops_done;
+        sample.busy_ns = sample.client_io_ns + (t_end - t_backend_start);
+        sample.events = static_cast<uint32_t>(n_client + n_backend);
+        sample.stalled = stall_threshold_ns != 0 && sample.busy_ns > stall_threshold_ns;
+        worker_metrics.record_loop_iteration(sample);
+        worker_metrics.loop_park();
+
+        if (sample.stalled) {
+            printf("Worker %d: event loop stall: %.1fms "
+                   "(client=%.1fms backend=%.1fms timers=%.1fms maintenance=%.1fms, %u events)\n",
+                   worker_id, sample.busy_ns / 1e6, sample.client_io_ns / 1e6,
+                   sample.backend_io_ns / 1e6, sample.timer_ns / 1e6,
+                   sample.maintenance_ns / 1e6, sample.events);
+        }
     }
 
     // Graceful shutdown: Wait for in-flight requests to complete
@@ -219,10 +646,19 @@ static void run_worker_thread(const control::Config& config, int worker_id) {
             for (int i = 0; i < n_client; ++i) {
                 int fd = client_events[i].data.fd;
 
-                if (client_events[i].events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP)) {
+                if (client_events[i].events & (EPOLLHUP | EPOLLRDHUP)) {
                     epoll_ctl(client_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
                     active_client_fds.erase(fd);
                     server.handle_close(fd);
+                } else if (client_events[i].events & EPOLLERR) {
+                    // MSG_ZEROCOPY completions surface as EPOLLERR via the
+                    // error queue; only a genuine socket error closes
+                    if (!server.handle_client_error(fd)) {
+                        epoll_ctl(client_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+                        active_client_fds.erase(fd);
+                    } else if (client_events[i].events & EPOLLIN) {
+                        server.handle_read(fd);
+                    }
                 } else if (client_events[i].events & EPOLLIN) {
                     server.handle_read(fd);
                 }
@@ -261,13 +697,22 @@ static void run_worker_thread(const control::Config& config, int worker_id) {
 }
 
 #elif defined(__APPLE__) || defined(__FreeBSD__)
-static void run_worker_thread(const control::Config& config, int worker_id) {
+static void run_worker_thread(const control::Config& config, int worker_id,
+                              int inherited_listen_fd = -1,
+                              core::AccessLogWriter* access_log = nullptr) {
     // Note: macOS doesn't support thread CPU affinity
     // core::pin_thread_to_core(worker_id);  // No-op on macOS
 
     // Build gateway components using factory
     auto router = gateway::build_router(config);
     auto upstream_manager = gateway::build_upstream_manager(config);
+
+    // Route names snapshot for per-route metrics (router is moved into Server)
+    std::vector<std::string> route_names;
+    route_names.reserve(router->routes().size());
+    for (const auto& route : router->routes()) {
+        route_names.push_back(route.handler_id);
+    }
     auto upstream_manager_ptr = upstream_manager.get();
 
     // Build JWT components (per-worker)
@@ -288,16 +733,82 @@ static void run_worker_thread(const control::Config& config, int worker_id) {
     // Create server with pre-built components
     core::Server server(config, std::move(router), std::move(upstream_manager),
                         std::move(pipeline));
+
+    // Per-worker metrics (TLS handshake/resumption counters)
+    control::ThreadMetrics worker_metrics;
+    server.set_metrics(&worker_metrics);
+    control::t_thread_metrics = &worker_metrics;
+
+    // Make this worker sampleable by the admin /_admin/profile endpoint
+    control::CpuProfiler::instance().register_thread(static_cast<uint32_t>(worker_id));
+
+    // Expose the loop heartbeat to the stall watchdog for this scope
+    LoopWatchdogRegistration watchdog_registration(worker_id, &worker_metrics);
+
+    // Binary access log: this worker's SPSC ring (owned by the writer)
+    if (access_log) {
+        core::t_access_log_ring = access_log->create_ring();
+    }
+
+    // Flat per-route stats table indexed by the router's dense metrics IDs
+    worker_metrics.configure_routes(std::move(route_names));
+
+    // Binary handover: adopt the predecessor's listener for this worker
+    server.set_inherited_listen_fd(inherited_listen_fd);
+
+    // RCU config hot swap: on SIGHUP the manager bumps its generation and
+    // each worker rebuilds router/upstreams/pipeline from the new snapshot
+    // at a loop-iteration boundary (see Server::poll_config_update). The
+    // JWT validator object is reused (its JWKS fetcher thread outlives
+    // individual snapshots), but a changed jwt section drops the verified-
+    // token caches so rotated keys take effect immediately.
+    if (const auto* config_manager =
+            core::g_config_manager_for_workers.load(std::memory_order_acquire)) {
+        server.set_config_source(
+            config_manager,
+            [jwt_validator](std::shared_ptr<const control::Config> cfg,
+                            const control::ConfigDelta& delta,
+                            core::Server::ConfigSnapshot& previous) {
+                core::Server::ConfigSnapshot snap;
+                // Unchanged sections ride over from the displaced bundle;
+                // the pipeline is always rebuilt (it points at the manager)
+                snap.router = !delta.routes_changed && previous.router
+                                  ? std::move(previous.router)
+                                  : gateway::build_router(*cfg);
+                snap.upstream_manager =
+                    gateway::build_upstream_manager(*cfg, &delta, previous.upstream_manager.get());
+                snap.pipeline = gateway::build_pipeline(*cfg, snap.upstream_manager.get(),
+                                                        g_revocation_queue, jwt_validator);
+                // Key rotation: verified-token caches hold results produced
+                // with the old keys - drop this worker's L1 and the
+                // process-wide L2 (the clear is idempotent across workers)
+                if (delta.jwt_changed) {
+                    if (jwt_validator) {
+                        jwt_validator->clear_cache();
+                    }
+                    core::SharedTokenCache::instance().clear();
+                }
+                snap.config = std::move(cfg);
+                return snap;
+            });
+    }
+
     if (auto ec = server.start(); ec) {
         return;
     }
 
+    // Expose this listener to a future successor process
+    if (!config.server.upgrade_socket_path.empty()) {
+        register_handover_listener(server.listen_fd());
+    }
+
     // Worker 0 shares its upstream_manager for admin server metrics
     if (worker_id == 0) {
         core::g_upstream_manager_for_metrics.store(server.upstream_manager(),
                                                    std::memory_order_release);
         core::g_compression_metrics_for_export.store(&gateway::compression_metrics,
                                                      std::memory_order_release);
+        core::g_worker_metrics_for_export.store(&worker_metrics, std::memory_order_release);
     }
 
     int listen_fd = server.listen_fd();
@@ -397,6 +908,12 @@ static void run_worker_thread(const control::Config& config, int worker_id) {
 
         // Process any pending backend operations
         server.process_backend_operations();
+
+        // Tick the timer wheel (client idle + backend timeouts)
+        server.process_timers();
+
+        // Pick up a pending config hot swap (no-op when generation unchanged)
+        server.poll_config_update();
     }
 
     // Graceful shutdown: Wait for in-flight requests to complete
@@ -468,6 +985,7 @@ std::error_code run_simple_server(const control::Config& config) {
     // Build gateway components using factory
     auto router = gateway::build_router(config);
     auto upstream_manager = gateway::build_upstream_manager(config);
+
     auto upstream_manager_ptr = upstream_manager.get();
 
     // Build JWT components
@@ -489,6 +1007,38 @@ std::error_code run_simple_server(const control::Config& config) {
     core::Server server(config, std::move(router), std::move(upstream_manager),
                         std::move(pipeline));
 
+    // RCU config hot swap (see Server::poll_config_update)
+    if (const auto* config_manager =
+            core::g_config_manager_for_workers.load(std::memory_order_acquire)) {
+        server.set_config_source(
+            config_manager,
+            [jwt_validator](std::shared_ptr<const control::Config> cfg,
+                            const control::ConfigDelta& delta,
+                            core::Server::ConfigSnapshot& previous) {
+                core::Server::ConfigSnapshot snap;
+                // Unchanged sections ride over from the displaced bundle;
+                // the pipeline is always rebuilt (it points at the manager)
+                snap.router = !delta.routes_changed && previous.router
+                                  ? std::move(previous.router)
+                                  : gateway::build_router(*cfg);
+                snap.upstream_manager =
+                    gateway::build_upstream_manager(*cfg, &delta, previous.upstream_manager.get());
+                snap.pipeline = gateway::build_pipeline(*cfg, snap.upstream_manager.get(),
+                                                        g_revocation_queue, jwt_validator);
+                // Key rotation: verified-token caches hold results produced
+                // with the old keys - drop this worker's L1 and the
+                // process-wide L2 (the clear is idempotent across workers)
+                if (delta.jwt_changed) {
+                    if (jwt_validator) {
+                        jwt_validator->clear_cache();
+                    }
+                    core::SharedTokenCache::instance().clear();
+                }
+                snap.config = std::move(cfg);
+                return snap;
+            });
+    }
+
     if (auto ec = server.start(); ec) {
         return ec;
     }
@@ -582,11 +1132,21 @@ std::error_code run_simple_server(const control::Config& config) {
             }
             // Handle client socket events
             else {
-                if (events[i].events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP)) {
-                    // Connection closed or error
+                if (events[i].events & (EPOLLHUP | EPOLLRDHUP)) {
+                    // Connection closed
                     epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
                     active_fds.erase(fd);
                     server.handle_close(fd);
+                } else if (events[i].events & EPOLLERR) {
+                    // MSG_ZEROCOPY completions surface as EPOLLERR via the
+                    // error queue; only a genuine socket error closes
+                    if (!server.handle_client_error(fd)) {
+                        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+                        active_fds.erase(fd);
+                    } else if (events[i].events & EPOLLIN) {
+                        // Data available to read
+                        server.handle_read(fd);
+                    }
                 } else if (events[i].events & EPOLLIN) {
                     // Data available to read
                     server.handle_read(fd);
@@ -608,6 +1168,12 @@ std::error_code run_simple_server(const control::Config& config) {
 
         // Process any pending backend operations (async proxy support)
         server.process_backend_operations();
+
+        // Tick the timer wheel (client idle + backend timeouts)
+        server.process_timers();
+
+        // Pick up a pending config hot swap (no-op when generation unchanged)
+        server.poll_config_update();
     }
 
     // Cleanup
@@ -625,6 +1191,7 @@ std::error_code run_simple_server(const control::Config& config) {
     // Build gateway components using factory
     auto router = gateway::build_router(config);
     auto upstream_manager = gateway::build_upstream_manager(config);
+
     auto upstream_manager_ptr = upstream_manager.get();
 
     // Build JWT components
@@ -646,6 +1213,38 @@ std::error_code run_simple_server(const control::Config& config) {
     core::Server server(config, std::move(router), std::move(upstream_manager),
                         std::move(pipeline));
 
+    // RCU config hot swap (see Server::poll_config_update)
+    if (const auto* config_manager =
+            core::g_config_manager_for_workers.load(std::memory_order_acquire)) {
+        server.set_config_source(
+            config_manager,
+            [jwt_validator](std::shared_ptr<const control::Config> cfg,
+                            const control::ConfigDelta& delta,
+                            core::Server::ConfigSnapshot& previous) {
+                core::Server::ConfigSnapshot snap;
+                // Unchanged sections ride over from the displaced bundle;
+                // the pipeline is always rebuilt (it points at the manager)
+                snap.router = !delta.routes_changed && previous.router
+                                  ? std::move(previous.router)
+                                  : gateway::build_router(*cfg);
+                snap.upstream_manager =
+                    gateway::build_upstream_manager(*cfg, &delta, previous.upstream_manager.get());
+                snap.pipeline = gateway::build_pipeline(*cfg, snap.upstream_manager.get(),
+                                                        g_revocation_queue, jwt_validator);
+                // Key rotation: verified-token caches hold results produced
+                // with the old keys - drop this worker's L1 and the
+                // process-wide L2 (the clear is idempotent across workers)
+                if (delta.jwt_changed) {
+                    if (jwt_validator) {
+                        jwt_validator->clear_cache();
+                    }
+                    core::SharedTokenCache::instance().clear();
+                }
+                snap.config = std::move(cfg);
+                return snap;
+            });
+    }
+
     if (auto ec = server.start(); ec) {
         return ec;
     }
@@ -764,6 +1363,12 @@ std::error_code run_simple_server(const control::Config& config) {
 
         // Process any pending backend operations (async proxy support)
         server.process_backend_operations();
+
+        // Tick the timer wheel (client idle + backend timeouts)
+        server.process_timers();
+
+        // Pick up a pending config hot swap (no-op when generation unchanged)
+        server.poll_config_update();
     }
 
     // Cleanup
@@ -787,6 +1392,10 @@ std::error_code run_multi_threaded_server(const control::Config& config) {
     // Set server running flag
     core::g_server_running = true;
 
+    // Hugepage-backed arenas/pool slabs: process-wide opt-in, decided
+    // before any worker allocates (see core::hugepages)
+    core::hugepages::set_enabled(config.server.hugepages_enabled);
+
     // Initialize global revocation queue for JWT token revocation
     // This is shared across all workers for synchronization
     core::RevocationQueue revocation_queue;
@@ -816,12 +1425,111 @@ std::error_code run_multi_threaded_server(const control::Config& config) {
         }
     }
 
+    // Binary access log: background writer shared by all workers (it owns
+    // the per-worker rings, so they outlive early-exiting worker threads)
+    std::unique_ptr<core::AccessLogWriter> access_log_writer;
+    if (config.logging.access_log_binary && !config.logging.access_log_path.empty()) {
+        access_log_writer = std::make_unique<core::AccessLogWriter>(config.logging.access_log_path);
+        if (access_log_writer->start()) {
+            std::printf("Binary access log: %s\n", config.logging.access_log_path.c_str());
+        } else {
+            std::fprintf(stderr, "Failed to open binary access log %s\n",
+                         config.logging.access_log_path.c_str());
+            access_log_writer.reset();
+        }
+    }
+
+    // Zero-downtime upgrade: adopt listeners from a running predecessor.
+    // Workers beyond the inherited count bind fresh SO_REUSEPORT sockets
+    // on the same port, so a worker-count change across the upgrade works.
+    std::vector<int> inherited_fds;
+    if (!config.server.upgrade_socket_path.empty()) {
+        inherited_fds = request_listener_handover(config.server.upgrade_socket_path);
+        if (!inherited_fds.empty()) {
+            std::printf("Handover: adopted %zu listener(s) from predecessor\n",
+                        inherited_fds.size());
+        }
+    }
+
+    // Active health checking: one prober thread multiplexes every
+    // configured backend over a non-blocking poll loop; workers fold its
+    // results into their own Backend objects from their timer paths
+    control::HealthProber health_prober(config);
+    if (health_prober.has_targets()) {
+        health_prober.start();
+        core::g_health_prober_for_workers.store(&health_prober, std::memory_order_release);
+    }
+
     // Spawn worker threads
     std::vector<std::thread> workers;
     workers.reserve(num_workers);
 
     for (uint32_t i = 0; i < num_workers; ++i) {
-        workers.emplace_back([&config, i]() { run_worker_thread(config, i); });
+        int inherited_fd = i < inherited_fds.size() ? inherited_fds[i] : -1;
+        core::AccessLogWriter* access_log = access_log_writer.get();
+        workers.emplace_back([&config, i, inherited_fd, access_log]() {
+            run_worker_thread(config, i, inherited_fd, access_log);
+        });
+    }
+
+    // Close inherited fds beyond the worker count. Their pending backlog
+    // is dropped, so keep worker_threads stable across upgrades.
+    for (size_t i = num_workers; i < inherited_fds.size(); ++i) {
+        core::close_fd(inherited_fds[i]);
+    }
+
+    // Serve the handover socket for the NEXT upgrade (flips graceful
+    // shutdown once a successor has taken the listeners)
+    if (!config.server.upgrade_socket_path.empty()) {
+        start_handover_server(config.server.upgrade_socket_path);
+    }
+
+    // Loop stall watchdog: scans worker heartbeats and, when a loop has
+    // been stuck inside a single iteration past the threshold, snapshots
+    // the stuck thread's stack while it is still in the slow callback
+    // (the in-loop stall log only fires after the iteration finishes)
+    std::thread watchdog_thread;
+    if (config.server.loop_stall_threshold_ms > 0) {
+        watchdog_thread = std::thread([&config] {
+            const uint64_t threshold_ns =
+                static_cast<uint64_t>(config.server.loop_stall_threshold_ms) * 1'000'000;
+            std::vector<uint64_t> last_capture_ns;
+            while (core::g_server_running) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+                std::lock_guard lock(g_loop_watchdog_mutex);
+                for (const auto& [worker_id, metrics] : g_loop_watchdog_workers) {
+                    uint64_t heartbeat = metrics->loop_heartbeat_ns();
+                    if (heartbeat == 0) {
+                        continue;  // Parked in epoll_wait
+                    }
+                    auto now = static_cast<uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count());
+                    if (now - heartbeat < threshold_ns) {
+                        continue;
+                    }
+                    // One capture per stall: back off 5s per worker
+                    if (last_capture_ns.size() <= static_cast<size_t>(worker_id)) {
+                        last_capture_ns.resize(static_cast<size_t>(worker_id) + 1, 0);
+                    }
+                    if (now - last_capture_ns[static_cast<size_t>(worker_id)] <
+                        5'000'000'000ULL) {
+                        continue;
+                    }
+                    last_capture_ns[static_cast<size_t>(worker_id)] = now;
+
+                    std::string stack =
+                        control::CpuProfiler::instance().capture_stack(
+                            static_cast<uint32_t>(worker_id));
+                    std::printf(
+                        "Worker %d: event loop stuck for %.0fms, stack:\n%s", worker_id,
+                        static_cast<double>(now - heartbeat) / 1e6,
+                        stack.empty() ? "    (no stack captured)\n" : stack.c_str());
+                }
+            }
+        });
     }
 
     // Wait for all workers to finish
@@ -831,6 +1539,14 @@ std::error_code run_multi_threaded_server(const control::Config& config) {
         }
     }
 
+    if (watchdog_thread.joinable()) {
+        watchdog_thread.join();
+    }
+
+    // Workers have exited, so nobody reads probe results anymore
+    core::g_health_prober_for_workers.store(nullptr, std::memory_order_release);
+    health_prober.stop();
+
     // Stop admin server
     if (admin_server) {
         admin_server->stop();
@@ -839,6 +1555,11 @@ std::error_code run_multi_threaded_server(const control::Config& config) {
         }
     }
 
+    // Flush and close the access log after all producers have exited
+    if (access_log_writer) {
+        access_log_writer->stop();
+    }
+
     // Cleanup global revocation queue pointer
     g_revocation_queue = nullptr;
 
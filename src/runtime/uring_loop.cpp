@@ -0,0 +1,260 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan io_uring Event Loop - Implementation
+
+#ifdef __linux__
+
+#include "uring_loop.hpp"
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+
+namespace titan::runtime {
+
+namespace {
+
+int sys_io_uring_setup(unsigned entries, struct io_uring_params* params) {
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags,
+                       const void* arg, size_t argsz) {
+    return static_cast<int>(
+        syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, arg, argsz));
+}
+
+// Acquire/release helpers for the shared ring indices
+uint32_t load_acquire(uint32_t* p) {
+    return std::atomic_ref<uint32_t>(*p).load(std::memory_order_acquire);
+}
+
+void store_release(uint32_t* p, uint32_t v) {
+    std::atomic_ref<uint32_t>(*p).store(v, std::memory_order_release);
+}
+
+}  // anonymous namespace
+
+// Local alias so the header doesn't need <linux/io_uring.h>
+struct Sqe : io_uring_sqe {};
+
+UringEventLoop::~UringEventLoop() {
+    if (sqes_) {
+        munmap(sqes_, sqes_size_);
+    }
+    if (cq_ring_ && !single_mmap_) {
+        munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_) {
+        munmap(sq_ring_, sq_ring_size_);
+    }
+    if (ring_fd_ >= 0) {
+        close(ring_fd_);
+    }
+}
+
+bool UringEventLoop::init(unsigned entries) {
+    io_uring_params params{};
+    ring_fd_ = sys_io_uring_setup(entries, &params);
+    if (ring_fd_ < 0) {
+        // ENOSYS on old kernels, EPERM in restricted containers
+        return false;
+    }
+
+    single_mmap_ = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+#ifdef IORING_ENTER_EXT_ARG
+    ext_arg_ = (params.features & IORING_FEAT_EXT_ARG) != 0;
+#endif
+
+    // Map submission queue ring
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if (single_mmap_ && cq_ring_size_ > sq_ring_size_) {
+        sq_ring_size_ = cq_ring_size_;
+    }
+
+    sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                    ring_fd_, IORING_OFF_SQ_RING);
+    if (sq_ring_ == MAP_FAILED) {
+        sq_ring_ = nullptr;
+        close(ring_fd_);
+        ring_fd_ = -1;
+        return false;
+    }
+
+    if (single_mmap_) {
+        cq_ring_ = sq_ring_;
+    } else {
+        cq_ring_ = mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        ring_fd_, IORING_OFF_CQ_RING);
+        if (cq_ring_ == MAP_FAILED) {
+            cq_ring_ = nullptr;
+            close(ring_fd_);
+            ring_fd_ = -1;
+            return false;
+        }
+    }
+
+    // Map submission queue entries
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                 IORING_OFF_SQES);
+    if (sqes_ == MAP_FAILED) {
+        sqes_ = nullptr;
+        close(ring_fd_);
+        ring_fd_ = -1;
+        return false;
+    }
+
+    auto* sq_base = static_cast<uint8_t*>(sq_ring_);
+    sq_head_ = reinterpret_cast<uint32_t*>(sq_base + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<uint32_t*>(sq_base + params.sq_off.tail);
+    sq_mask_ = reinterpret_cast<uint32_t*>(sq_base + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<uint32_t*>(sq_base + params.sq_off.array);
+
+    auto* cq_base = static_cast<uint8_t*>(cq_ring_);
+    cq_head_ = reinterpret_cast<uint32_t*>(cq_base + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<uint32_t*>(cq_base + params.cq_off.tail);
+    cq_mask_ = reinterpret_cast<uint32_t*>(cq_base + params.cq_off.ring_mask);
+    cqes_ = cq_base + params.cq_off.cqes;
+
+    return true;
+}
+
+Sqe* UringEventLoop::get_sqe() {
+    uint32_t head = load_acquire(sq_head_);
+    uint32_t tail = *sq_tail_;  // Only we write the tail
+
+    // Ring full - force a submit to drain queued entries
+    if (tail - head >= *sq_mask_ + 1) {
+        if (sys_io_uring_enter(ring_fd_, to_submit_, 0, 0, nullptr, 0) < 0) {
+            return nullptr;
+        }
+        to_submit_ = 0;
+        head = load_acquire(sq_head_);
+        if (tail - head >= *sq_mask_ + 1) {
+            return nullptr;  // Kernel not draining - give up on this SQE
+        }
+    }
+
+    uint32_t index = tail & *sq_mask_;
+    auto* sqe = static_cast<Sqe*>(sqes_) + index;
+    std::memset(sqe, 0, sizeof(io_uring_sqe));
+    sq_array_[index] = index;
+    store_release(sq_tail_, tail + 1);
+    ++to_submit_;
+    return sqe;
+}
+
+bool UringEventLoop::add_poll(int fd, uint32_t poll_mask) {
+    Sqe* sqe = get_sqe();
+    if (!sqe) {
+        return false;
+    }
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->poll_events = static_cast<uint16_t>(poll_mask);
+    sqe->user_data = static_cast<uint64_t>(fd);
+    return true;
+}
+
+bool UringEventLoop::remove_poll(int fd) {
+    Sqe* sqe = get_sqe();
+    if (!sqe) {
+        return false;
+    }
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->addr = static_cast<uint64_t>(fd);  // user_data of the poll to cancel
+    // Cancellation results carry user_data ~0 so the worker ignores them
+    sqe->user_data = ~0ULL;
+    return true;
+}
+
+int UringEventLoop::wait(std::vector<UringCompletion>& out, int timeout_ms) {
+    unsigned flags = IORING_ENTER_GETEVENTS;
+    int ret;
+
+#ifdef IORING_ENTER_EXT_ARG
+    if (ext_arg_) {
+        __kernel_timespec ts{};
+        ts.tv_sec = timeout_ms / 1000;
+        ts.tv_nsec = static_cast<long long>(timeout_ms % 1000) * 1000000;
+        io_uring_getevents_arg arg{};
+        arg.ts = reinterpret_cast<uint64_t>(&ts);
+        ret = sys_io_uring_enter(ring_fd_, to_submit_, 1, flags | IORING_ENTER_EXT_ARG, &arg,
+                                 sizeof(arg));
+    } else
+#endif
+    {
+        // No EXT_ARG support (pre-5.11): a plain submit would return
+        // immediately and the caller's loop would busy-spin. Arm a
+        // one-shot IORING_OP_TIMEOUT that completes after one other CQE
+        // posts (off=1) or timeout_ms elapses - the same shape liburing
+        // uses for io_uring_wait_cqe_timeout - then block on GETEVENTS.
+        // The kernel copies the timespec at submission, so the stack
+        // storage need not outlive this call.
+        __kernel_timespec ts{};
+        ts.tv_sec = timeout_ms / 1000;
+        ts.tv_nsec = static_cast<long long>(timeout_ms % 1000) * 1000000;
+        Sqe* timeout_sqe = get_sqe();
+        if (timeout_sqe) {
+            timeout_sqe->opcode = IORING_OP_TIMEOUT;
+            timeout_sqe->addr = reinterpret_cast<uint64_t>(&ts);
+            timeout_sqe->len = 1;
+            timeout_sqe->off = 1;  // Self-completes once one real CQE lands
+            // Timeout results are bookkeeping - harvest skips this marker
+            timeout_sqe->user_data = ~0ULL;
+            ret = sys_io_uring_enter(ring_fd_, to_submit_, 1, flags, nullptr, 0);
+        } else {
+            // Ring full - submit without blocking rather than risk a wait
+            // with no armed timeout; the queued SQEs will complete soon
+            ret = sys_io_uring_enter(ring_fd_, to_submit_, 0, 0, nullptr, 0);
+        }
+    }
+
+    if (ret < 0 && errno != ETIME && errno != EINTR) {
+        return -1;
+    }
+    to_submit_ = 0;
+
+    // Harvest all available completions
+    int harvested = 0;
+    uint32_t head = *cq_head_;  // Only we write the head
+    uint32_t tail = load_acquire(cq_tail_);
+    auto* cqes = static_cast<io_uring_cqe*>(cqes_);
+
+    while (head != tail) {
+        const io_uring_cqe& cqe = cqes[head & *cq_mask_];
+        if (cqe.user_data != ~0ULL) {  // Skip POLL_REMOVE results
+            out.push_back({static_cast<int>(cqe.user_data), cqe.res});
+            ++harvested;
+        }
+        ++head;
+    }
+    store_release(cq_head_, head);
+
+    return harvested;
+}
+
+}  // namespace titan::runtime
+
+#endif  // __linux__
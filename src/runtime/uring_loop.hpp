@@ -0,0 +1,104 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan io_uring Event Loop - Header
+// Readiness-based io_uring backend (raw syscalls, no liburing dependency)
+//
+// Used as an alternative to the per-fd epoll_wait cycle: poll requests for
+// all interesting fds are queued as SQEs and submitted in ONE io_uring_enter
+// syscall, and dozens of completions are harvested per wakeup. The Server
+// keeps doing its own non-blocking recv/send, so this file only provides
+// readiness notification with batched submission.
+
+#pragma once
+
+#ifdef __linux__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace titan::runtime {
+
+/// Single readiness completion harvested from the ring
+struct UringCompletion {
+    int fd = -1;
+    int32_t result = 0;  // poll revents mask, or negative errno
+};
+
+/// Minimal io_uring wrapper for readiness polling (IORING_OP_POLL_ADD)
+///
+/// One instance per worker thread - NOT thread-safe. Poll requests are
+/// one-shot and must be re-armed by the caller after each completion
+/// (the worker loop does this, mirroring edge-triggered epoll semantics).
+class UringEventLoop {
+public:
+    UringEventLoop() = default;
+    ~UringEventLoop();
+
+    // Non-copyable, non-movable (owns mmap'd rings)
+    UringEventLoop(const UringEventLoop&) = delete;
+    UringEventLoop& operator=(const UringEventLoop&) = delete;
+
+    /// Set up the ring. Returns false if the kernel lacks io_uring support
+    /// (caller falls back to the epoll path).
+    [[nodiscard]] bool init(unsigned entries = 4096);
+
+    /// Queue a one-shot poll request for fd (POLLIN/POLLOUT/... mask).
+    /// Only queued locally - nothing is submitted until wait() is called.
+    [[nodiscard]] bool add_poll(int fd, uint32_t poll_mask);
+
+    /// Queue cancellation of an outstanding poll for fd.
+    [[nodiscard]] bool remove_poll(int fd);
+
+    /// Submit all queued SQEs and wait up to timeout_ms for completions.
+    /// Harvested completions are appended to out. Returns number of
+    /// completions, or -1 on fatal ring error.
+    int wait(std::vector<UringCompletion>& out, int timeout_ms);
+
+    [[nodiscard]] bool valid() const noexcept { return ring_fd_ >= 0; }
+
+private:
+    struct Sqe* get_sqe();
+
+    int ring_fd_ = -1;
+
+    // Submission queue (mmap'd, shared with kernel)
+    void* sq_ring_ = nullptr;
+    size_t sq_ring_size_ = 0;
+    void* sqes_ = nullptr;
+    size_t sqes_size_ = 0;
+    uint32_t* sq_head_ = nullptr;
+    uint32_t* sq_tail_ = nullptr;
+    uint32_t* sq_mask_ = nullptr;
+    uint32_t* sq_array_ = nullptr;
+
+    // Completion queue (mmap'd, shared with kernel)
+    void* cq_ring_ = nullptr;
+    size_t cq_ring_size_ = 0;
+    uint32_t* cq_head_ = nullptr;
+    uint32_t* cq_tail_ = nullptr;
+    uint32_t* cq_mask_ = nullptr;
+    void* cqes_ = nullptr;
+
+    uint32_t to_submit_ = 0;      // SQEs queued since last io_uring_enter
+    bool single_mmap_ = false;    // IORING_FEAT_SINGLE_MMAP
+    bool ext_arg_ = false;        // IORING_ENTER_EXT_ARG (timeout support)
+};
+
+}  // namespace titan::runtime
+
+#endif  // __linux__
@@ -0,0 +1,658 @@
+/*
+ * Copyright 2025 Titan Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Titan Replay - Traffic replay load generator
+//
+// Replays a JSONL request capture against a running Titan instance over
+// keep-alive HTTP/1.1 or h2c (prior knowledge), and reports throughput
+// plus latency percentiles. One request per line:
+//
+//   {"method":"GET","path":"/api/users/42","headers":{"Accept":"*/*"},"body":""}
+//
+// "headers" and "body" are optional; lines without "method"/"path" are
+// counted and skipped, so mixed capture files replay their HTTP subset.
+//
+// Scheduling is open-loop: arrival times are fixed by --rate up front and
+// do not slow down when the target stalls, so queueing delay shows up in
+// the reported latency instead of being hidden by a coordinated-omission
+// feedback loop. Latency is measured from the scheduled arrival to the
+// last byte of the response.
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "http/h2.hpp"
+#include "http/http.hpp"
+#include "http/parser.hpp"
+#include "http/simd.hpp"
+#include "http/well_known_headers.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::atomic<bool> g_running{true};
+
+void signal_handler(int) {
+    g_running = false;
+}
+
+uint64_t now_ns() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch())
+            .count());
+}
+
+struct Options {
+    std::string log_path;
+    std::string host = "127.0.0.1";
+    uint16_t port = 8080;
+    double rate = 1000.0;       // requests per second
+    double duration_s = 10.0;   // seconds of scheduled arrivals
+    int connections = 16;       // h1: pool size; h2: multiplexed sessions
+    bool use_h2 = false;
+};
+
+void print_usage(const char* prog) {
+    fprintf(stderr,
+            "Usage: %s --log <capture.jsonl> [options]\n"
+            "  --target <host:port>   Target instance (default 127.0.0.1:8080)\n"
+            "  --rate <n>             Scheduled request rate per second (default 1000)\n"
+            "  --duration <seconds>   Length of the scheduled arrival window (default 10)\n"
+            "  --connections <n>      Client connections (default 16)\n"
+            "  --h2                   Speak h2c prior-knowledge instead of HTTP/1.1\n",
+            prog);
+}
+
+bool parse_args(int argc, char* argv[], Options& opts) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> const char* { return (i + 1 < argc) ? argv[++i] : nullptr; };
+        if (arg == "--log") {
+            const char* v = next();
+            if (!v) return false;
+            opts.log_path = v;
+        } else if (arg == "--target") {
+            const char* v = next();
+            if (!v) return false;
+            std::string target = v;
+            size_t colon = target.rfind(':');
+            if (colon == std::string::npos) return false;
+            opts.host = target.substr(0, colon);
+            opts.port = static_cast<uint16_t>(std::atoi(target.c_str() + colon + 1));
+        } else if (arg == "--rate") {
+            const char* v = next();
+            if (!v) return false;
+            opts.rate = std::atof(v);
+        } else if (arg == "--duration") {
+            const char* v = next();
+            if (!v) return false;
+            opts.duration_s = std::atof(v);
+        } else if (arg == "--connections") {
+            const char* v = next();
+            if (!v) return false;
+            opts.connections = std::atoi(v);
+        } else if (arg == "--h2") {
+            opts.use_h2 = true;
+        } else {
+            return false;
+        }
+    }
+    return !opts.log_path.empty() && opts.rate > 0 && opts.duration_s > 0 &&
+           opts.connections > 0;
+}
+
+/// One replayable request: parsed fields for h2 submission plus the
+/// pre-serialized HTTP/1.1 bytes, built once at load time so the send
+/// path is a single write.
+struct CapturedRequest {
+    titan::http::Method method = titan::http::Method::GET;
+    std::string path;
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::string body;
+    std::vector<uint8_t> h1_bytes;
+};
+
+struct Corpus {
+    std::vector<CapturedRequest> requests;
+    size_t skipped_lines = 0;
+};
+
+void serialize_h1(CapturedRequest& req, const std::string& host_port) {
+    std::string out;
+    out += titan::http::to_string(req.method);
+    out += " ";
+    out += req.path;
+    out += " HTTP/1.1\r\n";
+
+    bool has_host = false;
+    for (const auto& [name, value] : req.headers) {
+        if (name.size() == 4 &&
+            titan::http::simd::strcasecmp_eq(name.data(), "host", name.size())) {
+            has_host = true;
+        }
+        out += name;
+        out += ": ";
+        out += value;
+        out += "\r\n";
+    }
+    if (!has_host) {
+        out += "Host: " + host_port + "\r\n";
+    }
+    if (!req.body.empty()) {
+        out += "Content-Length: " + std::to_string(req.body.size()) + "\r\n";
+    }
+    out += "\r\n";
+    out += req.body;
+    req.h1_bytes.assign(out.begin(), out.end());
+}
+
+bool load_corpus(const Options& opts, Corpus& corpus) {
+    std::ifstream file(opts.log_path);
+    if (!file) {
+        fprintf(stderr, "titan_replay: cannot open %s\n", opts.log_path.c_str());
+        return false;
+    }
+
+    std::string host_port = opts.host + ":" + std::to_string(opts.port);
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        auto json = nlohmann::json::parse(line, nullptr, false);
+        if (json.is_discarded() || !json.is_object() || !json.contains("method") ||
+            !json.contains("path")) {
+            corpus.skipped_lines++;
+            continue;
+        }
+
+        CapturedRequest req;
+        req.method = titan::http::parse_method(json["method"].get<std::string>());
+        req.path = json["path"].get<std::string>();
+        if (req.method == titan::http::Method::UNKNOWN || req.path.empty()) {
+            corpus.skipped_lines++;
+            continue;
+        }
+        if (json.contains("headers") && json["headers"].is_object()) {
+            for (const auto& [name, value] : json["headers"].items()) {
+                if (value.is_string()) {
+                    req.headers.emplace_back(name, value.get<std::string>());
+                }
+            }
+        }
+        if (json.contains("body") && json["body"].is_string()) {
+            req.body = json["body"].get<std::string>();
+        }
+        serialize_h1(req, host_port);
+        corpus.requests.push_back(std::move(req));
+    }
+    return !corpus.requests.empty();
+}
+
+/// Build a transient h2 Request over a corpus entry; nghttp2 copies the
+/// header block during submit, so the views only need to live that long.
+titan::http::Request make_h2_request(const CapturedRequest& captured,
+                                     const std::string& host_port) {
+    titan::http::Request request;
+    request.method = captured.method;
+    request.path = captured.path;
+    request.uri = captured.path;
+    bool has_host = false;
+    for (const auto& [name, value] : captured.headers) {
+        request.headers.push_back({name, value});
+        if (name.size() == 4 &&
+            titan::http::simd::strcasecmp_eq(name.data(), "host", name.size())) {
+            request.well_known[static_cast<size_t>(titan::http::WellKnownHeader::Host)] =
+                static_cast<uint8_t>(request.headers.size());
+            has_host = true;
+        }
+    }
+    if (!has_host) {
+        request.headers.push_back({"Host", host_port});
+        request.well_known[static_cast<size_t>(titan::http::WellKnownHeader::Host)] =
+            static_cast<uint8_t>(request.headers.size());
+    }
+    request.body = {reinterpret_cast<const uint8_t*>(captured.body.data()),
+                    captured.body.size()};
+    return request;
+}
+
+struct Stats {
+    uint64_t dispatched = 0;
+    uint64_t completed = 0;
+    uint64_t http_errors = 0;       // 4xx/5xx responses
+    uint64_t transport_errors = 0;  // resets, parse failures, drain timeouts
+    std::vector<uint64_t> latencies_ns;
+
+    void record(uint64_t sched_ns, int status) {
+        completed++;
+        latencies_ns.push_back(now_ns() - sched_ns);
+        if (status >= 400) {
+            http_errors++;
+        }
+    }
+};
+
+int connect_target(const Options& opts) {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* result = nullptr;
+    std::string port_str = std::to_string(opts.port);
+    if (getaddrinfo(opts.host.c_str(), port_str.c_str(), &hints, &result) != 0) {
+        return -1;
+    }
+
+    int fd = -1;
+    for (addrinfo* ai = result; ai; ai = ai->ai_next) {
+        fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd < 0) {
+            continue;
+        }
+        if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0) {
+            break;
+        }
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(result);
+    if (fd < 0) {
+        return -1;
+    }
+
+    int flag = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    return fd;
+}
+
+// ============================================================================
+// HTTP/1.1 connections: one in-flight request per connection, keep-alive
+// ============================================================================
+
+struct H1Connection {
+    int fd = -1;
+    bool busy = false;
+    uint64_t sched_ns = 0;
+    const CapturedRequest* inflight = nullptr;
+    size_t send_offset = 0;
+    titan::http::Parser parser;
+    std::vector<uint8_t> recv_buffer;
+};
+
+/// Write as much of the in-flight request as the socket accepts; returns
+/// false on a dead connection.
+bool flush_h1(H1Connection& conn, Stats& stats) {
+    while (conn.inflight && conn.send_offset < conn.inflight->h1_bytes.size()) {
+        ssize_t n = send(conn.fd, conn.inflight->h1_bytes.data() + conn.send_offset,
+                         conn.inflight->h1_bytes.size() - conn.send_offset, MSG_NOSIGNAL);
+        if (n > 0) {
+            conn.send_offset += static_cast<size_t>(n);
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return true;  // EPOLLOUT will resume
+        }
+        stats.transport_errors++;
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// h2c connections: multiplexed streams over a shared session
+// ============================================================================
+
+struct H2Connection {
+    int fd = -1;
+    std::unique_ptr<titan::http::H2Session> session;
+    std::unordered_map<int32_t, uint64_t> stream_sched_ns;
+};
+
+/// Drain the session's pending frames to the socket.
+bool flush_h2(H2Connection& conn, Stats& stats) {
+    while (conn.session->want_write()) {
+        auto data = conn.session->send_data();
+        if (data.empty()) {
+            break;
+        }
+        ssize_t n = send(conn.fd, data.data(), data.size(), MSG_NOSIGNAL);
+        if (n > 0) {
+            conn.session->consume_send_buffer(static_cast<size_t>(n));
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return true;
+        }
+        stats.transport_errors++;
+        return false;
+    }
+    return true;
+}
+
+void print_report(const Options& opts, Stats& stats, double elapsed_s) {
+    printf("\n--- titan_replay report ---\n");
+    printf("protocol:        %s\n", opts.use_h2 ? "h2c" : "http/1.1");
+    printf("target rate:     %.0f rps for %.1fs\n", opts.rate, opts.duration_s);
+    printf("dispatched:      %llu\n", static_cast<unsigned long long>(stats.dispatched));
+    printf("completed:       %llu (%.1f rps achieved)\n",
+           static_cast<unsigned long long>(stats.completed),
+           elapsed_s > 0 ? static_cast<double>(stats.completed) / elapsed_s : 0.0);
+    printf("http errors:     %llu (4xx/5xx)\n",
+           static_cast<unsigned long long>(stats.http_errors));
+    printf("transport errors:%llu\n",
+           static_cast<unsigned long long>(stats.transport_errors));
+
+    if (stats.latencies_ns.empty()) {
+        return;
+    }
+    std::sort(stats.latencies_ns.begin(), stats.latencies_ns.end());
+    auto pct = [&](double p) {
+        size_t idx = static_cast<size_t>(p * static_cast<double>(stats.latencies_ns.size() - 1));
+        return static_cast<double>(stats.latencies_ns[idx]) / 1e6;
+    };
+    printf("latency (ms):    p50=%.3f p75=%.3f p90=%.3f p99=%.3f p99.9=%.3f max=%.3f\n",
+           pct(0.50), pct(0.75), pct(0.90), pct(0.99), pct(0.999),
+           static_cast<double>(stats.latencies_ns.back()) / 1e6);
+}
+
+int run(const Options& opts) {
+    Corpus corpus;
+    if (!load_corpus(opts, corpus)) {
+        fprintf(stderr, "titan_replay: no replayable requests in %s\n", opts.log_path.c_str());
+        return EXIT_FAILURE;
+    }
+    printf("loaded %zu requests from %s (%zu non-request lines skipped)\n",
+           corpus.requests.size(), opts.log_path.c_str(), corpus.skipped_lines);
+
+    std::string host_port = opts.host + ":" + std::to_string(opts.port);
+
+    int epoll_fd = epoll_create1(0);
+    if (epoll_fd < 0) {
+        perror("epoll_create1");
+        return EXIT_FAILURE;
+    }
+
+    std::vector<H1Connection> h1_conns;
+    std::vector<H2Connection> h2_conns;
+    int conn_count = opts.use_h2 ? std::min(opts.connections, 8) : opts.connections;
+    for (int i = 0; i < conn_count; ++i) {
+        int fd = connect_target(opts);
+        if (fd < 0) {
+            fprintf(stderr, "titan_replay: cannot connect to %s\n", host_port.c_str());
+            return EXIT_FAILURE;
+        }
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.u32 = static_cast<uint32_t>(i);
+        epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev);
+
+        if (opts.use_h2) {
+            H2Connection conn;
+            conn.fd = fd;
+            conn.session = std::make_unique<titan::http::H2Session>(false, 1 << 20);
+            h2_conns.push_back(std::move(conn));
+        } else {
+            H1Connection conn;
+            conn.fd = fd;
+            h1_conns.push_back(std::move(conn));
+        }
+    }
+
+    Stats stats;
+
+    // h2 sessions queue their connection preface + SETTINGS immediately
+    for (auto& conn : h2_conns) {
+        conn.session->set_stream_close_callback([](int32_t) {});
+        if (!flush_h2(conn, stats)) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    const uint64_t total_arrivals =
+        static_cast<uint64_t>(opts.rate * opts.duration_s);
+    const double interval_ns = 1e9 / opts.rate;
+    const uint64_t start_ns = now_ns();
+    uint64_t next_arrival_idx = 0;
+    size_t next_request_idx = 0;
+    size_t next_conn = 0;
+    uint64_t inflight = 0;
+
+    // Requests whose arrival fired while every h1 connection was busy;
+    // their latency clocks are already running
+    std::deque<std::pair<const CapturedRequest*, uint64_t>> h1_backlog;
+
+    auto dispatch_h1 = [&](const CapturedRequest* request, uint64_t sched) {
+        for (auto& conn : h1_conns) {
+            if (!conn.busy) {
+                conn.busy = true;
+                conn.sched_ns = sched;
+                conn.inflight = request;
+                conn.send_offset = 0;
+                conn.recv_buffer.clear();
+                inflight++;
+                return flush_h1(conn, stats);
+            }
+        }
+        h1_backlog.emplace_back(request, sched);
+        return true;
+    };
+
+    auto dispatch_h2 = [&](const CapturedRequest* request, uint64_t sched) {
+        H2Connection& conn = h2_conns[next_conn];
+        next_conn = (next_conn + 1) % h2_conns.size();
+        titan::http::Request h2_request = make_h2_request(*request, host_port);
+        int32_t stream_id = -1;
+        if (auto ec = conn.session->submit_request(h2_request, stream_id); ec) {
+            stats.transport_errors++;
+            return true;
+        }
+        conn.stream_sched_ns.emplace(stream_id, sched);
+        inflight++;
+        return flush_h2(conn, stats);
+    };
+
+    // Completion handling shared by the read paths
+    auto h1_complete = [&](H1Connection& conn, int status) {
+        stats.record(conn.sched_ns, status);
+        conn.busy = false;
+        conn.inflight = nullptr;
+        inflight--;
+        if (!h1_backlog.empty()) {
+            auto [request, sched] = h1_backlog.front();
+            h1_backlog.pop_front();
+            dispatch_h1(request, sched);
+        }
+    };
+
+    epoll_event events[64];
+    bool draining = false;
+    uint64_t drain_deadline_ns = 0;
+
+    while (g_running) {
+        uint64_t now = now_ns();
+
+        // Dispatch every arrival whose scheduled time has passed (open loop)
+        while (next_arrival_idx < total_arrivals) {
+            uint64_t arrival_ns =
+                start_ns + static_cast<uint64_t>(static_cast<double>(next_arrival_idx) * interval_ns);
+            if (arrival_ns > now) {
+                break;
+            }
+            const CapturedRequest* request = &corpus.requests[next_request_idx];
+            next_request_idx = (next_request_idx + 1) % corpus.requests.size();
+            next_arrival_idx++;
+            stats.dispatched++;
+            bool ok = opts.use_h2 ? dispatch_h2(request, arrival_ns)
+                                  : dispatch_h1(request, arrival_ns);
+            if (!ok) {
+                fprintf(stderr, "titan_replay: connection lost, aborting\n");
+                g_running = false;
+                break;
+            }
+        }
+
+        if (next_arrival_idx >= total_arrivals) {
+            if (inflight == 0 && h1_backlog.empty()) {
+                break;
+            }
+            if (!draining) {
+                draining = true;
+                drain_deadline_ns = now + 5'000'000'000ULL;  // 5s to settle in-flight
+            } else if (now > drain_deadline_ns) {
+                stats.transport_errors += inflight + h1_backlog.size();
+                break;
+            }
+        }
+
+        int timeout_ms = 1;
+        if (next_arrival_idx < total_arrivals) {
+            uint64_t arrival_ns =
+                start_ns + static_cast<uint64_t>(static_cast<double>(next_arrival_idx) * interval_ns);
+            timeout_ms = arrival_ns > now
+                             ? static_cast<int>(std::min<uint64_t>((arrival_ns - now) / 1'000'000, 10))
+                             : 0;
+        }
+
+        int n = epoll_wait(epoll_fd, events, 64, timeout_ms);
+        for (int i = 0; i < n; ++i) {
+            auto idx = static_cast<size_t>(events[i].data.u32);
+            if (opts.use_h2) {
+                H2Connection& conn = h2_conns[idx];
+                uint8_t buffer[65536];
+                while (true) {
+                    ssize_t r = recv(conn.fd, buffer, sizeof(buffer), 0);
+                    if (r > 0) {
+                        size_t consumed = 0;
+                        if (conn.session->recv({buffer, static_cast<size_t>(r)}, consumed)) {
+                            stats.transport_errors++;
+                            g_running = false;
+                            break;
+                        }
+                        // Completed streams: response_complete set by END_STREAM
+                        for (auto* stream : conn.session->get_active_streams()) {
+                            if (!stream->response_complete) {
+                                continue;
+                            }
+                            auto it = conn.stream_sched_ns.find(stream->stream_id);
+                            if (it != conn.stream_sched_ns.end()) {
+                                stats.record(it->second,
+                                             static_cast<int>(stream->response.status));
+                                conn.stream_sched_ns.erase(it);
+                                inflight--;
+                            }
+                            stream->response_complete = false;  // recorded once
+                        }
+                        continue;
+                    }
+                    if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                        break;
+                    }
+                    stats.transport_errors++;
+                    g_running = false;
+                    break;
+                }
+                if (!flush_h2(conn, stats)) {
+                    g_running = false;
+                }
+            } else {
+                H1Connection& conn = h1_conns[idx];
+                if (events[i].events & EPOLLOUT) {
+                    if (!flush_h1(conn, stats)) {
+                        g_running = false;
+                        continue;
+                    }
+                }
+                uint8_t buffer[65536];
+                while (conn.busy) {
+                    ssize_t r = recv(conn.fd, buffer, sizeof(buffer), 0);
+                    if (r > 0) {
+                        conn.recv_buffer.insert(conn.recv_buffer.end(), buffer, buffer + r);
+                        conn.parser.reset();
+                        titan::http::Response response;
+                        auto [result, consumed] = conn.parser.parse_response(
+                            std::span<const uint8_t>(conn.recv_buffer), response);
+                        if (result == titan::http::ParseResult::Complete) {
+                            h1_complete(conn, static_cast<int>(response.status));
+                        } else if (result == titan::http::ParseResult::Error) {
+                            stats.transport_errors++;
+                            g_running = false;
+                            break;
+                        }
+                        continue;
+                    }
+                    if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                        break;
+                    }
+                    stats.transport_errors++;
+                    g_running = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    uint64_t end_ns = now_ns();
+    for (auto& conn : h1_conns) {
+        close(conn.fd);
+    }
+    for (auto& conn : h2_conns) {
+        close(conn.fd);
+    }
+    close(epoll_fd);
+
+    print_report(opts, stats, static_cast<double>(end_ns - start_ns) / 1e9);
+    return stats.transport_errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    Options opts;
+    if (!parse_args(argc, argv, opts)) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    signal(SIGINT, signal_handler);
+    signal(SIGPIPE, SIG_IGN);
+
+    return run(opts);
+}